@@ -0,0 +1,293 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ay8912.h"
+#include "savestate.h"
+#include "sound.h"
+
+//=============================================================================
+
+// Logarithmic DAC output levels, normalised to 1.0
+const float CAY8912::s_volume[16] =
+{
+	0.0000f, 0.0137f, 0.0205f, 0.0291f, 0.0423f, 0.0618f, 0.0847f, 0.1369f,
+	0.1691f, 0.2647f, 0.3527f, 0.4499f, 0.5704f, 0.6873f, 0.8482f, 1.0000f
+};
+
+//=============================================================================
+
+CAY8912::CAY8912(void)
+{
+	Reset();
+}
+
+//=============================================================================
+
+void CAY8912::Reset(void)
+{
+	memset(m_register, 0, sizeof(m_register));
+	m_selectedRegister = 0;
+
+	for (uint32 channel = 0; channel < AY_CHANNELS; ++channel)
+	{
+		m_tonePeriod[channel] = 1;
+		m_toneCounter[channel] = 0;
+		m_toneOutput[channel] = 0;
+	}
+
+	m_noisePeriod = 2;
+	m_noiseCounter = 0;
+	m_noiseShift = 1;
+	m_envelopePeriod = 2;
+	ResetEnvelope();
+
+	m_renderedTstate = 0;
+	m_sampleCycles = 0;
+	m_sampleAccumulator = 0.0f;
+	m_sampleTicks = 0;
+	m_sampleCount = 0;
+}
+
+//=============================================================================
+
+void CAY8912::SaveState(CStateWriter& writer) const
+{
+	writer.Write(m_register, sizeof(m_register));
+	writer.Write(m_selectedRegister);
+	writer.Write(m_tonePeriod, sizeof(m_tonePeriod));
+	writer.Write(m_toneCounter, sizeof(m_toneCounter));
+	writer.Write(m_toneOutput, sizeof(m_toneOutput));
+	writer.Write(m_noisePeriod);
+	writer.Write(m_noiseCounter);
+	writer.Write(m_noiseShift);
+	writer.Write(m_envelopePeriod);
+	writer.Write(m_envelopeCounter);
+	writer.Write(m_envelopeStep);
+	writer.Write(m_envelopeAttack);
+	writer.Write(m_envelopeHolding);
+	writer.Write(m_renderedTstate);
+	writer.Write(m_sampleCycles);
+	writer.Write(m_sampleAccumulator);
+	writer.Write(m_sampleTicks);
+}
+
+//=============================================================================
+
+void CAY8912::RestoreState(CStateReader& reader)
+{
+	reader.Read(m_register, sizeof(m_register));
+	reader.Read(m_selectedRegister);
+	reader.Read(m_tonePeriod, sizeof(m_tonePeriod));
+	reader.Read(m_toneCounter, sizeof(m_toneCounter));
+	reader.Read(m_toneOutput, sizeof(m_toneOutput));
+	reader.Read(m_noisePeriod);
+	reader.Read(m_noiseCounter);
+	reader.Read(m_noiseShift);
+	reader.Read(m_envelopePeriod);
+	reader.Read(m_envelopeCounter);
+	reader.Read(m_envelopeStep);
+	reader.Read(m_envelopeAttack);
+	reader.Read(m_envelopeHolding);
+	reader.Read(m_renderedTstate);
+	reader.Read(m_sampleCycles);
+	reader.Read(m_sampleAccumulator);
+	reader.Read(m_sampleTicks);
+
+	// Samples rendered so far this frame aren't part of the state
+	m_sampleCount = 0;
+}
+
+//=============================================================================
+
+void CAY8912::SelectRegister(uint8 reg)
+{
+	m_selectedRegister = reg & 0x0F;
+}
+
+//=============================================================================
+
+uint8 CAY8912::ReadRegister(void) const
+{
+	return m_register[m_selectedRegister];
+}
+
+//=============================================================================
+
+void CAY8912::WriteRegister(uint8 value, uint32 tstate)
+{
+	// Everything up to now was generated with the old register values
+	Update(tstate);
+
+	// Unused bits read back as zero
+	static const uint8 s_registerMask[AY_REGISTER_COUNT] = { 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF };
+	m_register[m_selectedRegister] = value & s_registerMask[m_selectedRegister];
+
+	switch (m_selectedRegister)
+	{
+		case AR_TONE_A_FINE:
+		case AR_TONE_A_COARSE:
+		case AR_TONE_B_FINE:
+		case AR_TONE_B_COARSE:
+		case AR_TONE_C_FINE:
+		case AR_TONE_C_COARSE:
+			{
+				// Tone output toggles every period ticks (AY clock / 8)
+				uint32 channel = m_selectedRegister >> 1;
+				uint32 period = m_register[channel << 1] | (m_register[(channel << 1) + 1] << 8);
+				m_tonePeriod[channel] = (period > 0) ? period : 1;
+			}
+			break;
+
+		case AR_NOISE_PERIOD:
+			// Noise is clocked at AY clock / 16
+			m_noisePeriod = ((m_register[AR_NOISE_PERIOD] > 0) ? m_register[AR_NOISE_PERIOD] : 1) << 1;
+			break;
+
+		case AR_ENVELOPE_FINE:
+		case AR_ENVELOPE_COARSE:
+			{
+				// Each of the 16 envelope steps lasts period * 16 AY clocks
+				uint32 period = m_register[AR_ENVELOPE_FINE] | (m_register[AR_ENVELOPE_COARSE] << 8);
+				m_envelopePeriod = ((period > 0) ? period : 1) << 1;
+			}
+			break;
+
+		case AR_ENVELOPE_SHAPE:
+			ResetEnvelope();
+			break;
+	}
+}
+
+//=============================================================================
+
+void CAY8912::Update(uint32 tstate)
+{
+	int32 elapsed = static_cast<int32>(tstate) - m_renderedTstate;
+
+	if (elapsed >= AY_TSTATES_PER_TICK)
+	{
+		uint32 ticks = elapsed / AY_TSTATES_PER_TICK;
+		m_renderedTstate += ticks * AY_TSTATES_PER_TICK;
+		Render(ticks);
+	}
+}
+
+//=============================================================================
+
+void CAY8912::EndFrame(uint32 frameTstates)
+{
+	Update(frameTstates);
+	// Leaves a (small) negative remainder carried into the next frame
+	m_renderedTstate -= static_cast<int32>(frameTstates);
+}
+
+//=============================================================================
+
+void CAY8912::Render(uint32 ticks)
+{
+	uint8 mixer = m_register[AR_MIXER];
+	uint8 shape = m_register[AR_ENVELOPE_SHAPE];
+
+	// Per channel output masks; a disabled generator is held high
+	uint32 toneDisable[AY_CHANNELS];
+	uint32 noiseDisable[AY_CHANNELS];
+	bool useEnvelope[AY_CHANNELS];
+	float fixedLevel[AY_CHANNELS];
+	for (uint32 channel = 0; channel < AY_CHANNELS; ++channel)
+	{
+		toneDisable[channel] = (mixer >> channel) & 1;
+		noiseDisable[channel] = (mixer >> (channel + 3)) & 1;
+		useEnvelope[channel] = (m_register[AR_AMPLITUDE_A + channel] & 0x10) != 0;
+		fixedLevel[channel] = s_volume[m_register[AR_AMPLITUDE_A + channel] & 0x0F];
+	}
+
+	float envelopeLevel = s_volume[(m_envelopeStep ^ m_envelopeAttack) & 0x0F];
+
+	while (ticks-- > 0)
+	{
+		for (uint32 channel = 0; channel < AY_CHANNELS; ++channel)
+		{
+			if (++m_toneCounter[channel] >= m_tonePeriod[channel])
+			{
+				m_toneCounter[channel] = 0;
+				m_toneOutput[channel] ^= 1;
+			}
+		}
+
+		if (++m_noiseCounter >= m_noisePeriod)
+		{
+			// 17 bit LFSR, taps at bits 0 and 3
+			m_noiseCounter = 0;
+			m_noiseShift = (m_noiseShift >> 1) | (((m_noiseShift ^ (m_noiseShift >> 3)) & 1) << 16);
+		}
+
+		if (!m_envelopeHolding && (++m_envelopeCounter >= m_envelopePeriod))
+		{
+			m_envelopeCounter = 0;
+			if (--m_envelopeStep < 0)
+			{
+				if ((shape & ES_CONTINUE) == 0)
+				{
+					m_envelopeAttack = 0;
+					m_envelopeStep = 0;
+					m_envelopeHolding = true;
+				}
+				else
+				{
+					if (shape & ES_ALTERNATE)
+					{
+						m_envelopeAttack ^= 0x0F;
+					}
+
+					if (shape & ES_HOLD)
+					{
+						m_envelopeStep = 0;
+						m_envelopeHolding = true;
+					}
+					else
+					{
+						m_envelopeStep = 15;
+					}
+				}
+			}
+			envelopeLevel = s_volume[(m_envelopeStep ^ m_envelopeAttack) & 0x0F];
+		}
+
+		uint32 noise = m_noiseShift & 1;
+		float level = 0.0f;
+		for (uint32 channel = 0; channel < AY_CHANNELS; ++channel)
+		{
+			uint32 output = (m_toneOutput[channel] | toneDisable[channel]) & (noise | noiseDisable[channel]);
+			level += output ? (useEnvelope[channel] ? envelopeLevel : fixedLevel[channel]) : 0.0f;
+		}
+
+		m_sampleAccumulator += level;
+		++m_sampleTicks;
+
+		// Same sample clock as the beeper so the two can be mixed directly
+		m_sampleCycles += (AY_TSTATES_PER_TICK << TSTATE_BITSHIFT);
+		if (m_sampleCycles >= TSTATE_FIXED_FLOATING_POINT)
+		{
+			m_sampleCycles -= TSTATE_FIXED_FLOATING_POINT;
+			if (m_sampleCount < AY_MAX_SAMPLES)
+			{
+				m_samples[m_sampleCount++] = m_sampleAccumulator / static_cast<float>(m_sampleTicks * AY_CHANNELS);
+			}
+			m_sampleAccumulator = 0.0f;
+			m_sampleTicks = 0;
+		}
+	}
+}
+
+//=============================================================================
+
+void CAY8912::ResetEnvelope(void)
+{
+	m_envelopeCounter = 0;
+	m_envelopeStep = 15;
+	m_envelopeAttack = (m_register[AR_ENVELOPE_SHAPE] & ES_ATTACK) ? 0x0F : 0x00;
+	m_envelopeHolding = false;
+}
+
+//=============================================================================
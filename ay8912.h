@@ -0,0 +1,113 @@
+#if !defined(__AY8912_H__)
+#define __AY8912_H__
+
+#include "common/platform_types.h"
+
+class CStateWriter;
+class CStateReader;
+
+//=============================================================================
+// General Instrument AY-3-8912 programmable sound generator, as fitted to the
+// 128K machines (clocked at half the CPU clock).
+//
+// The chip is rendered lazily: nothing happens per instruction, instead the
+// generators are run in one block up to the current T state whenever a
+// register is written (so the write lands at the right time) or the frame
+// ends.  Rendered samples are at the same rate as the beeper output so they
+// can be mixed sample for sample.
+//=============================================================================
+
+class CAY8912
+{
+	public:
+		CAY8912(void);
+
+		void				Reset(void);
+		void				SaveState(CStateWriter& writer) const;
+		void				RestoreState(CStateReader& reader);
+
+		void				SelectRegister(uint8 reg);
+		uint8				ReadRegister(void) const;
+		uint8				GetSelectedRegister(void) const		{ return m_selectedRegister; }
+		uint8				GetRegister(uint8 reg) const			{ return m_register[reg & 0x0F]; }
+		void				WriteRegister(uint8 value, uint32 tstate);
+
+		// Render up to the given (frame relative) T state
+		void				Update(uint32 tstate);
+		// Render to the end of the frame and rebase the T state counter
+		void				EndFrame(uint32 frameTstates);
+
+		const float*	GetSamples(void) const			{ return m_samples; }
+		uint32				GetSampleCount(void) const	{ return m_sampleCount; }
+		void					ClearSamples(void)					{ m_sampleCount = 0; }
+
+	protected:
+		enum eAYConstant
+		{
+			AY_REGISTER_COUNT = 16,
+			AY_CHANNELS = 3,
+			AY_TSTATES_PER_TICK = 16,	// AY clock / 8 (the AY runs at half the CPU clock)
+			AY_MAX_SAMPLES = 2048
+		};
+
+		enum eAYRegister
+		{
+			AR_TONE_A_FINE = 0,
+			AR_TONE_A_COARSE = 1,
+			AR_TONE_B_FINE = 2,
+			AR_TONE_B_COARSE = 3,
+			AR_TONE_C_FINE = 4,
+			AR_TONE_C_COARSE = 5,
+			AR_NOISE_PERIOD = 6,
+			AR_MIXER = 7,
+			AR_AMPLITUDE_A = 8,
+			AR_AMPLITUDE_B = 9,
+			AR_AMPLITUDE_C = 10,
+			AR_ENVELOPE_FINE = 11,
+			AR_ENVELOPE_COARSE = 12,
+			AR_ENVELOPE_SHAPE = 13,
+			AR_IO_PORT_A = 14,
+			AR_IO_PORT_B = 15
+		};
+
+		enum eEnvelopeShape
+		{
+			ES_HOLD = 0x01,
+			ES_ALTERNATE = 0x02,
+			ES_ATTACK = 0x04,
+			ES_CONTINUE = 0x08
+		};
+
+		void				Render(uint32 ticks);
+		void				ResetEnvelope(void);
+
+		static const float s_volume[16];
+
+		uint8				m_register[AY_REGISTER_COUNT];
+		uint8				m_selectedRegister;
+
+		// Generator state (periods are in ticks of AY_TSTATES_PER_TICK)
+		uint32			m_tonePeriod[AY_CHANNELS];
+		uint32			m_toneCounter[AY_CHANNELS];
+		uint32			m_toneOutput[AY_CHANNELS];
+		uint32			m_noisePeriod;
+		uint32			m_noiseCounter;
+		uint32			m_noiseShift;
+		uint32			m_envelopePeriod;
+		uint32			m_envelopeCounter;
+		int32				m_envelopeStep;
+		uint8				m_envelopeAttack;
+		bool				m_envelopeHolding;
+
+		// Rendering state
+		int32				m_renderedTstate;
+		uint64			m_sampleCycles;
+		float				m_sampleAccumulator;
+		uint32			m_sampleTicks;
+		float				m_samples[AY_MAX_SAMPLES];
+		uint32			m_sampleCount;
+};
+
+//=============================================================================
+
+#endif // !defined(__AY8912_H__)
@@ -0,0 +1,51 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/platform_types.h"
+#include "batchrunner.h"
+
+int main(int argc, char* argv[])
+{
+	const char* jobList = NULL;
+	const char* outputPath = NULL;
+	uint32 threads = 0;
+	int arg = 1;
+
+	while (arg < argc)
+	{
+		if ((strcmp(argv[arg], "-threads") == 0) && (arg + 1 < argc))
+		{
+			threads = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if ((strcmp(argv[arg], "-out") == 0) && (arg + 1 < argc))
+		{
+			outputPath = argv[arg + 1];
+			arg += 2;
+		}
+		else
+		{
+			jobList = argv[arg++];
+		}
+	}
+
+	if (jobList == NULL)
+	{
+		fprintf(stderr, "usage: %s [-threads n] [-out path] <job list>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	CBatchRunner runner;
+	if (outputPath != NULL)
+	{
+		runner.SetOutputPath(outputPath);
+	}
+
+	if (!runner.LoadJobs(jobList))
+	{
+		return EXIT_FAILURE;
+	}
+
+	return (runner.Run(threads) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
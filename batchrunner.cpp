@@ -0,0 +1,329 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <thread>
+
+#include "batchrunner.h"
+#include "zxspectrum.h"
+
+#define MAX_JOB_LINE (1024)
+
+//=============================================================================
+
+CBatchRunner::CBatchRunner(void)
+	: m_outputPath(".")
+	, m_pQueues(NULL)
+	, m_queueCount(0)
+	, m_workersDone(false)
+	, m_failed(0)
+{
+}
+
+//=============================================================================
+
+CBatchRunner::~CBatchRunner(void)
+{
+	delete [] m_pQueues;
+}
+
+//=============================================================================
+
+bool CBatchRunner::LoadJobs(const char* fileName)
+{
+	FILE* pFile = fopen(fileName, "r");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[Batch]: unable to open job list '%s'\n", fileName);
+		return false;
+	}
+
+	char line[MAX_JOB_LINE];
+	uint32 lineNumber = 0;
+	while (fgets(line, sizeof(line), pFile) != NULL)
+	{
+		++lineNumber;
+
+		// Split into whitespace separated tokens; double quotes group a token
+		// (tape names often have spaces in them)
+		std::vector<std::string> tokens;
+		char* pChar = line;
+		while (*pChar != 0)
+		{
+			while ((*pChar == ' ') || (*pChar == '\t') || (*pChar == '\r') || (*pChar == '\n'))
+			{
+				++pChar;
+			}
+
+			if ((*pChar == 0) || (*pChar == '#'))
+			{
+				break;
+			}
+
+			std::string token;
+			if (*pChar == '"')
+			{
+				++pChar;
+				while ((*pChar != 0) && (*pChar != '"') && (*pChar != '\n'))
+				{
+					token += *pChar++;
+				}
+				if (*pChar == '"')
+				{
+					++pChar;
+				}
+			}
+			else
+			{
+				while ((*pChar != 0) && (*pChar != ' ') && (*pChar != '\t') && (*pChar != '\r') && (*pChar != '\n'))
+				{
+					token += *pChar++;
+				}
+			}
+			tokens.push_back(token);
+		}
+
+		if (tokens.empty())
+		{
+			continue;
+		}
+
+		if ((tokens.size() < 2) || (atoi(tokens[0].c_str()) <= 0))
+		{
+			fprintf(stderr, "[Batch]: %s(%d): expected '<frames> <output name> [arguments...]'\n", fileName, lineNumber);
+			continue;
+		}
+
+		SJob job;
+		job.m_frames = atoi(tokens[0].c_str());
+		job.m_name = tokens[1];
+		job.m_args.assign(tokens.begin() + 2, tokens.end());
+		m_jobs.push_back(job);
+	}
+
+	fclose(pFile);
+	fprintf(stdout, "[Batch]: loaded %d jobs from '%s'\n", GetJobCount(), fileName);
+	return true;
+}
+
+//=============================================================================
+
+uint32 CBatchRunner::Run(uint32 threadCount)
+{
+	if (threadCount == 0)
+	{
+		threadCount = std::thread::hardware_concurrency();
+		if (threadCount == 0)
+		{
+			threadCount = 1;
+		}
+	}
+	if (threadCount > GetJobCount())
+	{
+		threadCount = GetJobCount();
+	}
+
+	// Deal the jobs out round robin; stealing evens out the rest
+	delete [] m_pQueues;
+	m_pQueues = new SWorkQueue[threadCount];
+	m_queueCount = threadCount;
+	for (uint32 job = 0; job < GetJobCount(); ++job)
+	{
+		m_pQueues[job % threadCount].m_jobs.push_back(job);
+	}
+
+	m_failed = 0;
+	m_workersDone = false;
+	std::thread writer(&CBatchRunner::WriterThread, this);
+
+	fprintf(stdout, "[Batch]: running %d jobs on %d threads\n", GetJobCount(), threadCount);
+	std::vector<std::thread> workers;
+	for (uint32 worker = 0; worker < threadCount; ++worker)
+	{
+		workers.push_back(std::thread(&CBatchRunner::WorkerThread, this, worker));
+	}
+
+	for (uint32 worker = 0; worker < threadCount; ++worker)
+	{
+		workers[worker].join();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_resultMutex);
+		m_workersDone = true;
+	}
+	m_resultReady.notify_one();
+	writer.join();
+
+	fprintf(stdout, "[Batch]: finished %d jobs (%d failed)\n", GetJobCount(), m_failed.load());
+	return m_failed;
+}
+
+//=============================================================================
+
+void CBatchRunner::WorkerThread(uint32 worker)
+{
+	uint32 job = 0;
+	while (NextJob(worker, job))
+	{
+		if (!RunJob(m_jobs[job]))
+		{
+			++m_failed;
+		}
+	}
+}
+
+//=============================================================================
+
+bool CBatchRunner::NextJob(uint32 worker, uint32& job)
+{
+	{
+		SWorkQueue& queue = m_pQueues[worker];
+		std::lock_guard<std::mutex> lock(queue.m_mutex);
+		if (!queue.m_jobs.empty())
+		{
+			job = queue.m_jobs.front();
+			queue.m_jobs.pop_front();
+			return true;
+		}
+	}
+
+	// Nothing left locally, so steal from the back of someone else's queue
+	// (no jobs are added once running, so finding them all empty means done)
+	for (uint32 offset = 1; offset < m_queueCount; ++offset)
+	{
+		SWorkQueue& queue = m_pQueues[(worker + offset) % m_queueCount];
+		std::lock_guard<std::mutex> lock(queue.m_mutex);
+		if (!queue.m_jobs.empty())
+		{
+			job = queue.m_jobs.back();
+			queue.m_jobs.pop_back();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//=============================================================================
+
+bool CBatchRunner::RunJob(const SJob& job)
+{
+	std::vector<char*> argv;
+	for (uint32 arg = 0; arg < job.m_args.size(); ++arg)
+	{
+		argv.push_back(const_cast<char*>(job.m_args[arg].c_str()));
+	}
+	argv.push_back(NULL);
+
+	// The machine carries its frame buffer inline, which is too big for a
+	// worker's stack
+	CZXSpectrum* pSpeccy = new CZXSpectrum();
+	bool ok = pSpeccy->InitialiseHeadless(static_cast<int>(job.m_args.size()), &argv[0]);
+	if (ok)
+	{
+		ok = pSpeccy->RunFrames(job.m_frames);
+	}
+
+	if (ok)
+	{
+		SResult* pResult = new SResult;
+		pResult->m_name = job.m_name;
+		pResult->m_width = pSpeccy->GetScreenWidth();
+		pResult->m_height = pSpeccy->GetScreenHeight();
+		const uint32* pScreen = static_cast<const uint32*>(pSpeccy->GetScreenMemory());
+		pResult->m_screen.assign(pScreen, pScreen + (pResult->m_width * pResult->m_height));
+		pResult->m_memory.resize(0x10000);
+		for (uint32 address = 0; address < 0x10000; ++address)
+		{
+			pResult->m_memory[address] = pSpeccy->ReadMemory(static_cast<uint16>(address));
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_resultMutex);
+			m_results.push_back(pResult);
+		}
+		m_resultReady.notify_one();
+	}
+	else
+	{
+		fprintf(stderr, "[Batch]: job '%s' failed\n", job.m_name.c_str());
+	}
+
+	delete pSpeccy;
+	return ok;
+}
+
+//=============================================================================
+
+void CBatchRunner::WriterThread(void)
+{
+	for (;;)
+	{
+		SResult* pResult = NULL;
+		{
+			std::unique_lock<std::mutex> lock(m_resultMutex);
+			while (m_results.empty() && !m_workersDone)
+			{
+				m_resultReady.wait(lock);
+			}
+
+			if (m_results.empty())
+			{
+				break;
+			}
+
+			pResult = m_results.front();
+			m_results.pop_front();
+		}
+
+		if (!WriteResult(*pResult))
+		{
+			++m_failed;
+		}
+		delete pResult;
+	}
+}
+
+//=============================================================================
+
+bool CBatchRunner::WriteResult(const SResult& result) const
+{
+	std::string path = m_outputPath + "/" + result.m_name;
+
+	// Screen as a binary PPM; video memory is RGBA byte order
+	std::string fileName = path + ".ppm";
+	FILE* pFile = fopen(fileName.c_str(), "wb");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[Batch]: unable to write '%s'\n", fileName.c_str());
+		return false;
+	}
+
+	fprintf(pFile, "P6\n%d %d\n255\n", result.m_width, result.m_height);
+	std::vector<uint8> rgb(result.m_screen.size() * 3);
+	for (uint32 pixel = 0; pixel < result.m_screen.size(); ++pixel)
+	{
+		uint32 colour = result.m_screen[pixel];
+		rgb[(pixel * 3) + 0] = colour & 0xFF;
+		rgb[(pixel * 3) + 1] = (colour >> 8) & 0xFF;
+		rgb[(pixel * 3) + 2] = (colour >> 16) & 0xFF;
+	}
+	bool ok = (fwrite(&rgb[0], rgb.size(), 1, pFile) == 1);
+	fclose(pFile);
+
+	fileName = path + ".bin";
+	pFile = fopen(fileName.c_str(), "wb");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[Batch]: unable to write '%s'\n", fileName.c_str());
+		return false;
+	}
+
+	ok &= (fwrite(&result.m_memory[0], result.m_memory.size(), 1, pFile) == 1);
+	fclose(pFile);
+
+	return ok;
+}
+
+//=============================================================================
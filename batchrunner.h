@@ -0,0 +1,90 @@
+#if !defined(__BATCHRUNNER_H__)
+#define __BATCHRUNNER_H__
+
+#include "common/platform_types.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//=============================================================================
+// Runs a list of jobs, each on its own headless machine, across a pool of
+// worker threads.  Jobs are dealt out to per worker queues up front; a worker
+// takes from the front of its own queue and, once that is empty, steals from
+// the back of the others so long running jobs don't leave threads idle.
+//
+// Finished machines hand their screen and memory over to a writer thread so
+// the workers never wait on the disk.
+//
+// The job list has one job per line ('#' starts a comment):
+//		<frames> <output name> [machine arguments...]
+// where the machine arguments are the same as the emulator's command line
+// (e.g. -model 128K "tapes/some game.tzx").  Each job writes
+// <output name>.ppm (the screen, including border) and <output name>.bin (the
+// 64K address space as paged at the end of the run).
+//=============================================================================
+
+class CBatchRunner
+{
+	public:
+		CBatchRunner(void);
+		~CBatchRunner(void);
+
+		bool				LoadJobs(const char* fileName);
+		void				SetOutputPath(const char* path)	{ m_outputPath = path; }
+		uint32			GetJobCount(void) const					{ return static_cast<uint32>(m_jobs.size()); }
+
+		// Runs every job and returns the number that failed.  A thread count of
+		// 0 uses one worker per core.
+		uint32			Run(uint32 threadCount);
+
+	protected:
+		struct SJob
+		{
+			uint32										m_frames;
+			std::string								m_name;
+			std::vector<std::string>	m_args;
+		};
+
+		struct SResult
+		{
+			std::string						m_name;
+			uint32								m_width;
+			uint32								m_height;
+			std::vector<uint32>		m_screen;
+			std::vector<uint8>		m_memory;
+		};
+
+		struct SWorkQueue
+		{
+			std::mutex					m_mutex;
+			std::deque<uint32>	m_jobs;
+		};
+
+		void				WorkerThread(uint32 worker);
+		bool				NextJob(uint32 worker, uint32& job);
+		bool				RunJob(const SJob& job);
+		void				WriterThread(void);
+		bool				WriteResult(const SResult& result) const;
+
+		std::vector<SJob>		m_jobs;
+		std::string					m_outputPath;
+
+		SWorkQueue*					m_pQueues;
+		uint32							m_queueCount;
+
+		// Results waiting for the writer thread
+		std::mutex					m_resultMutex;
+		std::condition_variable	m_resultReady;
+		std::deque<SResult*>	m_results;
+		bool								m_workersDone;
+
+		std::atomic<uint32>	m_failed;
+};
+
+//=============================================================================
+
+#endif // !defined(__BATCHRUNNER_H__)
@@ -0,0 +1,231 @@
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "breakpoints.h"
+
+//=============================================================================
+
+CBreakpointSet::CBreakpointSet(void)
+{
+	Clear();
+}
+
+//=============================================================================
+
+void CBreakpointSet::AddRange(uint16 first, uint16 last)
+{
+	SetRange(first, last);
+	for (uint32 address = first; address <= last; ++address)
+	{
+		m_unconditionalBits[address >> 5] |= 1 << (address & 31);
+	}
+}
+
+//=============================================================================
+
+void CBreakpointSet::RemoveRange(uint16 first, uint16 last)
+{
+	for (uint32 address = first; address <= last; ++address)
+	{
+		uint32 bit = 1 << (address & 31);
+		if ((m_bits[address >> 5] & bit) != 0)
+		{
+			m_bits[address >> 5] &= ~bit;
+			--m_count;
+		}
+		m_unconditionalBits[address >> 5] &= ~bit;
+	}
+
+	for (uint32 page = first >> 8; page <= static_cast<uint32>(last >> 8); ++page)
+	{
+		UpdatePage(static_cast<uint8>(page));
+	}
+
+	// Conditions wholly within the range go with it
+	uint32 index = 0;
+	while (index < m_conditionCount)
+	{
+		if ((m_condition[index].m_first >= first) && (m_condition[index].m_last <= last))
+		{
+			m_condition[index] = m_condition[--m_conditionCount];
+		}
+		else
+		{
+			++index;
+		}
+	}
+}
+
+//=============================================================================
+
+bool CBreakpointSet::AddCondition(uint16 first, uint16 last, eRegister reg, uint16 value, uint32 hitCount)
+{
+	if (m_conditionCount >= BS_MAX_CONDITIONS)
+	{
+		return false;
+	}
+
+	SCondition& condition = m_condition[m_conditionCount++];
+	condition.m_first = first;
+	condition.m_last = last;
+	condition.m_value = value;
+	condition.m_register = reg;
+	condition.m_hitCount = hitCount;
+	condition.m_hits = 0;
+
+	SetRange(first, last);
+	return true;
+}
+
+//=============================================================================
+
+bool CBreakpointSet::Parse(const char* pText)
+{
+	static const char* s_registerName[BR_COUNT] = { "", "A", "AF", "BC", "DE", "HL", "IX", "IY", "SP" };
+
+	char* pEnd = NULL;
+	uint32 first = strtoul(pText, &pEnd, 16);
+	uint32 last = first;
+	if ((pEnd == pText) || (first > 0xFFFF))
+	{
+		return false;
+	}
+
+	if (*pEnd == '-')
+	{
+		const char* pLast = pEnd + 1;
+		last = strtoul(pLast, &pEnd, 16);
+		if ((pEnd == pLast) || (last > 0xFFFF) || (last < first))
+		{
+			return false;
+		}
+	}
+
+	eRegister reg = BR_NONE;
+	uint32 value = 0;
+	uint32 hitCount = 0;
+	if (*pEnd == ':')
+	{
+		const char* pName = pEnd + 1;
+		const char* pEquals = strchr(pName, '=');
+		if (pEquals == NULL)
+		{
+			return false;
+		}
+
+		uint32 index = BR_A;
+		while ((index < BR_COUNT) && ((strlen(s_registerName[index]) != static_cast<size_t>(pEquals - pName)) || (strncasecmp(pName, s_registerName[index], pEquals - pName) != 0)))
+		{
+			++index;
+		}
+		if (index == BR_COUNT)
+		{
+			return false;
+		}
+		reg = static_cast<eRegister>(index);
+
+		value = strtoul(pEquals + 1, &pEnd, 16);
+		if ((pEnd == pEquals + 1) || (value > 0xFFFF))
+		{
+			return false;
+		}
+	}
+
+	if (*pEnd == '@')
+	{
+		const char* pCount = pEnd + 1;
+		hitCount = strtoul(pCount, &pEnd, 10);
+		if (pEnd == pCount)
+		{
+			return false;
+		}
+	}
+
+	if (*pEnd != 0)
+	{
+		return false;
+	}
+
+	if ((reg == BR_NONE) && (hitCount <= 1))
+	{
+		AddRange(first, last);
+		return true;
+	}
+
+	return AddCondition(first, last, reg, value, hitCount);
+}
+
+//=============================================================================
+
+void CBreakpointSet::Clear(void)
+{
+	memset(m_bits, 0, sizeof(m_bits));
+	memset(m_unconditionalBits, 0, sizeof(m_unconditionalBits));
+	memset(m_page, 0, sizeof(m_page));
+	m_count = 0;
+	m_conditionCount = 0;
+}
+
+//=============================================================================
+
+bool CBreakpointSet::Hit(uint16 address, const uint16* pRegisters) const
+{
+	// Addresses added without a condition always break, even inside a
+	// conditional range (whose hits are still counted)
+	bool hit = (((m_unconditionalBits[address >> 5] >> (address & 31)) & 1) != 0);
+
+	for (uint32 index = 0; index < m_conditionCount; ++index)
+	{
+		const SCondition& condition = m_condition[index];
+		if ((address < condition.m_first) || (address > condition.m_last))
+		{
+			continue;
+		}
+
+		if ((condition.m_register == BR_NONE) || (pRegisters[condition.m_register] == condition.m_value))
+		{
+			if (++condition.m_hits >= condition.m_hitCount)
+			{
+				hit = true;
+			}
+		}
+	}
+
+	return hit;
+}
+
+//=============================================================================
+
+void CBreakpointSet::SetRange(uint16 first, uint16 last)
+{
+	for (uint32 address = first; address <= last; ++address)
+	{
+		uint32 bit = 1 << (address & 31);
+		if ((m_bits[address >> 5] & bit) == 0)
+		{
+			m_bits[address >> 5] |= bit;
+			++m_count;
+		}
+		m_page[address >> 8] = 1;
+	}
+}
+
+//=============================================================================
+
+void CBreakpointSet::UpdatePage(uint8 page)
+{
+	uint32 firstWord = static_cast<uint32>(page) * 8;
+
+	m_page[page] = 0;
+	for (uint32 word = firstWord; word < (firstWord + 8); ++word)
+	{
+		if (m_bits[word] != 0)
+		{
+			m_page[page] = 1;
+			break;
+		}
+	}
+}
+
+//=============================================================================
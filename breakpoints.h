@@ -0,0 +1,90 @@
+#if !defined(__BREAKPOINTS_H__)
+#define __BREAKPOINTS_H__
+
+#include "common/platform_types.h"
+
+//=============================================================================
+// A set of addresses (or ports) to break on.  Each CZ80 owns its own, so
+// machines running side by side can have different breakpoints.
+//
+// The set is a 64K bit map with a flag per 256 byte page, so checking an
+// address is a byte test, and a bit test only on pages with something set.
+// Addresses can also carry conditions (a register value, a hit count), which
+// are only looked at once the address itself has been hit.
+//=============================================================================
+
+class CBreakpointSet
+{
+	public:
+		// Registers a condition can test; the CPU fills these in
+		enum eRegister
+		{
+			BR_NONE,
+			BR_A,
+			BR_AF,
+			BR_BC,
+			BR_DE,
+			BR_HL,
+			BR_IX,
+			BR_IY,
+			BR_SP,
+
+			BR_COUNT
+		};
+
+		CBreakpointSet(void);
+
+		void				Add(uint16 address)					{ AddRange(address, address); }
+		void				AddRange(uint16 first, uint16 last);
+		void				Remove(uint16 address)			{ RemoveRange(address, address); }
+		void				RemoveRange(uint16 first, uint16 last);
+		// Only breaks at the range when the register has the value (unless it's
+		// BR_NONE), and then from the given hit on (0 or 1 for every hit)
+		bool				AddCondition(uint16 first, uint16 last, eRegister reg, uint16 value, uint32 hitCount);
+		// Adds a range from text: <first>[-<last>][:<register>=<value>][@<hit count>]
+		// with the addresses and value in hex, e.g. "4000-57FF", "8000:HL=5C00@3"
+		bool				Parse(const char* pText);
+		void				Clear(void);
+
+		bool				IsSet(uint16 address) const
+		{
+			return (m_page[address >> 8] != 0) && (((m_bits[address >> 5] >> (address & 31)) & 1) != 0);
+		}
+
+		// For an address that IsSet(), whether its conditions (if any) say to
+		// break; counts the hit
+		bool				Hit(uint16 address, const uint16* pRegisters) const;
+		bool				HasConditions(void) const		{ return (m_conditionCount > 0); }
+		uint32			GetCount(void) const				{ return m_count; }
+
+	protected:
+		enum eBreakpointSetConstant
+		{
+			BS_MAX_CONDITIONS = 16
+		};
+
+		struct SCondition
+		{
+			uint16			m_first;
+			uint16			m_last;
+			uint16			m_value;
+			uint8				m_register;
+			uint32			m_hitCount;
+			mutable uint32	m_hits;
+		};
+
+		void				SetRange(uint16 first, uint16 last);
+		void				UpdatePage(uint8 page);
+
+		// Every address set, and those of them added without a condition
+		uint32			m_bits[0x10000 / 32];
+		uint32			m_unconditionalBits[0x10000 / 32];
+		uint8				m_page[0x100];
+		uint32			m_count;
+		SCondition	m_condition[BS_MAX_CONDITIONS];
+		uint32			m_conditionCount;
+};
+
+//=============================================================================
+
+#endif // !defined(__BREAKPOINTS_H__)
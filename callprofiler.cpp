@@ -0,0 +1,213 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "callprofiler.h"
+#include "symbols.h"
+
+//=============================================================================
+
+CCallProfiler::CCallProfiler(void)
+{
+	Reset();
+}
+
+//=============================================================================
+
+void CCallProfiler::Reset(void)
+{
+	SNode root;
+	root.m_tstates = 0;
+	root.m_calls = 0;
+	root.m_parent = CP_NO_NODE;
+	root.m_child = CP_NO_NODE;
+	root.m_sibling = CP_NO_NODE;
+	root.m_address = 0;
+
+	m_nodes.clear();
+	m_nodes.push_back(root);
+
+	m_depth = 0;
+	m_stack[0].m_node = 0;
+	m_stack[0].m_sp = 0xFFFF;
+}
+
+//=============================================================================
+
+void CCallProfiler::Call(uint16 address, uint16 sp)
+{
+	if (m_depth + 1 >= CP_MAX_DEPTH)
+	{
+		return;
+	}
+
+	uint32 parent = m_stack[m_depth].m_node;
+	uint32 node = m_nodes[parent].m_child;
+	while ((node != CP_NO_NODE) && (m_nodes[node].m_address != address))
+	{
+		node = m_nodes[node].m_sibling;
+	}
+
+	if (node == CP_NO_NODE)
+	{
+		if (m_nodes.size() >= CP_MAX_NODES)
+		{
+			return;
+		}
+
+		// Children always come after their parent, which WriteCallees() relies on
+		SNode child;
+		child.m_tstates = 0;
+		child.m_calls = 0;
+		child.m_parent = parent;
+		child.m_child = CP_NO_NODE;
+		child.m_sibling = m_nodes[parent].m_child;
+		child.m_address = address;
+
+		node = static_cast<uint32>(m_nodes.size());
+		m_nodes[parent].m_child = node;
+		m_nodes.push_back(child);
+	}
+
+	++m_nodes[node].m_calls;
+	++m_depth;
+	m_stack[m_depth].m_node = node;
+	m_stack[m_depth].m_sp = sp;
+}
+
+//=============================================================================
+
+void CCallProfiler::Return(uint16 sp)
+{
+	while ((m_depth > 0) && (m_stack[m_depth].m_sp <= sp))
+	{
+		--m_depth;
+	}
+}
+
+//=============================================================================
+
+void CCallProfiler::GetName(uint32 node, const CSymbolTable* pSymbols, char* pName) const
+{
+	if (node == 0)
+	{
+		strcpy(pName, "Z80");
+		return;
+	}
+
+	uint16 address = m_nodes[node].m_address;
+	uint16 offset = 0;
+	const char* pLabel = (pSymbols != NULL) ? pSymbols->Lookup(address, offset) : NULL;
+	if (pLabel == NULL)
+	{
+		sprintf(pName, "%04X", address);
+	}
+	else
+	{
+		sprintf(pName, (offset > 0) ? "%s+%d" : "%s", pLabel, offset);
+	}
+}
+
+//=============================================================================
+
+void CCallProfiler::WriteCollapsedStacks(FILE* pFile, const CSymbolTable* pSymbols) const
+{
+	uint32 path[CP_MAX_DEPTH];
+	for (uint32 node = 0; node < m_nodes.size(); ++node)
+	{
+		if (m_nodes[node].m_tstates == 0)
+		{
+			continue;
+		}
+
+		uint32 depth = 0;
+		for (uint32 frame = node; frame != CP_NO_NODE; frame = m_nodes[frame].m_parent)
+		{
+			path[depth++] = frame;
+		}
+
+		while (depth > 0)
+		{
+			char name[64];
+			GetName(path[--depth], pSymbols, name);
+			fprintf(pFile, (depth > 0) ? "%s;" : "%s", name);
+		}
+		fprintf(pFile, " %llu\n", static_cast<unsigned long long>(m_nodes[node].m_tstates));
+	}
+}
+
+//=============================================================================
+
+void CCallProfiler::WriteCallees(FILE* pFile, const CSymbolTable* pSymbols, uint32 maxCallees) const
+{
+	struct SHeavier
+	{
+		SHeavier(const std::vector<uint64>& tstates) : m_tstates(tstates) {}
+		bool operator()(uint32 lhs, uint32 rhs) const { return m_tstates[lhs] > m_tstates[rhs]; }
+		const std::vector<uint64>& m_tstates;
+	};
+
+	// Each node's total including everything below it
+	std::vector<uint64> total(m_nodes.size());
+	for (uint32 node = 0; node < m_nodes.size(); ++node)
+	{
+		total[node] = m_nodes[node].m_tstates;
+	}
+	for (uint32 node = static_cast<uint32>(m_nodes.size()) - 1; node > 0; --node)
+	{
+		total[m_nodes[node].m_parent] += total[node];
+	}
+
+	std::vector<uint64> inclusive(0x10000, 0);
+	std::vector<uint64> exclusive(0x10000, 0);
+	std::vector<uint64> calls(0x10000, 0);
+	for (uint32 node = 1; node < m_nodes.size(); ++node)
+	{
+		uint16 address = m_nodes[node].m_address;
+		exclusive[address] += m_nodes[node].m_tstates;
+		calls[address] += m_nodes[node].m_calls;
+
+		// A recursive call is already included in the outermost one
+		bool recursive = false;
+		for (uint32 parent = m_nodes[node].m_parent; (parent != 0) && !recursive; parent = m_nodes[parent].m_parent)
+		{
+			recursive = (m_nodes[parent].m_address == address);
+		}
+		if (!recursive)
+		{
+			inclusive[address] += total[node];
+		}
+	}
+
+	std::vector<uint32> addresses;
+	for (uint32 address = 0; address < 0x10000; ++address)
+	{
+		if (calls[address] > 0)
+		{
+			addresses.push_back(address);
+		}
+	}
+	std::sort(addresses.begin(), addresses.end(), SHeavier(inclusive));
+
+	fprintf(pFile, "Z80 call graph: %llu T states, %u routines called\n\n", static_cast<unsigned long long>(total[0]), static_cast<uint32>(addresses.size()));
+	fprintf(pFile, "  %%time   inclusive   exclusive       calls  address  label\n");
+
+	for (uint32 index = 0; (index < addresses.size()) && (index < maxCallees); ++index)
+	{
+		uint16 address = static_cast<uint16>(addresses[index]);
+		char label[64] = "";
+		uint16 offset = 0;
+		const char* pName = (pSymbols != NULL) ? pSymbols->Lookup(address, offset) : NULL;
+		if (pName != NULL)
+		{
+			sprintf(label, (offset > 0) ? "%s+%d" : "%s", pName, offset);
+		}
+
+		double percent = (total[0] > 0) ? (100.0 * inclusive[address]) / total[0] : 0.0;
+		fprintf(pFile, "%7.2f %11llu %11llu %11llu     %04X  %s\n", percent, static_cast<unsigned long long>(inclusive[address]), static_cast<unsigned long long>(exclusive[address]),
+			static_cast<unsigned long long>(calls[address]), address, label);
+	}
+}
+
+//=============================================================================
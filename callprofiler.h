@@ -0,0 +1,76 @@
+#if !defined(__CALLPROFILER_H__)
+#define __CALLPROFILER_H__
+
+#include <stdio.h>
+
+#include <vector>
+
+#include "common/platform_types.h"
+
+class CSymbolTable;
+
+//=============================================================================
+// Shadow call stack for the call graph profiler (cmake -DZ80_CALL_PROFILER=ON).
+// The CPU reports every CALL, RST, interrupt and RET, and the T states of
+// everything it runs, which are charged to whatever is on top of the stack.
+// Each distinct call path is a node in a tree, from which come the inclusive
+// and exclusive T states per routine and the collapsed stacks flamegraph.pl
+// reads (a line per path, e.g. "Z80;MASK-INT;KEYBOARD 1234").
+//
+// Returns are matched on SP rather than assumed to pair up with the calls: a
+// RET pops every frame whose return address is at or below SP, so code that
+// drops its return address (or resets SP) unwinds properly, and a RET used as
+// a jump (PUSH then RET) pops nothing.
+//=============================================================================
+
+class CCallProfiler
+{
+	public:
+		CCallProfiler(void);
+
+		void				Reset(void);
+
+		// sp is where the return address was pushed
+		void				Call(uint16 address, uint16 sp);
+		// sp is where the return address is about to be popped from
+		void				Return(uint16 sp);
+		inline void	AddTstates(uint32 tstates)		{ m_nodes[m_stack[m_depth].m_node].m_tstates += tstates; }
+
+		void				WriteCollapsedStacks(FILE* pFile, const CSymbolTable* pSymbols) const;
+		// The routines taking the most time, including what they call
+		void				WriteCallees(FILE* pFile, const CSymbolTable* pSymbols, uint32 maxCallees) const;
+
+	protected:
+		enum eCallProfilerConstant
+		{
+			CP_MAX_DEPTH = 256,		// deeper calls are charged to the deepest frame
+			CP_MAX_NODES = 1 << 20,	// as are new paths once there are this many
+			CP_NO_NODE = 0xFFFFFFFF
+		};
+
+		struct SNode
+		{
+			uint64			m_tstates;		// exclusive
+			uint32			m_calls;
+			uint32			m_parent;
+			uint32			m_child;			// first child
+			uint32			m_sibling;		// next child of the parent
+			uint16			m_address;
+		};
+
+		struct SFrame
+		{
+			uint32			m_node;
+			uint16			m_sp;
+		};
+
+		void				GetName(uint32 node, const CSymbolTable* pSymbols, char* pName) const;
+
+		std::vector<SNode>	m_nodes;			// the root, node 0, is whatever runs outside any call
+		SFrame			m_stack[CP_MAX_DEPTH];
+		uint32			m_depth;							// m_stack[0] is the root, which is never popped
+};
+
+//=============================================================================
+
+#endif // !defined(__CALLPROFILER_H__)
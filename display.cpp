@@ -6,6 +6,7 @@
 //#include "includes/glext.h"
 
 #include "display.h"
+#include "perfcounters.h"
 
 //=============================================================================
 
@@ -61,6 +62,8 @@ CDisplay::~CDisplay(void)
 
 bool CDisplay::Update(IScreenMemory* pScreenMemory)
 {
+	PERF_SCOPE(PF_DISPLAY);
+
 	int width, height;
 
 	// Get window size (and protect against height being 0)
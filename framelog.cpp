@@ -0,0 +1,313 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <png.h>
+
+#include "framelog.h"
+#include "iscreenmemory.h"
+
+#define HASH_PRIME_1 (0x9E3779B185EBCA87ULL)
+#define HASH_PRIME_2 (0xC2B2AE3D27D4EB4FULL)
+#define HASH_PRIME_3 (0x165667B19E3779F9ULL)
+#define HASH_ROTATE(_value_, _bits_) (((_value_) << (_bits_)) | ((_value_) >> (64 - (_bits_))))
+
+//=============================================================================
+
+CFrameLog::CFrameLog(void)
+	: m_pFile(NULL)
+	, m_flags(0)
+	, m_dumpInterval(0)
+	, m_dumpFormat(DF_PNG)
+	, m_stopWriter(false)
+{
+	m_dumpPrefix[0] = 0;
+}
+
+//=============================================================================
+
+CFrameLog::~CFrameLog(void)
+{
+	Close();
+}
+
+//=============================================================================
+
+bool CFrameLog::Open(const char* fileName, bool hashMemory)
+{
+	Close();
+
+	if (!IsHashPositional())
+	{
+		fprintf(stderr, "[Frame Log]: the hash doesn't see where content is, so can't be used to compare frames\n");
+		return false;
+	}
+
+	m_pFile = fopen(fileName, "wb");
+	if (m_pFile == NULL)
+	{
+		fprintf(stderr, "[Frame Log]: unable to open '%s'\n", fileName);
+		return false;
+	}
+
+	m_flags = hashMemory ? FL_HASH_MEMORY : 0;
+	uint32 magic = FL_MAGIC;
+	uint16 version = FL_VERSION;
+	fwrite(&magic, sizeof(magic), 1, m_pFile);
+	fwrite(&version, sizeof(version), 1, m_pFile);
+	fwrite(&m_flags, sizeof(m_flags), 1, m_pFile);
+
+	fprintf(stdout, "[Frame Log]: logging frame hashes%s to '%s'\n", hashMemory ? " (with memory)" : "", fileName);
+	return true;
+}
+
+//=============================================================================
+
+void CFrameLog::SetDumps(const char* prefix, uint32 interval, eDumpFormat format)
+{
+	strncpy(m_dumpPrefix, prefix, sizeof(m_dumpPrefix) - 1);
+	m_dumpPrefix[sizeof(m_dumpPrefix) - 1] = 0;
+	m_dumpInterval = interval;
+	m_dumpFormat = format;
+
+	if ((m_dumpInterval > 0) && !m_writer.joinable())
+	{
+		m_stopWriter = false;
+		m_writer = std::thread(&CFrameLog::WriterThread, this);
+	}
+}
+
+//=============================================================================
+
+void CFrameLog::Close(void)
+{
+	if (m_writer.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_dumpMutex);
+			m_stopWriter = true;
+		}
+		m_dumpChanged.notify_all();
+		m_writer.join();
+	}
+
+	if (m_pFile != NULL)
+	{
+		fclose(m_pFile);
+		m_pFile = NULL;
+	}
+}
+
+//=============================================================================
+
+void CFrameLog::EndFrame(uint32 frame, const IScreenMemory* pScreen, const uint8* const* ppPages, uint32 pageCount, uint32 pageSize)
+{
+	uint32 width = pScreen->GetScreenWidth();
+	uint32 height = pScreen->GetScreenHeight();
+	const uint32* pPixels = static_cast<const uint32*>(pScreen->GetScreenMemory());
+
+	if (m_pFile != NULL)
+	{
+		uint64 videoHash = Hash(pPixels, width * height * sizeof(uint32), 0);
+		fwrite(&frame, sizeof(frame), 1, m_pFile);
+		fwrite(&videoHash, sizeof(videoHash), 1, m_pFile);
+
+		if (IsHashingMemory())
+		{
+			uint64 memoryHash = 0;
+			for (uint32 page = 0; page < pageCount; ++page)
+			{
+				if (ppPages[page] != NULL)
+				{
+					memoryHash = Hash(ppPages[page], pageSize, memoryHash);
+				}
+			}
+			fwrite(&memoryHash, sizeof(memoryHash), 1, m_pFile);
+		}
+	}
+
+	if ((m_dumpInterval > 0) && ((frame % m_dumpInterval) == 0))
+	{
+		SFrameDump* pDump = new SFrameDump;
+		pDump->m_frame = frame;
+		pDump->m_width = width;
+		pDump->m_height = height;
+		pDump->m_pixels.assign(pPixels, pPixels + (width * height));
+
+		// If the disk can't keep up, hold the emulation back rather than
+		// queueing frames without limit
+		std::unique_lock<std::mutex> lock(m_dumpMutex);
+		while (m_dumps.size() >= FL_MAX_QUEUED_DUMPS)
+		{
+			m_dumpChanged.wait(lock);
+		}
+		m_dumps.push_back(pDump);
+		lock.unlock();
+		m_dumpChanged.notify_all();
+	}
+}
+
+//=============================================================================
+
+uint64 CFrameLog::Hash(const void* pData, uint32 size, uint64 seed)
+{
+	// Per lane keys (the fractional digits of pi) stop identical input words
+	// cancelling out in neighbouring lanes
+	static const uint64 s_key[8] =
+	{
+		0x243F6A8885A308D3ULL, 0x13198A2E03707344ULL, 0xA4093822299F31D0ULL, 0x082EFA98EC4E6C89ULL,
+		0x452821E638D01377ULL, 0xBE5466CF34E90C6CULL, 0xC0AC29B7C97C50DDULL, 0x3F84D5B5B5470917ULL
+	};
+
+	const uint8* pBytes = static_cast<const uint8*>(pData);
+	uint64 lane[8];
+	for (uint32 index = 0; index < 8; ++index)
+	{
+		lane[index] = seed ^ s_key[index];
+	}
+
+	// Each stripe's keys are offset by its position, otherwise content moved by
+	// a multiple of 64 bytes (e.g. a sprite 16 pixels along, or a line down)
+	// would add the same into the lanes
+	uint64 stripeKey = 0;
+	while (size >= 64)
+	{
+		uint64 value[8];
+		memcpy(value, pBytes, sizeof(value));
+		for (uint32 index = 0; index < 8; ++index)
+		{
+			uint64 keyed = value[index] ^ (s_key[index] + stripeKey);
+			lane[index] += value[index] + ((keyed & 0xFFFFFFFF) * (keyed >> 32));
+		}
+		stripeKey += HASH_PRIME_2;
+		pBytes += 64;
+		size -= 64;
+	}
+
+	uint64 hash = (size * HASH_PRIME_1) ^ seed;
+	for (uint32 index = 0; index < 8; ++index)
+	{
+		hash ^= HASH_ROTATE(lane[index] * HASH_PRIME_2, 31) * HASH_PRIME_1;
+		hash = (hash * HASH_PRIME_1) + HASH_PRIME_3;
+	}
+
+	// Whatever didn't fill a whole stripe
+	while (size > 0)
+	{
+		hash ^= (*pBytes++) * HASH_PRIME_3;
+		hash = HASH_ROTATE(hash, 11) * HASH_PRIME_1;
+		--size;
+	}
+
+	hash ^= hash >> 33;
+	hash *= HASH_PRIME_2;
+	hash ^= hash >> 29;
+	hash *= HASH_PRIME_3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+//=============================================================================
+
+bool CFrameLog::IsHashPositional(void)
+{
+	// The same 8 pixel sprite at x = 40, x = 56 (a stripe along) and a line
+	// further down a 288 pixel wide frame must all hash differently
+	static const uint32 s_offset[3] = { 40, 56, 40 + 288 };
+	uint64 hash[3];
+	std::vector<uint32> pixels(288 * 4);
+	for (uint32 test = 0; test < 3; ++test)
+	{
+		std::fill(pixels.begin(), pixels.end(), 0xFF000000);
+		std::fill(pixels.begin() + s_offset[test], pixels.begin() + s_offset[test] + 8, 0xFFFFFFFF);
+		hash[test] = Hash(&pixels[0], static_cast<uint32>(pixels.size() * sizeof(uint32)), 0);
+	}
+
+	return (hash[0] != hash[1]) && (hash[0] != hash[2]) && (hash[1] != hash[2]);
+}
+
+//=============================================================================
+
+void CFrameLog::WriterThread(void)
+{
+	for (;;)
+	{
+		SFrameDump* pDump = NULL;
+		{
+			std::unique_lock<std::mutex> lock(m_dumpMutex);
+			while (m_dumps.empty() && !m_stopWriter)
+			{
+				m_dumpChanged.wait(lock);
+			}
+
+			if (m_dumps.empty())
+			{
+				break;
+			}
+
+			pDump = m_dumps.front();
+			m_dumps.pop_front();
+		}
+		m_dumpChanged.notify_all();
+
+		char fileName[300];
+		sprintf(fileName, "%s_%06d.%s", m_dumpPrefix, pDump->m_frame, (m_dumpFormat == DF_PNG) ? "png" : "rgba");
+		bool ok = (m_dumpFormat == DF_PNG) ? WritePNG(*pDump, fileName) : WriteRaw(*pDump, fileName);
+		if (!ok)
+		{
+			fprintf(stderr, "[Frame Log]: unable to write '%s'\n", fileName);
+		}
+		delete pDump;
+	}
+}
+
+//=============================================================================
+
+bool CFrameLog::WritePNG(const SFrameDump& dump, const char* fileName) const
+{
+	FILE* pFile = fopen(fileName, "wb");
+	if (pFile == NULL)
+	{
+		return false;
+	}
+
+	png_structp pPNG = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	png_infop pInfo = (pPNG != NULL) ? png_create_info_struct(pPNG) : NULL;
+	if ((pInfo == NULL) || setjmp(png_jmpbuf(pPNG)))
+	{
+		png_destroy_write_struct(&pPNG, &pInfo);
+		fclose(pFile);
+		return false;
+	}
+
+	// Video memory is already RGBA byte order
+	png_init_io(pPNG, pFile);
+	png_set_IHDR(pPNG, pInfo, dump.m_width, dump.m_height, 8, PNG_COLOR_TYPE_RGB_ALPHA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+	png_write_info(pPNG, pInfo);
+	for (uint32 y = 0; y < dump.m_height; ++y)
+	{
+		png_write_row(pPNG, reinterpret_cast<png_const_bytep>(&dump.m_pixels[y * dump.m_width]));
+	}
+	png_write_end(pPNG, NULL);
+	png_destroy_write_struct(&pPNG, &pInfo);
+
+	return (fclose(pFile) == 0);
+}
+
+//=============================================================================
+
+bool CFrameLog::WriteRaw(const SFrameDump& dump, const char* fileName) const
+{
+	FILE* pFile = fopen(fileName, "wb");
+	if (pFile == NULL)
+	{
+		return false;
+	}
+
+	bool ok = (fwrite(&dump.m_pixels[0], dump.m_pixels.size() * sizeof(uint32), 1, pFile) == 1);
+	return (fclose(pFile) == 0) && ok;
+}
+
+//=============================================================================
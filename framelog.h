@@ -0,0 +1,96 @@
+#if !defined(__FRAMELOG_H__)
+#define __FRAMELOG_H__
+
+#include <stdio.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/platform_types.h"
+#include "common/macros.h"
+
+struct IScreenMemory;
+
+//=============================================================================
+// Per frame hashes for spotting divergences between runs.  Each frame's
+// video memory (and optionally RAM) is hashed and appended to a compact
+// binary log:
+//		header:	'ZXFH' magic, uint16 version, uint16 flags (FL_HASH_MEMORY)
+//		frame:	uint32 frame number, uint64 video hash[, uint64 memory hash]
+// all little endian.  Every N frames the screen can also be dumped as a PNG
+// or raw RGBA file; the copies are encoded and written on a background
+// thread so the emulation only pays for a memcpy.
+//=============================================================================
+
+class CFrameLog
+{
+	public:
+		enum eFrameLogConstant
+		{
+			FL_MAGIC = 0x4846585A, // 'ZXFH'
+			FL_VERSION = 2,
+			FL_HASH_MEMORY = 0x0001,
+			FL_MAX_QUEUED_DUMPS = 32
+		};
+
+		enum eDumpFormat
+		{
+			DF_PNG,
+			DF_RAW
+		};
+
+		CFrameLog(void);
+		~CFrameLog(void);
+
+		bool				Open(const char* fileName, bool hashMemory);
+		// Dumps every interval frames (0 disables) to <prefix>_<frame>.png/.rgba
+		void				SetDumps(const char* prefix, uint32 interval, eDumpFormat format);
+		void				Close(void);
+
+		bool				IsHashingMemory(void) const		{ return (m_flags & FL_HASH_MEMORY) != 0; }
+		// Logs the frame just finished.  RAM pages are only hashed (in order)
+		// when memory hashing is enabled; NULL pages are skipped.
+		void				EndFrame(uint32 frame, const IScreenMemory* pScreen, const uint8* const* ppPages, uint32 pageCount, uint32 pageSize);
+
+		// 64 bit hash over eight independent lanes of 32x32->64 bit multiplies,
+		// which the compiler can turn straight into SIMD (pmuludq)
+		static	uint64	Hash(const void* pData, uint32 size, uint64 seed);
+		// Checks that moving content changes the hash (checked by Open())
+		static	bool		IsHashPositional(void);
+
+	protected:
+		struct SFrameDump
+		{
+			uint32							m_frame;
+			uint32							m_width;
+			uint32							m_height;
+			std::vector<uint32>	m_pixels;
+		};
+
+		void				WriterThread(void);
+		bool				WritePNG(const SFrameDump& dump, const char* fileName) const;
+		bool				WriteRaw(const SFrameDump& dump, const char* fileName) const;
+
+		FILE*				m_pFile;
+		uint16			m_flags;
+
+		char				m_dumpPrefix[256];
+		uint32			m_dumpInterval;
+		eDumpFormat	m_dumpFormat;
+
+		std::thread							m_writer;
+		std::mutex							m_dumpMutex;
+		std::condition_variable	m_dumpChanged;
+		std::deque<SFrameDump*>	m_dumps;
+		bool										m_stopWriter;
+
+	private:
+		PREVENT_CLASS_COPY(CFrameLog);
+};
+
+//=============================================================================
+
+#endif // !defined(__FRAMELOG_H__)
@@ -7,6 +7,18 @@ struct IMemory
 	virtual uint8 ReadMemory(uint16 address) const = 0;
 	virtual void WritePort(uint16 address, uint8 byte) = 0;
 	virtual uint8 ReadPort(uint16 address) const = 0;
+
+	// Direct access to length bytes from address for block instructions (the
+	// range never crosses a 256 byte boundary).  NULL means the bytes must go
+	// through the calls above; a write block may also be refused if writes
+	// there over the next tstates T states would have visible side effects.
+	virtual const uint8* GetReadBlock(uint16 address, uint16 length) const = 0;
+	virtual uint8* GetWriteBlock(uint16 address, uint16 length, uint32 tstates) = 0;
+
+	// 256 counters, one per 256 byte page of the address space, that change
+	// whenever anything in the page might have (a write, or paging in other
+	// memory).  Used to tell whether decoded code is still valid.
+	virtual const uint32* GetWriteGenerations(void) const = 0;
 };
 
 #endif // !defined(__IMEMORY_H__)
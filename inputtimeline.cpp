@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "inputtimeline.h"
+
+#define MAX_TIMELINE_LINE (256)
+
+//=============================================================================
+
+CInputTimeline::CInputTimeline(void)
+	: m_nextEvent(0)
+	, m_playing(false)
+	, m_pRecordFile(NULL)
+{
+	memset(m_recordedMatrix, 0, sizeof(m_recordedMatrix));
+}
+
+//=============================================================================
+
+CInputTimeline::~CInputTimeline(void)
+{
+	if (m_pRecordFile != NULL)
+	{
+		fclose(m_pRecordFile);
+	}
+}
+
+//=============================================================================
+
+bool CInputTimeline::StartRecording(const char* fileName)
+{
+	m_pRecordFile = fopen(fileName, "w");
+	if (m_pRecordFile == NULL)
+	{
+		fprintf(stderr, "[Input]: unable to record to '%s'\n", fileName);
+		return false;
+	}
+
+	fprintf(m_pRecordFile, "# frame tstate half rows (FEFE FDFE FBFE F7FE EFFE DFFE BFFE 7FFE)\n");
+	memset(m_recordedMatrix, 0, sizeof(m_recordedMatrix));
+	fprintf(stdout, "[Input]: recording input to '%s'\n", fileName);
+	return true;
+}
+
+//=============================================================================
+
+bool CInputTimeline::LoadPlayback(const char* fileName)
+{
+	FILE* pFile = fopen(fileName, "r");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[Input]: unable to open '%s'\n", fileName);
+		return false;
+	}
+
+	m_events.clear();
+	m_nextEvent = 0;
+
+	char line[MAX_TIMELINE_LINE];
+	uint32 lineNumber = 0;
+	bool ok = true;
+	while (ok && (fgets(line, sizeof(line), pFile) != NULL))
+	{
+		++lineNumber;
+
+		char* pComment = strchr(line, '#');
+		if (pComment != NULL)
+		{
+			*pComment = 0;
+		}
+
+		SInputEvent event;
+		uint32 row[CKeyboard::KB_MATRIX_ROWS];
+		int fields = sscanf(line, "%u %u %x %x %x %x %x %x %x %x", &event.m_frame, &event.m_tstate, &row[0], &row[1], &row[2], &row[3], &row[4], &row[5], &row[6], &row[7]);
+		if (fields <= 0)
+		{
+			// Blank line
+			continue;
+		}
+
+		if (fields != 2 + CKeyboard::KB_MATRIX_ROWS)
+		{
+			fprintf(stderr, "[Input]: %s(%d): expected '<frame> <tstate>' and %d half rows\n", fileName, lineNumber, CKeyboard::KB_MATRIX_ROWS);
+			ok = false;
+		}
+		else if (!m_events.empty() && !IsDue(m_events.back(), event.m_frame, event.m_tstate))
+		{
+			fprintf(stderr, "[Input]: %s(%d): events must be in time order\n", fileName, lineNumber);
+			ok = false;
+		}
+		else
+		{
+			for (uint32 index = 0; index < CKeyboard::KB_MATRIX_ROWS; ++index)
+			{
+				event.m_matrix[index] = static_cast<uint8>(row[index] & 0x1F);
+			}
+			m_events.push_back(event);
+		}
+	}
+	fclose(pFile);
+
+	m_playing = ok;
+	if (ok)
+	{
+		fprintf(stdout, "[Input]: loaded %d input events from '%s'\n", static_cast<uint32>(m_events.size()), fileName);
+	}
+	return ok;
+}
+
+//=============================================================================
+
+void CInputTimeline::Record(uint32 frame, uint32 tstate, const uint8* pMatrix)
+{
+	if ((m_pRecordFile != NULL) && (memcmp(pMatrix, m_recordedMatrix, sizeof(m_recordedMatrix)) != 0))
+	{
+		memcpy(m_recordedMatrix, pMatrix, sizeof(m_recordedMatrix));
+		fprintf(m_pRecordFile, "%u %u", frame, tstate);
+		for (uint32 index = 0; index < CKeyboard::KB_MATRIX_ROWS; ++index)
+		{
+			fprintf(m_pRecordFile, " %02X", pMatrix[index]);
+		}
+		fprintf(m_pRecordFile, "\n");
+	}
+}
+
+//=============================================================================
+
+const uint8* CInputTimeline::Advance(uint32 frame, uint32 tstate)
+{
+	// Several events may have come due since the last check; only the latest
+	// state matters
+	const uint8* pMatrix = NULL;
+	while ((m_nextEvent < m_events.size()) && IsDue(m_events[m_nextEvent], frame, tstate))
+	{
+		pMatrix = m_events[m_nextEvent++].m_matrix;
+	}
+	return pMatrix;
+}
+
+//=============================================================================
@@ -0,0 +1,83 @@
+#if !defined(__INPUTTIMELINE_H__)
+#define __INPUTTIMELINE_H__
+
+#include <stdio.h>
+
+#include <vector>
+
+#include "common/platform_types.h"
+#include "keyboard.h"
+
+//=============================================================================
+// A timeline of key matrix states, each taking effect at a given frame and
+// T state.  It can be recorded from a live session and played back into a
+// machine's keyboard (headless or not); as the emulation is deterministic a
+// replayed timeline produces exactly the same frames every time.
+//
+// Timelines are text, one change per line ('#' starts a comment):
+//		<frame> <T state> <half row 0> ... <half row 7>
+// where each half row is a hex byte with bit n set while key n is down (so
+// they're easy to write by hand for benchmark scripts).
+//=============================================================================
+
+class CInputTimeline
+{
+	public:
+		CInputTimeline(void);
+		~CInputTimeline(void);
+
+		bool				StartRecording(const char* fileName);
+		bool				LoadPlayback(const char* fileName);
+
+		bool				IsRecording(void) const		{ return m_pRecordFile != NULL; }
+		bool				IsPlaying(void) const			{ return m_playing; }
+
+		// Appends an event if the matrix differs from the last one recorded
+		void				Record(uint32 frame, uint32 tstate, const uint8* pMatrix);
+		// Returns the matrix to apply if an event is due at (or before) the
+		// given point, otherwise NULL
+		const uint8*	Playback(uint32 frame, uint32 tstate)
+		{
+			if ((m_nextEvent < m_events.size()) && IsDue(m_events[m_nextEvent], frame, tstate))
+			{
+				return Advance(frame, tstate);
+			}
+			return NULL;
+		}
+		// T states from the given point to the next event in the same frame
+		// (0xFFFFFFFF if there isn't one)
+		uint32			GetTstatesToNextEvent(uint32 frame, uint32 tstate) const
+		{
+			if ((m_nextEvent < m_events.size()) && (m_events[m_nextEvent].m_frame == frame) && (m_events[m_nextEvent].m_tstate > tstate))
+			{
+				return m_events[m_nextEvent].m_tstate - tstate;
+			}
+			return 0xFFFFFFFF;
+		}
+
+	protected:
+		struct SInputEvent
+		{
+			uint32			m_frame;
+			uint32			m_tstate;
+			uint8				m_matrix[CKeyboard::KB_MATRIX_ROWS];
+		};
+
+		static	bool	IsDue(const SInputEvent& event, uint32 frame, uint32 tstate)
+		{
+			return (event.m_frame < frame) || ((event.m_frame == frame) && (event.m_tstate <= tstate));
+		}
+
+		const uint8*	Advance(uint32 frame, uint32 tstate);
+
+		std::vector<SInputEvent>	m_events;
+		uint32			m_nextEvent;
+		bool				m_playing;
+
+		FILE*				m_pRecordFile;
+		uint8				m_recordedMatrix[CKeyboard::KB_MATRIX_ROWS];
+};
+
+//=============================================================================
+
+#endif // !defined(__INPUTTIMELINE_H__)
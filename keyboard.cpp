@@ -8,30 +8,87 @@
 
 //=============================================================================
 
-bool CKeyboard::s_keyState[512];
-bool CKeyboard::s_keyPrevState[512];
+// Half rows are in address line order (A8 to A15), keys in data bit order
+const CKeyboard::SMatrixKey CKeyboard::s_matrixKey[KB_MATRIX_KEYS] =
+{
+	{ GLFW_KEY_LSHIFT, 0, 0x01 },	{ 'Z', 0, 0x02 },	{ 'X', 0, 0x04 },	{ 'C', 0, 0x08 },	{ 'V', 0, 0x10 },
+	{ 'A', 1, 0x01 },	{ 'S', 1, 0x02 },	{ 'D', 1, 0x04 },	{ 'F', 1, 0x08 },	{ 'G', 1, 0x10 },
+	{ 'Q', 2, 0x01 },	{ 'W', 2, 0x02 },	{ 'E', 2, 0x04 },	{ 'R', 2, 0x08 },	{ 'T', 2, 0x10 },
+	{ '1', 3, 0x01 },	{ '2', 3, 0x02 },	{ '3', 3, 0x04 },	{ '4', 3, 0x08 },	{ '5', 3, 0x10 },
+	{ '0', 4, 0x01 },	{ '9', 4, 0x02 },	{ '8', 4, 0x04 },	{ '7', 4, 0x08 },	{ '6', 4, 0x10 },
+	{ 'P', 5, 0x01 },	{ 'O', 5, 0x02 },	{ 'I', 5, 0x04 },	{ 'U', 5, 0x08 },	{ 'Y', 5, 0x10 },
+	{ GLFW_KEY_ENTER, 6, 0x01 },	{ 'L', 6, 0x02 },	{ 'K', 6, 0x04 },	{ 'J', 6, 0x08 },	{ 'H', 6, 0x10 },
+	{ GLFW_KEY_SPACE, 7, 0x01 },	{ GLFW_KEY_RSHIFT, 7, 0x02 },	{ 'M', 7, 0x04 },	{ 'N', 7, 0x08 },	{ 'B', 7, 0x10 }
+};
+
+CKeyboard* CKeyboard::s_pAttached = NULL;
 
 //=============================================================================
 
-void CKeyboard::Initialise(void)
+CKeyboard::CKeyboard(void)
+	: m_hostMatrix(true)
 {
-	memset(s_keyState, 0, sizeof(s_keyState) * sizeof(bool));
-	memset(s_keyPrevState, 0, sizeof(s_keyPrevState) * sizeof(bool));
+	memset(m_keyState, 0, sizeof(m_keyState));
+	memset(m_keyPrevState, 0, sizeof(m_keyPrevState));
+	memset(m_matrix, 0, sizeof(m_matrix));
+}
+
+//=============================================================================
+
+void CKeyboard::Attach(void)
+{
+	s_pAttached = this;
+	glfwSetKeyCallback(KeyCallback);
+}
+
+//=============================================================================
 
-	glfwSetKeyCallback(Update);
+void CKeyboard::Detach(void)
+{
+	if (s_pAttached == this)
+	{
+		glfwSetKeyCallback(NULL);
+		s_pAttached = NULL;
+	}
 }
 
 //=============================================================================
 
-void CKeyboard::Uninitialise(void)
+void CKeyboard::KeyCallback(int key, int action)
 {
+	if (s_pAttached != NULL)
+	{
+		s_pAttached->Update(key, action);
+	}
 }
 
 //=============================================================================
 
 void CKeyboard::Update(int key, int action)
 {
-	s_keyState[key] = (action == GLFW_PRESS) ? true : false;
+	if ((key < 0) || (key >= KB_MAX_KEYS))
+	{
+		return;
+	}
+
+	m_keyState[key] = (action == GLFW_PRESS) ? true : false;
+
+	for (uint32 index = 0; m_hostMatrix && (index < KB_MATRIX_KEYS); ++index)
+	{
+		const SMatrixKey& matrixKey = s_matrixKey[index];
+		if (matrixKey.m_key == key)
+		{
+			if (m_keyState[key])
+			{
+				m_matrix[matrixKey.m_row] |= matrixKey.m_bit;
+			}
+			else
+			{
+				m_matrix[matrixKey.m_row] &= ~matrixKey.m_bit;
+			}
+			break;
+		}
+	}
 //	if (key >= GLFW_KEY_SPECIAL)
 //	{
 //		fprintf(stderr, "key %d, %s\n", key, (action == GLFW_PRESS) ? "pressed" : "released");
@@ -44,36 +101,35 @@ void CKeyboard::Update(int key, int action)
 
 //=============================================================================
 
-bool CKeyboard::IsKeyPressed(int key)
+void CKeyboard::SetMatrix(const uint8* pMatrix)
 {
-	bool pressed = (s_keyState[key] && !s_keyPrevState[key]);
-	s_keyPrevState[key] = s_keyState[key];
-	return pressed;
+	memcpy(m_matrix, pMatrix, sizeof(m_matrix));
 }
 
 //=============================================================================
 
-bool CKeyboard::IsKeyHeld(int key)
+bool CKeyboard::IsKeyPressed(int key)
 {
-	bool held = (s_keyState[key] && s_keyPrevState[key]);
-	s_keyPrevState[key] = s_keyState[key];
-	return held;
+	bool pressed = (m_keyState[key] && !m_keyPrevState[key]);
+	m_keyPrevState[key] = m_keyState[key];
+	return pressed;
 }
 
 //=============================================================================
 
-bool CKeyboard::IsKeyDown(int key)
+bool CKeyboard::IsKeyHeld(int key)
 {
-	bool down = s_keyState[key];
-	s_keyPrevState[key] = s_keyState[key];
-	return down;
+	bool held = (m_keyState[key] && m_keyPrevState[key]);
+	m_keyPrevState[key] = m_keyState[key];
+	return held;
 }
 
 //=============================================================================
 
 void CKeyboard::ClearKey(int key)
 {
-	s_keyPrevState[key] = s_keyState[key] = false;
+	Update(key, GLFW_RELEASE);
+	m_keyPrevState[key] = false;
 }
 
 //=============================================================================
@@ -1,21 +1,63 @@
 #if !defined(__KEYBOARD_H__)
 #define __KEYBOARD_H__
 
+#include "common/platform_types.h"
+
+//=============================================================================
+// Host key state for one machine.  GLFW only has a single, context free key
+// callback, so a keyboard has to be attached to receive it; only the
+// windowed machine does that, headless ones are fed some other way.
+//
+// Alongside the raw host keys the Spectrum's 8 half rows of 5 keys are kept
+// as a matrix (one byte per half row, bit set = key down) which is only
+// touched when a key event arrives, so reading the keyboard port is cheap.
+//=============================================================================
+
 class CKeyboard
 {
 public:
-	static	void				Initialise(void);
-	static	void				Uninitialise(void);
+	enum eKeyboardConstant
+	{
+		KB_MATRIX_ROWS = 8,
+		KB_MATRIX_KEYS = 40,
+		KB_MAX_KEYS = 512
+	};
+
+	CKeyboard(void);
+
+					void				Attach(void);
+					void				Detach(void);
 
-	static	void				Update(int key, int action);
-	static	bool				IsKeyPressed(int key);
-	static	bool				IsKeyHeld(int key);
-	static	bool				IsKeyDown(int key);
-	static	void				ClearKey(int key);
+					void				Update(int key, int action);
+					bool				IsKeyPressed(int key);
+					bool				IsKeyHeld(int key);
+					bool				IsKeyDown(int key) const			{ return m_keyState[key]; }
+					void				ClearKey(int key);
+
+					const uint8*	GetMatrix(void) const			{ return m_matrix; }
+					void				SetMatrix(const uint8* pMatrix);
+					// When something else (e.g. input playback) drives the matrix, host key
+					// events only update the raw key state
+					void				SetHostMatrix(bool enable)		{ m_hostMatrix = enable; }
 
 protected:
-	static	bool				s_keyState[512];
-	static	bool				s_keyPrevState[512];
+	static	void				KeyCallback(int key, int action);
+
+	// Host key for each matrix position
+	struct SMatrixKey
+	{
+		int					m_key;
+		uint8				m_row;
+		uint8				m_bit;
+	};
+	static	const SMatrixKey	s_matrixKey[KB_MATRIX_KEYS];
+
+	static	CKeyboard*	s_pAttached;
+
+					bool				m_keyState[KB_MAX_KEYS];
+					bool				m_keyPrevState[KB_MAX_KEYS];
+					uint8				m_matrix[KB_MATRIX_ROWS];
+					bool				m_hostMatrix;
 };
 
 #endif // !defined(__KEYBOARD_H__)
@@ -0,0 +1,484 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "common/platform_types.h"
+#include "common/macros.h"
+#include "imemory.h"
+#include "z80.h"
+#include "zxspectrum.h"
+
+//=============================================================================
+// Runs the fast core (decode cache, block repeats, halt skipping and, built
+// with Z80_JIT, translated blocks) and the reference core (every instruction
+// decoded and run one at a time by Step()) side by side from the same state,
+// and stops at the first place they disagree:
+//		lockstep [-frames n] [-warmup n] [-every n] [machine arguments...]
+//
+// The machine arguments are the emulator's (e.g. tapes/zexall.sna); the
+// machine runs for the warmup frames (to load a tape, say) and then its CPU
+// and 64K address space are handed to both cores.  Each has its own copy of
+// the memory, with the ROM below 0x4000 and no paging or contention, ports
+// that read as 0xFF and an interrupt every frame.
+//
+// Each step of the fast core (which may be a whole translated block, or many
+// halts or block iterations) is matched by as many reference instructions as
+// take the same T states, then the registers, T states, port writes and any
+// memory written since the last check are compared.  With -every n that is
+// only done every n steps; a divergence is then replayed from the start,
+// checking every step, to find the instruction it started at.
+//
+// Both cores are CZ80s sharing the opcode table and the Implement* handlers;
+// they differ only in how instructions are found and run.  So this checks
+// the layers over the handlers (the decode cache, block repeats, halt
+// skipping and the JIT), but a wrong handler, flag or table entry is wrong
+// in both cores and never shows up as a divergence.  The handlers are left
+// to ZEXALL (tapes/zexall.sna) and the table's T states to
+// CZ80::AreTstatesConsistent().
+//=============================================================================
+
+#define LOCKSTEP_HISTORY (16)
+
+//=============================================================================
+
+class CLockstepMemory : public IMemory
+{
+	public:
+		CLockstepMemory(const uint8* pMemory)
+			: m_portHash(0)
+			, m_portWrites(0)
+		{
+			memcpy(m_memory, pMemory, sizeof(m_memory));
+			memset(m_generations, 0, sizeof(m_generations));
+			memset(m_written, 0, sizeof(m_written));
+		}
+
+		virtual void WriteMemory(uint16 address, uint8 byte)
+		{
+			if (address >= LM_RAM_START)
+			{
+				m_memory[address] = byte;
+				Touch(address);
+			}
+		}
+		virtual uint8 ReadMemory(uint16 address) const				{ return m_memory[address]; }
+		virtual void WritePort(uint16 address, uint8 byte)
+		{
+			m_portHash = (m_portHash ^ ((address << 8) | byte)) * 1099511628211ULL;
+			++m_portWrites;
+		}
+		virtual uint8 ReadPort(uint16 address) const					{ IGNORE_PARAMETER(address); return 0xFF; }
+		virtual const uint8* GetReadBlock(uint16 address, uint16 length) const		{ IGNORE_PARAMETER(length); return &m_memory[address]; }
+		virtual uint8* GetWriteBlock(uint16 address, uint16 length, uint32 tstates)
+		{
+			IGNORE_PARAMETER(length);
+			IGNORE_PARAMETER(tstates);
+			if (address < LM_RAM_START)
+			{
+				return NULL;
+			}
+
+			// Blocks never cross a page, so this covers all of it
+			Touch(address);
+			return &m_memory[address];
+		}
+		virtual const uint32* GetWriteGenerations(void) const	{ return m_generations; }
+
+		const uint8*	GetMemory(void) const											{ return m_memory; }
+		bool				IsWritten(uint32 page) const							{ return m_written[page] != 0; }
+		void				ClearWritten(void)												{ memset(m_written, 0, sizeof(m_written)); }
+		uint64			GetPortHash(void) const										{ return m_portHash; }
+		uint32			GetPortWrites(void) const									{ return m_portWrites; }
+
+	protected:
+		enum
+		{
+			LM_RAM_START = 0x4000
+		};
+
+		void				Touch(uint16 address)
+		{
+			++m_generations[address >> 8];
+			m_written[address >> 8] = 1;
+		}
+
+		uint8				m_memory[0x10000];
+		uint32			m_generations[256];
+		uint8				m_written[256];			// pages written since the last check
+		uint64			m_portHash;
+		uint32			m_portWrites;
+};
+
+//=============================================================================
+
+class CLockstep
+{
+	public:
+		CLockstep(const uint8* pMemory, const SZ80Registers& registers, uint32 frameTstate, uint32 tstatesPerFrame);
+		~CLockstep(void);
+
+		// Returns false at the first divergence; when checking every n steps,
+		// that is only after the n steps in which it happened
+		bool				Run(uint32 frames, uint32 every);
+
+		uint64			GetInstructions(void) const		{ return m_instructions; }
+
+	protected:
+		struct SHistory
+		{
+			SZ80Registers	m_registers;
+			uint64				m_instruction;
+		};
+
+		bool				Check(uint16 fastPC);
+		bool				CheckRegisters(void) const;
+		bool				CheckMemory(void);
+		void				Dump(uint16 fastPC) const;
+		void				OutputRegisters(const char* pName, const SZ80Registers& registers) const;
+
+		CLockstepMemory		m_fastMemory;
+		CLockstepMemory		m_referenceMemory;
+		CZ80*				m_pFast;
+		CZ80*				m_pReference;
+
+		uint32			m_tstatesPerFrame;
+		uint32			m_frameTstate;
+		uint32			m_frame;
+		uint64			m_fastTstates;
+		uint64			m_referenceTstates;
+		uint64			m_steps;
+		uint64			m_instructions;				// run by the reference core
+
+		SHistory		m_history[LOCKSTEP_HISTORY];
+		bool				m_recordHistory;
+};
+
+//=============================================================================
+
+CLockstep::CLockstep(const uint8* pMemory, const SZ80Registers& registers, uint32 frameTstate, uint32 tstatesPerFrame)
+	: m_fastMemory(pMemory)
+	, m_referenceMemory(pMemory)
+	, m_pFast(NULL)
+	, m_pReference(NULL)
+	, m_tstatesPerFrame(tstatesPerFrame)
+	, m_frameTstate(frameTstate)
+	, m_frame(0)
+	, m_fastTstates(0)
+	, m_referenceTstates(0)
+	, m_steps(0)
+	, m_instructions(0)
+	, m_recordHistory(false)
+{
+	memset(m_history, 0, sizeof(m_history));
+
+	m_pFast = new CZ80(&m_fastMemory);
+	m_pFast->SetRegisters(registers);
+
+	m_pReference = new CZ80(&m_referenceMemory);
+	m_pReference->SetEnableDecodeCache(false);
+	m_pReference->SetRegisters(registers);
+}
+
+//=============================================================================
+
+CLockstep::~CLockstep(void)
+{
+	delete m_pFast;
+	delete m_pReference;
+}
+
+//=============================================================================
+
+bool CLockstep::Run(uint32 frames, uint32 every)
+{
+	m_recordHistory = (every == 1);
+
+	while (m_frame < frames)
+	{
+		SZ80Registers registers;
+		m_pFast->GetRegisters(registers);
+		uint16 fastPC = registers.m_PC;
+		uint32 tstates = 0;
+
+		// Both take the interrupt at the same point, as the machine would
+		if (m_frameTstate >= m_tstatesPerFrame)
+		{
+			m_frameTstate -= m_tstatesPerFrame;
+			++m_frame;
+
+			tstates = m_pFast->ServiceInterrupts();
+			m_fastTstates += tstates;
+			m_referenceTstates += m_pReference->ServiceInterrupts();
+		}
+		else
+		{
+			// As the machine steps it, up to the end of the frame
+			uint32 toEvent = m_tstatesPerFrame - m_frameTstate;
+			tstates = m_pFast->SkipHalt(toEvent);
+			if (tstates == 0)
+			{
+				m_pFast->SetStepBudget(toEvent);
+				tstates = m_pFast->SingleStep();
+			}
+			m_fastTstates += tstates;
+
+			while (m_referenceTstates < m_fastTstates)
+			{
+				if (m_recordHistory)
+				{
+					SHistory& history = m_history[m_instructions % LOCKSTEP_HISTORY];
+					m_pReference->GetRegisters(history.m_registers);
+					history.m_instruction = m_instructions;
+				}
+
+				m_referenceTstates += m_pReference->SingleStep();
+				++m_instructions;
+			}
+		}
+		m_frameTstate += tstates;
+
+		if ((++m_steps % every) == 0)
+		{
+			if (!Check(fastPC))
+			{
+				return false;
+			}
+		}
+	}
+
+	SZ80Registers registers;
+	m_pFast->GetRegisters(registers);
+	return Check(registers.m_PC);
+}
+
+//=============================================================================
+
+bool CLockstep::Check(uint16 fastPC)
+{
+	bool same = true;
+
+	if (m_fastTstates != m_referenceTstates)
+	{
+		fprintf(stdout, "[Lockstep]: T states differ (fast %llu, reference %llu)\n", static_cast<unsigned long long>(m_fastTstates), static_cast<unsigned long long>(m_referenceTstates));
+		same = false;
+	}
+
+	same &= CheckRegisters();
+	same &= CheckMemory();
+
+	if ((m_fastMemory.GetPortWrites() != m_referenceMemory.GetPortWrites()) || (m_fastMemory.GetPortHash() != m_referenceMemory.GetPortHash()))
+	{
+		fprintf(stdout, "[Lockstep]: port writes differ (fast %u, reference %u)\n", m_fastMemory.GetPortWrites(), m_referenceMemory.GetPortWrites());
+		same = false;
+	}
+
+	if (!same)
+	{
+		Dump(fastPC);
+	}
+
+	return same;
+}
+
+//=============================================================================
+
+bool CLockstep::CheckRegisters(void) const
+{
+	SZ80Registers fast;
+	SZ80Registers reference;
+	m_pFast->GetRegisters(fast);
+	m_pReference->GetRegisters(reference);
+
+#define CHECK_REGISTER(_name_, _field_) \
+	if (fast._field_ != reference._field_) \
+	{ \
+		fprintf(stdout, "[Lockstep]: %s differs (fast %04X, reference %04X)\n", _name_, fast._field_, reference._field_); \
+		same = false; \
+	}
+
+	bool same = true;
+	CHECK_REGISTER("AF", m_AF);
+	CHECK_REGISTER("BC", m_BC);
+	CHECK_REGISTER("DE", m_DE);
+	CHECK_REGISTER("HL", m_HL);
+	CHECK_REGISTER("AF'", m_AFalt);
+	CHECK_REGISTER("BC'", m_BCalt);
+	CHECK_REGISTER("DE'", m_DEalt);
+	CHECK_REGISTER("HL'", m_HLalt);
+	CHECK_REGISTER("IX", m_IX);
+	CHECK_REGISTER("IY", m_IY);
+	CHECK_REGISTER("SP", m_SP);
+	CHECK_REGISTER("PC", m_PC);
+	CHECK_REGISTER("I", m_I);
+	CHECK_REGISTER("R", m_R);
+	CHECK_REGISTER("IFF1", m_IFF1);
+	CHECK_REGISTER("IFF2", m_IFF2);
+	CHECK_REGISTER("IM", m_interruptMode);
+
+#undef CHECK_REGISTER
+
+	return same;
+}
+
+//=============================================================================
+
+bool CLockstep::CheckMemory(void)
+{
+	// Only pages either core has written since the last check can differ
+	const uint8* pFast = m_fastMemory.GetMemory();
+	const uint8* pReference = m_referenceMemory.GetMemory();
+	bool same = true;
+	for (uint32 page = 0; (page < 256) && same; ++page)
+	{
+		if (m_fastMemory.IsWritten(page) || m_referenceMemory.IsWritten(page))
+		{
+			for (uint32 address = page << 8; address < ((page + 1) << 8); ++address)
+			{
+				if (pFast[address] != pReference[address])
+				{
+					fprintf(stdout, "[Lockstep]: memory at %04X differs (fast %02X, reference %02X)\n", address, pFast[address], pReference[address]);
+					same = false;
+					break;
+				}
+			}
+		}
+	}
+
+	m_fastMemory.ClearWritten();
+	m_referenceMemory.ClearWritten();
+	return same;
+}
+
+//=============================================================================
+
+void CLockstep::Dump(uint16 fastPC) const
+{
+	fprintf(stdout, "[Lockstep]: diverged in frame %u, step %llu (reference instruction %llu); the fast core's step started at %04X\n", m_frame, static_cast<unsigned long long>(m_steps),
+		static_cast<unsigned long long>(m_instructions), fastPC);
+
+	if (m_recordHistory)
+	{
+		// The last few reference instructions, with the registers before each
+		uint64 first = (m_instructions > LOCKSTEP_HISTORY) ? m_instructions - LOCKSTEP_HISTORY : 0;
+		for (uint64 instruction = first; instruction < m_instructions; ++instruction)
+		{
+			const SZ80Registers& registers = m_history[instruction % LOCKSTEP_HISTORY].m_registers;
+			uint16 address = registers.m_PC;
+			char mnemonic[64];
+			m_pReference->Decode(address, mnemonic);
+
+			char bytes[16] = "";
+			for (uint16 byte = 0; (byte < static_cast<uint16>(address - registers.m_PC)) && (byte < 4); ++byte)
+			{
+				sprintf(&bytes[byte * 3], "%02X ", m_referenceMemory.ReadMemory(registers.m_PC + byte));
+			}
+
+			fprintf(stdout, "%10llu %04X : %-12s: %-20s AF=%04X BC=%04X DE=%04X HL=%04X IX=%04X IY=%04X SP=%04X\n", static_cast<unsigned long long>(instruction), registers.m_PC, bytes, mnemonic,
+				registers.m_AF, registers.m_BC, registers.m_DE, registers.m_HL, registers.m_IX, registers.m_IY, registers.m_SP);
+		}
+	}
+
+	SZ80Registers registers;
+	m_pFast->GetRegisters(registers);
+	OutputRegisters("fast", registers);
+	m_pReference->GetRegisters(registers);
+	OutputRegisters("reference", registers);
+}
+
+//=============================================================================
+
+void CLockstep::OutputRegisters(const char* pName, const SZ80Registers& registers) const
+{
+	static const char s_flags[] = "SZ5H3PNC";
+	char flags[9];
+	for (uint32 bit = 0; bit < 8; ++bit)
+	{
+		flags[bit] = (registers.m_AF & (0x80 >> bit)) ? s_flags[bit] : '-';
+	}
+	flags[8] = 0;
+
+	fprintf(stdout, "%10s PC=%04X AF=%04X [%s] BC=%04X DE=%04X HL=%04X IX=%04X IY=%04X SP=%04X I=%02X R=%02X IFF=%d%d IM%d\n", pName, registers.m_PC, registers.m_AF, flags, registers.m_BC,
+		registers.m_DE, registers.m_HL, registers.m_IX, registers.m_IY, registers.m_SP, registers.m_I, registers.m_R, registers.m_IFF1, registers.m_IFF2, registers.m_interruptMode);
+}
+
+//=============================================================================
+
+int main(int argc, char* argv[])
+{
+	uint32 frames = 500;
+	uint32 warmup = 0;
+	uint32 every = 1;
+	std::vector<char*> machineArgs;
+	int arg = 1;
+
+	while (arg < argc)
+	{
+		if ((strcmp(argv[arg], "-frames") == 0) && (arg + 1 < argc))
+		{
+			frames = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if ((strcmp(argv[arg], "-warmup") == 0) && (arg + 1 < argc))
+		{
+			warmup = atoi(argv[arg + 1]);
+			arg += 2;
+		}
+		else if ((strcmp(argv[arg], "-every") == 0) && (arg + 1 < argc))
+		{
+			every = atoi(argv[arg + 1]);
+			every = (every > 0) ? every : 1;
+			arg += 2;
+		}
+		else
+		{
+			machineArgs.push_back(argv[arg++]);
+		}
+	}
+	uint32 machineArgCount = static_cast<uint32>(machineArgs.size());
+	machineArgs.push_back(NULL);
+
+	// The machine carries its frame buffer inline, so isn't for the stack
+	CZXSpectrum* pSpeccy = new CZXSpectrum();
+	if (!pSpeccy->InitialiseHeadless(machineArgCount, &machineArgs[0]) || !pSpeccy->RunFrames(warmup))
+	{
+		fprintf(stderr, "[Lockstep]: unable to start the machine\n");
+		delete pSpeccy;
+		return EXIT_FAILURE;
+	}
+
+	std::vector<uint8> memory(0x10000);
+	for (uint32 address = 0; address < 0x10000; ++address)
+	{
+		memory[address] = pSpeccy->ReadMemory(static_cast<uint16>(address));
+	}
+	SZ80Registers registers;
+	pSpeccy->GetRegisters(registers);
+	uint32 frameTstate = pSpeccy->GetFrameTstate();
+	uint32 tstatesPerFrame = pSpeccy->GetTstatesPerFrame();
+	delete pSpeccy;
+
+	fprintf(stdout, "[Lockstep]: running %d frames from %04X, checking every %d steps\n", frames, registers.m_PC, every);
+	CLockstep* pLockstep = new CLockstep(&memory[0], registers, frameTstate, tstatesPerFrame);
+	bool same = pLockstep->Run(frames, every);
+	if (!same && (every > 1))
+	{
+		// Everything is deterministic, so running it again checking every step
+		// finds where it started
+		fprintf(stdout, "[Lockstep]: replaying, checking every step\n");
+		delete pLockstep;
+		pLockstep = new CLockstep(&memory[0], registers, frameTstate, tstatesPerFrame);
+		pLockstep->Run(frames, 1);
+	}
+
+	if (same)
+	{
+		fprintf(stdout, "[Lockstep]: no divergence in %d frames (%llu instructions)\n", frames, static_cast<unsigned long long>(pLockstep->GetInstructions()));
+	}
+
+	delete pLockstep;
+	return same ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//=============================================================================
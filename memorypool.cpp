@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <mutex>
+
+#include "memorypool.h"
+
+//=============================================================================
+
+namespace
+{
+	// Free RAM pages are chained through their first bytes
+	struct SFreePage
+	{
+		SFreePage* m_pNext;
+	};
+
+	struct SROMImage
+	{
+		SROMImage*	m_pNext;
+		char*				m_pFileName;
+		uint8*			m_pData;
+		uint32			m_pages;
+	};
+
+	std::mutex	g_poolMutex;
+	SFreePage*	g_pFreePages = NULL;
+	SROMImage*	g_pROMImages = NULL;
+	const uint8	g_blankPage[CMemoryPool::MPC_PAGE_SIZE] = { 0 };
+}
+
+//=============================================================================
+
+uint8* CMemoryPool::AllocatePage(void)
+{
+	uint8* pPage = NULL;
+
+	{
+		std::lock_guard<std::mutex> lock(g_poolMutex);
+
+		if (g_pFreePages == NULL)
+		{
+			// Pool is dry; carve up a new slab.  Slabs are never returned to the
+			// heap, they just keep recirculating through the free list.
+			uint8* pSlab = static_cast<uint8*>(malloc(MPC_PAGE_SIZE * MPC_PAGES_PER_SLAB));
+			if (pSlab != NULL)
+			{
+				for (uint32 index = 0; index < MPC_PAGES_PER_SLAB; ++index)
+				{
+					SFreePage* pFree = reinterpret_cast<SFreePage*>(&pSlab[index * MPC_PAGE_SIZE]);
+					pFree->m_pNext = g_pFreePages;
+					g_pFreePages = pFree;
+				}
+			}
+		}
+
+		if (g_pFreePages != NULL)
+		{
+			pPage = reinterpret_cast<uint8*>(g_pFreePages);
+			g_pFreePages = g_pFreePages->m_pNext;
+		}
+	}
+
+	if (pPage != NULL)
+	{
+		memset(pPage, 0, MPC_PAGE_SIZE);
+	}
+	else
+	{
+		fprintf(stderr, "[Memory Pool]: out of memory allocating page\n");
+	}
+
+	return pPage;
+}
+
+//=============================================================================
+
+void CMemoryPool::FreePage(uint8* pPage)
+{
+	if (pPage != NULL)
+	{
+		std::lock_guard<std::mutex> lock(g_poolMutex);
+
+		SFreePage* pFree = reinterpret_cast<SFreePage*>(pPage);
+		pFree->m_pNext = g_pFreePages;
+		g_pFreePages = pFree;
+	}
+}
+
+//=============================================================================
+
+const uint8* CMemoryPool::GetROMPage(const char* fileName, uint32 page)
+{
+	std::lock_guard<std::mutex> lock(g_poolMutex);
+
+	SROMImage* pImage = g_pROMImages;
+	while ((pImage != NULL) && (strcmp(pImage->m_pFileName, fileName) != 0))
+	{
+		pImage = pImage->m_pNext;
+	}
+
+	if (pImage == NULL)
+	{
+		FILE* pFile = fopen(fileName, "rb");
+		if (pFile == NULL)
+		{
+			return NULL;
+		}
+
+		fseek(pFile, 0, SEEK_END);
+		long size = ftell(pFile);
+		fseek(pFile, 0, SEEK_SET);
+
+		// Partial pages are padded with zeroes
+		uint32 pages = (size > 0) ? static_cast<uint32>((size + MPC_PAGE_MASK) >> MPC_PAGE_SHIFT) : 0;
+		uint8* pData = (pages > 0) ? static_cast<uint8*>(calloc(pages, MPC_PAGE_SIZE)) : NULL;
+		if ((pData == NULL) || (fread(pData, size, 1, pFile) != 1))
+		{
+			fclose(pFile);
+			free(pData);
+			return NULL;
+		}
+		fclose(pFile);
+
+		pImage = new SROMImage;
+		pImage->m_pFileName = strdup(fileName);
+		pImage->m_pData = pData;
+		pImage->m_pages = pages;
+		pImage->m_pNext = g_pROMImages;
+		g_pROMImages = pImage;
+	}
+
+	return (page < pImage->m_pages) ? &pImage->m_pData[page << MPC_PAGE_SHIFT] : NULL;
+}
+
+//=============================================================================
+
+const uint8* CMemoryPool::GetBlankPage(void)
+{
+	return g_blankPage;
+}
+
+//=============================================================================
@@ -0,0 +1,42 @@
+#if !defined(__MEMORYPOOL_H__)
+#define __MEMORYPOOL_H__
+
+#include "common/platform_types.h"
+#include "common/macros.h"
+
+//=============================================================================
+// Memory is handed out in 16K pages (the granularity the Spectrum maps its
+// address space in).  RAM pages come from a process wide pool so that many
+// machines can be created and destroyed without fragmenting the heap, and ROM
+// images are loaded once and shared (read only) by every machine that uses
+// them.
+//=============================================================================
+
+class CMemoryPool
+{
+	public:
+		enum eMemoryPoolConstant
+		{
+			MPC_PAGE_SHIFT = 14,
+			MPC_PAGE_SIZE = 1 << MPC_PAGE_SHIFT,
+			MPC_PAGE_MASK = MPC_PAGE_SIZE - 1,
+			MPC_PAGES_PER_SLAB = 64
+		};
+
+		// RAM pages are returned zeroed
+		static	uint8*				AllocatePage(void);
+		static	void					FreePage(uint8* pPage);
+
+		// Returns the requested 16K page of a ROM image, loading and caching the
+		// image on first use.  Returns NULL if the file (or page) doesn't exist.
+		static	const uint8*	GetROMPage(const char* fileName, uint32 page);
+		// A shared page of zeroes for unpopulated ROM slots
+		static	const uint8*	GetBlankPage(void);
+
+	protected:
+		PREVENT_CLASS_INSTANCE();
+};
+
+//=============================================================================
+
+#endif // !defined(__MEMORYPOOL_H__)
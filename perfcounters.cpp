@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "perfcounters.h"
+
+#if defined(PERFORMANCE_COUNTERS)
+
+#include <chrono>
+
+#define PERF_SUMMARY_PERIOD (1.0)
+
+//=============================================================================
+
+const char* CPerfCounters::s_name[PF_COUNT] =
+{
+	"update",
+	"z80",
+	"scanline",
+	"render",
+	"tape",
+	"sound",
+	"display"
+};
+
+//=============================================================================
+
+CPerfCounters::CPerfCounters(void)
+	: m_periodFrames(0)
+	, m_periodStartTicks(GetTicks())
+	, m_periodStartTime(GetSeconds())
+	, m_ticksPerSecond(0.0)
+{
+	memset(&m_frame, 0, sizeof(m_frame));
+	memset(&m_lastFrame, 0, sizeof(m_lastFrame));
+	memset(&m_period, 0, sizeof(m_period));
+}
+
+//=============================================================================
+
+CPerfCounters& CPerfCounters::Get(void)
+{
+	static thread_local CPerfCounters s_counters;
+	return s_counters;
+}
+
+//=============================================================================
+
+double CPerfCounters::GetSeconds(void)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//=============================================================================
+
+void CPerfCounters::EndFrame(void)
+{
+	m_lastFrame = m_frame;
+	for (uint32 counter = 0; counter < PF_COUNT; ++counter)
+	{
+		m_period.m_ticks[counter] += m_frame.m_ticks[counter];
+		m_period.m_calls[counter] += m_frame.m_calls[counter];
+	}
+	memset(&m_frame, 0, sizeof(m_frame));
+	++m_periodFrames;
+
+	double now = GetSeconds();
+	double elapsed = now - m_periodStartTime;
+	if (elapsed >= PERF_SUMMARY_PERIOD)
+	{
+		uint64 ticks = GetTicks();
+		m_ticksPerSecond = static_cast<double>(ticks - m_periodStartTicks) / elapsed;
+
+		// Everything as milliseconds per frame
+		char summary[512];
+		int length = sprintf(summary, "[Perf]: %.1f fps |", m_periodFrames / elapsed);
+		double msPerTick = 1000.0 / (m_ticksPerSecond * m_periodFrames);
+		for (uint32 counter = 0; counter < PF_COUNT; ++counter)
+		{
+			length += sprintf(&summary[length], " %s %.3fms", s_name[counter], m_period.m_ticks[counter] * msPerTick);
+		}
+		fprintf(stdout, "%s\n", summary);
+
+		memset(&m_period, 0, sizeof(m_period));
+		m_periodFrames = 0;
+		m_periodStartTicks = ticks;
+		m_periodStartTime = now;
+	}
+}
+
+//=============================================================================
+
+#endif // defined(PERFORMANCE_COUNTERS)
@@ -0,0 +1,130 @@
+#if !defined(__PERFCOUNTERS_H__)
+#define __PERFCOUNTERS_H__
+
+#include "common/platform_types.h"
+
+// Defining PERFORMANCE_COUNTERS for the whole build (cmake
+// -DPERFORMANCE_COUNTERS=ON) times the main emulator subsystems on the host
+// and prints a rolling per frame breakdown (about once a second).  Compiles
+// to nothing when not defined.
+
+#if defined(PERFORMANCE_COUNTERS)
+
+#include <stdio.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+//=============================================================================
+// Counters are accumulated per thread (so machines running side by side on
+// worker threads don't share or contend), in raw timestamp ticks; they are
+// converted to time when the summary is printed.  Timers nest, so each
+// counter is inclusive of anything timed inside it.
+//=============================================================================
+
+enum ePerfCounter
+{
+	PF_UPDATE,
+	PF_Z80_STEP,
+	PF_SCANLINE,
+	PF_RENDER,
+	PF_TAPE,
+	PF_SOUND,
+	PF_DISPLAY,
+
+	PF_COUNT
+};
+
+struct SPerfFrame
+{
+	uint64			m_ticks[PF_COUNT];
+	uint32			m_calls[PF_COUNT];
+};
+
+class CPerfCounters
+{
+	public:
+		CPerfCounters(void);
+
+		static	CPerfCounters&	Get(void);
+
+		static	uint64	GetTicks(void)
+		{
+#if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+			return __rdtsc();
+#else
+			timespec now;
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			return (static_cast<uint64>(now.tv_sec) * 1000000000ULL) + now.tv_nsec;
+#endif
+		}
+
+		void				Add(ePerfCounter counter, uint64 ticks)
+		{
+			m_frame.m_ticks[counter] += ticks;
+			++m_frame.m_calls[counter];
+		}
+
+		// Closes the current frame's counters and prints the summary when due
+		void				EndFrame(void);
+
+		// The last complete frame, and the timestamp rate measured over the last
+		// summary period (0 until the first summary)
+		const SPerfFrame&	GetLastFrame(void) const		{ return m_lastFrame; }
+		double			GetTicksPerSecond(void) const				{ return m_ticksPerSecond; }
+
+	protected:
+		static	double	GetSeconds(void);
+
+		static	const char*	s_name[PF_COUNT];
+
+		SPerfFrame	m_frame;
+		SPerfFrame	m_lastFrame;
+		SPerfFrame	m_period;
+		uint32			m_periodFrames;
+		uint64			m_periodStartTicks;
+		double			m_periodStartTime;
+		double			m_ticksPerSecond;
+};
+
+//=============================================================================
+
+class CScopedPerfTimer
+{
+	public:
+		CScopedPerfTimer(ePerfCounter counter)
+			: m_counter(counter)
+			, m_start(CPerfCounters::GetTicks())
+		{
+		}
+
+		~CScopedPerfTimer(void)
+		{
+			CPerfCounters::Get().Add(m_counter, CPerfCounters::GetTicks() - m_start);
+		}
+
+	protected:
+		ePerfCounter	m_counter;
+		uint64				m_start;
+};
+
+#define PERF_TIMER_NAME2(_line_) perfTimer##_line_
+#define PERF_TIMER_NAME(_line_) PERF_TIMER_NAME2(_line_)
+#define PERF_SCOPE(_counter_) CScopedPerfTimer PERF_TIMER_NAME(__LINE__)(_counter_)
+#define PERF_END_FRAME() CPerfCounters::Get().EndFrame()
+
+#else
+
+#define PERF_SCOPE(_counter_)
+#define PERF_END_FRAME()
+
+#endif // defined(PERFORMANCE_COUNTERS)
+
+//=============================================================================
+
+#endif // !defined(__PERFCOUNTERS_H__)
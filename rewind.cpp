@@ -0,0 +1,254 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rewind.h"
+
+//=============================================================================
+
+CRewindBuffer::CRewindBuffer(uint32 stateSize, uint32 capacity)
+	: m_stateSize(stateSize)
+	, m_capacity(capacity)
+	, m_writePos(0)
+	, m_firstEntry(0)
+	, m_entryCount(0)
+	, m_haveLatest(false)
+{
+	m_pLatest = static_cast<uint8*>(calloc(stateSize, 1));
+	m_pCapture = static_cast<uint8*>(calloc(stateSize, 1));
+	// Worst case encoding is 3 bytes for every 2, plus region headers
+	m_pScratch = static_cast<uint8*>(malloc(stateSize * 2));
+	m_pHistory = static_cast<uint8*>(malloc(capacity));
+}
+
+//=============================================================================
+
+CRewindBuffer::~CRewindBuffer(void)
+{
+	free(m_pLatest);
+	free(m_pCapture);
+	free(m_pScratch);
+	free(m_pHistory);
+}
+
+//=============================================================================
+
+void CRewindBuffer::CommitCapture(const SRewindLayout& layout, const uint64* pDirtyBlocks)
+{
+	if (m_haveLatest)
+	{
+		uint32 size = 0;
+
+		// Everything outside RAM is small, so just compare all of it (apart from
+		// the region that isn't kept)
+		uint32 ramEnd = layout.m_ramOffset + (layout.m_ramPages * RC_BLOCKS_PER_PAGE * RC_BLOCK_SIZE);
+		uint32 skipEnd = layout.m_skipOffset + layout.m_skipSize;
+		uint32 span[3][2] = { { 0, layout.m_ramOffset }, { ramEnd, m_stateSize }, { 0, 0 } };
+		if ((layout.m_skipSize > 0) && (layout.m_skipOffset >= ramEnd))
+		{
+			span[1][1] = layout.m_skipOffset;
+			span[2][0] = skipEnd;
+			span[2][1] = m_stateSize;
+		}
+
+		for (uint32 index = 0; index < 3; ++index)
+		{
+			if (span[index][1] > span[index][0])
+			{
+				size += EncodeRegion(&m_pScratch[size], span[index][0], span[index][1] - span[index][0]);
+			}
+		}
+
+		// RAM only where it's been written to, coalescing runs of dirty blocks
+		for (uint32 page = 0; page < layout.m_ramPages; ++page)
+		{
+			uint64 dirty = pDirtyBlocks[page];
+			uint32 block = 0;
+			while (dirty != 0)
+			{
+				while ((dirty & 1) == 0)
+				{
+					dirty >>= 1;
+					++block;
+				}
+
+				uint32 first = block;
+				while (dirty & 1)
+				{
+					dirty >>= 1;
+					++block;
+				}
+
+				uint32 offset = layout.m_ramOffset + (((page * RC_BLOCKS_PER_PAGE) + first) << RC_BLOCK_SHIFT);
+				size += EncodeRegion(&m_pScratch[size], offset, (block - first) << RC_BLOCK_SHIFT);
+			}
+		}
+
+		AddEntry(m_pScratch, size);
+	}
+
+	uint8* pSwap = m_pLatest;
+	m_pLatest = m_pCapture;
+	m_pCapture = pSwap;
+	m_haveLatest = true;
+}
+
+//=============================================================================
+
+const uint8* CRewindBuffer::Rewind(uint32 steps)
+{
+	if (!m_haveLatest || (steps > m_entryCount))
+	{
+		return NULL;
+	}
+
+	// XOR deltas undo themselves, so just walk back from the latest state
+	while (steps-- > 0)
+	{
+		const SEntry& entry = m_entry[(m_firstEntry + m_entryCount - 1) % RC_MAX_ENTRIES];
+		ApplyDelta(m_pLatest, &m_pHistory[entry.m_offset], entry.m_size);
+		m_writePos = entry.m_offset;
+		--m_entryCount;
+	}
+
+	return m_pLatest;
+}
+
+//=============================================================================
+
+uint32 CRewindBuffer::GetBytesUsed(void) const
+{
+	uint32 used = 0;
+	for (uint32 index = 0; index < m_entryCount; ++index)
+	{
+		used += m_entry[(m_firstEntry + index) % RC_MAX_ENTRIES].m_size;
+	}
+
+	return used;
+}
+
+//=============================================================================
+
+uint32 CRewindBuffer::EncodeRegion(uint8* pOut, uint32 offset, uint32 size) const
+{
+	// Region header (offset and length) followed by pairs of zero run and
+	// literal counts, each literal being the XOR of the old and new byte
+	const uint8* pNew = &m_pCapture[offset];
+	const uint8* pOld = &m_pLatest[offset];
+	uint32 length = 2 * sizeof(uint32);
+	bool changed = false;
+
+	memcpy(&pOut[0], &offset, sizeof(uint32));
+	memcpy(&pOut[sizeof(uint32)], &size, sizeof(uint32));
+
+	uint32 pos = 0;
+	while (pos < size)
+	{
+		uint32 zeroes = 0;
+		while ((pos < size) && (zeroes < 255) && (pNew[pos] == pOld[pos]))
+		{
+			++zeroes;
+			++pos;
+		}
+
+		uint8* pCount = &pOut[length];
+		length += 2;
+		uint32 literals = 0;
+		while ((pos < size) && (literals < 255) && (pNew[pos] != pOld[pos]))
+		{
+			pOut[length++] = pNew[pos] ^ pOld[pos];
+			++literals;
+			++pos;
+		}
+
+		pCount[0] = static_cast<uint8>(zeroes);
+		pCount[1] = static_cast<uint8>(literals);
+		changed |= (literals > 0);
+	}
+
+	// Nothing worth recording
+	return changed ? length : 0;
+}
+
+//=============================================================================
+
+void CRewindBuffer::ApplyDelta(uint8* pState, const uint8* pDelta, uint32 size) const
+{
+	const uint8* pEnd = pDelta + size;
+	while (pDelta < pEnd)
+	{
+		uint32 offset = 0;
+		uint32 length = 0;
+		memcpy(&offset, pDelta, sizeof(uint32));
+		memcpy(&length, pDelta + sizeof(uint32), sizeof(uint32));
+		pDelta += 2 * sizeof(uint32);
+
+		uint8* pOut = &pState[offset];
+		uint32 pos = 0;
+		while (pos < length)
+		{
+			pos += *pDelta++;
+			uint32 literals = *pDelta++;
+			while (literals-- > 0)
+			{
+				pOut[pos++] ^= *pDelta++;
+			}
+		}
+	}
+}
+
+//=============================================================================
+
+void CRewindBuffer::AddEntry(const uint8* pDelta, uint32 size)
+{
+	if (size > m_capacity)
+	{
+		// Can't be kept, and the chain is broken without it
+		fprintf(stderr, "[Rewind]: %d byte delta doesn't fit in the history, discarding it all\n", size);
+		m_entryCount = 0;
+		m_writePos = 0;
+		return;
+	}
+
+	if ((m_writePos + size) > m_capacity)
+	{
+		m_writePos = 0;
+	}
+
+	// Make room by dropping the oldest history
+	if (m_entryCount == RC_MAX_ENTRIES)
+	{
+		DropOldest();
+	}
+
+	while (m_entryCount > 0)
+	{
+		const SEntry& oldest = m_entry[m_firstEntry];
+		if ((oldest.m_offset < (m_writePos + size)) && ((oldest.m_offset + oldest.m_size) > m_writePos))
+		{
+			DropOldest();
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	SEntry& entry = m_entry[(m_firstEntry + m_entryCount) % RC_MAX_ENTRIES];
+	entry.m_offset = m_writePos;
+	entry.m_size = size;
+	++m_entryCount;
+
+	memcpy(&m_pHistory[m_writePos], pDelta, size);
+	m_writePos += size;
+}
+
+//=============================================================================
+
+void CRewindBuffer::DropOldest(void)
+{
+	m_firstEntry = (m_firstEntry + 1) % RC_MAX_ENTRIES;
+	--m_entryCount;
+}
+
+//=============================================================================
@@ -0,0 +1,81 @@
+#if !defined(__REWIND_H__)
+#define __REWIND_H__
+
+#include "common/platform_types.h"
+
+//=============================================================================
+// Keeps a history of save states as a chain of deltas running backwards from
+// the most recent capture.  Each delta is the XOR of two consecutive states,
+// run length encoded, and only covers the RAM blocks the machine reports as
+// written since the previous capture (plus the small non-RAM part of the
+// state), so an idle frame costs a few bytes.  When the history fills up the
+// oldest deltas are dropped.
+//=============================================================================
+
+// Where things live in a save state, as far as the rewind buffer cares
+struct SRewindLayout
+{
+	uint32	m_ramOffset;			// RAM pages are stored contiguously from here...
+	uint32	m_ramPages;				// ...as this many 16K pages
+	uint32	m_skipOffset;			// A region that isn't worth keeping (it's
+	uint32	m_skipSize;				// regenerated on restore)
+};
+
+//=============================================================================
+
+class CRewindBuffer
+{
+	public:
+		enum eRewindConstant
+		{
+			RC_BLOCK_SHIFT = 8,
+			RC_BLOCK_SIZE = 1 << RC_BLOCK_SHIFT,
+			RC_BLOCKS_PER_PAGE = 64,	// 16K pages, so one uint64 of dirty bits per page
+			RC_MAX_ENTRIES = 16384
+		};
+
+		CRewindBuffer(uint32 stateSize, uint32 capacity);
+		~CRewindBuffer(void);
+
+		// Save the state straight into this, then commit it.  Dirty blocks are
+		// indexed by RAM page in state order.
+		uint8*			GetCaptureBuffer(void)			{ return m_pCapture; }
+		void				CommitCapture(const SRewindLayout& layout, const uint64* pDirtyBlocks);
+
+		// Rebuilds the state from the given number of captures ago (discarding
+		// everything newer).  Returns NULL if there isn't that much history.
+		const uint8*	Rewind(uint32 steps);
+
+		uint32			GetStateSize(void) const		{ return m_stateSize; }
+		uint32			GetEntryCount(void) const		{ return m_entryCount; }
+		uint32			GetBytesUsed(void) const;
+
+	protected:
+		struct SEntry
+		{
+			uint32	m_offset;
+			uint32	m_size;
+		};
+
+		uint32			EncodeRegion(uint8* pOut, uint32 offset, uint32 size) const;
+		void				ApplyDelta(uint8* pState, const uint8* pDelta, uint32 size) const;
+		void				AddEntry(const uint8* pDelta, uint32 size);
+		void				DropOldest(void);
+
+		uint32			m_stateSize;
+		uint8*			m_pLatest;		// The most recent capture in full
+		uint8*			m_pCapture;		// Where the next capture is saved
+		uint8*			m_pScratch;		// Delta being encoded
+
+		uint8*			m_pHistory;		// Ring of encoded deltas
+		uint32			m_capacity;
+		uint32			m_writePos;
+		SEntry			m_entry[RC_MAX_ENTRIES];
+		uint32			m_firstEntry;
+		uint32			m_entryCount;
+		bool				m_haveLatest;
+};
+
+//=============================================================================
+
+#endif // !defined(__REWIND_H__)
@@ -0,0 +1,111 @@
+#if !defined(__SAVESTATE_H__)
+#define __SAVESTATE_H__
+
+#include <string.h>
+
+#include "common/platform_types.h"
+
+//=============================================================================
+// Save states are written straight into a caller supplied buffer and read
+// straight back out of it, so neither direction touches the heap.  A writer
+// without a buffer just counts, which is how the size of a state is found.
+//=============================================================================
+
+class CStateWriter
+{
+	public:
+		CStateWriter(void* pBuffer, uint32 size)
+			: m_pBuffer(static_cast<uint8*>(pBuffer))
+			, m_size(size)
+			, m_pos(0)
+			, m_overflow(false)
+		{
+		}
+
+		void				Write(const void* pData, uint32 size)
+		{
+			if (m_pBuffer != NULL)
+			{
+				if ((m_pos + size) > m_size)
+				{
+					m_overflow = true;
+					return;
+				}
+				memcpy(&m_pBuffer[m_pos], pData, size);
+			}
+			m_pos += size;
+		}
+
+		template <typename T>
+		void				Write(const T& value)				{ Write(&value, sizeof(T)); }
+
+		uint8*			GetBuffer(void) const				{ return m_pBuffer; }
+		uint32			GetPosition(void) const			{ return m_pos; }
+		bool				IsValid(void) const					{ return !m_overflow; }
+
+	protected:
+		uint8*			m_pBuffer;
+		uint32			m_size;
+		uint32			m_pos;
+		bool				m_overflow;
+};
+
+//=============================================================================
+
+class CStateReader
+{
+	public:
+		CStateReader(const void* pBuffer, uint32 size)
+			: m_pBuffer(static_cast<const uint8*>(pBuffer))
+			, m_size(size)
+			, m_pos(0)
+			, m_underflow(false)
+		{
+		}
+
+		void				Read(void* pData, uint32 size)
+		{
+			if ((m_pos + size) > m_size)
+			{
+				m_underflow = true;
+				memset(pData, 0, size);
+				return;
+			}
+			memcpy(pData, &m_pBuffer[m_pos], size);
+			m_pos += size;
+		}
+
+		template <typename T>
+		void				Read(T& value)							{ Read(&value, sizeof(T)); }
+
+		uint32			GetPosition(void) const			{ return m_pos; }
+		bool				IsValid(void) const					{ return !m_underflow; }
+
+	protected:
+		const uint8*	m_pBuffer;
+		uint32			m_size;
+		uint32			m_pos;
+		bool				m_underflow;
+};
+
+//=============================================================================
+
+// Every save state starts with this; restoring checks all of it before
+// touching the machine
+struct SStateHeader
+{
+	enum eStateConstant
+	{
+		SS_MAGIC = 0x5453585A,	// 'ZXST'
+		SS_VERSION = 1
+	};
+
+	uint32			m_magic;
+	uint16			m_version;
+	uint16			m_model;
+	uint32			m_size;
+};
+
+//=============================================================================
+
+#endif // !defined(__SAVESTATE_H__)
@@ -5,6 +5,8 @@
 #include <string.h>
 
 #include "sound.h"
+#include "savestate.h"
+#include "perfcounters.h"
 
 //=============================================================================
 
@@ -18,10 +20,15 @@ static const BUFFER_TYPE g_levelLow = 0x00;
 CSound::CSound(void)
 	: m_pOpenALDevice(NULL)
 	, m_pOpenALContext(NULL)
+	, m_mixRead(0)
+	, m_mixWrite(0)
 	, m_soundCycles(0)
 	, m_currentSourceBufferIndex(0)
 	, m_sourceBufferToQueueIndex(0)
 	, m_buffersUsed(0)
+#if defined(DEBUG)
+	, m_stallTime(0)
+#endif // defined(DEBUG)
 	, m_initialised(false)
 {
 }
@@ -68,17 +75,23 @@ bool CSound::Initialise(void)
 
 void CSound::Update(uint32 tstates, float volume)
 {
-#if defined(DEBUG)
-	static uint32 stallTime = 0;
-#endif // defined(DEBUG)
+	PERF_SCOPE(PF_SOUND);
 
-	m_soundCycles += (tstates << TSTATE_BITSHIFT);
-	if (m_soundCycles >= TSTATE_FIXED_FLOATING_POINT)
+	// Normally at most one sample is due, but a skipped HALT can span many
+	m_soundCycles += (static_cast<uint64>(tstates) << TSTATE_BITSHIFT);
+	while (m_soundCycles >= TSTATE_FIXED_FLOATING_POINT)
 	{
 		m_soundCycles -= TSTATE_FIXED_FLOATING_POINT;
 
+		float mix = 0.0f;
+		if (m_mixRead != m_mixWrite)
+		{
+			mix = m_mixBuffer[m_mixRead];
+			m_mixRead = (m_mixRead + 1) & (MIX_BUFFER_SIZE - 1);
+		}
+
 		// TODO: need to fix how volume works when using 16 bit samples
-		BUFFER_TYPE data = static_cast<BUFFER_TYPE>(volume * static_cast<float>(g_levelHigh));
+		BUFFER_TYPE data = static_cast<BUFFER_TYPE>((volume + mix) * static_cast<float>(g_levelHigh));
 		if (m_source[m_currentSourceBufferIndex].AddSample(data))
 		{
 			//			printf("source buffer %d is full (full index %d)\n", m_currentSourceBufferIndex, m_fullSourceBufferIndex);
@@ -90,7 +103,7 @@ void CSound::Update(uint32 tstates, float volume)
 				//fprintf(stderr, "[Sound]: CSound::Update() all source buffers full! (%d destination buffers in use)\n", m_buffersUsed);
 				printf("[Sound]: CSound::Update() all source buffers full! (%d destination buffers in use)\n", m_buffersUsed);
 #if defined(DEBUG)
-				stallTime += tstates;
+				m_stallTime += tstates;
 #endif // defined(DEBUG)
 			}
 			else
@@ -109,10 +122,10 @@ void CSound::Update(uint32 tstates, float volume)
 			if (size > 0)
 			{
 #if defined(DEBUG)
-				if (stallTime > 0)
+				if (m_stallTime > 0)
 				{
-					fprintf(stderr, "[Sound]: CSound::Update() queueing a buffer but stalled for %d tstates\n", stallTime);
-					stallTime = 0;
+					fprintf(stderr, "[Sound]: CSound::Update() queueing a buffer but stalled for %d tstates\n", m_stallTime);
+					m_stallTime = 0;
 				}
 #endif // defined(DEBUG)
 
@@ -143,6 +156,41 @@ void CSound::Update(uint32 tstates, float volume)
 
 //=============================================================================
 
+void CSound::MixSamples(const float* pSamples, uint32 count)
+{
+	// Samples that don't fit are dropped (the beeper isn't consuming them)
+	for (uint32 index = 0; index < count; ++index)
+	{
+		uint32 next = (m_mixWrite + 1) & (MIX_BUFFER_SIZE - 1);
+		if (next == m_mixRead)
+		{
+			break;
+		}
+
+		m_mixBuffer[m_mixWrite] = pSamples[index];
+		m_mixWrite = next;
+	}
+}
+
+//=============================================================================
+
+void CSound::SaveState(CStateWriter& writer) const
+{
+	// Only the sample phase is machine state; whatever is already buffered
+	// for OpenAL just carries on playing
+	writer.Write(m_soundCycles);
+}
+
+//=============================================================================
+
+void CSound::RestoreState(CStateReader& reader)
+{
+	reader.Read(m_soundCycles);
+	m_mixRead = m_mixWrite;
+}
+
+//=============================================================================
+
 void CSound::Uninitialise(void)
 {
 	if (m_initialised)
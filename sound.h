@@ -8,6 +8,9 @@
 #include <AL/al.h>
 #include <AL/alc.h>
 
+class CStateWriter;
+class CStateReader;
+
 #define BUFFER_TYPE int8
 #define BUFFER_ELEMENT_SIZE (sizeof(BUFFER_TYPE))
 #define NUM_DESTINATION_BUFFERS (3)
@@ -34,6 +37,10 @@
 #define TSTATE_MULTIPLIER (1 << TSTATE_BITSHIFT)
 #define TSTATE_FIXED_FLOATING_POINT (TSTATE_COUNT*TSTATE_MULTIPLIER)
 
+// Samples from other sources (e.g. the AY) queued for mixing with the beeper;
+// they arrive a frame at a time so this needs to hold a couple of frames
+#define MIX_BUFFER_SIZE (4096)
+
 
 //=============================================================================
 
@@ -45,6 +52,9 @@ class CSound
 
 		bool				Initialise(void);
 		void				Update(uint32 tstates, float volume);
+		void				MixSamples(const float* pSamples, uint32 count);
+		void				SaveState(CStateWriter& writer) const;
+		void				RestoreState(CStateReader& reader);
 		void				Uninitialise(void);
 
 	protected:
@@ -90,10 +100,17 @@ class CSound
 		ALCdevice* m_pOpenALDevice;
 		ALCcontext* m_pOpenALContext;
 
+		float m_mixBuffer[MIX_BUFFER_SIZE];
+		uint32 m_mixRead;
+		uint32 m_mixWrite;
+
 		uint64 m_soundCycles;
 		uint32 m_currentSourceBufferIndex;
 		uint32 m_sourceBufferToQueueIndex;
 		uint32 m_buffersUsed;
+#if defined(DEBUG)
+		uint32 m_stallTime;
+#endif // defined(DEBUG)
 		ALuint m_alBuffer[NUM_DESTINATION_BUFFERS];
 		ALuint m_alSource;
 		bool m_bufferInUse[NUM_DESTINATION_BUFFERS];
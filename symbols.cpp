@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "symbols.h"
+
+#define MAX_SYMBOL_LINE (1024)
+
+//=============================================================================
+
+CSymbolTable::CSymbolTable(void)
+	: m_end(0)
+{
+}
+
+//=============================================================================
+
+bool CSymbolTable::LoadZX82(const char* fileName)
+{
+	FILE* pFile = fopen(fileName, "r");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[Symbols]: unable to open '%s'\n", fileName);
+		return false;
+	}
+
+	char line[MAX_SYMBOL_LINE];
+	while (fgets(line, sizeof(line), pFile) != NULL)
+	{
+		unsigned int address = 0;
+		char name[SY_MAX_NAME];
+		if (sscanf(line, "<a name=\"L%4x\"></a>;; <b>%23[^<]</b>", &address, name) == 2)
+		{
+			SSymbol symbol;
+			symbol.m_address = static_cast<uint16>(address);
+			strcpy(symbol.m_name, name);
+			m_symbols.push_back(symbol);
+		}
+	}
+	fclose(pFile);
+
+	struct SCompare
+	{
+		bool operator()(const SSymbol& lhs, const SSymbol& rhs) const { return lhs.m_address < rhs.m_address; }
+	};
+	std::stable_sort(m_symbols.begin(), m_symbols.end(), SCompare());
+	m_end = 0x4000;
+
+	fprintf(stdout, "[Symbols]: loaded %d labels from '%s'\n", GetCount(), fileName);
+	return !m_symbols.empty();
+}
+
+//=============================================================================
+
+const char* CSymbolTable::Lookup(uint16 address, uint16& offset) const
+{
+	if ((address >= m_end) || m_symbols.empty() || (address < m_symbols[0].m_address))
+	{
+		return NULL;
+	}
+
+	// Binary search for the last label at or below the address
+	uint32 low = 0;
+	uint32 high = GetCount();
+	while ((high - low) > 1)
+	{
+		uint32 middle = (low + high) >> 1;
+		if (m_symbols[middle].m_address <= address)
+		{
+			low = middle;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	offset = address - m_symbols[low].m_address;
+	return m_symbols[low].m_name;
+}
+
+//=============================================================================
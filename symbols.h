@@ -0,0 +1,45 @@
+#if !defined(__SYMBOLS_H__)
+#define __SYMBOLS_H__
+
+#include <vector>
+
+#include "common/platform_types.h"
+
+//=============================================================================
+// Address labels for annotating reports, e.g. the ROM routine names from the
+// commented 48K ROM disassembly (zx82.htm).  An address is reported relative
+// to the nearest label at or below it.
+//=============================================================================
+
+class CSymbolTable
+{
+	public:
+		CSymbolTable(void);
+
+		// Reads the <a name="Lxxxx"></a>;; <b>LABEL</b> anchors; the labels only
+		// cover the ROM
+		bool				LoadZX82(const char* fileName);
+
+		// Returns NULL if the address isn't covered
+		const char*	Lookup(uint16 address, uint16& offset) const;
+		uint32			GetCount(void) const			{ return static_cast<uint32>(m_symbols.size()); }
+
+	protected:
+		enum eSymbolConstant
+		{
+			SY_MAX_NAME = 24
+		};
+
+		struct SSymbol
+		{
+			uint16			m_address;
+			char				m_name[SY_MAX_NAME];
+		};
+
+		std::vector<SSymbol>	m_symbols;
+		uint32			m_end;
+};
+
+//=============================================================================
+
+#endif // !defined(__SYMBOLS_H__)
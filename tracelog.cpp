@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "tracelog.h"
+
+static_assert(sizeof(STraceRecord) == 20, "trace records are written as is");
+
+//=============================================================================
+
+CTraceLog::CTraceLog(void)
+	: m_pFile(NULL)
+	, m_pRing(NULL)
+	, m_tstate(0)
+	, m_recordCount(0)
+	, m_head(0)
+	, m_tail(0)
+	, m_stopWriter(false)
+{
+}
+
+//=============================================================================
+
+CTraceLog::~CTraceLog(void)
+{
+	Close();
+}
+
+//=============================================================================
+
+bool CTraceLog::Open(const char* fileName)
+{
+	Close();
+
+	m_pFile = fopen(fileName, "wb");
+	if (m_pFile == NULL)
+	{
+		fprintf(stderr, "[Trace Log]: unable to open '%s'\n", fileName);
+		return false;
+	}
+
+	uint32 magic = TL_MAGIC;
+	uint16 version = TL_VERSION;
+	uint16 recordSize = sizeof(STraceRecord);
+	fwrite(&magic, sizeof(magic), 1, m_pFile);
+	fwrite(&version, sizeof(version), 1, m_pFile);
+	fwrite(&recordSize, sizeof(recordSize), 1, m_pFile);
+
+	m_pRing = new STraceRecord[TL_RING_SIZE];
+	m_head = 0;
+	m_tail = 0;
+	m_recordCount = 0;
+	m_stopWriter = false;
+	m_writer = std::thread(&CTraceLog::WriterThread, this);
+
+	fprintf(stdout, "[Trace Log]: tracing instructions to '%s'\n", fileName);
+	return true;
+}
+
+//=============================================================================
+
+void CTraceLog::Close(void)
+{
+	if (m_writer.joinable())
+	{
+		m_stopWriter = true;
+		m_writer.join();
+	}
+
+	if (m_pFile != NULL)
+	{
+		fclose(m_pFile);
+		m_pFile = NULL;
+		fprintf(stdout, "[Trace Log]: wrote %llu instructions\n", static_cast<unsigned long long>(m_recordCount));
+	}
+
+	delete [] m_pRing;
+	m_pRing = NULL;
+}
+
+//=============================================================================
+
+void CTraceLog::WriterThread(void)
+{
+	for (;;)
+	{
+		// Read the stop flag first, so everything queued before it was set is
+		// seen below
+		bool stopping = m_stopWriter;
+		uint32 tail = m_tail.load(std::memory_order_relaxed);
+		uint32 head = m_head.load(std::memory_order_acquire);
+
+		if (head == tail)
+		{
+			if (stopping)
+			{
+				break;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
+		}
+
+		// Up to the end of the ring at most, so it's one contiguous write
+		uint32 start = tail & TL_RING_MASK;
+		uint32 count = head - tail;
+		if (count > (TL_RING_SIZE - start))
+		{
+			count = TL_RING_SIZE - start;
+		}
+
+		fwrite(&m_pRing[start], sizeof(STraceRecord), count, m_pFile);
+		m_recordCount += count;
+		m_tail.store(tail + count, std::memory_order_release);
+	}
+}
+
+//=============================================================================
@@ -0,0 +1,92 @@
+#if !defined(__TRACELOG_H__)
+#define __TRACELOG_H__
+
+#include <stdio.h>
+
+#include <atomic>
+#include <thread>
+
+#include "common/platform_types.h"
+#include "common/macros.h"
+
+//=============================================================================
+// Compact binary execution trace, for the unattended debug mode (F5) in place
+// of a line of text per instruction.  The CPU writes a fixed size record per
+// instruction into a single producer, single consumer ring buffer, and a
+// background thread writes them out:
+//		header:	'Z80T' magic, uint16 version, uint16 record size
+//		record:	STraceRecord
+// all little endian.  When the writer falls behind, the CPU waits for it
+// rather than drop records.  traceview disassembles a trace.
+//=============================================================================
+
+struct STraceRecord
+{
+	uint32			m_tstate;			// into the frame (it going backwards is a new frame)
+	uint16			m_PC;
+	uint16			m_AF;
+	uint16			m_BC;
+	uint16			m_DE;
+	uint16			m_HL;
+	uint16			m_SP;
+	uint8				m_opcode[4];	// the bytes at PC (an instruction is at most 4)
+};
+
+class CTraceLog
+{
+	public:
+		enum eTraceLogConstant
+		{
+			TL_MAGIC = 0x5430385A, // 'Z80T'
+			TL_VERSION = 1,
+			TL_RING_SIZE = 1 << 16,	// records; a power of 2
+			TL_RING_MASK = TL_RING_SIZE - 1
+		};
+
+		CTraceLog(void);
+		~CTraceLog(void);
+
+		bool				Open(const char* fileName);
+		// Writes out whatever is still queued and stops the writer
+		void				Close(void);
+		bool				IsOpen(void) const						{ return (m_pFile != NULL); }
+
+		// The owner keeps the clock, as the CPU doesn't know where it is in the
+		// frame
+		void				SetTstate(uint32 tstate)			{ m_tstate = tstate; }
+		uint32			GetTstate(void) const					{ return m_tstate; }
+
+		inline void	Record(const STraceRecord& record)
+		{
+			uint32 head = m_head.load(std::memory_order_relaxed);
+			while ((head - m_tail.load(std::memory_order_acquire)) >= TL_RING_SIZE)
+			{
+				std::this_thread::yield();
+			}
+
+			m_pRing[head & TL_RING_MASK] = record;
+			m_head.store(head + 1, std::memory_order_release);
+		}
+
+	protected:
+		void				WriterThread(void);
+
+		FILE*				m_pFile;
+		STraceRecord*	m_pRing;
+		uint32			m_tstate;
+		uint64			m_recordCount;
+
+		// Only the CPU moves the head and only the writer moves the tail; each
+		// on its own cache line
+		alignas(64) std::atomic<uint32>	m_head;
+		alignas(64) std::atomic<uint32>	m_tail;
+		std::atomic<bool>		m_stopWriter;
+		std::thread					m_writer;
+
+	private:
+		PREVENT_CLASS_COPY(CTraceLog);
+};
+
+//=============================================================================
+
+#endif // !defined(__TRACELOG_H__)
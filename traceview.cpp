@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/platform_types.h"
+#include "imemory.h"
+#include "tracelog.h"
+#include "z80.h"
+
+//=============================================================================
+// Disassembles a binary trace written in unattended debug mode (-trace), one
+// line per instruction:
+//		<frame> <T state> <PC> : <opcode bytes> : <mnemonic>  <registers>
+// Frames are counted from the start of the trace.
+//=============================================================================
+
+// Just the opcode bytes of the record being disassembled
+class CTraceMemory : public IMemory
+{
+	public:
+		CTraceMemory(void)
+			: m_pRecord(NULL)
+		{
+			memset(m_generations, 0, sizeof(m_generations));
+		}
+
+		void				SetRecord(const STraceRecord* pRecord)	{ m_pRecord = pRecord; }
+
+		virtual void WriteMemory(uint16 address, uint8 byte)	{ IGNORE_PARAMETER(address); IGNORE_PARAMETER(byte); }
+		virtual uint8 ReadMemory(uint16 address) const
+		{
+			uint16 offset = address - m_pRecord->m_PC;
+			return (offset < sizeof(m_pRecord->m_opcode)) ? m_pRecord->m_opcode[offset] : 0;
+		}
+		virtual void WritePort(uint16 address, uint8 byte)		{ IGNORE_PARAMETER(address); IGNORE_PARAMETER(byte); }
+		virtual uint8 ReadPort(uint16 address) const					{ IGNORE_PARAMETER(address); return 0xFF; }
+		virtual const uint8* GetReadBlock(uint16 address, uint16 length) const		{ IGNORE_PARAMETER(address); IGNORE_PARAMETER(length); return NULL; }
+		virtual uint8* GetWriteBlock(uint16 address, uint16 length, uint32 tstates)	{ IGNORE_PARAMETER(address); IGNORE_PARAMETER(length); IGNORE_PARAMETER(tstates); return NULL; }
+		virtual const uint32* GetWriteGenerations(void) const	{ return m_generations; }
+
+	protected:
+		const STraceRecord*	m_pRecord;
+		uint32			m_generations[256];
+};
+
+//=============================================================================
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s <trace file> [first instruction] [count]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	uint64 first = (argc > 2) ? strtoull(argv[2], NULL, 10) : 0;
+	uint64 count = (argc > 3) ? strtoull(argv[3], NULL, 10) : ~0ULL;
+
+	FILE* pFile = fopen(argv[1], "rb");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[Trace View]: unable to open '%s'\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	uint32 magic = 0;
+	uint16 version = 0;
+	uint16 recordSize = 0;
+	if ((fread(&magic, sizeof(magic), 1, pFile) != 1) || (fread(&version, sizeof(version), 1, pFile) != 1) || (fread(&recordSize, sizeof(recordSize), 1, pFile) != 1) ||
+		(magic != CTraceLog::TL_MAGIC) || (version != CTraceLog::TL_VERSION) || (recordSize != sizeof(STraceRecord)))
+	{
+		fprintf(stderr, "[Trace View]: '%s' isn't a version %d trace\n", argv[1], CTraceLog::TL_VERSION);
+		fclose(pFile);
+		return EXIT_FAILURE;
+	}
+
+	CTraceMemory memory;
+	CZ80 cpu(&memory);
+
+	STraceRecord records[4096];
+	uint64 index = 0;
+	uint32 frame = 0;
+	uint32 lastTstate = 0;
+	size_t read = 0;
+	while ((count > 0) && ((read = fread(records, sizeof(STraceRecord), sizeof(records) / sizeof(records[0]), pFile)) > 0))
+	{
+		for (size_t record = 0; (record < read) && (count > 0); ++record, ++index)
+		{
+			const STraceRecord& trace = records[record];
+			if (trace.m_tstate < lastTstate)
+			{
+				++frame;
+			}
+			lastTstate = trace.m_tstate;
+
+			if (index < first)
+			{
+				continue;
+			}
+
+			memory.SetRecord(&trace);
+			uint16 address = trace.m_PC;
+			char mnemonic[64];
+			cpu.Decode(address, mnemonic);
+
+			char bytes[16] = "";
+			uint16 length = address - trace.m_PC;
+			for (uint16 byte = 0; (byte < length) && (byte < sizeof(trace.m_opcode)); ++byte)
+			{
+				sprintf(&bytes[byte * 3], "%02X ", trace.m_opcode[byte]);
+			}
+
+			fprintf(stdout, "%6u %6u %04X : %-12s: %-20s AF=%04X BC=%04X DE=%04X HL=%04X SP=%04X\n", frame, trace.m_tstate, trace.m_PC, bytes, mnemonic, trace.m_AF, trace.m_BC, trace.m_DE, trace.m_HL, trace.m_SP);
+			--count;
+		}
+	}
+
+	fclose(pFile);
+	return EXIT_SUCCESS;
+}
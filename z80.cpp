@@ -8,6 +8,15 @@
 
 #include "z80.h"
 #include "imemory.h"
+#include "perfcounters.h"
+#include "savestate.h"
+#include "symbols.h"
+#include "tracelog.h"
+
+#if defined(Z80_PROFILER)
+#include <algorithm>
+#include <vector>
+#endif // defined(Z80_PROFILER)
 
 //=============================================================================
 // TODO:
@@ -33,9 +42,6 @@
 //	each T State is assumed to be 0.25 microseconds, based on a 4MHz clock.
 //=============================================================================
 
-static uint16 g_addressBreakpoint = 0x1024; // ED_ENTER
-static uint16 g_dataBreakpoint = 0; //0x5C3A; // ERR_NR
-
 // #define LEE_COMPATIBLE
 
 //=============================================================================
@@ -74,12 +80,28 @@ CZ80::CZ80(IMemory* pMemory)
 	, m_address(*(reinterpret_cast<uint16*>(&m_RegisterMemory[eR_Address])))
 	, m_addresshi(m_RegisterMemory[eR_Addressh])
 	, m_addresslo(m_RegisterMemory[eR_Addressl])
+	, m_MEMPTR(*(reinterpret_cast<uint16*>(&m_RegisterMemory[eR_MEMPTR])))
 	, m_pMemory(pMemory)
 	, m_enableDebug(false)
 	, m_enableUnattendedDebug(false)
 	, m_enableOutputStatus(false)
 	, m_enableBreakpoints(false)
 	, m_enableProgramFlowBreakpoints(false)
+	, m_features(0)
+	, m_pSingleStep(NULL)
+	, m_pTraceLog(NULL)
+	, m_pContention(NULL)
+	, m_contentionTableSize(0)
+	, m_contentionTstate(0)
+	, m_contentionDelay(0)
+	, m_contentionInstruction(0)
+	, m_contentionFetched(0)
+	, m_contendedSlotMask(0)
+	, m_stepBudget(0)
+	, m_stepTstates(0)
+	, m_pDecodeCache(NULL)
+	, m_pWriteGenerations(pMemory->GetWriteGenerations())
+	, m_pDecoding(NULL)
 {
 	// Easy decoding of opcodes to 16 bit registers
 	m_16BitRegisterOffset[BC] = eR_BC;
@@ -98,11 +120,37 @@ CZ80::CZ80(IMemory* pMemory)
 	m_8BitRegisterOffset[L] = eR_L;
 	m_8BitRegisterOffset[A] = eR_A;
 
+	UpdateFeatures();
+	SetEnableDecodeCache(true);
+#if defined(Z80_JIT)
+	m_pJit = new CZ80Jit(*this);
+#endif // defined(Z80_JIT)
+
+#if defined(Z80_PROFILER)
+	m_pProfileCount = static_cast<uint32*>(malloc(0x10000 * sizeof(uint32)));
+	m_pProfileTstates = static_cast<uint64*>(malloc(0x10000 * sizeof(uint64)));
+	ResetProfile();
+#endif // defined(Z80_PROFILER)
+
 	Reset();
 }
 
 //=============================================================================
 
+CZ80::~CZ80(void)
+{
+#if defined(Z80_JIT)
+	delete m_pJit;
+#endif // defined(Z80_JIT)
+	free(m_pDecodeCache);
+#if defined(Z80_PROFILER)
+	free(m_pProfileCount);
+	free(m_pProfileTstates);
+#endif // defined(Z80_PROFILER)
+}
+
+//=============================================================================
+
 void CZ80::Reset(void)
 {
 	memset(m_RegisterMemory, 0, sizeof(m_RegisterMemory));
@@ -127,30 +175,74 @@ void CZ80::Reset(void)
 	m_State.m_IFF2 = 0;
 
 	m_address = 0;
+	m_MEMPTR = 0;
 }
 
 //=============================================================================
 
-uint32 CZ80::SingleStep(void)
+template <uint32 FEATURES>
+uint32 CZ80::SingleStepWith(void)
 {
-	if (GetEnableDebug() || GetEnableUnattendedDebug())
+	if (FEATURES & ZF_TRACE)
 	{
-		if (GetEnableOutputStatus())
+		if ((m_pTraceLog != NULL) && GetEnableUnattendedDebug())
 		{
-			OutputStatus();
+			TraceInstruction();
 		}
+		else
+		{
+			if (GetEnableOutputStatus())
+			{
+				OutputStatus();
+			}
 
-		OutputInstruction(m_PC);
+			OutputInstruction(m_PC);
+		}
 	}
 
-	if (GetEnableBreakpoints() && (m_PC == g_addressBreakpoint))
+	if ((FEATURES & ZF_ADDRESS_BREAKPOINTS) && m_addressBreakpoints.IsSet(m_PC) && IsBreakpointHit(m_addressBreakpoints, m_PC))
 	{
 		HitBreakpoint("address");
 	}
 
+	if (m_pContention != NULL)
+	{
+		m_contentionDelay = 0;
+		m_contentionInstruction = m_PC;
+		m_contentionFetched = 0;
+	}
+
 	uint16 prevPC = m_PC;
 	uint16 prevSP = m_SP;
-	uint32 tstates = Step();
+	// Contention and breakpoints need every opcode fetch to go through
+	// ReadMemory(), so can't use the decode cache
+	uint32 tstates = 0;
+	if (((FEATURES & (ZF_ADDRESS_BREAKPOINTS | ZF_DATA_WATCHPOINTS | ZF_FLOW_BREAKPOINTS)) == 0) && (m_pDecodeCache != NULL) && (m_pContention == NULL))
+	{
+#if defined(Z80_JIT)
+		// A translated block runs as one step, so not while tracing
+		if (((FEATURES & ZF_TRACE) == 0) && (m_stepBudget > 0))
+		{
+			tstates = m_pJit->Run(m_PC, m_stepBudget);
+		}
+		if (tstates == 0)
+#endif // defined(Z80_JIT)
+		{
+			tstates = StepCached();
+		}
+	}
+	else
+	{
+		tstates = Step<FEATURES & ZF_FLOW_BREAKPOINTS>() + m_contentionDelay;
+	}
+	m_stepBudget = 0;
+
+#if defined(Z80_PROFILER)
+	ProfileInstruction(prevPC, tstates);
+#endif // defined(Z80_PROFILER)
+#if defined(Z80_CALL_PROFILER)
+	m_callProfiler.AddTstates(tstates);
+#endif // defined(Z80_CALL_PROFILER)
 
 //	if ((m_SP >= 0x5C00) && (m_SP <= 0x5CB5))
 //	{
@@ -165,6 +257,96 @@ uint32 CZ80::SingleStep(void)
 
 //=============================================================================
 
+void CZ80::SetEnableDecodeCache(bool set)
+{
+	if (set && (m_pDecodeCache == NULL))
+	{
+		m_pDecodeCache = static_cast<SDecodedInstruction*>(calloc(0x10000, sizeof(SDecodedInstruction)));
+	}
+	else if (!set)
+	{
+		free(m_pDecodeCache);
+		m_pDecodeCache = NULL;
+	}
+}
+
+//=============================================================================
+
+uint32 CZ80::StepCached(void)
+{
+	// An instruction is at most 4 bytes, so it lies within these two pages;
+	// if neither has been written since it was decoded, it's still valid
+	SDecodedInstruction& instruction = m_pDecodeCache[m_PC];
+	uint8 firstPage = m_PC >> 8;
+	uint8 lastPage = static_cast<uint16>(m_PC + 3) >> 8;
+
+	if ((instruction.m_handler != NULL) && (instruction.m_generation[0] == m_pWriteGenerations[firstPage]) && (instruction.m_generation[1] == m_pWriteGenerations[lastPage]))
+	{
+		PERF_SCOPE(PF_Z80_STEP);
+
+		IncrementR(instruction.m_refresh);
+		return (this->*instruction.m_handler)();
+	}
+
+	// Decode it by running it through Step(), which notes the handler it ends
+	// up at (anything that doesn't go through Dispatch() is never cached)
+	uint8 opcode = m_pMemory->ReadMemory(m_PC);
+	instruction.m_handler = NULL;
+	instruction.m_generation[0] = m_pWriteGenerations[firstPage];
+	instruction.m_generation[1] = m_pWriteGenerations[lastPage];
+	instruction.m_refresh = ((opcode == 0xCB) || (opcode == 0xDD) || (opcode == 0xED) || (opcode == 0xFD)) ? 2 : 1;
+
+	m_pDecoding = &instruction;
+	uint32 tstates = Step<0>();
+	m_pDecoding = NULL;
+
+	return tstates;
+}
+
+//=============================================================================
+
+uint32 CZ80::SkipHalt(uint32 tstates)
+{
+	// Anything watching each instruction go by needs them one at a time, as
+	// does a HALT in contended memory (every refetch is delayed differently)
+	if (m_features & (ZF_TRACE | ZF_ADDRESS_BREAKPOINTS | ZF_DATA_WATCHPOINTS))
+	{
+		return 0;
+	}
+
+	if ((m_pContention != NULL) && ((m_contendedSlotMask >> (m_PC >> 14)) & 1))
+	{
+		return 0;
+	}
+
+	if (m_pMemory->ReadMemory(m_PC) != 0x76)
+	{
+		return 0;
+	}
+
+	// Each HALT is a 4 T state M1 cycle that refreshes memory
+	uint32 count = (tstates + 3) >> 2;
+	if (count == 0)
+	{
+		count = 1;
+	}
+	IncrementR(static_cast<uint8>(count & 0x7F));
+	tstates = count << 2;
+
+#if defined(Z80_PROFILER)
+	m_pProfileCount[m_PC] += count;
+	m_pProfileTstates[m_PC] += tstates;
+	m_profileOpcodeCount[OT_NONE][0x76] += count;
+#endif // defined(Z80_PROFILER)
+#if defined(Z80_CALL_PROFILER)
+	m_callProfiler.AddTstates(tstates);
+#endif // defined(Z80_CALL_PROFILER)
+
+	return tstates;
+}
+
+//=============================================================================
+
 uint32 CZ80::ServiceInterrupts(void)
 {
 	uint32 tstates = 0;
@@ -188,6 +370,7 @@ uint32 CZ80::ServiceInterrupts(void)
 				WriteMemory(--m_SP, m_PCh);
 				WriteMemory(--m_SP, m_PCl);
 				m_PC = 0x0038;
+				m_MEMPTR = m_PC;
 				tstates = 13; // RST (11) + 2
 				break;
 			case 2:
@@ -197,6 +380,7 @@ uint32 CZ80::ServiceInterrupts(void)
 				WriteMemory(--m_SP, m_PCl);
 				m_PCl = ReadMemory(m_address++);
 				m_PCh = ReadMemory(m_address);
+				m_MEMPTR = m_PC;
 				tstates += 19;
 				break;
 			default:
@@ -204,6 +388,14 @@ uint32 CZ80::ServiceInterrupts(void)
 				HitBreakpoint("illegal interrupt mode");
 				break;
 		}
+
+#if defined(Z80_CALL_PROFILER)
+		if (tstates > 0)
+		{
+			m_callProfiler.Call(m_PC, m_SP);
+			m_callProfiler.AddTstates(tstates);
+		}
+#endif // defined(Z80_CALL_PROFILER)
 	}
 
 	return tstates;
@@ -269,6 +461,67 @@ void CZ80::LoadSNA(uint8* regs)
 
 //=============================================================================
 
+void CZ80::GetRegisters(SZ80Registers& registers) const
+{
+	registers.m_AF = m_AF;
+	registers.m_BC = m_BC;
+	registers.m_DE = m_DE;
+	registers.m_HL = m_HL;
+	registers.m_AFalt = m_AFalt;
+	registers.m_BCalt = m_BCalt;
+	registers.m_DEalt = m_DEalt;
+	registers.m_HLalt = m_HLalt;
+	registers.m_IX = m_IX;
+	registers.m_IY = m_IY;
+	registers.m_SP = m_SP;
+	registers.m_PC = m_PC;
+	registers.m_I = m_I;
+	registers.m_R = m_R;
+	registers.m_IFF1 = m_State.m_IFF1;
+	registers.m_IFF2 = m_State.m_IFF2;
+	registers.m_interruptMode = m_State.m_InterruptMode;
+}
+
+//=============================================================================
+
+void CZ80::SetRegisters(const SZ80Registers& registers)
+{
+	m_AF = registers.m_AF;
+	m_BC = registers.m_BC;
+	m_DE = registers.m_DE;
+	m_HL = registers.m_HL;
+	m_AFalt = registers.m_AFalt;
+	m_BCalt = registers.m_BCalt;
+	m_DEalt = registers.m_DEalt;
+	m_HLalt = registers.m_HLalt;
+	m_IX = registers.m_IX;
+	m_IY = registers.m_IY;
+	m_SP = registers.m_SP;
+	m_PC = registers.m_PC;
+	m_I = registers.m_I;
+	m_R = registers.m_R;
+	m_State.m_IFF1 = registers.m_IFF1 & 1;
+	m_State.m_IFF2 = registers.m_IFF2 & 1;
+	m_State.m_InterruptMode = registers.m_interruptMode & 3;
+}
+
+//=============================================================================
+
+void CZ80::SaveState(CStateWriter& writer) const
+{
+	// Every register (and the processor state) lives in register memory
+	writer.Write(m_RegisterMemory, sizeof(m_RegisterMemory));
+}
+
+//=============================================================================
+
+void CZ80::RestoreState(CStateReader& reader)
+{
+	reader.Read(m_RegisterMemory, sizeof(m_RegisterMemory));
+}
+
+//=============================================================================
+
 bool CZ80::GetEnableDebug(void) const
 {
  	return m_enableDebug;
@@ -279,6 +532,7 @@ bool CZ80::GetEnableDebug(void) const
 void CZ80::SetEnableDebug(bool set)
 {
  	m_enableDebug = set;
+	UpdateFeatures();
 	fprintf(stderr, "[Z80] Turning %s debug mode\n", (m_enableDebug) ? "on" : "off");
 	if (m_enableDebug)
 	{
@@ -306,6 +560,7 @@ bool CZ80::GetEnableUnattendedDebug(void) const
 void CZ80::SetEnableUnattendedDebug(bool set)
 {
  	m_enableUnattendedDebug = set;
+	UpdateFeatures();
 	fprintf(stderr, "[Z80] Turning %s unattended debug mode\n", (m_enableUnattendedDebug) ? "on" : "off");
 }
 
@@ -340,6 +595,7 @@ bool CZ80::GetEnableBreakpoints(void) const
 void CZ80::SetEnableBreakpoints(bool set)
 {
  	m_enableBreakpoints = set;
+	UpdateFeatures();
 	fprintf(stderr, "[Z80] Enable breakpoints %s\n", (m_enableBreakpoints) ? "on" : "off");
 	if (!m_enableBreakpoints && GetEnableProgramFlowBreakpoints())
 	{
@@ -359,6 +615,7 @@ bool CZ80::GetEnableProgramFlowBreakpoints(void) const
 void CZ80::SetEnableProgramFlowBreakpoints(bool set)
 {
  	m_enableProgramFlowBreakpoints = set;
+	UpdateFeatures();
 	fprintf(stderr, "[Z80] Enable program flow breakpoints %s\n", (m_enableProgramFlowBreakpoints) ? "on" : "off");
 }
 
@@ -366,8 +623,8 @@ void CZ80::SetEnableProgramFlowBreakpoints(bool set)
 
 void CZ80::OutputStatus(void) const
 {
-	bool breakpointsEnabled = m_enableBreakpoints;
-	m_enableBreakpoints = false;
+	uint32 features = m_features;
+	m_features &= ~ZF_DATA_WATCHPOINTS;
 
 	fprintf(stdout, "--------\n");
 #if defined(LEE_COMPATIBLE)
@@ -394,15 +651,15 @@ void CZ80::OutputStatus(void) const
 #endif
 	fprintf(stdout, "--------\n");
 
-	m_enableBreakpoints = breakpointsEnabled;
+	m_features = features;
 }
 
 //=============================================================================
 
 void CZ80::OutputInstruction(uint16 address) const
 {
-	bool breakpointsEnabled = m_enableBreakpoints;
-	m_enableBreakpoints = false;
+	uint32 features = m_features;
+	m_features &= ~ZF_DATA_WATCHPOINTS;
 
 	uint16 decodeAddress = address;
 	char buffer[64];
@@ -449,7 +706,28 @@ void CZ80::OutputInstruction(uint16 address) const
 	}
 #endif
 
-	m_enableBreakpoints = breakpointsEnabled;
+	m_features = features;
+}
+
+//=============================================================================
+
+void CZ80::TraceInstruction(void) const
+{
+	// Straight from memory, so as not to trip watchpoints
+	STraceRecord record;
+	record.m_tstate = m_pTraceLog->GetTstate();
+	record.m_PC = m_PC;
+	record.m_AF = m_AF;
+	record.m_BC = m_BC;
+	record.m_DE = m_DE;
+	record.m_HL = m_HL;
+	record.m_SP = m_SP;
+	for (uint32 index = 0; index < sizeof(record.m_opcode); ++index)
+	{
+		record.m_opcode[index] = m_pMemory->ReadMemory(m_PC + index);
+	}
+
+	m_pTraceLog->Record(record);
 }
 
 //=============================================================================
@@ -469,11041 +747,1652 @@ void CZ80::HitBreakpoint(const char* type) const
 			m_enableUnattendedDebug = false;
 		}
 		m_enableDebug = true;
+		UpdateFeatures();
 	}
 }
 
 //=============================================================================
 
-void CZ80::HandleIllegalOpcode(void) const
+void CZ80::UpdateFeatures(void) const
 {
-	OutputStatus();
-	exit(EXIT_FAILURE);
+	static const StepFunction s_singleStep[ZF_COMBINATIONS] =
+	{
+		&CZ80::SingleStepWith<0>,		&CZ80::SingleStepWith<1>,		&CZ80::SingleStepWith<2>,		&CZ80::SingleStepWith<3>,
+		&CZ80::SingleStepWith<4>,		&CZ80::SingleStepWith<5>,		&CZ80::SingleStepWith<6>,		&CZ80::SingleStepWith<7>,
+		&CZ80::SingleStepWith<8>,		&CZ80::SingleStepWith<9>,		&CZ80::SingleStepWith<10>,	&CZ80::SingleStepWith<11>,
+		&CZ80::SingleStepWith<12>,	&CZ80::SingleStepWith<13>,	&CZ80::SingleStepWith<14>,	&CZ80::SingleStepWith<15>
+	};
+
+	m_features = 0;
+	if (m_enableDebug || m_enableUnattendedDebug)
+	{
+		m_features |= ZF_TRACE;
+	}
+	if (m_enableBreakpoints)
+	{
+		// Program flow breakpoints only fire while breakpoints are enabled
+		m_features |= ZF_ADDRESS_BREAKPOINTS | ZF_DATA_WATCHPOINTS;
+		if (m_enableProgramFlowBreakpoints)
+		{
+			m_features |= ZF_FLOW_BREAKPOINTS;
+		}
+	}
+
+	m_pSingleStep = s_singleStep[m_features];
 }
 
 //=============================================================================
 
-uint32 CZ80::Step(void)
+#if defined(Z80_PROFILER)
+void CZ80::ResetProfile(void)
 {
-	IncrementR(1);
-	switch (ReadMemory(m_PC))
-	{
-		case 0x00:
-			return ImplementNOP();
-			break;
+	memset(m_pProfileCount, 0, 0x10000 * sizeof(uint32));
+	memset(m_pProfileTstates, 0, 0x10000 * sizeof(uint64));
+	memset(m_profileOpcodeCount, 0, sizeof(m_profileOpcodeCount));
+}
 
-		case 0x10:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementDJNZe();
-			break;
+//=============================================================================
 
-		case 0x20:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementJRNZe();
-			break;
+void CZ80::ProfileInstruction(uint16 address, uint32 tstates)
+{
+	++m_pProfileCount[address];
+	m_pProfileTstates[address] += tstates;
 
-		case 0x30:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementJRNCe();
-			break;
+	// The opcode is read back after it has run (straight from memory, so
+	// there's no contention); only self modifying code would notice
+	uint8 opcode = 0;
+	eOpcodeTable table = FindOpcode(address, opcode);
+	++m_profileOpcodeCount[table][opcode];
+}
 
-		case 0x01: // LD BC,nn
-		case 0x11: // LD DE,nn
-		case 0x21: // LD HL,nn
-		case 0x31: // LD SP,nn
-			return ImplementLDddnn();
-			break;
+//=============================================================================
 
-		case 0x02:
-			return ImplementLD_BC_A();
-			break;
+void CZ80::WriteProfile(FILE* pFile, const CSymbolTable* pSymbols, uint32 maxHotspots) const
+{
+	struct SHotter
+	{
+		SHotter(const uint64* pTstates) : m_pTstates(pTstates) {}
+		bool operator()(uint32 lhs, uint32 rhs) const { return m_pTstates[lhs] > m_pTstates[rhs]; }
+		const uint64* m_pTstates;
+	};
+
+	uint64 totalTstates = 0;
+	uint64 totalCount = 0;
+	std::vector<uint32> addresses;
+	for (uint32 address = 0; address < 0x10000; ++address)
+	{
+		if (m_pProfileCount[address] > 0)
+		{
+			addresses.push_back(address);
+			totalTstates += m_pProfileTstates[address];
+			totalCount += m_pProfileCount[address];
+		}
+	}
+	std::sort(addresses.begin(), addresses.end(), SHotter(m_pProfileTstates));
 
-		case 0x12:
-			return ImplementLD_DE_A();
-			break;
+	fprintf(pFile, "Z80 profile: %llu instructions, %llu T states, %u addresses executed\n\n", static_cast<unsigned long long>(totalCount), static_cast<unsigned long long>(totalTstates), static_cast<uint32>(addresses.size()));
+	fprintf(pFile, "  %%time    T states       count  address  label                         instruction\n");
 
-		case 0x22:
-			return ImplementLD_nn_HL();
-			break;
+	// Decoding reads memory through the CPU, which mustn't trip breakpoints
+	uint32 features = m_features;
+	m_features &= ~ZF_DATA_WATCHPOINTS;
 
-		case 0x32:
-			return ImplementLD_nn_A();
-			break;
+	for (uint32 index = 0; (index < addresses.size()) && (index < maxHotspots); ++index)
+	{
+		uint16 address = static_cast<uint16>(addresses[index]);
+		char label[64] = "";
+		uint16 offset = 0;
+		const char* pName = (pSymbols != NULL) ? pSymbols->Lookup(address, offset) : NULL;
+		if (pName != NULL)
+		{
+			sprintf(label, (offset > 0) ? "%s+%d" : "%s", pName, offset);
+		}
 
-		case 0x03: // INC BC
-		case 0x13: // INC DE
-		case 0x23: // INC HL
-		case 0x33: // INC SP
-			return ImplementINCdd();
-			break;
+		char mnemonic[64];
+		uint16 decodeAddress = address;
+		Decode(decodeAddress, mnemonic);
 
-		case 0x04: // INC B
-		case 0x14: // INC D
-		case 0x24: // INC H
-		case 0x0C: // INC C
-		case 0x1C: // INC E
-		case 0x2C: // INC L
-		case 0x3C: // INC A
-			return ImplementINCr();
-			break;
+		double percent = (totalTstates > 0) ? (100.0 * m_pProfileTstates[address]) / totalTstates : 0.0;
+		fprintf(pFile, "%7.2f %11llu %11u     %04X  %-28s  %s\n", percent, static_cast<unsigned long long>(m_pProfileTstates[address]), m_pProfileCount[address], address, label, mnemonic);
+	}
 
-		case 0x34:
-			return ImplementINC_HL_();
-			break;
+	m_features = features;
 
-		case 0x05: // DEC B
-		case 0x15: // DEC D
-		case 0x25: // DEC H
-		case 0x0D: // DEC C
-		case 0x1D: // DEC E
-		case 0x2D: // DEC L
-		case 0x3D: // DEC A
-			return ImplementDECr();
-			break;
+	static const char* s_prefixName[OT_COUNT] = { "", "CB ", "ED ", "DD ", "FD ", "DD CB ", "FD CB " };
+	fprintf(pFile, "\nOpcode counts:\n");
+	for (uint32 prefix = 0; prefix < OT_COUNT; ++prefix)
+	{
+		for (uint32 opcode = 0; opcode < 256; ++opcode)
+		{
+			if (m_profileOpcodeCount[prefix][opcode] > 0)
+			{
+				fprintf(pFile, "  %s%02X %u\n", s_prefixName[prefix], opcode, m_profileOpcodeCount[prefix][opcode]);
+			}
+		}
+	}
+}
 
-		case 0x35:
-			return ImplementDEC_HL_();
-			break;
+//=============================================================================
+#endif // defined(Z80_PROFILER)
 
-		case 0x06: // LD B,n
-		case 0x16: // LD D,n
-		case 0x26: // LD H,n
-		case 0x0E: // LD C,n
-		case 0x1E: // LD E,n
-		case 0x2E: // LD L,n
-		case 0x3E: // LD A,n
-			return ImplementLDrn();
-			break;
+//=============================================================================
 
-		case 0x36:
-			return ImplementLD_HL_n();
-			break;
+void CZ80::HandleIllegalOpcode(void) const
+{
+	OutputStatus();
+	exit(EXIT_FAILURE);
+}
 
-		case 0x07:
-			return ImplementRLCA();
-			break;
+//=============================================================================
 
-		case 0x17:
-			return ImplementRLA();
-			break;
+template <uint32 FEATURES>
+uint32 CZ80::Step(void)
+{
+	PERF_SCOPE(PF_Z80_STEP);
 
-		case 0x27:
-			return ImplementDAA();
-			break;
+	// Each prefix is an M1 cycle of its own, except the CB of DD CB d op and
+	// FD CB d op (where the opcode comes after the displacement)
+	IncrementR(1);
+	const SOpcode* pOpcode = &s_opcode[OT_NONE][ReadMemory(m_PC)];
+	uint16 opcodeBytes = 1;
+	if (pOpcode->m_flags & OF_PREFIX)
+	{
+		IncrementR(1);
+		pOpcode = &s_opcode[pOpcode->m_table][ReadMemory(m_PC + 1)];
+		opcodeBytes = 2;
+		if (pOpcode->m_flags & OF_PREFIX)
+		{
+			pOpcode = &s_opcode[pOpcode->m_table][ReadMemory(m_PC + 3)];
+			opcodeBytes = 4;
+		}
+	}
 
-		case 0x37:
-			return ImplementSCF();
-			break;
+	if ((FEATURES & ZF_FLOW_BREAKPOINTS) && (pOpcode->m_flags & OF_FLOW))
+	{
+		HitBreakpoint("program flow");
+	}
 
-		case 0x08:
-			return ImplementEXAFAF();
-			break;
+	if (pOpcode->m_handler == NULL)
+	{
+		fprintf(stderr, "[Z80] Unhandled opcode");
+		for (uint16 byte = 0; byte < opcodeBytes; ++byte)
+		{
+			fprintf(stderr, " %02X", ReadMemory(m_PC + byte));
+		}
+		fprintf(stderr, " at address %04X\n", m_PC);
+		HandleIllegalOpcode();
+		return 0;
+	}
 
-		case 0x18:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementJRe();
-			break;
+	return Dispatch(pOpcode->m_handler);
+}
 
-		case 0x28:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementJRZe();
-			break;
+//=============================================================================
 
-		case 0x38:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementJRCe();
-			break;
+void CZ80::Decode(uint16& address, char* pMnemonic) const
+{
+	// The operands follow the opcode, apart from the displacement of DD CB d op
+	// and FD CB d op
+	const SOpcode* pOpcode = &s_opcode[OT_NONE][ReadMemory(address)];
+	uint16 opcodeBytes = 1;
+	uint16 operand = address + 1;
+	if (pOpcode->m_flags & OF_PREFIX)
+	{
+		pOpcode = &s_opcode[pOpcode->m_table][ReadMemory(address + 1)];
+		opcodeBytes = 2;
+		operand = address + 2;
+		if (pOpcode->m_flags & OF_PREFIX)
+		{
+			pOpcode = &s_opcode[pOpcode->m_table][ReadMemory(address + 3)];
+			opcodeBytes = 4;
+		}
+	}
 
-		case 0x09: // ADD HL,BC
-		case 0x19: // ADD HL,DE
-		case 0x29: // ADD HL,HL
-		case 0x39: // ADD HL,SP
-			return ImplementADDHLdd();
-			break;
+	if (pOpcode->m_handler == NULL)
+	{
+		fprintf(stderr, "[Z80] Error decoding unhandled opcode");
+		for (uint16 byte = 0; byte < opcodeBytes; ++byte)
+		{
+			fprintf(stderr, " %02X", ReadMemory(address + byte));
+		}
+		fprintf(stderr, " at address %04X\n", address);
+		HandleIllegalOpcode();
+		return;
+	}
 
-		case 0x0A:
-			return ImplementLDA_BC_();
-			break;
+	address += pOpcode->m_length;
+	for (const char* pTemplate = pOpcode->m_pMnemonic; *pTemplate != 0; ++pTemplate)
+	{
+		if (*pTemplate != '{')
+		{
+			*pMnemonic++ = *pTemplate;
+			continue;
+		}
 
-		case 0x1A:
-			return ImplementLDA_DE_();
-			break;
+		if (pTemplate[1] == 'e')
+		{
+#if defined(LEE_COMPATIBLE)
+			pMnemonic += sprintf(pMnemonic, "%02X", ReadMemory(operand));
+#else
+			pMnemonic += sprintf(pMnemonic, "%04X", static_cast<uint16>(address + static_cast<int8>(ReadMemory(operand))));
+#endif
+			++operand;
+		}
+		else if (pTemplate[2] == 'n')
+		{
+			// {nn}
+			pMnemonic += sprintf(pMnemonic, "%04X", ReadMemory(operand) + (ReadMemory(operand + 1) << 8));
+			operand += 2;
+		}
+		else
+		{
+			// {n} or {d}
+			pMnemonic += sprintf(pMnemonic, "%02X", ReadMemory(operand));
+			++operand;
+		}
+		pTemplate = strchr(pTemplate, '}');
+	}
+	*pMnemonic = 0;
+}
 
-		case 0x2A:
-			return ImplementLDHL_nn_();
-			break;
+//=============================================================================
 
-		case 0x3A:
-			return ImplementLDA_nn_();
-			break;
+CZ80::eOpcodeTable CZ80::FindOpcode(uint16 address, uint8& opcode) const
+{
+	eOpcodeTable table = OT_NONE;
+	opcode = m_pMemory->ReadMemory(address);
+	if (s_opcode[table][opcode].m_flags & OF_PREFIX)
+	{
+		table = static_cast<eOpcodeTable>(s_opcode[table][opcode].m_table);
+		opcode = m_pMemory->ReadMemory(address + 1);
+		if (s_opcode[table][opcode].m_flags & OF_PREFIX)
+		{
+			table = static_cast<eOpcodeTable>(s_opcode[table][opcode].m_table);
+			opcode = m_pMemory->ReadMemory(address + 3);
+		}
+	}
+	return table;
+}
 
-		case 0x0B: // DEC BC
-		case 0x1B: // DEC DE
-		case 0x2B: // DEC HL
-		case 0x3B: // DEC SP
-			return ImplementDECdd();
-			break;
+//=============================================================================
 
-		case 0x0F:
-			return ImplementRRCA();
-			break;
+// Plain 64K of RAM for AreTstatesConsistent() to run handlers in
+class CScratchMemory : public IMemory
+{
+	public:
+		CScratchMemory(void)																		{ memset(m_memory, 0, sizeof(m_memory)); memset(m_generation, 0, sizeof(m_generation)); }
+		virtual ~CScratchMemory(void)																{}
 
-		case 0x1F:
-			return ImplementRRA();
-			break;
+		virtual void WriteMemory(uint16 address, uint8 byte)					{ m_memory[address] = byte; }
+		virtual uint8 ReadMemory(uint16 address) const								{ return m_memory[address]; }
+		virtual void WritePort(uint16 address, uint8 byte)						{ (void)address; (void)byte; }
+		virtual uint8 ReadPort(uint16 address) const									{ (void)address; return 0xFF; }
+		virtual const uint8* GetReadBlock(uint16 address, uint16 length) const	{ (void)address; (void)length; return NULL; }
+		virtual uint8* GetWriteBlock(uint16 address, uint16 length, uint32 tstates)	{ (void)address; (void)length; (void)tstates; return NULL; }
+		virtual const uint32* GetWriteGenerations(void) const					{ return m_generation; }
 
-		case 0x2F:
-			return ImplementCPL();
-			break;
+	private:
+		uint8		m_memory[0x10000];
+		uint32	m_generation[256];
+};
 
-		case 0x3F:
-			return ImplementCCF();
-			break;
+//=============================================================================
 
-		case 0x40: // LD B,B
-		case 0x41: // LD B,C
-		case 0x42: // LD B,D
-		case 0x43: // LD B,E
-		case 0x44: // LD B,H
-		case 0x45: // LD B,L
-		case 0x47: // LD B,A
-		case 0x50: // LD D,B
-		case 0x51: // LD D,C
-		case 0x52: // LD D,D
-		case 0x53: // LD D,E
-		case 0x54: // LD D,H
-		case 0x55: // LD D,L
-		case 0x57: // LD D,A
-		case 0x60: // LD H,B
-		case 0x61: // LD H,C
-		case 0x62: // LD H,D
-		case 0x63: // LD H,E
-		case 0x64: // LD H,H
-		case 0x65: // LD H,L
-		case 0x67: // LD H,A
-		case 0x48: // LD C,B
-		case 0x49: // LD C,C
-		case 0x4A: // LD C,D
-		case 0x4B: // LD C,E
-		case 0x4C: // LD C,H
-		case 0x4D: // LD C,L
-		case 0x4F: // LD C,A
-		case 0x58: // LD E,B
-		case 0x59: // LD E,C
-		case 0x5A: // LD E,D
-		case 0x5B: // LD E,E
-		case 0x5C: // LD E,H
-		case 0x5D: // LD E,L
-		case 0x5F: // LD E,A
-		case 0x68: // LD L,B
-		case 0x69: // LD L,C
-		case 0x6A: // LD L,D
-		case 0x6B: // LD L,E
-		case 0x6C: // LD L,H
-		case 0x6D: // LD L,L
-		case 0x6F: // LD L,A
-		case 0x78: // LD A,B
-		case 0x79: // LD A,C
-		case 0x7A: // LD A,D
-		case 0x7B: // LD A,E
-		case 0x7C: // LD A,H
-		case 0x7D: // LD A,L
-		case 0x7F: // LD A,A
-			return ImplementLDrr();
-			break;
+bool CZ80::AreTstatesConsistent(void)
+{
+	// The prefix bytes (and DD CB / FD CB displacement) before the opcode in
+	// each table
+	static const uint8 s_prefix[OT_COUNT][3] = { { 0 }, { 0xCB }, { 0xED }, { 0xDD }, { 0xFD }, { 0xDD, 0xCB, 0x00 }, { 0xFD, 0xCB, 0x00 } };
+	static const uint8 s_prefixLength[OT_COUNT] = { 0, 1, 1, 1, 1, 3, 3 };
+	// Every flag clear and every flag set, with B and then BC running out,
+	// takes every conditional instruction both ways (A isn't 0, so CPIR and
+	// the rest never find the 0s in memory)
+	static const uint16 s_AF[4] = { 0x5500, 0x5500, 0x55FF, 0x55FF };
+	static const uint16 s_BC[4] = { 0x0101, 0x0001, 0x0101, 0x0001 };
 
-		case 0x46: // LD B,(HL)
-		case 0x56: // LD D,(HL)
-		case 0x66: // LD H,(HL)
-		case 0x4E: // LD C,(HL)
-		case 0x5E: // LD E,(HL)
-		case 0x6E: // LD L,(HL)
-		case 0x7E: // LD A,(HL)
-			return ImplementLDr_HL_();
-			break;
+	CScratchMemory* pMemory = new CScratchMemory;
+	CZ80* pCPU = new CZ80(pMemory);
+	bool consistent = true;
 
-		case 0x70: // LD (HL),B
-		case 0x71: // LD (HL),C
-		case 0x72: // LD (HL),D
-		case 0x73: // LD (HL),E
-		case 0x74: // LD (HL),H
-		case 0x75: // LD (HL),L
-		case 0x77: // LD (HL),A
-			return ImplementLD_HL_r();
-			break;
+	for (uint32 table = OT_NONE; table < OT_COUNT; ++table)
+	{
+		for (uint32 opcode = 0; opcode < 256; ++opcode)
+		{
+			const SOpcode& entry = s_opcode[table][opcode];
+			if (entry.m_handler == NULL)
+			{
+				continue;
+			}
 
-		case 0x76:
-			return ImplementHALT();
-			break;
+			bool matched = true;
+			bool seenNotTaken = false;
+			bool seenTaken = false;
+			for (uint32 setup = 0; setup < 4; ++setup)
+			{
+				SZ80Registers registers;
+				memset(&registers, 0, sizeof(registers));
+				registers.m_AF = s_AF[setup];
+				registers.m_BC = s_BC[setup];
+				registers.m_HL = registers.m_IX = registers.m_IY = 0x9000;
+				registers.m_SP = 0xC000;
+				registers.m_PC = 0x8000;
+				pCPU->SetRegisters(registers);
+
+				for (uint32 byte = 0; byte < 4; ++byte)
+				{
+					pMemory->WriteMemory(0x8000 + byte, (byte < s_prefixLength[table]) ? s_prefix[table][byte] : 0);
+				}
+				pMemory->WriteMemory(0x8000 + s_prefixLength[table], opcode);
+
+				uint32 tstates = (pCPU->*entry.m_handler)();
+				seenNotTaken |= (tstates == entry.m_tstates);
+				seenTaken |= (tstates == entry.m_takenTstates);
+				if ((tstates != entry.m_tstates) && (tstates != entry.m_takenTstates))
+				{
+					fprintf(stderr, "[Z80] %s takes %u T states, not the %u (or %u) in the opcode table\n", entry.m_pMnemonic, tstates, entry.m_tstates, entry.m_takenTstates);
+					matched = false;
+					break;
+				}
+			}
 
-		case 0x80: // ADD A,B
-		case 0x81: // ADD A,C
-		case 0x82: // ADD A,D
-		case 0x83: // ADD A,E
-		case 0x84: // ADD A,H
-		case 0x85: // ADD A,L
-		case 0x87: // ADD A,A
-			return ImplementADDAr();
-			break;
-
-		case 0x86:
-			return ImplementADDA_HL_();
-			break;
-
-		case 0x90: // SUB A,B
-		case 0x91: // SUB A,C
-		case 0x92: // SUB A,D
-		case 0x93: // SUB A,E
-		case 0x94: // SUB A,H
-		case 0x95: // SUB A,L
-		case 0x97: // SUB A,A
-			return ImplementSUBr();
-			break;
-
-		case 0x96:
-			return ImplementSUB_HL_();
-			break;
-
-		case 0xA0: // AND A,B
-		case 0xA1: // AND A,C
-		case 0xA2: // AND A,D
-		case 0xA3: // AND A,E
-		case 0xA4: // AND A,H
-		case 0xA5: // AND A,L
-		case 0xA7: // AND A,A
-			return ImplementANDr();
-			break;
-
-		case 0xA6:
-			return ImplementAND_HL_();
-			break;
-
-		case 0xB0: // OR A,B
-		case 0xB1: // OR A,C
-		case 0xB2: // OR A,D
-		case 0xB3: // OR A,E
-		case 0xB4: // OR A,H
-		case 0xB5: // OR A,L
-		case 0xB7: // OR A,A
-			return ImplementORr();
-			break;
-
-		case 0xB6:
-			return ImplementOR_HL_();
-			break;
-
-		case 0x88: // ADC A,B
-		case 0x89: // ADC A,C
-		case 0x8A: // ADC A,D
-		case 0x8B: // ADC A,E
-		case 0x8C: // ADC A,H
-		case 0x8D: // ADC A,L
-		case 0x8F: // ADC A,A
-			return ImplementADCAr();
-			break;
-
-		case 0x8E:
-			return ImplementADCA_HL_();
-			break;
-
-		case 0x98: // SBC A,B
-		case 0x99: // SBC A,C
-		case 0x9A: // SBC A,D
-		case 0x9B: // SBC A,E
-		case 0x9C: // SBC A,H
-		case 0x9D: // SBC A,L
-		case 0x9F: // SBC A,A
-			return ImplementSBCAr();
-			break;
-
-		case 0x9E:
-			return ImplementSBCA_HL_();
-			break;
-
-		case 0xA8: // XOR A,B
-		case 0xA9: // XOR A,C
-		case 0xAA: // XOR A,D
-		case 0xAB: // XOR A,E
-		case 0xAC: // XOR A,H
-		case 0xAD: // XOR A,L
-		case 0xAF: // XOR A,A
-			return ImplementXORr();
-			break;
-
-		case 0xAE:
-			return ImplementXOR_HL_();
-			break;
-
-		case 0xB8: // CP A,B
-		case 0xB9: // CP A,C
-		case 0xBA: // CP A,D
-		case 0xBB: // CP A,E
-		case 0xBC: // CP A,H
-		case 0xBD: // CP A,L
-		case 0xBF: // CP A,A
-			return ImplementCPr();
-			break;
-
-		case 0xBE:
-			return ImplementCP_HL_();
-			break;
-
-		case 0xC0: // RET NZ
-		case 0xD0: // RET NC
-		case 0xE0: // RET PO
-		case 0xF0: // RET P
-		case 0xC8: // RET Z
-		case 0xD8: // RET C
-		case 0xE8: // RET PE
-		case 0xF8: // RET M
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementRETcc();
-			break;
-
-		case 0xC1: // POP BC
-		case 0xD1: // POP DE
-		case 0xE1: // POP HL
-			return ImplementPOPqq();
-			break;
-
-		case 0xF1: // POP AF
-			return ImplementPOPAF();
-			break;
-
-		case 0xC2: // JP NZ,nn
-		case 0xD2: // JP NC,nn
-		case 0xE2: // JP PO,nn
-		case 0xF2: // JP P,nn
-		case 0xCA: // JP Z,nn
-		case 0xDA: // JP C,nn
-		case 0xEA: // JP PE,nn
-		case 0xFA: // JP M,nn
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementJPccnn();
-			break;
-
-		case 0xC3:
-			if (GetEnableProgramFlowBreakpoints())
+			if (matched && (!seenNotTaken || !seenTaken))
 			{
-				HitBreakpoint("program flow");
+				fprintf(stderr, "[Z80] %s never takes %u T states, as the opcode table has it can\n", entry.m_pMnemonic, seenTaken ? entry.m_tstates : entry.m_takenTstates);
+				matched = false;
 			}
-			return ImplementJPnn();
-			break;
-
-		case 0xD3:
-			return ImplementOUT_n_A();
-			break;
+			consistent &= matched;
+		}
+	}
 
-		case 0xE3:
-			return ImplementEX_SP_HL();
-			break;
+	delete pCPU;
+	delete pMemory;
+	return consistent;
+}
 
-		case 0xF3:
-			return ImplementDI();
-			break;
+//=============================================================================
 
-		case 0xC4: // CALL NZ,nn
-		case 0xD4: // CALL NC,nn
-		case 0xE4: // CALL PO,nn
-		case 0xF4: // CALL P,nn
-		case 0xCC: // CALL Z,nn
-		case 0xDC: // CALL C,nn
-		case 0xEC: // CALL PE,nn
-		case 0xFC: // CALL M,nn
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementCALLccnn();
-			break;
+uint8 CZ80::HandleArithmeticAddFlags(uint16 source1, uint16 source2, bool withCarry)
+{
+	uint16 carry = (withCarry == true) ? (m_F & eF_C) : 0;
+	uint16 result = source1 + source2 + carry;
+	uint16 half = (source1 & 0x0F) + (source2 & 0x0F) + carry;
+	uint16 overflow = ((source1 & source2 & ~result) | (~source1 & ~source2 & result)) >> 5;
 
-		case 0xC5: // PUSH BC
-		case 0xD5: // PUSH DE
-		case 0xE5: // PUSH HL
-			return ImplementPUSHqq();
-			break;
+	m_F = (result & (eF_S | eF_Y | eF_X)) | (((result & 0xFF) == 0) ? eF_Z : 0) | (half & eF_H) | (overflow & eF_PV) | ((result >> 8) & eF_C);
 
-		case 0xF5: // PUSH AF
-			return ImplementPUSHAF();
-			break;
+	return (result & 0xFF);
+}
 
-		case 0xC6:
-			return ImplementADDAn();
-			break;
+//=============================================================================
 
-		case 0xD6:
-			return ImplementSUBn();
-			break;
+uint8 CZ80::HandleArithmeticSubtractFlags(uint16 source1, uint16 source2, bool withCarry)
+{
+	uint16 carry = (withCarry == true) ? (m_F & eF_C) : 0;
+	uint16 result = source1 - source2 - carry;
+	uint16 half = (source1 & 0x0F) - (source2 & 0x0F) - carry;
+	uint16 overflow = ((source1 & ~source2 & ~result) | (~source1 & source2 & result)) >> 5;
 
-		case 0xE6:
-			return ImplementANDn();
-			break;
+	m_F = (result & (eF_S | eF_Y | eF_X)) | (((result & 0xFF) == 0) ? eF_Z : 0) | (half & eF_H) | (overflow & eF_PV) | eF_N | ((result >> 8) & eF_C);
 
-		case 0xF6:
-			return ImplementORn();
-			break;
+	return (result & 0xFF);
+}
 
-		case 0xC7: // RST 0
-		case 0xCF: // RST 8
-		case 0xD7: // RST 16
-		case 0xDF: // RST 24
-		case 0xE7: // RST 32
-		case 0xEF: // RST 40
-		case 0xF7: // RST 48
-		case 0xFF: // RST 56
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementRSTp();
-			break;
+//=============================================================================
 
-		case 0xC9:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementRET();
-			break;
+void CZ80::HandleLogicalFlags(uint8 source)
+{
+	uint8 parity = source;
+	parity ^= parity >> 4;
+	parity &= 0xF;
+	parity = ((0x6996 >> parity) << 2);
+	m_F = (source & (eF_S | eF_Y | eF_X)) | ((source == 0) ? eF_Z : 0) | (~parity & eF_PV);
+}
 
-		case 0xD9:
-			return ImplementEXX();
-			break;
+//=============================================================================
 
-		case 0xE9:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementJP_HL_();
-			break;
+uint16 CZ80::Handle16BitArithmeticAddFlags(uint32 source1, uint32 source2, bool withCarry)
+{
+	uint16 carry = (withCarry == true) ? (m_F & eF_C) : 0;
+	uint32 result = source1 + source2 + carry;
+	uint32 half = ((source1 & 0x0FFF) + (source2 & 0x0FFF) + carry) >> 8;
+	uint32 overflow = ((source1 & source2 & ~result) | (~source1 & ~source2 & result)) >> 13;
 
-		case 0xCB: // Prefix CB
-			IncrementR(1);
-			switch (ReadMemory(m_PC + 1))
-			{
-				case 0x00: // RLC B
-				case 0x01: // RLC C
-				case 0x02: // RLC D
-				case 0x03: // RLC E
-				case 0x04: // RLC H
-				case 0x05: // RLC L
-				case 0x07: // RLC A
-					return ImplementRLCr();
-					break;
+	m_F = ((result >> 8) & (eF_S | eF_X | eF_Y)) | (((result & 0xFFFF) == 0) ? eF_Z : 0) | (half & eF_H) | (overflow & eF_PV) | ((result >> 16) & eF_C);
 
-				case 0x06:
-					return ImplementRLC_HL_();
-					break;
+	return (result & 0xFFFF);
+}
 
-				case 0x08: // RRC B
-				case 0x09: // RRC C
-				case 0x0A: // RRC D
-				case 0x0B: // RRC E
-				case 0x0C: // RRC H
-				case 0x0D: // RRC L
-				case 0x0F: // RRC A
-					return ImplementRRCr();
-					break;
+//=============================================================================
 
-				case 0x0E:
-					return ImplementRRC_HL_();
-					break;
+uint16 CZ80::Handle16BitArithmeticSubtractFlags(uint32 source1, uint32 source2, bool withCarry)
+{
+	uint16 carry = (withCarry == true) ? (m_F & eF_C) : 0;
+	uint32 result = source1 - source2 - carry;
+	uint32 half = ((source1 & 0x0FFF) - (source2 & 0x0FFF) - carry) >> 8;
+	uint32 overflow = ((source1 & ~source2 & ~result) | (~source1 & source2 & result)) >> 13;
 
-				case 0x10: // RL B
-				case 0x11: // RL C
-				case 0x12: // RL D
-				case 0x13: // RL E
-				case 0x14: // RL H
-				case 0x15: // RL L
-				case 0x17: // RL A
-					return ImplementRLr();
-					break;
+	m_F = ((result >> 8) & (eF_S | eF_X | eF_Y)) | (((result & 0xFFFF) == 0) ? eF_Z : 0) | (half & eF_H) | (overflow & eF_PV) | eF_N | ((result >> 16) & eF_C);
 
-				case 0x16:
-					return ImplementRL_HL_();
-					break;
+	return (result & 0xFFFF);
+}
 
-				case 0x18: // RR B
-				case 0x19: // RR C
-				case 0x1A: // RR D
-				case 0x1B: // RR E
-				case 0x1C: // RR H
-				case 0x1D: // RR L
-				case 0x1F: // RR A
-					return ImplementRRr();
-					break;
+//=============================================================================
 
-				case 0x1E:
-					return ImplementRR_HL_();
-					break;
+void CZ80::SetContention(const uint8* pTable, uint32 tableSize)
+{
+	m_pContention = pTable;
+	m_contentionTableSize = (pTable != NULL) ? tableSize : 0;
+	m_contentionDelay = 0;
+}
 
-				case 0x20: // SLA B
-				case 0x21: // SLA C
-				case 0x22: // SLA D
-				case 0x23: // SLA E
-				case 0x24: // SLA H
-				case 0x25: // SLA L
-				case 0x27: // SLA A
-					return ImplementSLAr();
-					break;
+//=============================================================================
 
-				case 0x26:
-					return ImplementSLA_HL_();
-					break;
+void CZ80::ContendRead(uint16 address) const
+{
+	// Timing is approximated by M cycle: the opcode fetch takes 4 T states and
+	// every other access 3; internal cycles between accesses aren't tracked.
+	uint16 offset = address - m_contentionInstruction;
+	if (offset < m_contentionFetched)
+	{
+		// Handler re-reading an instruction byte that has already been fetched
+		return;
+	}
 
-				case 0x28: // SRA B
-				case 0x29: // SRA C
-				case 0x2A: // SRA D
-				case 0x2B: // SRA E
-				case 0x2C: // SRA H
-				case 0x2D: // SRA L
-				case 0x2F: // SRA A
-					return ImplementSRAr();
-					break;
+	if (offset == m_contentionFetched)
+	{
+		++m_contentionFetched;
+		Contend(address, (offset == 0) ? 4 : 3);
+	}
+	else
+	{
+		Contend(address, 3);
+	}
+}
 
-				case 0x2E:
-					return ImplementSRA_HL_();
-					break;
+//=============================================================================
 
-				case 0x30: // SLL B
-				case 0x31: // SLL C
-				case 0x32: // SLL D
-				case 0x33: // SLL E
-				case 0x34: // SLL H
-				case 0x35: // SLL L
-				case 0x37: // SLL A
-					return ImplementSLLr();
-					break;
+void CZ80::ContendPort(uint16 address) const
+{
+	// The ULA sees the high byte of the port on the address bus as if it were a
+	// memory access, and also responds (with its own contention) to even ports
+	bool highContended = ((m_contendedSlotMask >> (address >> 14)) & 1) != 0;
 
-				case 0x36:
-					return ImplementSLL_HL_();
-					break;
+	if (address & 0x0001)
+	{
+		if (highContended)
+		{
+			ContendULA(1);
+			ContendULA(1);
+			ContendULA(1);
+			ContendULA(1);
+		}
+		else
+		{
+			m_contentionTstate += 4;
+		}
+	}
+	else
+	{
+		if (highContended)
+		{
+			ContendULA(1);
+		}
+		else
+		{
+			m_contentionTstate += 1;
+		}
+		ContendULA(3);
+	}
+}
 
-				case 0x38: // SRL B
-				case 0x39: // SRL C
-				case 0x3A: // SRL D
-				case 0x3B: // SRL E
-				case 0x3C: // SRL H
-				case 0x3D: // SRL L
-				case 0x3F: // SRL A
-					return ImplementSRLr();
-					break;
+//=============================================================================
 
-				case 0x3E:
-					return ImplementSRL_HL_();
-					break;
+void CZ80::WriteMemory(uint16 address, uint8 byte)
+{
+	if (m_pContention != NULL)
+	{
+		Contend(address, 3);
+	}
 
-				case 0x40: // BIT 0,B
-				case 0x41: // BIT 0,C
-				case 0x42: // BIT 0,D
-				case 0x43: // BIT 0,E
-				case 0x44: // BIT 0,H
-				case 0x45: // BIT 0,L
-				case 0x47: // BIT 0,A
-				case 0x48: // BIT 1,B
-				case 0x49: // BIT 1,C
-				case 0x4A: // BIT 1,D
-				case 0x4B: // BIT 1,E
-				case 0x4C: // BIT 1,H
-				case 0x4D: // BIT 1,L
-				case 0x4F: // BIT 1,A
-				case 0x50: // BIT 2,B
-				case 0x51: // BIT 2,C
-				case 0x52: // BIT 2,D
-				case 0x53: // BIT 2,E
-				case 0x54: // BIT 2,H
-				case 0x55: // BIT 2,L
-				case 0x57: // BIT 2,A
-				case 0x58: // BIT 3,B
-				case 0x59: // BIT 3,C
-				case 0x5A: // BIT 3,D
-				case 0x5B: // BIT 3,E
-				case 0x5C: // BIT 3,H
-				case 0x5D: // BIT 3,L
-				case 0x5F: // BIT 3,A
-				case 0x60: // BIT 4,B
-				case 0x61: // BIT 4,C
-				case 0x62: // BIT 4,D
-				case 0x63: // BIT 4,E
-				case 0x64: // BIT 4,H
-				case 0x65: // BIT 4,L
-				case 0x67: // BIT 4,A
-				case 0x68: // BIT 5,B
-				case 0x69: // BIT 5,C
-				case 0x6A: // BIT 5,D
-				case 0x6B: // BIT 5,E
-				case 0x6C: // BIT 5,H
-				case 0x6D: // BIT 5,L
-				case 0x6F: // BIT 5,A
-				case 0x70: // BIT 6,B
-				case 0x71: // BIT 6,C
-				case 0x72: // BIT 6,D
-				case 0x73: // BIT 6,E
-				case 0x74: // BIT 6,H
-				case 0x75: // BIT 6,L
-				case 0x77: // BIT 6,A
-				case 0x78: // BIT 7,B
-				case 0x79: // BIT 7,C
-				case 0x7A: // BIT 7,D
-				case 0x7B: // BIT 7,E
-				case 0x7C: // BIT 7,H
-				case 0x7D: // BIT 7,L
-				case 0x7F: // BIT 7,A
-					return ImplementBITbr();
-					break;
+	if ((m_features & ZF_DATA_WATCHPOINTS) && m_writeWatchpoints.IsSet(address) && IsBreakpointHit(m_writeWatchpoints, address))
+	{
+		fprintf(stderr, "[Z80] writing %02X to %04X\n", byte, address);
+		HitBreakpoint("write");
+	}
 
-				case 0x46: // BIT 0,(HL)
-				case 0x4E: // BIT 1,(HL)
-				case 0x56: // BIT 2,(HL)
-				case 0x5E: // BIT 3,(HL)
-				case 0x66: // BIT 4,(HL)
-				case 0x6E: // BIT 5,(HL)
-				case 0x76: // BIT 6,(HL)
-				case 0x7E: // BIT 7,(HL)
-					return ImplementBITb_HL_();
-					break;
+	m_pMemory->WriteMemory(address, byte);
+}
 
-				case 0x80: // RES 0,B
-				case 0x81: // RES 0,C
-				case 0x82: // RES 0,D
-				case 0x83: // RES 0,E
-				case 0x84: // RES 0,H
-				case 0x85: // RES 0,L
-				case 0x87: // RES 0,A
-				case 0x88: // RES 1,B
-				case 0x89: // RES 1,C
-				case 0x8A: // RES 1,D
-				case 0x8B: // RES 1,E
-				case 0x8C: // RES 1,H
-				case 0x8D: // RES 1,L
-				case 0x8F: // RES 1,A
-				case 0x90: // RES 2,B
-				case 0x91: // RES 2,C
-				case 0x92: // RES 2,D
-				case 0x93: // RES 2,E
-				case 0x94: // RES 2,H
-				case 0x95: // RES 2,L
-				case 0x97: // RES 2,A
-				case 0x98: // RES 3,B
-				case 0x99: // RES 3,C
-				case 0x9A: // RES 3,D
-				case 0x9B: // RES 3,E
-				case 0x9C: // RES 3,H
-				case 0x9D: // RES 3,L
-				case 0x9F: // RES 3,A
-				case 0xA0: // RES 4,B
-				case 0xA1: // RES 4,C
-				case 0xA2: // RES 4,D
-				case 0xA3: // RES 4,E
-				case 0xA4: // RES 4,H
-				case 0xA5: // RES 4,L
-				case 0xA7: // RES 4,A
-				case 0xA8: // RES 5,B
-				case 0xA9: // RES 5,C
-				case 0xAA: // RES 5,D
-				case 0xAB: // RES 5,E
-				case 0xAC: // RES 5,H
-				case 0xAD: // RES 5,L
-				case 0xAF: // RES 5,A
-				case 0xB0: // RES 6,B
-				case 0xB1: // RES 6,C
-				case 0xB2: // RES 6,D
-				case 0xB3: // RES 6,E
-				case 0xB4: // RES 6,H
-				case 0xB5: // RES 6,L
-				case 0xB7: // RES 6,A
-				case 0xB8: // RES 7,B
-				case 0xB9: // RES 7,C
-				case 0xBA: // RES 7,D
-				case 0xBB: // RES 7,E
-				case 0xBC: // RES 7,H
-				case 0xBD: // RES 7,L
-				case 0xBF: // RES 7,A
-					return ImplementRESbr();
-					break;
+//=============================================================================
 
-				case 0x86: // RES 0,(HL)
-				case 0x8E: // RES 1,(HL)
-				case 0x96: // RES 2,(HL)
-				case 0x9E: // RES 3,(HL)
-				case 0xA6: // RES 4,(HL)
-				case 0xAE: // RES 5,(HL)
-				case 0xB6: // RES 6,(HL)
-				case 0xBE: // RES 7,(HL)
-					return ImplementRESb_HL_();
-					break;
+uint8 CZ80::ReadMemory(uint16 address) const
+{
+	if (m_pContention != NULL)
+	{
+		ContendRead(address);
+	}
 
-				case 0xC0: // SET 0,B
-				case 0xC1: // SET 0,C
-				case 0xC2: // SET 0,D
-				case 0xC3: // SET 0,E
-				case 0xC4: // SET 0,H
-				case 0xC5: // SET 0,L
-				case 0xC7: // SET 0,A
-				case 0xC8: // SET 1,B
-				case 0xC9: // SET 1,C
-				case 0xCA: // SET 1,D
-				case 0xCB: // SET 1,E
-				case 0xCC: // SET 1,H
-				case 0xCD: // SET 1,L
-				case 0xCF: // SET 1,A
-				case 0xD0: // SET 2,B
-				case 0xD1: // SET 2,C
-				case 0xD2: // SET 2,D
-				case 0xD3: // SET 2,E
-				case 0xD4: // SET 2,H
-				case 0xD5: // SET 2,L
-				case 0xD7: // SET 2,A
-				case 0xD8: // SET 3,B
-				case 0xD9: // SET 3,C
-				case 0xDA: // SET 3,D
-				case 0xDB: // SET 3,E
-				case 0xDC: // SET 3,H
-				case 0xDD: // SET 3,L
-				case 0xDF: // SET 3,A
-				case 0xE0: // SET 4,B
-				case 0xE1: // SET 4,C
-				case 0xE2: // SET 4,D
-				case 0xE3: // SET 4,E
-				case 0xE4: // SET 4,H
-				case 0xE5: // SET 4,L
-				case 0xE7: // SET 4,A
-				case 0xE8: // SET 5,B
-				case 0xE9: // SET 5,C
-				case 0xEA: // SET 5,D
-				case 0xEB: // SET 5,E
-				case 0xEC: // SET 5,H
-				case 0xED: // SET 5,L
-				case 0xEF: // SET 5,A
-				case 0xF0: // SET 6,B
-				case 0xF1: // SET 6,C
-				case 0xF2: // SET 6,D
-				case 0xF3: // SET 6,E
-				case 0xF4: // SET 6,H
-				case 0xF5: // SET 6,L
-				case 0xF7: // SET 6,A
-				case 0xF8: // SET 7,B
-				case 0xF9: // SET 7,C
-				case 0xFA: // SET 7,D
-				case 0xFB: // SET 7,E
-				case 0xFC: // SET 7,H
-				case 0xFD: // SET 7,L
-				case 0xFF: // SET 7,A
-					return ImplementSETbr();
-					break;
+	uint8 byte = m_pMemory->ReadMemory(address);
 
-				case 0xC6: // SET 0,(HL)
-				case 0xCE: // SET 1,(HL)
-				case 0xD6: // SET 2,(HL)
-				case 0xDE: // SET 3,(HL)
-				case 0xE6: // SET 4,(HL)
-				case 0xEE: // SET 5,(HL)
-				case 0xF6: // SET 6,(HL)
-				case 0xFE: // SET 7,(HL)
-					return ImplementSETb_HL_();
-					break;
+	if ((m_features & ZF_DATA_WATCHPOINTS) && m_readWatchpoints.IsSet(address) && IsBreakpointHit(m_readWatchpoints, address))
+	{
+		fprintf(stderr, "[Z80] reading %02X from %04X\n", byte, address);
+		HitBreakpoint("read");
+	}
 
-				default:
-					fprintf(stderr, "[Z80] Unhandled opcode CB %02X at address %04X\n", ReadMemory(m_PC + 1), m_PC);
-					HandleIllegalOpcode();
-					return 0;
-					break;
-			};
-			break;
+	return byte;
+}
 
-		case 0xDB:
-			return ImplementINA_n_();
-			break;
+//=============================================================================
 
-		case 0xEB:
-			return ImplementEXDEHL();
-			break;
+void CZ80::WritePort(uint16 address, uint8 byte)
+{
+	if (m_pContention != NULL)
+	{
+		ContendPort(address);
+	}
 
-		case 0xFB:
-			return ImplementEI();
-			break;
+	if ((m_features & ZF_DATA_WATCHPOINTS) && m_portOutWatchpoints.IsSet(address) && IsBreakpointHit(m_portOutWatchpoints, address))
+	{
+		fprintf(stderr, "[Z80] writing %02X to port %04X\n", byte, address);
+		HitBreakpoint("port out");
+	}
 
-		case 0xF9:
-			return ImplementLDSPHL();
-			break;
+	m_pMemory->WritePort(address, byte);
+}
 
-		case 0xCD:
-			if (GetEnableProgramFlowBreakpoints())
-			{
-				HitBreakpoint("program flow");
-			}
-			return ImplementCALLnn();
-			break;
+//=============================================================================
 
-		case 0xDD: // Prefix DD
-			IncrementR(1);
-			switch (ReadMemory(m_PC + 1))
-			{
-				case 0x09: // ADD IX,BC
-				case 0x19: // ADD IX,DE
-				case 0x29: // ADD IX,HL
-				case 0x39: // ADD IX,SP
-					return ImplementADDIXdd();
-					break;
+uint8 CZ80::ReadPort(uint16 address) const
+{
+	if (m_pContention != NULL)
+	{
+		ContendPort(address);
+	}
 
-				case 0x21:
-					return ImplementLDIXnn();
-					break;
+	uint8 byte = m_pMemory->ReadPort(address);
 
-				case 0x22:
-					return ImplementLD_nn_IX();
-					break;
+	if ((m_features & ZF_DATA_WATCHPOINTS) && m_portInWatchpoints.IsSet(address) && IsBreakpointHit(m_portInWatchpoints, address))
+	{
+		fprintf(stderr, "[Z80] reading %02X from port %04X\n", byte, address);
+		HitBreakpoint("port in");
+	}
 
-				case 0x23:
-					return ImplementINCIX();
-					break;
+	return byte;
+}
 
-				case 0x24: // INC IXh
-					return ImplementINCIXh();
-					break;
+//=============================================================================
 
-				case 0x25: // DEC IXh
-					return ImplementDECIXh();
-					break;
+bool CZ80::IsBreakpointHit(const CBreakpointSet& breakpoints, uint16 address) const
+{
+	// Only gets here once the address is known to be set, so the registers are
+	// only gathered for conditional breakpoints
+	if (!breakpoints.HasConditions())
+	{
+		return true;
+	}
 
-				case 0x26: // LD IXh,n
-					return ImplementLDIXhn();
-					break;
+	uint16 registers[CBreakpointSet::BR_COUNT];
+	registers[CBreakpointSet::BR_NONE] = 0;
+	registers[CBreakpointSet::BR_A] = m_A;
+	registers[CBreakpointSet::BR_AF] = m_AF;
+	registers[CBreakpointSet::BR_BC] = m_BC;
+	registers[CBreakpointSet::BR_DE] = m_DE;
+	registers[CBreakpointSet::BR_HL] = m_HL;
+	registers[CBreakpointSet::BR_IX] = m_IX;
+	registers[CBreakpointSet::BR_IY] = m_IY;
+	registers[CBreakpointSet::BR_SP] = m_SP;
 
-				case 0x2A:
-					return ImplementLDIX_nn_();
-					break;
+	return breakpoints.Hit(address, registers);
+}
 
-				case 0x2B:
-					return ImplementDECIX();
-					break;
+//=============================================================================
 
-				case 0x2C: // INC IXl 
-					return ImplementINCIXl();
-					break;
+bool CZ80::IsConditionTrue(uint8 threeBits) const
+{
+	switch (threeBits & 0x07)
+	{
+		case 0: return (m_F & eF_Z) == 0;		break; // Not Zero
+		case 1: return (m_F & eF_Z) != 0;		break; // Zero
+		case 2: return (m_F & eF_C) == 0;		break; // Not Carry
+		case 3: return (m_F & eF_C) != 0;		break; // Carry
+		case 4: return (m_F & eF_PV) == 0;	break; // Parity Odd
+		case 5: return (m_F & eF_PV) != 0;	break; // Parity Even
+		case 6: return (m_F & eF_S) == 0;		break; // Positive (Not Sign)
+		case 7: return (m_F & eF_S) != 0;		break; // Minus (Sign)
+	}
+	return false;
+}
 
-				case 0x2D: // DEC IXl
-					return ImplementDECIXl();
-					break;
+//=============================================================================
 
-				case 0x2E: // LD IXl,n
-					return ImplementLDIXln();
-					break;
+//-----------------------------------------------------------------------------
+//	8-Bit Load Group
+//-----------------------------------------------------------------------------
 
-				case 0x34:
-					return ImplementINC_IXd_();
-					break;
+//=============================================================================
 
-				case 0x35:
-					return ImplementDEC_IXd_();
-					break;
-
-				case 0x36:
-					return ImplementLD_IXd_n();
-					break;
-
-				case 0x40: // LD B,B
-				case 0x41: // LD B,C
-				case 0x42: // LD B,D
-				case 0x43: // LD B,E
-				case 0x47: // LD B,A
-				case 0x50: // LD D,B
-				case 0x51: // LD D,C
-				case 0x52: // LD D,D
-				case 0x53: // LD D,E
-				case 0x57: // LD D,A
-				case 0x48: // LD C,B
-				case 0x49: // LD C,C
-				case 0x4A: // LD C,D
-				case 0x4B: // LD C,E
-				case 0x4F: // LD C,A
-				case 0x58: // LD E,B
-				case 0x59: // LD E,C
-				case 0x5A: // LD E,D
-				case 0x5B: // LD E,E
-				case 0x5F: // LD E,A
-				case 0x78: // LD A,B
-				case 0x79: // LD A,C
-				case 0x7A: // LD A,D
-				case 0x7B: // LD A,E
-				case 0x7F: // LD A,A
-					return 4 + ImplementLDrr();
-					break;
-
-				case 0x44: // LD B,IXh
-				case 0x54: // LD D,IXh
-				case 0x4C: // LD C,IXh
-				case 0x5C: // LD E,IXh
-				case 0x7C: // LD A,IXh
-					ImplementLDrIXh();
-					break;
-
-				case 0x45: // LD B,IXl
-				case 0x55: // LD D,IXl
-				case 0x4D: // LD C,IXl
-				case 0x5D: // LD E,IXl
-				case 0x7D: // LD A,IXl
-					ImplementLDrIXl();
-					break;
-
-				case 0x46: // LD B,(IX+d)
-				case 0x56: // LD D,(IX+d)
-				case 0x66: // LD H,(IX+d)
-				case 0x4E: // LD C,(IX+d)
-				case 0x5E: // LD E,(IX+d)
-				case 0x6E: // LD L,(IX+d)
-				case 0x7E: // LD A,(IX+d)
-					return ImplementLDr_IXd_();
-					break;
-
-				case 0x60: // LD IXh,B
-				case 0x61: // LD IXh,C
-				case 0x62: // LD IXh,D
-				case 0x63: // LD IXh,E
-				case 0x64: // LD IXh,IXh
-				case 0x65: // LD IXh,IXl
-				case 0x67: // LD IXh,A
-					return ImplementLDIXhr();
-					break;
-
-				case 0x68: // LD IXl,B
-				case 0x69: // LD IXl,C
-				case 0x6A: // LD IXl,D
-				case 0x6B: // LD IXl,E
-				case 0x6C: // LD IXl,IXh
-				case 0x6D: // LD IXl,IXl
-				case 0x6F: // LD IXl,A
-					return ImplementLDIXlr();
-					break;
-
-				case 0x70: // LD (IX+d),B
-				case 0x71: // LD (IX+d),C
-				case 0x72: // LD (IX+d),D
-				case 0x73: // LD (IX+d),E
-				case 0x74: // LD (IX+d),H
-				case 0x75: // LD (IX+d),L
-				case 0x77: // LD (IX+d),A
-					return ImplementLD_IXd_r();
-					break;
-
-				case 0x84: // ADD A,IXh
-					return ImplementADDAIXh();
-					break;
-
-				case 0x85: // ADD A,IXl
-					return ImplementADDAIXl();
-					break;
-
-				case 0x86:
-					return ImplementADDA_IXd_();
-					break;
-
-				case 0x8C: // ADC A,IXh
-					return ImplementADCAIXh();
-					break;
-
-				case 0x8D: // ADC A,IXl
-					return ImplementADCAIXl();
-					break;
-
-				case 0x8E:
-					return ImplementADCA_IXd_();
-					break;
-
-				case 0x94: // SUB IXh
-					return ImplementSUBIXh();
-					break;
-
-				case 0x95: // SUB IXl
-					return ImplementSUBIXl();
-					break;
-
-				case 0x9C: // SBC A,IXh
-					return ImplementSBCAIXh();
-					break;
-
-				case 0x9D: // SBC A,IXl
-					return ImplementSBCAIXl();
-					break;
-
-				case 0x96:
-					return ImplementSUB_IXd_();
-
-				case 0x9E:
-					return ImplementSBCA_IXd_();
-					break;
-
-				case 0xA4: // AND IXh
-					return ImplementANDIXh();
-					break;
-
-				case 0xA5: // AND IXl
-					return ImplementANDIXl();
-					break;
-
-				case 0xA6:
-					return ImplementAND_IXd_();
-					break;
-
-				case 0xB6:
-					return ImplementOR_IXd_();
-					break;
-
-				case 0xBE:
-					return ImplementCP_IXd_();
-					break;
-
-				case 0xAC: // XOR IXh
-					return ImplementXORIXh();
-					break;
-
-				case 0xAD: // XOR IXl
-					return ImplementXORIXl();
-					break;
-
-				case 0xAE:
-					return ImplementXOR_IXd_();
-					break;
-
-				case 0xB4: // OR IXh
-					return ImplementORIXh();
-					break;
-
-				case 0xB5: // OR IXl
-					return ImplementORIXl();
-					break;
-
-				case 0xBC: // CP IXh
-					return ImplementCPIXh();
-					break;
-
-				case 0xBD: // CP IXl
-					return ImplementCPIXl();
-					break;
-
-				case 0xCB: // Prefix CB
-					switch (ReadMemory(m_PC + 3))
-					{
-						case 0x00:
-						case 0x01:
-						case 0x02:
-						case 0x03:
-						case 0x04:
-						case 0x05:
-						case 0x06:
-						case 0x07:
-							return ImplementRLC_IXd_();
-							break;
-
-						case 0x08:
-						case 0x09:
-						case 0x0A:
-						case 0x0B:
-						case 0x0C:
-						case 0x0D:
-						case 0x0E:
-						case 0x0F:
-							return ImplementRRC_IXd_();
-							break;
-
-						case 0x10:
-						case 0x11:
-						case 0x12:
-						case 0x13:
-						case 0x14:
-						case 0x15:
-						case 0x16:
-						case 0x17:
-							return ImplementRL_IXd_();
-							break;
-
-						case 0x18:
-						case 0x19:
-						case 0x1A:
-						case 0x1B:
-						case 0x1C:
-						case 0x1D:
-						case 0x1E:
-						case 0x1F:
-							return ImplementRR_IXd_();
-							break;
-
-						case 0x20:
-						case 0x21:
-						case 0x22:
-						case 0x23:
-						case 0x24:
-						case 0x25:
-						case 0x26:
-						case 0x27:
-							return ImplementSLA_IXd_();
-							break;
-
-						case 0x28:
-						case 0x29:
-						case 0x2A:
-						case 0x2B:
-						case 0x2C:
-						case 0x2D:
-						case 0x2E:
-						case 0x2F:
-							return ImplementSRA_IXd_();
-							break;
-
-						case 0x30:
-						case 0x31:
-						case 0x32:
-						case 0x33:
-						case 0x34:
-						case 0x35:
-						case 0x36:
-						case 0x37:
-							return ImplementSLL_IXd_();
-							break;
-
-						case 0x38:
-						case 0x39:
-						case 0x3A:
-						case 0x3B:
-						case 0x3C:
-						case 0x3D:
-						case 0x3E:
-						case 0x3F:
-							return ImplementSRL_IXd_();
-							break;
-
-						case 0x40:
-						case 0x41:
-						case 0x42:
-						case 0x43:
-						case 0x44:
-						case 0x45:
-						case 0x46: // BIT 0,(IX+d)
-						case 0x47:
-						case 0x48:
-						case 0x49:
-						case 0x4A:
-						case 0x4B:
-						case 0x4C:
-						case 0x4D:
-						case 0x4E: // BIT 1,(IX+d)
-						case 0x4F:
-						case 0x50:
-						case 0x51:
-						case 0x52:
-						case 0x53:
-						case 0x54:
-						case 0x55:
-						case 0x56: // BIT 2,(IX+d)
-						case 0x57:
-						case 0x58:
-						case 0x59:
-						case 0x5A:
-						case 0x5B:
-						case 0x5C:
-						case 0x5D:
-						case 0x5E: // BIT 3,(IX+d)
-						case 0x5F:
-						case 0x60:
-						case 0x61:
-						case 0x62:
-						case 0x63:
-						case 0x64:
-						case 0x65:
-						case 0x66: // BIT 4,(IX+d)
-						case 0x67:
-						case 0x68:
-						case 0x69:
-						case 0x6A:
-						case 0x6B:
-						case 0x6C:
-						case 0x6D:
-						case 0x6E: // BIT 5,(IX+d)
-						case 0x6F:
-						case 0x70:
-						case 0x71:
-						case 0x72:
-						case 0x73:
-						case 0x74:
-						case 0x75:
-						case 0x76: // BIT 6,(IX+d)
-						case 0x77:
-						case 0x78:
-						case 0x79:
-						case 0x7A:
-						case 0x7B:
-						case 0x7C:
-						case 0x7D:
-						case 0x7E: // BIT 7,(IX+d)
-						case 0x7F:
-							return ImplementBITb_IXd_();
-							break;
-
-						case 0x80:
-						case 0x81:
-						case 0x82:
-						case 0x83:
-						case 0x84:
-						case 0x85:
-						case 0x86: // RES 0,(IX+d)
-						case 0x87:
-						case 0x88:
-						case 0x89:
-						case 0x8A:
-						case 0x8B:
-						case 0x8C:
-						case 0x8D:
-						case 0x8E: // RES 1,(IX+d)
-						case 0x8F:
-						case 0x90:
-						case 0x91:
-						case 0x92:
-						case 0x93:
-						case 0x94:
-						case 0x95:
-						case 0x96: // RES 2,(IX+d)
-						case 0x97:
-						case 0x98:
-						case 0x99:
-						case 0x9A:
-						case 0x9B:
-						case 0x9C:
-						case 0x9D:
-						case 0x9E: // RES 3,(IX+d)
-						case 0x9F:
-						case 0xA0:
-						case 0xA1:
-						case 0xA2:
-						case 0xA3:
-						case 0xA4:
-						case 0xA5:
-						case 0xA6: // RES 4,(IX+d)
-						case 0xA7:
-						case 0xA8:
-						case 0xA9:
-						case 0xAA:
-						case 0xAB:
-						case 0xAC:
-						case 0xAD:
-						case 0xAE: // RES 5,(IX+d)
-						case 0xAF:
-						case 0xB0:
-						case 0xB1:
-						case 0xB2:
-						case 0xB3:
-						case 0xB4:
-						case 0xB5:
-						case 0xB6: // RES 6,(IX+d)
-						case 0xB7:
-						case 0xB8:
-						case 0xB9:
-						case 0xBA:
-						case 0xBB:
-						case 0xBC:
-						case 0xBD:
-						case 0xBE: // RES 7,(IX+d)
-						case 0xBF:
-							return ImplementRESb_IXd_();
-							break;
-
-						case 0xC0:
-						case 0xC1:
-						case 0xC2:
-						case 0xC3:
-						case 0xC4:
-						case 0xC5:
-						case 0xC6: // SET 0,(IX+d)
-						case 0xC7:
-						case 0xC8:
-						case 0xC9:
-						case 0xCA:
-						case 0xCB:
-						case 0xCC:
-						case 0xCD:
-						case 0xCE: // SET 1,(IX+d)
-						case 0xCF:
-						case 0xD0:
-						case 0xD1:
-						case 0xD2:
-						case 0xD3:
-						case 0xD4:
-						case 0xD5:
-						case 0xD6: // SET 2,(IX+d)
-						case 0xD7:
-						case 0xD8:
-						case 0xD9:
-						case 0xDA:
-						case 0xDB:
-						case 0xDC:
-						case 0xDD:
-						case 0xDE: // SET 3,(IX+d)
-						case 0xDF:
-						case 0xE0:
-						case 0xE1:
-						case 0xE2:
-						case 0xE3:
-						case 0xE4:
-						case 0xE5:
-						case 0xE6: // SET 4,(IX+d)
-						case 0xE7:
-						case 0xE8:
-						case 0xE9:
-						case 0xEA:
-						case 0xEB:
-						case 0xEC:
-						case 0xED:
-						case 0xEE: // SET 5,(IX+d)
-						case 0xEF:
-						case 0xF0:
-						case 0xF1:
-						case 0xF2:
-						case 0xF3:
-						case 0xF4:
-						case 0xF5:
-						case 0xF6: // SET 6,(IX+d)
-						case 0xF7:
-						case 0xF8:
-						case 0xF9:
-						case 0xFA:
-						case 0xFB:
-						case 0xFC:
-						case 0xFD:
-						case 0xFE: // SET 7,(IX+d)
-						case 0xFF:
-							return ImplementSETb_IXd_();
-							break;
-
-						default:
-							fprintf(stderr, "[Z80] Unhandled opcode DD CB %02X %02X at address %04X\n", ReadMemory(m_PC + 2), ReadMemory(m_PC + 3), m_PC);
-							HandleIllegalOpcode();
-							return 0;
-							break;
-					};
-					break;
-
-				case 0xE1:
-					return ImplementPOPIX();
-					break;
-
-				case 0xE3:
-					return ImplementEX_SP_IX();
-					break;
-
-				case 0xE5:
-					return ImplementPUSHIX();
-					break;
-
-				case 0xE9:
-					if (GetEnableProgramFlowBreakpoints())
-					{
-						HitBreakpoint("program flow");
-					}
-					return ImplementJP_IX_();
-					break;
-
-				case 0xF9:
-					return ImplementLDSPIX();
-					break;
-
-				default:
-					fprintf(stderr, "[Z80] Unhandled opcode DD %02X at address %04X\n", ReadMemory(m_PC + 1), m_PC);
-					HandleIllegalOpcode();
-					return 0;
-					break;
-			};
-			break;
-
-		case 0xED: // Prefix ED
-			IncrementR(1);
-			switch (ReadMemory(m_PC + 1))
-			{
-				case 0x00:
-				case 0x01:
-				case 0x02:
-				case 0x03:
-				case 0x04:
-				case 0x05:
-				case 0x06:
-				case 0x07:
-				case 0x08:
-				case 0x09:
-				case 0x0A:
-				case 0x0B:
-				case 0x0C:
-				case 0x0D:
-				case 0x0E:
-				case 0x0F:
-				case 0x10:
-				case 0x11:
-				case 0x12:
-				case 0x13:
-				case 0x14:
-				case 0x15:
-				case 0x16:
-				case 0x17:
-				case 0x18:
-				case 0x19:
-				case 0x1A:
-				case 0x1B:
-				case 0x1C:
-				case 0x1D:
-				case 0x1E:
-				case 0x1F:
-				case 0x20:
-				case 0x21:
-				case 0x22:
-				case 0x23:
-				case 0x24:
-				case 0x25:
-				case 0x26:
-				case 0x27:
-				case 0x28:
-				case 0x29:
-				case 0x2A:
-				case 0x2B:
-				case 0x2C:
-				case 0x2D:
-				case 0x2E:
-				case 0x2F:
-				case 0x30:
-				case 0x31:
-				case 0x32:
-				case 0x33:
-				case 0x34:
-				case 0x35:
-				case 0x36:
-				case 0x37:
-				case 0x38:
-				case 0x39:
-				case 0x3A:
-				case 0x3B:
-				case 0x3C:
-				case 0x3D:
-				case 0x3E:
-				case 0x3F:
-					return ImplementNOP() + ImplementNOP();
-					break;
-
-				case 0x40: // IN B,(C)
-				case 0x50: // IN D,(C)
-				case 0x60: // IN H,(C)
-				case 0x48: // IN C,(C)
-				case 0x58: // IN E,(C)
-				case 0x68: // IN L,(C)
-				case 0x78: // IN A,(C)
-					return ImplementINr_C_();
-					break;
-
-				case 0x41: // OUT (C),B
-				case 0x51: // OUT (C),D
-				case 0x61: // OUT (C),H
-				case 0x49: // OUT (C),C
-				case 0x59: // OUT (C),E
-				case 0x69: // OUT (C),L
-				case 0x79: // OUT (C),A
-					return ImplementOUT_C_r();
-					break;
-
-				case 0x42: // SBC HL,BC
-				case 0x52: // SBC HL,DE
-				case 0x62: // SBC HL,HL
-				case 0x72: // SBC HL,SP
-					return ImplementSBCHLdd();
-					break;
-
-				case 0x43: // LD (nn),BC
-				case 0x53: // LD (nn),DE
-				case 0x63: // LD (nn),HL
-				case 0x73: // LD (nn),SP
-					return ImplementLD_nn_dd();
-					break;
-
-				case 0x44:
-					return ImplementNEG();
-					break;
-
-				case 0x45:
-					if (GetEnableProgramFlowBreakpoints())
-					{
-						HitBreakpoint("program flow");
-					}
-					return ImplementRETN();
-					break;
-
-				case 0x46:
-					return ImplementIM0();
-					break;
-
-				case 0x56:
-					return ImplementIM1();
-					break;
-
-				case 0x47:
-					return ImplementLDIA();
-					break;
-
-				case 0x57:
-					return ImplementLDAI();
-					break;
-
-				case 0x67:
-					return ImplementRRD();
-					break;
-
-				case 0x4A: // ADC HL,BC
-				case 0x5A: // ADC HL,DE
-				case 0x6A: // ADC HL,HL
-				case 0x7A: // ADC HL,SP
-					return ImplementADCHLdd();
-					break;
-
-				case 0x4B: // LD BC,(nn)
-				case 0x5B: // LD DE,(nn)
-				case 0x6B: // LD HL,(nn)
-				case 0x7B: // LD SP,(nn)
-					return ImplementLDdd_nn_();
-					break;
-
-				case 0x4D:
-					if (GetEnableProgramFlowBreakpoints())
-					{
-						HitBreakpoint("program flow");
-					}
-					return ImplementRETI();
-					break;
-
-				case 0x5E:
-					return ImplementIM2();
-					break;
-
-				case 0x4F:
-					return ImplementLDRA();
-					break;
-
-				case 0x5F:
-					return ImplementLDAR();
-					break;
-
-				case 0x6F:
-					return ImplementRLD();
-					break;
-
-				case 0x80:
-				case 0x81:
-				case 0x82:
-				case 0x83:
-				case 0x84:
-				case 0x85:
-				case 0x86:
-				case 0x87:
-				case 0x88:
-				case 0x89:
-				case 0x8A:
-				case 0x8B:
-				case 0x8C:
-				case 0x8D:
-				case 0x8E:
-				case 0x8F:
-				case 0x90:
-				case 0x91:
-				case 0x92:
-				case 0x93:
-				case 0x94:
-				case 0x95:
-				case 0x96:
-				case 0x97:
-				case 0x98:
-				case 0x99:
-				case 0x9A:
-				case 0x9B:
-				case 0x9C:
-				case 0x9D:
-				case 0x9E:
-				case 0x9F:
-					return ImplementNOP() + ImplementNOP();
-					break;
-
-				case 0xA0:
-					return ImplementLDI();
-					break;
-
-				case 0xA1:
-					return ImplementCPI();
-					break;
-
-				case 0xA2:
-					return ImplementINI();
-					break;
-
-				case 0xA3:
-					return ImplementOUTI();
-					break;
-
-				case 0xA4:
-				case 0xA5:
-				case 0xA6:
-				case 0xA7:
-					return ImplementNOP() + ImplementNOP();
-					break;
-
-				case 0xA8:
-					return ImplementLDD();
-					break;
-
-				case 0xA9:
-					return ImplementCPD();
-					break;
-
-				case 0xAA:
-					return ImplementIND();
-					break;
-
-				case 0xAB:
-					return ImplementOUTD();
-					break;
-
-				case 0xAC:
-				case 0xAD:
-				case 0xAE:
-				case 0xAF:
-					return ImplementNOP() + ImplementNOP();
-					break;
-
-				case 0xB0:
-					return ImplementLDIR();
-					break;
-
-				case 0xB1:
-					return ImplementCPIR();
-					break;
-
-				case 0xB2:
-					return ImplementINIR();
-					break;
-
-				case 0xB3:
-					return ImplementOTIR();
-					break;
-
-				case 0xB4:
-				case 0xB5:
-				case 0xB6:
-				case 0xB7:
-					return ImplementNOP() + ImplementNOP();
-					break;
-
-				case 0xB8:
-					return ImplementLDDR();
-					break;
-
-				case 0xB9:
-					return ImplementCPDR();
-					break;
-
-				case 0xBA:
-					return ImplementINDR();
-					break;
-
-				case 0xBB:
-					return ImplementOTDR();
-					break;
-
-				case 0xBC:
-				case 0xBD:
-				case 0xBE:
-				case 0xBF:
-				case 0xC0:
-				case 0xC1:
-				case 0xC2:
-				case 0xC3:
-				case 0xC4:
-				case 0xC5:
-				case 0xC6:
-				case 0xC7:
-				case 0xC8:
-				case 0xC9:
-				case 0xCA:
-				case 0xCB:
-				case 0xCC:
-				case 0xCD:
-				case 0xCE:
-				case 0xCF:
-				case 0xD0:
-				case 0xD1:
-				case 0xD2:
-				case 0xD3:
-				case 0xD4:
-				case 0xD5:
-				case 0xD6:
-				case 0xD7:
-				case 0xD8:
-				case 0xD9:
-				case 0xDA:
-				case 0xDB:
-				case 0xDC:
-				case 0xDD:
-				case 0xDE:
-				case 0xDF:
-				case 0xE0:
-				case 0xE1:
-				case 0xE2:
-				case 0xE3:
-				case 0xE4:
-				case 0xE5:
-				case 0xE6:
-				case 0xE7:
-				case 0xE8:
-				case 0xE9:
-				case 0xEA:
-				case 0xEB:
-				case 0xEC:
-				case 0xED:
-				case 0xEE:
-				case 0xEF:
-				case 0xF0:
-				case 0xF1:
-				case 0xF2:
-				case 0xF3:
-				case 0xF4:
-				case 0xF5:
-				case 0xF6:
-				case 0xF7:
-				case 0xF8:
-				case 0xF9:
-				case 0xFA:
-				case 0xFB:
-				case 0xFC:
-				case 0xFD:
-				case 0xFE:
-				case 0xFF:
-					return ImplementNOP() + ImplementNOP();
-					break;
-
-				default:
-					fprintf(stderr, "[Z80] Unhandled opcode ED %02X at address %04X\n", ReadMemory(m_PC + 1), m_PC);
-					HandleIllegalOpcode();
-					return 0;
-					break;
-			};
-			break;
-
-		case 0xFD: // Prefix FD
-			IncrementR(1);
-			switch (ReadMemory(m_PC + 1))
-			{
-				case 0x09: // ADD IY,BC
-				case 0x19: // ADD IY,DE
-				case 0x29: // ADD IY,HL
-				case 0x39: // ADD IY,SP
-					return ImplementADDIYdd();
-					break;
-
-				case 0x21:
-					return ImplementLDIYnn();
-					break;
-
-				case 0x22:
-					return ImplementLD_nn_IY();
-					break;
-
-				case 0x23:
-					return ImplementINCIY();
-					break;
-
-				case 0x24: // INC IYh
-					return ImplementINCIYh();
-					break;
-
-				case 0x25: // DEC IYh
-					return ImplementDECIYh();
-					break;
-
-				case 0x26: // LD IYh,n
-					return ImplementLDIYhn();
-					break;
-
-				case 0x2A:
-					return ImplementLDIY_nn_();
-					break;
-
-				case 0x2B:
-					return ImplementDECIY();
-					break;
-
-				case 0x2C: // INC IYl 
-					return ImplementINCIYl();
-					break;
-
-				case 0x2D: // DEC IYl
-					return ImplementDECIYl();
-					break;
-
-				case 0x2E: // LD IYl,n
-					return ImplementLDIYln();
-					break;
-
-				case 0x34:
-					return ImplementINC_IYd_();
-					break;
-
-				case 0x35:
-					return ImplementDEC_IYd_();
-					break;
-
-				case 0x36:
-					return ImplementLD_IYd_n();
-					break;
-
-				case 0x40: // LD B,B
-				case 0x41: // LD B,C
-				case 0x42: // LD B,D
-				case 0x43: // LD B,E
-				case 0x47: // LD B,A
-				case 0x50: // LD D,B
-				case 0x51: // LD D,C
-				case 0x52: // LD D,D
-				case 0x53: // LD D,E
-				case 0x57: // LD D,A
-				case 0x48: // LD C,B
-				case 0x49: // LD C,C
-				case 0x4A: // LD C,D
-				case 0x4B: // LD C,E
-				case 0x4F: // LD C,A
-				case 0x58: // LD E,B
-				case 0x59: // LD E,C
-				case 0x5A: // LD E,D
-				case 0x5B: // LD E,E
-				case 0x5F: // LD E,A
-				case 0x78: // LD A,B
-				case 0x79: // LD A,C
-				case 0x7A: // LD A,D
-				case 0x7B: // LD A,E
-				case 0x7F: // LD A,A
-					return 4 + ImplementLDrr();
-					break;
-
-				case 0x44: // LD B,IYh
-				case 0x54: // LD D,IYh
-				case 0x4C: // LD C,IYh
-				case 0x5C: // LD E,IYh
-				case 0x7C: // LD A,IYh
-					ImplementLDrIYh();
-					break;
-
-				case 0x45: // LD B,IYl
-				case 0x55: // LD D,IYl
-				case 0x4D: // LD C,IYl
-				case 0x5D: // LD E,IYl
-				case 0x7D: // LD A,IYl
-					ImplementLDrIYl();
-					break;
-
-				case 0x46: // LD B,(IY+d)
-				case 0x56: // LD D,(IY+d)
-				case 0x66: // LD H,(IY+d)
-				case 0x4E: // LD C,(IY+d)
-				case 0x5E: // LD E,(IY+d)
-				case 0x6E: // LD L,(IY+d)
-				case 0x7E: // LD A,(IY+d)
-					return ImplementLDr_IYd_();
-					break;
-
-				case 0x60: // LD IYh,B
-				case 0x61: // LD IYh,C
-				case 0x62: // LD IYh,D
-				case 0x63: // LD IYh,E
-				case 0x64: // LD IYh,IYh
-				case 0x65: // LD IYh,IYl
-				case 0x67: // LD IYh,A
-					return ImplementLDIYhr();
-					break;
-
-				case 0x68: // LD IYl,B
-				case 0x69: // LD IYl,C
-				case 0x6A: // LD IYl,D
-				case 0x6B: // LD IYl,E
-				case 0x6C: // LD IYl,IYh
-				case 0x6D: // LD IYl,IYl
-				case 0x6F: // LD IYl,A
-					return ImplementLDIYlr();
-					break;
-
-				case 0x70: // LD (IY+d),B
-				case 0x71: // LD (IY+d),C
-				case 0x72: // LD (IY+d),D
-				case 0x73: // LD (IY+d),E
-				case 0x74: // LD (IY+d),H
-				case 0x75: // LD (IY+d),L
-				case 0x77: // LD (IY+d),A
-					return ImplementLD_IYd_r();
-					break;
-
-				case 0x84: // ADD A,IYh
-					return ImplementADDAIYh();
-					break;
-
-				case 0x85: // ADD A,IYl
-					return ImplementADDAIYl();
-					break;
-
-				case 0x86:
-					return ImplementADDA_IYd_();
-					break;
-
-				case 0x8C: // ADC A,IYh
-					return ImplementADCAIYh();
-					break;
-
-				case 0x8D: // ADC A,IYl
-					return ImplementADCAIYl();
-					break;
-
-				case 0x8E:
-					return ImplementADCA_IYd_();
-					break;
-
-				case 0x94: // SUB IYh
-					return ImplementSUBIYh();
-					break;
-
-				case 0x95: // SUB IYl
-					return ImplementSUBIYl();
-					break;
-
-				case 0x96:
-					return ImplementSUB_IYd_();
-
-				case 0x9C: // SBC A,IYh
-					return ImplementSBCAIYh();
-					break;
-
-				case 0x9D: // SBC A,IYl
-					return ImplementSBCAIYl();
-					break;
-
-				case 0x9E:
-					return ImplementSBCA_IYd_();
-					break;
-
-				case 0xA4: // AND IYh
-					return ImplementANDIYh();
-					break;
-
-				case 0xA5: // AND IYl
-					return ImplementANDIYl();
-					break;
-
-				case 0xB4: // OR IYh
-					return ImplementORIYh();
-					break;
-
-				case 0xB5: // OR IYl
-					return ImplementORIYl();
-					break;
-
-				case 0xA6:
-					return ImplementAND_IYd_();
-					break;
-
-				case 0xAC: // XOR IYh
-					return ImplementXORIYh();
-					break;
-
-				case 0xAD: // XOR IYl
-					return ImplementXORIYl();
-					break;
-
-				case 0xAE:
-					return ImplementXOR_IYd_();
-					break;
-
-				case 0xB6:
-					return ImplementOR_IYd_();
-					break;
-
-				case 0xBC: // CP IYh
-					return ImplementCPIYh();
-					break;
-
-				case 0xBD: // CP IYl
-					return ImplementCPIYl();
-					break;
-
-				case 0xBE:
-					return ImplementCP_IYd_();
-					break;
-
-				case 0xE1:
-					return ImplementPOPIY();
-					break;
-
-				case 0xE3:
-					return ImplementEX_SP_IY();
-					break;
-
-				case 0xE5:
-					return ImplementPUSHIY();
-					break;
-
-				case 0xE9:
-					if (GetEnableProgramFlowBreakpoints())
-					{
-						HitBreakpoint("program flow");
-					}
-					return ImplementJP_IY_();
-					break;
-
-				case 0xCB: // Prefix CB
-					switch (ReadMemory(m_PC + 3))
-					{
-						case 0x00:
-						case 0x01:
-						case 0x02:
-						case 0x03:
-						case 0x04:
-						case 0x05:
-						case 0x06:
-						case 0x07:
-							return ImplementRLC_IYd_();
-							break;
-
-						case 0x08:
-						case 0x09:
-						case 0x0A:
-						case 0x0B:
-						case 0x0C:
-						case 0x0D:
-						case 0x0E:
-						case 0x0F:
-							return ImplementRRC_IYd_();
-							break;
-
-						case 0x10:
-						case 0x11:
-						case 0x12:
-						case 0x13:
-						case 0x14:
-						case 0x15:
-						case 0x16:
-						case 0x17:
-							return ImplementRL_IYd_();
-							break;
-
-						case 0x18:
-						case 0x19:
-						case 0x1A:
-						case 0x1B:
-						case 0x1C:
-						case 0x1D:
-						case 0x1E:
-						case 0x1F:
-							return ImplementRR_IYd_();
-							break;
-
-						case 0x20:
-						case 0x21:
-						case 0x22:
-						case 0x23:
-						case 0x24:
-						case 0x25:
-						case 0x26:
-						case 0x27:
-							return ImplementSLA_IYd_();
-							break;
-
-						case 0x28:
-						case 0x29:
-						case 0x2A:
-						case 0x2B:
-						case 0x2C:
-						case 0x2D:
-						case 0x2E:
-						case 0x2F:
-							return ImplementSRA_IYd_();
-							break;
-
-						case 0x30:
-						case 0x31:
-						case 0x32:
-						case 0x33:
-						case 0x34:
-						case 0x35:
-						case 0x36:
-						case 0x37:
-							return ImplementSLL_IYd_();
-							break;
-
-						case 0x38:
-						case 0x39:
-						case 0x3A:
-						case 0x3B:
-						case 0x3C:
-						case 0x3D:
-						case 0x3E:
-						case 0x3F:
-							return ImplementSRL_IYd_();
-							break;
-
-						case 0x40:
-						case 0x41:
-						case 0x42:
-						case 0x43:
-						case 0x44:
-						case 0x45:
-						case 0x46: // BIT 0,(IY+d)
-						case 0x47:
-						case 0x48:
-						case 0x49:
-						case 0x4A:
-						case 0x4B:
-						case 0x4C:
-						case 0x4D:
-						case 0x4E: // BIT 1,(IY+d)
-						case 0x4F:
-						case 0x50:
-						case 0x51:
-						case 0x52:
-						case 0x53:
-						case 0x54:
-						case 0x55:
-						case 0x56: // BIT 2,(IY+d)
-						case 0x57:
-						case 0x58:
-						case 0x59:
-						case 0x5A:
-						case 0x5B:
-						case 0x5C:
-						case 0x5D:
-						case 0x5E: // BIT 3,(IY+d)
-						case 0x5F:
-						case 0x60:
-						case 0x61:
-						case 0x62:
-						case 0x63:
-						case 0x64:
-						case 0x65:
-						case 0x66: // BIT 4,(IY+d)
-						case 0x67:
-						case 0x68:
-						case 0x69:
-						case 0x6A:
-						case 0x6B:
-						case 0x6C:
-						case 0x6D:
-						case 0x6E: // BIT 5,(IY+d)
-						case 0x6F:
-						case 0x70:
-						case 0x71:
-						case 0x72:
-						case 0x73:
-						case 0x74:
-						case 0x75:
-						case 0x76: // BIT 6,(IY+d)
-						case 0x77:
-						case 0x78:
-						case 0x79:
-						case 0x7A:
-						case 0x7B:
-						case 0x7C:
-						case 0x7D:
-						case 0x7E: // BIT 7,(IY+d)
-						case 0x7F:
-							return ImplementBITb_IYd_();
-							break;
-
-						case 0x80:
-						case 0x81:
-						case 0x82:
-						case 0x83:
-						case 0x84:
-						case 0x85:
-						case 0x86: // RES 0,(IY+d)
-						case 0x87:
-						case 0x88:
-						case 0x89:
-						case 0x8A:
-						case 0x8B:
-						case 0x8C:
-						case 0x8D:
-						case 0x8E: // RES 1,(IY+d)
-						case 0x8F:
-						case 0x90:
-						case 0x91:
-						case 0x92:
-						case 0x93:
-						case 0x94:
-						case 0x95:
-						case 0x96: // RES 2,(IY+d)
-						case 0x97:
-						case 0x98:
-						case 0x99:
-						case 0x9A:
-						case 0x9B:
-						case 0x9C:
-						case 0x9D:
-						case 0x9E: // RES 3,(IY+d)
-						case 0x9F:
-						case 0xA0:
-						case 0xA1:
-						case 0xA2:
-						case 0xA3:
-						case 0xA4:
-						case 0xA5:
-						case 0xA6: // RES 4,(IY+d)
-						case 0xA7:
-						case 0xA8:
-						case 0xA9:
-						case 0xAA:
-						case 0xAB:
-						case 0xAC:
-						case 0xAD:
-						case 0xAE: // RES 5,(IY+d)
-						case 0xAF:
-						case 0xB0:
-						case 0xB1:
-						case 0xB2:
-						case 0xB3:
-						case 0xB4:
-						case 0xB5:
-						case 0xB6: // RES 6,(IY+d)
-						case 0xB7:
-						case 0xB8:
-						case 0xB9:
-						case 0xBA:
-						case 0xBB:
-						case 0xBC:
-						case 0xBD:
-						case 0xBE: // RES 7,(IY+d)
-						case 0xBF:
-							return ImplementRESb_IYd_();
-							break;
-
-						case 0xC0:
-						case 0xC1:
-						case 0xC2:
-						case 0xC3:
-						case 0xC4:
-						case 0xC5:
-						case 0xC6: // SET 0,(IY+d)
-						case 0xC7:
-						case 0xC8:
-						case 0xC9:
-						case 0xCA:
-						case 0xCB:
-						case 0xCC:
-						case 0xCD:
-						case 0xCE: // SET 1,(IY+d)
-						case 0xCF:
-						case 0xD0:
-						case 0xD1:
-						case 0xD2:
-						case 0xD3:
-						case 0xD4:
-						case 0xD5:
-						case 0xD6: // SET 2,(IY+d)
-						case 0xD7:
-						case 0xD8:
-						case 0xD9:
-						case 0xDA:
-						case 0xDB:
-						case 0xDC:
-						case 0xDD:
-						case 0xDE: // SET 3,(IY+d)
-						case 0xDF:
-						case 0xE0:
-						case 0xE1:
-						case 0xE2:
-						case 0xE3:
-						case 0xE4:
-						case 0xE5:
-						case 0xE6: // SET 4,(IY+d)
-						case 0xE7:
-						case 0xE8:
-						case 0xE9:
-						case 0xEA:
-						case 0xEB:
-						case 0xEC:
-						case 0xED:
-						case 0xEE: // SET 5,(IY+d)
-						case 0xEF:
-						case 0xF0:
-						case 0xF1:
-						case 0xF2:
-						case 0xF3:
-						case 0xF4:
-						case 0xF5:
-						case 0xF6: // SET 6,(IY+d)
-						case 0xF7:
-						case 0xF8:
-						case 0xF9:
-						case 0xFA:
-						case 0xFB:
-						case 0xFC:
-						case 0xFD:
-						case 0xFE: // SET 7,(IY+d)
-						case 0xFF:
-							return ImplementSETb_IYd_();
-							break;
-
-						default:
-							fprintf(stderr, "[Z80] Unhandled opcode FD CB %02X %02X at address %04X\n", ReadMemory(m_PC + 2), ReadMemory(m_PC + 3), m_PC);
-							HandleIllegalOpcode();
-							return 0;
-							break;
-					};
-					break;
-
-				case 0xF9:
-					return ImplementLDSPIY();
-					break;
-
-				default:
-					fprintf(stderr, "[Z80] Unhandled opcode FD %02X at address %04X\n", ReadMemory(m_PC + 1), m_PC);
-					HandleIllegalOpcode();
-					return 0;
-					break;
-			};
-			break;
-
-		case 0xCE:
-			return ImplementADCAn();
-			break;
-
-		case 0xDE:
-			return ImplementSBCAn();
-			break;
-
-		case 0xEE:
-			return ImplementXORn();
-			break;
-
-		case 0xFE:
-			return ImplementCPn();
-			break;
-
-		default:
-			fprintf(stderr, "[Z80] Unhandled opcode %02X at address %04X\n", ReadMemory(m_PC), m_PC);
-			HandleIllegalOpcode();
-			return 0;
-			break;
-	}
-}
-
-//=============================================================================
-
-void CZ80::Decode(uint16& address, char* pMnemonic) const
-{
-		switch (ReadMemory(address))
-		{
-			case 0x00:
-				DecodeNOP(address, pMnemonic);
-				break;
-
-			case 0x10:
-				DecodeDJNZe(address, pMnemonic);
-				break;
-
-			case 0x20:
-				DecodeJRNZe(address, pMnemonic);
-				break;
-
-			case 0x30:
-				DecodeJRNCe(address, pMnemonic);
-				break;
-
-			case 0x01: // LD BC,nn
-			case 0x11: // LD DE,nn
-			case 0x21: // LD HL,nn
-			case 0x31: // LD SP,nn
-				DecodeLDddnn(address, pMnemonic);
-				break;
-
-			case 0x02:
-				DecodeLD_BC_A(address, pMnemonic);
-				break;
-
-			case 0x12:
-				DecodeLD_DE_A(address, pMnemonic);
-				break;
-
-			case 0x22:
-				DecodeLD_nn_HL(address, pMnemonic);
-				break;
-
-			case 0x32:
-				DecodeLD_nn_A(address, pMnemonic);
-				break;
-
-			case 0x03: // INC BC
-			case 0x13: // INC DE
-			case 0x23: // INC HL
-			case 0x33: // INC SP
-				DecodeINCdd(address, pMnemonic);
-				break;
-
-			case 0x04: // INC B
-			case 0x14: // INC D
-			case 0x24: // INC H
-			case 0x34: // INC (HL)
-			case 0x0C: // INC C
-			case 0x1C: // INC E
-			case 0x2C: // INC L
-			case 0x3C: // INC A
-				DecodeINCr(address, pMnemonic);
-				break;
-
-			case 0x05: // DEC B
-			case 0x15: // DEC D
-			case 0x25: // DEC H
-			case 0x35: // DEC (HL)
-			case 0x0D: // DEC C
-			case 0x1D: // DEC E
-			case 0x2D: // DEC L
-			case 0x3D: // DEC A
-				DecodeDECr(address, pMnemonic);
-				break;
-
-			case 0x06: // LD B,n
-			case 0x16: // LD D,n
-			case 0x26: // LD H,n
-			case 0x0E: // LD C,n
-			case 0x1E: // LD E,n
-			case 0x2E: // LD L,n
-			case 0x3E: // LD A,n
-				DecodeLDrn(address, pMnemonic);
-				break;
-
-			case 0x36:
-				DecodeLD_HL_n(address, pMnemonic);
-				break;
-
-			case 0x07:
-				DecodeRLCA(address, pMnemonic);
-				break;
-
-			case 0x17:
-				DecodeRLA(address, pMnemonic);
-				break;
-
-			case 0x27:
-				DecodeDAA(address, pMnemonic);
-				break;
-
-			case 0x37:
-				DecodeSCF(address, pMnemonic);
-				break;
-
-			case 0x08:
-				DecodeEXAFAF(address, pMnemonic);
-				break;
-
-			case 0x18:
-				DecodeJRe(address, pMnemonic);
-				break;
-
-			case 0x28:
-				DecodeJRZe(address, pMnemonic);
-				break;
-
-			case 0x38:
-				DecodeJRCe(address, pMnemonic);
-				break;
-
-			case 0x09: // ADD HL,BC
-			case 0x19: // ADD HL,DE
-			case 0x29: // ADD HL,HL
-			case 0x39: // ADD HL,SP
-				DecodeADDHLdd(address, pMnemonic);
-				break;
-
-			case 0x0A:
-				DecodeLDA_BC_(address, pMnemonic);
-				break;
-
-			case 0x1A:
-				DecodeLDA_DE_(address, pMnemonic);
-				break;
-
-			case 0x2A:
-				DecodeLDHL_nn_(address, pMnemonic);
-				break;
-
-			case 0x3A:
-				DecodeLDA_nn_(address, pMnemonic);
-				break;
-
-			case 0x0B: // DEC BC
-			case 0x1B: // DEC DE
-			case 0x2B: // DEC HL
-			case 0x3B: // DEC SP
-				DecodeDECdd(address, pMnemonic);
-				break;
-
-			case 0x0F:
-				DecodeRRCA(address, pMnemonic);
-				break;
-
-			case 0x1F:
-				DecodeRRA(address, pMnemonic);
-				break;
-
-			case 0x2F:
-				DecodeCPL(address, pMnemonic);
-				break;
-
-			case 0x3F:
-				DecodeCCF(address, pMnemonic);
-				break;
-
-			case 0x40: // LD B,B
-			case 0x41: // LD B,C
-			case 0x42: // LD B,D
-			case 0x43: // LD B,E
-			case 0x44: // LD B,H
-			case 0x45: // LD B,L
-			case 0x46: // LD B,(HL)
-			case 0x47: // LD B,A
-			case 0x50: // LD D,B
-			case 0x51: // LD D,C
-			case 0x52: // LD D,D
-			case 0x53: // LD D,E
-			case 0x54: // LD D,H
-			case 0x55: // LD D,L
-			case 0x56: // LD D,(HL)
-			case 0x57: // LD D,A
-			case 0x60: // LD H,B
-			case 0x61: // LD H,C
-			case 0x62: // LD H,D
-			case 0x63: // LD H,E
-			case 0x64: // LD H,H
-			case 0x65: // LD H,L
-			case 0x66: // LD H,(HL)
-			case 0x67: // LD H,A
-			case 0x48: // LD C,B
-			case 0x49: // LD C,C
-			case 0x4A: // LD C,D
-			case 0x4B: // LD C,E
-			case 0x4C: // LD C,H
-			case 0x4D: // LD C,L
-			case 0x4E: // LD C,(HL)
-			case 0x4F: // LD C,A
-			case 0x58: // LD E,B
-			case 0x59: // LD E,C
-			case 0x5A: // LD E,D
-			case 0x5B: // LD E,E
-			case 0x5C: // LD E,H
-			case 0x5D: // LD E,L
-			case 0x5E: // LD E,(HL)
-			case 0x5F: // LD E,A
-			case 0x68: // LD L,B
-			case 0x69: // LD L,C
-			case 0x6A: // LD L,D
-			case 0x6B: // LD L,E
-			case 0x6C: // LD L,H
-			case 0x6D: // LD L,L
-			case 0x6E: // LD L,(HL)
-			case 0x6F: // LD L,A
-			case 0x70: // LD (HL),B
-			case 0x71: // LD (HL),C
-			case 0x72: // LD (HL),D
-			case 0x73: // LD (HL),E
-			case 0x74: // LD (HL),H
-			case 0x75: // LD (HL),L
-			case 0x77: // LD (HL),A
-			case 0x78: // LD A,B
-			case 0x79: // LD A,C
-			case 0x7A: // LD A,D
-			case 0x7B: // LD A,E
-			case 0x7C: // LD A,H
-			case 0x7D: // LD A,L
-			case 0x7F: // LD A,A
-			case 0x7E: // LD A,(HL)
-				DecodeLDrr(address, pMnemonic);
-				break;
-
-			case 0x76:
-				DecodeHALT(address, pMnemonic);
-				break;
-
-			case 0x80: // ADD A,B
-			case 0x81: // ADD A,C
-			case 0x82: // ADD A,D
-			case 0x83: // ADD A,E
-			case 0x84: // ADD A,H
-			case 0x85: // ADD A,L
-			case 0x86: // ADD A,(HL)
-			case 0x87: // ADD A,A
-				DecodeADDAr(address, pMnemonic);
-				break;
-
-			case 0x90: // SUB B
-			case 0x91: // SUB C
-			case 0x92: // SUB D
-			case 0x93: // SUB E
-			case 0x94: // SUB H
-			case 0x95: // SUB L
-			case 0x96: // SUB (HL)
-			case 0x97: // SUB A
-				DecodeSUBr(address, pMnemonic);
-				break;
-
-			case 0xA0: // AND B
-			case 0xA1: // AND C
-			case 0xA2: // AND D
-			case 0xA3: // AND E
-			case 0xA4: // AND H
-			case 0xA5: // AND L
-			case 0xA6: // AND (HL)
-			case 0xA7: // AND A
-				DecodeANDr(address, pMnemonic);
-				break;
-
-			case 0xB0: // OR B
-			case 0xB1: // OR C
-			case 0xB2: // OR D
-			case 0xB3: // OR E
-			case 0xB4: // OR H
-			case 0xB5: // OR L
-			case 0xB6: // OR (HL)
-			case 0xB7: // OR A
-				DecodeORr(address, pMnemonic);
-				break;
-
-			case 0x88: // ADC A,B
-			case 0x89: // ADC A,C
-			case 0x8A: // ADC A,D
-			case 0x8B: // ADC A,E
-			case 0x8C: // ADC A,H
-			case 0x8D: // ADC A,L
-			case 0x8E: // ADC A,(HL)
-			case 0x8F: // ADC A,A
-				DecodeADCAr(address, pMnemonic);
-				break;
-
-			case 0x98: // SBC A,B
-			case 0x99: // SBC A,C
-			case 0x9A: // SBC A,D
-			case 0x9B: // SBC A,E
-			case 0x9C: // SBC A,H
-			case 0x9D: // SBC A,L
-			case 0x9E: // SBC A,(HL)
-			case 0x9F: // SBC A,A
-				DecodeSBCAr(address, pMnemonic);
-				break;
-
-			case 0xA8: // XOR B
-			case 0xA9: // XOR C
-			case 0xAA: // XOR D
-			case 0xAB: // XOR E
-			case 0xAC: // XOR H
-			case 0xAD: // XOR L
-			case 0xAE: // XOR (HL)
-			case 0xAF: // XOR A
-				DecodeXORr(address, pMnemonic);
-				break;
-
-			case 0xB8: // CP B
-			case 0xB9: // CP C
-			case 0xBA: // CP D
-			case 0xBB: // CP E
-			case 0xBC: // CP H
-			case 0xBD: // CP L
-			case 0xBE: // CP (HL)
-			case 0xBF: // CP A
-				DecodeCPr(address, pMnemonic);
-				break;
-
-			case 0xC0: // RET NZ
-			case 0xD0: // RET NC
-			case 0xE0: // RET PO
-			case 0xF0: // RET P
-			case 0xC8: // RET Z
-			case 0xD8: // RET C
-			case 0xE8: // RET PE
-			case 0xF8: // RET M
-				DecodeRETcc(address, pMnemonic);
-				break;
-
-			case 0xC1: // POP BC
-			case 0xD1: // POP DE
-			case 0xE1: // POP HL
-				DecodePOPqq(address, pMnemonic);
-				break;
-
-			case 0xF1: // POP AF
-				DecodePOPAF(address, pMnemonic);
-				break;
-
-			case 0xC2: // JP NZ,nn
-			case 0xD2: // JP NC,nn
-			case 0xE2: // JP PO,nn
-			case 0xF2: // JP P,nn
-			case 0xCA: // JP Z,nn
-			case 0xDA: // JP C,nn
-			case 0xEA: // JP PE,nn
-			case 0xFA: // JP M,nn
-				DecodeJPccnn(address, pMnemonic);
-				break;
-
-			case 0xC3:
-				DecodeJPnn(address, pMnemonic);
-				break;
-
-			case 0xD3:
-				DecodeOUT_n_A(address, pMnemonic);
-				break;
-
-			case 0xE3:
-				DecodeEX_SP_HL(address, pMnemonic);
-				break;
-
-			case 0xF3:
-				DecodeDI(address, pMnemonic);
-				break;
-
-			case 0xC4: // CALL NZ,nn
-			case 0xD4: // CALL NC,nn
-			case 0xE4: // CALL PO,nn
-			case 0xF4: // CALL P,nn
-			case 0xCC: // CALL Z,nn
-			case 0xDC: // CALL C,nn
-			case 0xEC: // CALL PE,nn
-			case 0xFC: // CALL M,nn
-				DecodeCALLccnn(address, pMnemonic);
-				break;
-
-			case 0xC5: // PUSH BC
-			case 0xD5: // PUSH DE
-			case 0xE5: // PUSH HL
-				DecodePUSHqq(address, pMnemonic);
-				break;
-
-			case 0xF5: // PUSH AF
-				DecodePUSHAF(address, pMnemonic);
-				break;
-
-			case 0xC6:
-				DecodeADDAn(address, pMnemonic);
-				break;
-
-			case 0xD6:
-				DecodeSUBn(address, pMnemonic);
-				break;
-
-			case 0xE6:
-				DecodeANDn(address, pMnemonic);
-				break;
-
-			case 0xF6:
-				DecodeORn(address, pMnemonic);
-				break;
-
-			case 0xC7: // RST 0
-			case 0xD7: // RST 16
-			case 0xE7: // RST 32
-			case 0xF7: // RST 48
-			case 0xCF: // RST 8
-			case 0xDF: // RST 24
-			case 0xEF: // RST 40
-			case 0xFF: // RST 56
-				DecodeRSTp(address, pMnemonic);
-				break;
-
-			case 0xC9:
-				DecodeRET(address, pMnemonic);
-				break;
-
-			case 0xD9:
-				DecodeEXX(address, pMnemonic);
-				break;
-
-			case 0xE9:
-				DecodeJP_HL_(address, pMnemonic);
-				break;
-
-			case 0xF9:
-				DecodeLDSPHL(address, pMnemonic);
-				break;
-
-			case 0xCB: // Prefix CB
-				switch (ReadMemory(address + 1))
-				{
-					case 0x00: // RLC B
-					case 0x01: // RLC C
-					case 0x02: // RLC D
-					case 0x03: // RLC E
-					case 0x04: // RLC H
-					case 0x05: // RLC L
-					case 0x06: // RLC (HL)
-					case 0x07: // RLC A
-						DecodeRLCr(address, pMnemonic);
-						break;
-
-					case 0x08: // RRC B
-					case 0x09: // RRC C
-					case 0x0A: // RRC D
-					case 0x0B: // RRC E
-					case 0x0C: // RRC H
-					case 0x0D: // RRC L
-					case 0x0E: // RRC (HL)
-					case 0x0F: // RRC A
-						DecodeRRCr(address, pMnemonic);
-						break;
-
-					case 0x10: // RL B
-					case 0x11: // RL C
-					case 0x12: // RL D
-					case 0x13: // RL E
-					case 0x14: // RL H
-					case 0x15: // RL L
-					case 0x16: // RL (HL)
-					case 0x17: // RL A
-						DecodeRLr(address, pMnemonic);
-						break;
-
-					case 0x18: // RR B
-					case 0x19: // RR C
-					case 0x1A: // RR D
-					case 0x1B: // RR E
-					case 0x1C: // RR H
-					case 0x1D: // RR L
-					case 0x1E: // RR (HL)
-					case 0x1F: // RR A
-						DecodeRRr(address, pMnemonic);
-						break;
-
-					case 0x20: // SLA B
-					case 0x21: // SLA C
-					case 0x22: // SLA D
-					case 0x23: // SLA E
-					case 0x24: // SLA H
-					case 0x25: // SLA L
-					case 0x26: // SLA (HL)
-					case 0x27: // SLA A
-						DecodeSLAr(address, pMnemonic);
-						break;
-
-					case 0x28: // SRA B
-					case 0x29: // SRA C
-					case 0x2A: // SRA D
-					case 0x2B: // SRA E
-					case 0x2C: // SRA H
-					case 0x2D: // SRA L
-					case 0x2E: // SRA (HL)
-					case 0x2F: // SRA A
-						DecodeSRAr(address, pMnemonic);
-						break;
-
-					case 0x30: // SLL B
-					case 0x31: // SLL C
-					case 0x32: // SLL D
-					case 0x33: // SLL E
-					case 0x34: // SLL H
-					case 0x35: // SLL L
-					case 0x36: // SLL (HL)
-					case 0x37: // SLL A
-						DecodeSLLr(address, pMnemonic);
-						break;
-
-					case 0x38: // SRL B
-					case 0x39: // SRL C
-					case 0x3A: // SRL D
-					case 0x3B: // SRL E
-					case 0x3C: // SRL H
-					case 0x3D: // SRL L
-					case 0x3E: // SRL (HL)
-					case 0x3F: // SRL A
-						DecodeSRLr(address, pMnemonic);
-						break;
-
-					case 0x40: // BIT 0,B
-					case 0x41: // BIT 0,C
-					case 0x42: // BIT 0,D
-					case 0x43: // BIT 0,E
-					case 0x44: // BIT 0,H
-					case 0x45: // BIT 0,L
-					case 0x47: // BIT 0,A
-					case 0x46: // BIT 0,(HL)
-					case 0x48: // BIT 1,B
-					case 0x49: // BIT 1,C
-					case 0x4A: // BIT 1,D
-					case 0x4B: // BIT 1,E
-					case 0x4C: // BIT 1,H
-					case 0x4D: // BIT 1,L
-					case 0x4E: // BIT 1,(HL)
-					case 0x4F: // BIT 1,A
-					case 0x50: // BIT 2,B
-					case 0x51: // BIT 2,C
-					case 0x52: // BIT 2,D
-					case 0x53: // BIT 2,E
-					case 0x54: // BIT 2,H
-					case 0x55: // BIT 2,L
-					case 0x56: // BIT 2,(HL)
-					case 0x57: // BIT 2,A
-					case 0x58: // BIT 3,B
-					case 0x59: // BIT 3,C
-					case 0x5A: // BIT 3,D
-					case 0x5B: // BIT 3,E
-					case 0x5C: // BIT 3,H
-					case 0x5D: // BIT 3,L
-					case 0x5E: // BIT 3,(HL)
-					case 0x5F: // BIT 3,A
-					case 0x60: // BIT 4,B
-					case 0x61: // BIT 4,C
-					case 0x62: // BIT 4,D
-					case 0x63: // BIT 4,E
-					case 0x64: // BIT 4,H
-					case 0x65: // BIT 4,L
-					case 0x66: // BIT 4,(HL)
-					case 0x67: // BIT 4,A
-					case 0x68: // BIT 5,B
-					case 0x69: // BIT 5,C
-					case 0x6A: // BIT 5,D
-					case 0x6B: // BIT 5,E
-					case 0x6C: // BIT 5,H
-					case 0x6D: // BIT 5,L
-					case 0x6E: // BIT 5,(HL)
-					case 0x6F: // BIT 5,A
-					case 0x70: // BIT 6,B
-					case 0x71: // BIT 6,C
-					case 0x72: // BIT 6,D
-					case 0x73: // BIT 6,E
-					case 0x74: // BIT 6,H
-					case 0x75: // BIT 6,L
-					case 0x76: // BIT 6,(HL)
-					case 0x77: // BIT 6,A
-					case 0x78: // BIT 7,B
-					case 0x79: // BIT 7,C
-					case 0x7A: // BIT 7,D
-					case 0x7B: // BIT 7,E
-					case 0x7C: // BIT 7,H
-					case 0x7D: // BIT 7,L
-					case 0x7E: // BIT 7,(HL)
-					case 0x7F: // BIT 7,A
-						DecodeBITbr(address, pMnemonic);
-						break;
-
-					case 0x80: // RES 0,B
-					case 0x81: // RES 0,C
-					case 0x82: // RES 0,D
-					case 0x83: // RES 0,E
-					case 0x84: // RES 0,H
-					case 0x85: // RES 0,L
-					case 0x86: // RES 0,(HL)
-					case 0x87: // RES 0,A
-					case 0x88: // RES 1,B
-					case 0x89: // RES 1,C
-					case 0x8A: // RES 1,D
-					case 0x8B: // RES 1,E
-					case 0x8C: // RES 1,H
-					case 0x8D: // RES 1,L
-					case 0x8E: // RES 1,(HL)
-					case 0x8F: // RES 1,A
-					case 0x90: // RES 2,B
-					case 0x91: // RES 2,C
-					case 0x92: // RES 2,D
-					case 0x93: // RES 2,E
-					case 0x94: // RES 2,H
-					case 0x95: // RES 2,L
-					case 0x96: // RES 2,(HL)
-					case 0x97: // RES 2,A
-					case 0x98: // RES 3,B
-					case 0x99: // RES 3,C
-					case 0x9A: // RES 3,D
-					case 0x9B: // RES 3,E
-					case 0x9C: // RES 3,H
-					case 0x9D: // RES 3,L
-					case 0x9E: // RES 3,(HL)
-					case 0x9F: // RES 3,A
-					case 0xA0: // RES 4,B
-					case 0xA1: // RES 4,C
-					case 0xA2: // RES 4,D
-					case 0xA3: // RES 4,E
-					case 0xA4: // RES 4,H
-					case 0xA5: // RES 4,L
-					case 0xA6: // RES 4,(HL)
-					case 0xA7: // RES 4,A
-					case 0xA8: // RES 5,B
-					case 0xA9: // RES 5,C
-					case 0xAA: // RES 5,D
-					case 0xAB: // RES 5,E
-					case 0xAC: // RES 5,H
-					case 0xAD: // RES 5,L
-					case 0xAE: // RES 5,(HL)
-					case 0xAF: // RES 5,A
-					case 0xB0: // RES 6,B
-					case 0xB1: // RES 6,C
-					case 0xB2: // RES 6,D
-					case 0xB3: // RES 6,E
-					case 0xB4: // RES 6,H
-					case 0xB5: // RES 6,L
-					case 0xB6: // RES 6,(HL)
-					case 0xB7: // RES 6,A
-					case 0xB8: // RES 7,B
-					case 0xB9: // RES 7,C
-					case 0xBA: // RES 7,D
-					case 0xBB: // RES 7,E
-					case 0xBC: // RES 7,H
-					case 0xBD: // RES 7,L
-					case 0xBE: // RES 7,(HL)
-					case 0xBF: // RES 7,A
-						DecodeRESbr(address, pMnemonic);
-						break;
-
-					case 0xC0: // SET 0,B
-					case 0xC1: // SET 0,C
-					case 0xC2: // SET 0,D
-					case 0xC3: // SET 0,E
-					case 0xC4: // SET 0,H
-					case 0xC5: // SET 0,L
-					case 0xC6: // SET 0,(HL)
-					case 0xC7: // SET 0,A
-					case 0xC8: // SET 1,B
-					case 0xC9: // SET 1,C
-					case 0xCA: // SET 1,D
-					case 0xCB: // SET 1,E
-					case 0xCC: // SET 1,H
-					case 0xCD: // SET 1,L
-					case 0xCE: // SET 1,(HL)
-					case 0xCF: // SET 1,A
-					case 0xD0: // SET 2,B
-					case 0xD1: // SET 2,C
-					case 0xD2: // SET 2,D
-					case 0xD3: // SET 2,E
-					case 0xD4: // SET 2,H
-					case 0xD5: // SET 2,L
-					case 0xD6: // SET 2,(HL)
-					case 0xD7: // SET 2,A
-					case 0xD8: // SET 3,B
-					case 0xD9: // SET 3,C
-					case 0xDA: // SET 3,D
-					case 0xDB: // SET 3,E
-					case 0xDC: // SET 3,H
-					case 0xDD: // SET 3,L
-					case 0xDE: // SET 3,(HL)
-					case 0xDF: // SET 3,A
-					case 0xE0: // SET 4,B
-					case 0xE1: // SET 4,C
-					case 0xE2: // SET 4,D
-					case 0xE3: // SET 4,E
-					case 0xE4: // SET 4,H
-					case 0xE6: // SET 4,(HL)
-					case 0xE5: // SET 4,L
-					case 0xE7: // SET 4,A
-					case 0xE8: // SET 5,B
-					case 0xE9: // SET 5,C
-					case 0xEA: // SET 5,D
-					case 0xEB: // SET 5,E
-					case 0xEC: // SET 5,H
-					case 0xED: // SET 5,L
-					case 0xEE: // SET 5,(HL)
-					case 0xEF: // SET 5,A
-					case 0xF0: // SET 6,B
-					case 0xF1: // SET 6,C
-					case 0xF2: // SET 6,D
-					case 0xF3: // SET 6,E
-					case 0xF4: // SET 6,H
-					case 0xF5: // SET 6,L
-					case 0xF7: // SET 6,A
-					case 0xF6: // SET 6,(HL)
-					case 0xF8: // SET 7,B
-					case 0xF9: // SET 7,C
-					case 0xFA: // SET 7,D
-					case 0xFB: // SET 7,E
-					case 0xFC: // SET 7,H
-					case 0xFD: // SET 7,L
-					case 0xFE: // SET 7,(HL)
-					case 0xFF: // SET 7,A
-						DecodeSETbr(address, pMnemonic);
-						break;
-
-				default:
-					fprintf(stderr, "[Z80] Error decoding unhandled opcode CB %02X at address %04X\n", ReadMemory(address + 1), address);
-					HandleIllegalOpcode();
-					return;
-					break;
-				};
-				break;
-
-			case 0xDB:
-				DecodeINA_n_(address, pMnemonic);
-				break;
-
-			case 0xEB:
-				DecodeEXDEHL(address, pMnemonic);
-				break;
-
-			case 0xFB:
-				DecodeEI(address, pMnemonic);
-				break;
-
-			case 0xCD:
-				DecodeCALLnn(address, pMnemonic);
-				break;
-
-			case 0xDD: // Prefix DD
-				switch (ReadMemory(address + 1))
-				{
-					case 0x46: // LD B,(IX+d)
-					case 0x56: // LD D,(IX+d)
-					case 0x66: // LD H,(IX+d)
-					case 0x4E: // LD C,(IX+d)
-					case 0x5E: // LD E,(IX+d)
-					case 0x6E: // LD L,(IX+d)
-					case 0x7E: // LD A,(IX+d)
-						DecodeLDr_IXd_(address, pMnemonic);
-						break;
-
-					case 0x60: // LD IXh,B
-					case 0x61: // LD IXh,C
-					case 0x62: // LD IXh,D
-					case 0x63: // LD IXh,E
-					case 0x64: // LD IXh,IXh
-					case 0x65: // LD IXh,IXl
-					case 0x67: // LD IXh,A
-						return DecodeLDIXhr(address, pMnemonic);
-						break;
-
-					case 0x68: // LD IXl,B
-					case 0x69: // LD IXl,C
-					case 0x6A: // LD IXl,D
-					case 0x6B: // LD IXl,E
-					case 0x6C: // LD IXl,IXh
-					case 0x6D: // LD IXl,IXl
-					case 0x6F: // LD IXl,A
-						return DecodeLDIXlr(address, pMnemonic);
-						break;
-
-					case 0x70: // LD (IX+d),B
-					case 0x71: // LD (IX+d),C
-					case 0x72: // LD (IX+d),D
-					case 0x73: // LD (IX+d),E
-					case 0x74: // LD (IX+d),H
-					case 0x75: // LD (IX+d),L
-					case 0x77: // LD (IX+d),A
-						DecodeLD_IXd_r(address, pMnemonic);
-						break;
-
-					case 0x09: // ADD IX,BC
-					case 0x19: // ADD IX,DE
-					case 0x29: // ADD IX,HL
-					case 0x39: // ADD IX,SP
-						DecodeADDIXdd(address, pMnemonic);
-						break;
-
-					case 0x23:
-						DecodeINCIX(address, pMnemonic);
-						break;
-
-					case 0x24: // INC IXh
-						DecodeINCIXh(address, pMnemonic);
-						break;
-
-					case 0x25: // DEC IXh
-						DecodeDECIXh(address, pMnemonic);
-						break;
-
-					case 0x26: // LD IXh,n
-						return DecodeLDIXhn(address, pMnemonic);
-						break;
-
-					case 0x2C: // INC IXl 
-						DecodeDECIXl(address, pMnemonic);
-						break;
-
-					case 0x2D: // DEC IXl
-						DecodeDECIXl(address, pMnemonic);
-						break;
-
-					case 0x2E: // LD IXl,n
-						return DecodeLDIXln(address, pMnemonic);
-						break;
-
-					case 0x2B:
-						DecodeDECIX(address, pMnemonic);
-						break;
-
-					case 0x34:
-						DecodeINC_IXd_(address, pMnemonic);
-						break;
-
-					case 0x35:
-						DecodeDEC_IXd_(address, pMnemonic);
-						break;
-
-					case 0x36:
-						DecodeLD_IXd_n(address, pMnemonic);
-						break;
-
-					case 0xE9:
-						DecodeJP_IX_(address, pMnemonic);
-						break;
-
-					case 0x21:
-						DecodeLDIXnn(address, pMnemonic);
-						break;
-
-					case 0x22:
-						DecodeLD_nn_IX(address, pMnemonic);
-						break;
-
-					case 0x2A:
-						DecodeLDIX_nn_(address, pMnemonic);
-						break;
-
-					case 0xF9:
-						DecodeLDSPIX(address, pMnemonic);
-						break;
-
-					case 0xE5:
-						DecodePUSHIX(address, pMnemonic);
-						break;
-
-					case 0xE1:
-						DecodePOPIX(address, pMnemonic);
-						break;
-
-					case 0xE3:
-						DecodeEX_SP_IX(address, pMnemonic);
-						break;
-
-					case 0x86:
-						DecodeADDA_IXd_(address, pMnemonic);
-						break;
-
-					case 0x96:
-						DecodeSUB_IXd_(address, pMnemonic);
-
-					case 0xA6:
-						DecodeAND_IXd_(address, pMnemonic);
-						break;
-
-					case 0xB6:
-						DecodeOR_IXd_(address, pMnemonic);
-						break;
-
-					case 0x8E:
-						DecodeADCA_IXd_(address, pMnemonic);
-						break;
-
-					case 0x9E:
-						DecodeSBCA_IXd_(address, pMnemonic);
-						break;
-
-					case 0xAE:
-						DecodeXOR_IXd_(address, pMnemonic);
-						break;
-
-					case 0xBE:
-						DecodeCP_IXd_(address, pMnemonic);
-						break;
-
-					case 0xCB: // Prefix CB
-						switch (ReadMemory(address + 3))
-						{
-							case 0x00:
-							case 0x01:
-							case 0x02:
-							case 0x03:
-							case 0x04:
-							case 0x05:
-							case 0x06:
-							case 0x07:
-								DecodeRLC_IXd_(address, pMnemonic);
-								break;
-
-							case 0x08:
-							case 0x09:
-							case 0x0A:
-							case 0x0B:
-							case 0x0C:
-							case 0x0D:
-							case 0x0E:
-							case 0x0F:
-								DecodeRRC_IXd_(address, pMnemonic);
-								break;
-
-							case 0x10:
-							case 0x11:
-							case 0x12:
-							case 0x13:
-							case 0x14:
-							case 0x15:
-							case 0x16:
-							case 0x17:
-								DecodeRL_IXd_(address, pMnemonic);
-								break;
-
-							case 0x18:
-							case 0x19:
-							case 0x1A:
-							case 0x1B:
-							case 0x1C:
-							case 0x1D:
-							case 0x1E:
-							case 0x1F:
-								DecodeRR_IXd_(address, pMnemonic);
-								break;
-
-							case 0x20:
-							case 0x21:
-							case 0x22:
-							case 0x23:
-							case 0x24:
-							case 0x25:
-							case 0x26:
-							case 0x27:
-								DecodeSLA_IXd_(address, pMnemonic);
-								break;
-
-							case 0x28:
-							case 0x29:
-							case 0x2A:
-							case 0x2B:
-							case 0x2C:
-							case 0x2D:
-							case 0x2E:
-							case 0x2F:
-								DecodeSRA_IXd_(address, pMnemonic);
-								break;
-
-							case 0x30:
-							case 0x31:
-							case 0x32:
-							case 0x33:
-							case 0x34:
-							case 0x35:
-							case 0x36:
-							case 0x37:
-								DecodeSLL_IXd_(address, pMnemonic);
-								break;
-
-							case 0x38:
-							case 0x39:
-							case 0x3A:
-							case 0x3B:
-							case 0x3C:
-							case 0x3D:
-							case 0x3E:
-							case 0x3F:
-								DecodeSRL_IXd_(address, pMnemonic);
-								break;
-
-							case 0x40:
-							case 0x41:
-							case 0x42:
-							case 0x43:
-							case 0x44:
-							case 0x45:
-							case 0x46: // BIT 0,(IX+d)
-							case 0x47:
-							case 0x48:
-							case 0x49:
-							case 0x4A:
-							case 0x4B:
-							case 0x4C:
-							case 0x4D:
-							case 0x4E: // BIT 1,(IX+d)
-							case 0x4F:
-							case 0x50:
-							case 0x51:
-							case 0x52:
-							case 0x53:
-							case 0x54:
-							case 0x55:
-							case 0x56: // BIT 2,(IX+d)
-							case 0x57:
-							case 0x58:
-							case 0x59:
-							case 0x5A:
-							case 0x5B:
-							case 0x5C:
-							case 0x5D:
-							case 0x5E: // BIT 3,(IX+d)
-							case 0x5F:
-							case 0x60:
-							case 0x61:
-							case 0x62:
-							case 0x63:
-							case 0x64:
-							case 0x65:
-							case 0x66: // BIT 4,(IX+d)
-							case 0x67:
-							case 0x68:
-							case 0x69:
-							case 0x6A:
-							case 0x6B:
-							case 0x6C:
-							case 0x6D:
-							case 0x6E: // BIT 5,(IX+d)
-							case 0x6F:
-							case 0x70:
-							case 0x71:
-							case 0x72:
-							case 0x73:
-							case 0x74:
-							case 0x75:
-							case 0x76: // BIT 6,(IX+d)
-							case 0x77:
-							case 0x78:
-							case 0x79:
-							case 0x7A:
-							case 0x7B:
-							case 0x7C:
-							case 0x7D:
-							case 0x7E: // BIT 7,(IX+d)
-							case 0x7F:
-								DecodeBITb_IXd_(address, pMnemonic);
-								break;
-
-							case 0x80:
-							case 0x81:
-							case 0x82:
-							case 0x83:
-							case 0x84:
-							case 0x85:
-							case 0x86: // RES 0,(IX+d)
-							case 0x87:
-							case 0x88:
-							case 0x89:
-							case 0x8A:
-							case 0x8B:
-							case 0x8C:
-							case 0x8D:
-							case 0x8E: // RES 1,(IX+d)
-							case 0x8F:
-							case 0x90:
-							case 0x91:
-							case 0x92:
-							case 0x93:
-							case 0x94:
-							case 0x95:
-							case 0x96: // RES 2,(IX+d)
-							case 0x97:
-							case 0x98:
-							case 0x99:
-							case 0x9A:
-							case 0x9B:
-							case 0x9C:
-							case 0x9D:
-							case 0x9E: // RES 3,(IX+d)
-							case 0x9F:
-							case 0xA0:
-							case 0xA1:
-							case 0xA2:
-							case 0xA3:
-							case 0xA4:
-							case 0xA5:
-							case 0xA6: // RES 4,(IX+d)
-							case 0xA7:
-							case 0xA8:
-							case 0xA9:
-							case 0xAA:
-							case 0xAB:
-							case 0xAC:
-							case 0xAD:
-							case 0xAE: // RES 5,(IX+d)
-							case 0xAF:
-							case 0xB0:
-							case 0xB1:
-							case 0xB2:
-							case 0xB3:
-							case 0xB4:
-							case 0xB5:
-							case 0xB6: // RES 6,(IX+d)
-							case 0xB7:
-							case 0xB8:
-							case 0xB9:
-							case 0xBA:
-							case 0xBB:
-							case 0xBC:
-							case 0xBD:
-							case 0xBE: // RES 7,(IX+d)
-							case 0xBF:
-								DecodeRESb_IXd_(address, pMnemonic);
-								break;
-
-							case 0xC0:
-							case 0xC1:
-							case 0xC2:
-							case 0xC3:
-							case 0xC4:
-							case 0xC5:
-							case 0xC6: // SET 0,(IX+d)
-							case 0xC7:
-							case 0xC8:
-							case 0xC9:
-							case 0xCA:
-							case 0xCB:
-							case 0xCC:
-							case 0xCD:
-							case 0xCE: // SET 1,(IX+d)
-							case 0xCF:
-							case 0xD0:
-							case 0xD1:
-							case 0xD2:
-							case 0xD3:
-							case 0xD4:
-							case 0xD5:
-							case 0xD6: // SET 2,(IX+d)
-							case 0xD7:
-							case 0xD8:
-							case 0xD9:
-							case 0xDA:
-							case 0xDB:
-							case 0xDC:
-							case 0xDD:
-							case 0xDE: // SET 3,(IX+d)
-							case 0xDF:
-							case 0xE0:
-							case 0xE1:
-							case 0xE2:
-							case 0xE3:
-							case 0xE4:
-							case 0xE5:
-							case 0xE6: // SET 4,(IX+d)
-							case 0xE7:
-							case 0xE8:
-							case 0xE9:
-							case 0xEA:
-							case 0xEB:
-							case 0xEC:
-							case 0xED:
-							case 0xEE: // SET 5,(IX+d)
-							case 0xEF:
-							case 0xF0:
-							case 0xF1:
-							case 0xF2:
-							case 0xF3:
-							case 0xF4:
-							case 0xF5:
-							case 0xF6: // SET 6,(IX+d)
-							case 0xF7:
-							case 0xF8:
-							case 0xF9:
-							case 0xFA:
-							case 0xFB:
-							case 0xFC:
-							case 0xFD:
-							case 0xFE: // SET 7,(IX+d)
-							case 0xFF:
-								DecodeSETb_IXd_(address, pMnemonic);
-								break;
-
-							default:
-								fprintf(stderr, "[Z80] Error decoding unhandled opcode DD CB %02X %02X at address %04X\n", ReadMemory(address + 2), ReadMemory(address + 3), address);
-								HandleIllegalOpcode();
-								return;
-								break;
-						};
-						break;
-
-				default:
-					fprintf(stderr, "[Z80] Error decoding unhandled opcode DD %02X at address %04X\n", ReadMemory(address + 1), address);
-					HandleIllegalOpcode();
-					return;
-					break;
-				};
-				break;
-
-			case 0xED: // Prefix ED
-				switch (ReadMemory(address + 1))
-				{
-					case 0x00:
-					case 0x01:
-					case 0x02:
-					case 0x03:
-					case 0x04:
-					case 0x05:
-					case 0x06:
-					case 0x07:
-					case 0x08:
-					case 0x09:
-					case 0x0A:
-					case 0x0B:
-					case 0x0C:
-					case 0x0D:
-					case 0x0E:
-					case 0x0F:
-					case 0x10:
-					case 0x11:
-					case 0x12:
-					case 0x13:
-					case 0x14:
-					case 0x15:
-					case 0x16:
-					case 0x17:
-					case 0x18:
-					case 0x19:
-					case 0x1A:
-					case 0x1B:
-					case 0x1C:
-					case 0x1D:
-					case 0x1E:
-					case 0x1F:
-					case 0x20:
-					case 0x21:
-					case 0x22:
-					case 0x23:
-					case 0x24:
-					case 0x25:
-					case 0x26:
-					case 0x27:
-					case 0x28:
-					case 0x29:
-					case 0x2A:
-					case 0x2B:
-					case 0x2C:
-					case 0x2D:
-					case 0x2E:
-					case 0x2F:
-					case 0x30:
-					case 0x31:
-					case 0x32:
-					case 0x33:
-					case 0x34:
-					case 0x35:
-					case 0x36:
-					case 0x37:
-					case 0x38:
-					case 0x39:
-					case 0x3A:
-					case 0x3B:
-					case 0x3C:
-					case 0x3D:
-					case 0x3E:
-					case 0x3F:
-						DecodeNOP(address, pMnemonic);
-						break;
-
-					case 0x40: // IN B,(C)
-					case 0x50: // IN D,(C)
-					case 0x60: // IN H,(C)
-					case 0x48: // IN C,(C)
-					case 0x58: // IN E,(C)
-					case 0x68: // IN L,(C)
-					case 0x78: // IN A,(C)
-						DecodeINr_C_(address, pMnemonic);
-						break;
-
-					case 0x41: // OUT (C),B
-					case 0x51: // OUT (C),D
-					case 0x61: // OUT (C),H
-					case 0x49: // OUT (C),C
-					case 0x59: // OUT (C),E
-					case 0x69: // OUT (C),L
-					case 0x79: // OUT (C),A
-						DecodeOUT_C_r(address, pMnemonic);
-						break;
-
-					case 0x42: // SBC HL,BC
-					case 0x52: // SBC HL,DE
-					case 0x62: // SBC HL,HL
-					case 0x72: // SBC HL,SP
-						DecodeSBCHLdd(address, pMnemonic);
-						break;
-
-					case 0x43: // LD (nn),BC
-					case 0x53: // LD (nn),DE
-					case 0x63: // LD (nn),HL
-					case 0x73: // LD (nn),SP
-						DecodeLD_nn_dd(address, pMnemonic);
-						break;
-
-					case 0x44:
-						DecodeNEG(address, pMnemonic);
-						break;
-
-					case 0x45:
-						DecodeRETN(address, pMnemonic);
-						break;
-
-					case 0x46:
-						DecodeIM0(address, pMnemonic);
-						break;
-
-					case 0x56:
-						DecodeIM1(address, pMnemonic);
-						break;
-
-					case 0x47:
-						DecodeLDIA(address, pMnemonic);
-						break;
-
-					case 0x57:
-						DecodeLDAI(address, pMnemonic);
-						break;
-
-					case 0x67:
-						DecodeRRD(address, pMnemonic);
-						break;
-
-					case 0x4A: // ADC HL,BC
-					case 0x5A: // ADC HL,DE
-					case 0x6A: // ADC HL,HL
-					case 0x7A: // ADC HL,SP
-						DecodeADCHLdd(address, pMnemonic);
-						break;
-
-					case 0x4B: // LD BC,(nn)
-					case 0x5B: // LD DE,(nn)
-					case 0x6B: // LD HL,(nn)
-					case 0x7B: // LD SP,(nn)
-						DecodeLDdd_nn_(address, pMnemonic);
-						break;
-
-					case 0x4D:
-						DecodeRETI(address, pMnemonic);
-						break;
-
-					case 0x5E:
-						DecodeIM2(address, pMnemonic);
-						break;
-
-					case 0x4F:
-						DecodeLDRA(address, pMnemonic);
-						break;
-
-					case 0x5F:
-						DecodeLDAR(address, pMnemonic);
-						break;
-
-					case 0x6F:
-						DecodeRLD(address, pMnemonic);
-						break;
-
-					case 0x80:
-					case 0x81:
-					case 0x82:
-					case 0x83:
-					case 0x84:
-					case 0x85:
-					case 0x86:
-					case 0x87:
-					case 0x88:
-					case 0x89:
-					case 0x8A:
-					case 0x8B:
-					case 0x8C:
-					case 0x8D:
-					case 0x8E:
-					case 0x8F:
-					case 0x90:
-					case 0x91:
-					case 0x92:
-					case 0x93:
-					case 0x94:
-					case 0x95:
-					case 0x96:
-					case 0x97:
-					case 0x98:
-					case 0x99:
-					case 0x9A:
-					case 0x9B:
-					case 0x9C:
-					case 0x9D:
-					case 0x9E:
-					case 0x9F:
-						DecodeNOP(address, pMnemonic);
-						break;
-
-					case 0xA0:
-						DecodeLDI(address, pMnemonic);
-						break;
-
-					case 0xA1:
-						DecodeCPI(address, pMnemonic);
-						break;
-
-					case 0xA2:
-						DecodeINI(address, pMnemonic);
-						break;
-
-					case 0xA3:
-						DecodeOUTI(address, pMnemonic);
-						break;
-
-					case 0xA4:
-					case 0xA5:
-					case 0xA6:
-					case 0xA7:
-						DecodeNOP(address, pMnemonic);
-						break;
-
-					case 0xA8:
-						DecodeLDD(address, pMnemonic);
-						break;
-
-					case 0xA9:
-						DecodeCPD(address, pMnemonic);
-						break;
-
-					case 0xAA:
-						DecodeIND(address, pMnemonic);
-						break;
-
-					case 0xAB:
-						DecodeOUTD(address, pMnemonic);
-						break;
-
-					case 0xAC:
-					case 0xAD:
-					case 0xAE:
-					case 0xAF:
-						DecodeNOP(address, pMnemonic);
-						break;
-
-					case 0xB0:
-						DecodeLDIR(address, pMnemonic);
-						break;
-
-					case 0xB1:
-						DecodeCPIR(address, pMnemonic);
-						break;
-
-					case 0xB2:
-						DecodeINIR(address, pMnemonic);
-						break;
-
-					case 0xB3:
-						DecodeOTIR(address, pMnemonic);
-						break;
-
-					case 0xB4:
-					case 0xB5:
-					case 0xB6:
-					case 0xB7:
-						DecodeNOP(address, pMnemonic);
-						break;
-
-					case 0xB8:
-						DecodeLDDR(address, pMnemonic);
-						break;
-
-					case 0xB9:
-						DecodeCPDR(address, pMnemonic);
-						break;
-
-					case 0xBA:
-						DecodeINDR(address, pMnemonic);
-						break;
-
-					case 0xBB:
-						DecodeOTDR(address, pMnemonic);
-						break;
-
-					case 0xBC:
-					case 0xBD:
-					case 0xBE:
-					case 0xBF:
-					case 0xC0:
-					case 0xC1:
-					case 0xC2:
-					case 0xC3:
-					case 0xC4:
-					case 0xC5:
-					case 0xC6:
-					case 0xC7:
-					case 0xC8:
-					case 0xC9:
-					case 0xCA:
-					case 0xCB:
-					case 0xCC:
-					case 0xCD:
-					case 0xCE:
-					case 0xCF:
-					case 0xD0:
-					case 0xD1:
-					case 0xD2:
-					case 0xD3:
-					case 0xD4:
-					case 0xD5:
-					case 0xD6:
-					case 0xD7:
-					case 0xD8:
-					case 0xD9:
-					case 0xDA:
-					case 0xDB:
-					case 0xDC:
-					case 0xDD:
-					case 0xDE:
-					case 0xDF:
-					case 0xE0:
-					case 0xE1:
-					case 0xE2:
-					case 0xE3:
-					case 0xE4:
-					case 0xE5:
-					case 0xE6:
-					case 0xE7:
-					case 0xE8:
-					case 0xE9:
-					case 0xEA:
-					case 0xEB:
-					case 0xEC:
-					case 0xED:
-					case 0xEE:
-					case 0xEF:
-					case 0xF0:
-					case 0xF1:
-					case 0xF2:
-					case 0xF3:
-					case 0xF4:
-					case 0xF5:
-					case 0xF6:
-					case 0xF7:
-					case 0xF8:
-					case 0xF9:
-					case 0xFA:
-					case 0xFB:
-					case 0xFC:
-					case 0xFD:
-					case 0xFE:
-					case 0xFF:
-						DecodeNOP(address, pMnemonic);
-						break;
-
-				default:
-					fprintf(stderr, "[Z80] Error decoding unhandled opcode ED %02X at address %04X\n", ReadMemory(address + 1), address);
-					HandleIllegalOpcode();
-					return;
-					break;
-				};
-				break;
-
-			case 0xFD: // Prefix FD
-				switch (ReadMemory(address + 1))
-				{
-					case 0x46: // LD B,(IY+d)
-					case 0x56: // LD D,(IY+d)
-					case 0x66: // LD H,(IY+d)
-					case 0x4E: // LD C,(IY+d)
-					case 0x5E: // LD E,(IY+d)
-					case 0x6E: // LD L,(IY+d)
-					case 0x7E: // LD A,(IY+d)
-						DecodeLDr_IYd_(address, pMnemonic);
-						break;
-
-					case 0x60: // LD IYh,B
-					case 0x61: // LD IYh,C
-					case 0x62: // LD IYh,D
-					case 0x63: // LD IYh,E
-					case 0x64: // LD IYh,IYh
-					case 0x65: // LD IYh,IYl
-					case 0x67: // LD IYh,A
-						return DecodeLDIYhr(address, pMnemonic);
-						break;
-
-					case 0x68: // LD IYl,B
-					case 0x69: // LD IYl,C
-					case 0x6A: // LD IYl,D
-					case 0x6B: // LD IYl,E
-					case 0x6C: // LD IYl,IYh
-					case 0x6D: // LD IYl,IYl
-					case 0x6F: // LD IYl,A
-						return DecodeLDIYlr(address, pMnemonic);
-						break;
-
-					case 0x70: // LD (IY+d),B
-					case 0x71: // LD (IY+d),C
-					case 0x72: // LD (IY+d),D
-					case 0x73: // LD (IY+d),E
-					case 0x74: // LD (IY+d),H
-					case 0x75: // LD (IY+d),L
-					case 0x77: // LD (IY+d),A
-						DecodeLD_IYd_r(address, pMnemonic);
-						break;
-
-					case 0x09: // ADD IY,BC
-					case 0x19: // ADD IY,DE
-					case 0x29: // ADD IY,HL
-					case 0x39: // ADD IY,SP
-						DecodeADDIYdd(address, pMnemonic);
-						break;
-
-					case 0x23:
-						DecodeINCIY(address, pMnemonic);
-						break;
-
-					case 0x24: // INC IYh
-						DecodeINCIYh(address, pMnemonic);
-						break;
-
-					case 0x25: // DEC IYh
-						DecodeDECIYh(address, pMnemonic);
-						break;
-
-					case 0x26: // LD IYh,n
-						return DecodeLDIYhn(address, pMnemonic);
-						break;
-
-					case 0x2E: // LD IYl,n
-						return DecodeLDIYln(address, pMnemonic);
-						break;
-
-					case 0x2B:
-						DecodeDECIY(address, pMnemonic);
-						break;
-
-					case 0x2C: // INC IYl 
-						DecodeDECIYl(address, pMnemonic);
-						break;
-
-					case 0x2D: // DEC IYl
-						DecodeDECIYl(address, pMnemonic);
-						break;
-
-					case 0x34:
-						DecodeINC_IYd_(address, pMnemonic);
-						break;
-
-					case 0x35:
-						DecodeDEC_IYd_(address, pMnemonic);
-						break;
-
-					case 0x36:
-						DecodeLD_IYd_n(address, pMnemonic);
-						break;
-
-					case 0xE9:
-						DecodeJP_IY_(address, pMnemonic);
-						break;
-
-					case 0x21:
-						DecodeLDIYnn(address, pMnemonic);
-						break;
-
-					case 0x22:
-						DecodeLD_nn_IY(address, pMnemonic);
-						break;
-
-					case 0x2A:
-						DecodeLDIY_nn_(address, pMnemonic);
-						break;
-
-					case 0xF9:
-						DecodeLDSPIY(address, pMnemonic);
-						break;
-
-					case 0xE5:
-						DecodePUSHIY(address, pMnemonic);
-						break;
-
-					case 0xE1:
-						DecodePOPIY(address, pMnemonic);
-						break;
-
-					case 0xE3:
-						DecodeEX_SP_IY(address, pMnemonic);
-						break;
-
-					case 0x86:
-						DecodeADDA_IYd_(address, pMnemonic);
-						break;
-
-					case 0x96:
-						DecodeSUB_IYd_(address, pMnemonic);
-						break;
-
-					case 0xA6:
-						DecodeAND_IYd_(address, pMnemonic);
-						break;
-
-					case 0xB6:
-						DecodeOR_IYd_(address, pMnemonic);
-						break;
-
-					case 0x8E:
-						DecodeADCA_IYd_(address, pMnemonic);
-						break;
-
-					case 0x9E:
-						DecodeSBCA_IYd_(address, pMnemonic);
-						break;
-
-					case 0xAE:
-						DecodeXOR_IYd_(address, pMnemonic);
-						break;
-
-					case 0xBE:
-						DecodeCP_IYd_(address, pMnemonic);
-						break;
-
-					case 0xCB: // Prefix CB
-						switch (ReadMemory(address + 3))
-						{
-							case 0x00:
-							case 0x01:
-							case 0x02:
-							case 0x03:
-							case 0x04:
-							case 0x05:
-							case 0x06:
-							case 0x07:
-								DecodeRLC_IYd_(address, pMnemonic);
-								break;
-
-							case 0x08:
-							case 0x09:
-							case 0x0A:
-							case 0x0B:
-							case 0x0C:
-							case 0x0D:
-							case 0x0E:
-							case 0x0F:
-								DecodeRRC_IYd_(address, pMnemonic);
-								break;
-
-							case 0x10:
-							case 0x11:
-							case 0x12:
-							case 0x13:
-							case 0x14:
-							case 0x15:
-							case 0x16:
-							case 0x17:
-								DecodeRL_IYd_(address, pMnemonic);
-								break;
-
-							case 0x18:
-							case 0x19:
-							case 0x1A:
-							case 0x1B:
-							case 0x1C:
-							case 0x1D:
-							case 0x1E:
-							case 0x1F:
-								DecodeRR_IYd_(address, pMnemonic);
-								break;
-
-							case 0x20:
-							case 0x21:
-							case 0x22:
-							case 0x23:
-							case 0x24:
-							case 0x25:
-							case 0x26:
-							case 0x27:
-								DecodeSLA_IYd_(address, pMnemonic);
-								break;
-
-							case 0x28:
-							case 0x29:
-							case 0x2A:
-							case 0x2B:
-							case 0x2C:
-							case 0x2D:
-							case 0x2E:
-							case 0x2F:
-								DecodeSRA_IYd_(address, pMnemonic);
-								break;
-
-							case 0x30:
-							case 0x31:
-							case 0x32:
-							case 0x33:
-							case 0x34:
-							case 0x35:
-							case 0x36:
-							case 0x37:
-								DecodeSLL_IYd_(address, pMnemonic);
-								break;
-
-							case 0x38:
-							case 0x39:
-							case 0x3A:
-							case 0x3B:
-							case 0x3C:
-							case 0x3D:
-							case 0x3E:
-							case 0x3F:
-								DecodeSRL_IYd_(address, pMnemonic);
-								break;
-
-							case 0x40:
-							case 0x41:
-							case 0x42:
-							case 0x43:
-							case 0x44:
-							case 0x45:
-							case 0x46: // BIT 0,(IY+d)
-							case 0x47:
-							case 0x48:
-							case 0x49:
-							case 0x4A:
-							case 0x4B:
-							case 0x4C:
-							case 0x4D:
-							case 0x4E: // BIT 1,(IY+d)
-							case 0x4F:
-							case 0x50:
-							case 0x51:
-							case 0x52:
-							case 0x53:
-							case 0x54:
-							case 0x55:
-							case 0x56: // BIT 2,(IY+d)
-							case 0x57:
-							case 0x58:
-							case 0x59:
-							case 0x5A:
-							case 0x5B:
-							case 0x5C:
-							case 0x5D:
-							case 0x5E: // BIT 3,(IY+d)
-							case 0x5F:
-							case 0x60:
-							case 0x61:
-							case 0x62:
-							case 0x63:
-							case 0x64:
-							case 0x65:
-							case 0x66: // BIT 4,(IY+d)
-							case 0x67:
-							case 0x68:
-							case 0x69:
-							case 0x6A:
-							case 0x6B:
-							case 0x6C:
-							case 0x6D:
-							case 0x6E: // BIT 5,(IY+d)
-							case 0x6F:
-							case 0x70:
-							case 0x71:
-							case 0x72:
-							case 0x73:
-							case 0x74:
-							case 0x75:
-							case 0x76: // BIT 6,(IY+d)
-							case 0x77:
-							case 0x78:
-							case 0x79:
-							case 0x7A:
-							case 0x7B:
-							case 0x7C:
-							case 0x7D:
-							case 0x7E: // BIT 7,(IY+d)
-							case 0x7F:
-								DecodeBITb_IYd_(address, pMnemonic);
-								break;
-
-							case 0x80:
-							case 0x81:
-							case 0x82:
-							case 0x83:
-							case 0x84:
-							case 0x85:
-							case 0x86: // RES 0,(IY+d)
-							case 0x87:
-							case 0x88:
-							case 0x89:
-							case 0x8A:
-							case 0x8B:
-							case 0x8C:
-							case 0x8D:
-							case 0x8E: // RES 1,(IY+d)
-							case 0x8F:
-							case 0x90:
-							case 0x91:
-							case 0x92:
-							case 0x93:
-							case 0x94:
-							case 0x95:
-							case 0x96: // RES 2,(IY+d)
-							case 0x97:
-							case 0x98:
-							case 0x99:
-							case 0x9A:
-							case 0x9B:
-							case 0x9C:
-							case 0x9D:
-							case 0x9E: // RES 3,(IY+d)
-							case 0x9F:
-							case 0xA0:
-							case 0xA1:
-							case 0xA2:
-							case 0xA3:
-							case 0xA4:
-							case 0xA5:
-							case 0xA6: // RES 4,(IY+d)
-							case 0xA7:
-							case 0xA8:
-							case 0xA9:
-							case 0xAA:
-							case 0xAB:
-							case 0xAC:
-							case 0xAD:
-							case 0xAE: // RES 5,(IY+d)
-							case 0xAF:
-							case 0xB0:
-							case 0xB1:
-							case 0xB2:
-							case 0xB3:
-							case 0xB4:
-							case 0xB5:
-							case 0xB6: // RES 6,(IY+d)
-							case 0xB7:
-							case 0xB8:
-							case 0xB9:
-							case 0xBA:
-							case 0xBB:
-							case 0xBC:
-							case 0xBD:
-							case 0xBE: // RES 7,(IY+d)
-							case 0xBF:
-								DecodeRESb_IYd_(address, pMnemonic);
-								break;
-
-							case 0xC0:
-							case 0xC1:
-							case 0xC2:
-							case 0xC3:
-							case 0xC4:
-							case 0xC5:
-							case 0xC6: // SET 0,(IY+d)
-							case 0xC7:
-							case 0xC8:
-							case 0xC9:
-							case 0xCA:
-							case 0xCB:
-							case 0xCC:
-							case 0xCD:
-							case 0xCE: // SET 1,(IY+d)
-							case 0xCF:
-							case 0xD0:
-							case 0xD1:
-							case 0xD2:
-							case 0xD3:
-							case 0xD4:
-							case 0xD5:
-							case 0xD6: // SET 2,(IY+d)
-							case 0xD7:
-							case 0xD8:
-							case 0xD9:
-							case 0xDA:
-							case 0xDB:
-							case 0xDC:
-							case 0xDD:
-							case 0xDE: // SET 3,(IY+d)
-							case 0xDF:
-							case 0xE0:
-							case 0xE1:
-							case 0xE2:
-							case 0xE3:
-							case 0xE4:
-							case 0xE5:
-							case 0xE6: // SET 4,(IY+d)
-							case 0xE7:
-							case 0xE8:
-							case 0xE9:
-							case 0xEA:
-							case 0xEB:
-							case 0xEC:
-							case 0xED:
-							case 0xEE: // SET 5,(IY+d)
-							case 0xEF:
-							case 0xF0:
-							case 0xF1:
-							case 0xF2:
-							case 0xF3:
-							case 0xF4:
-							case 0xF5:
-							case 0xF6: // SET 6,(IY+d)
-							case 0xF7:
-							case 0xF8:
-							case 0xF9:
-							case 0xFA:
-							case 0xFB:
-							case 0xFC:
-							case 0xFD:
-							case 0xFE: // SET 7,(IY+d)
-							case 0xFF:
-								DecodeSETb_IYd_(address, pMnemonic);
-								break;
-
-							default:
-								fprintf(stderr, "[Z80] Error decoding unhandled opcode FD CB %02X %02X at address %04X\n", ReadMemory(address + 2), ReadMemory(address + 3), address);
-								HandleIllegalOpcode();
-								return;
-								break;
-						};
-						break;
-
-				default:
-					fprintf(stderr, "[Z80] Error decoding unhandled opcode FD %02X at address %04X\n", ReadMemory(address + 1), address);
-					HandleIllegalOpcode();
-					return;
-					break;
-				};
-				break;
-
-			case 0xCE:
-				DecodeADCAn(address, pMnemonic);
-				break;
-
-			case 0xDE:
-				DecodeSBCAn(address, pMnemonic);
-				break;
-
-			case 0xEE:
-				DecodeXORn(address, pMnemonic);
-				break;
-
-			case 0xFE:
-				DecodeCPn(address, pMnemonic);
-				break;
-
-			default:
-				fprintf(stderr, "[Z80] Error decoding unhandled opcode %02X at address %04X\n", ReadMemory(address), address);
-				HandleIllegalOpcode();
-				return;
-				break;
-		}
-}
-
-//=============================================================================
-
-uint8 CZ80::HandleArithmeticAddFlags(uint16 source1, uint16 source2, bool withCarry)
-{
-	uint16 carry = (withCarry == true) ? (m_F & eF_C) : 0;
-	uint16 result = source1 + source2 + carry;
-	uint16 half = (source1 & 0x0F) + (source2 & 0x0F) + carry;
-	uint16 overflow = ((source1 & source2 & ~result) | (~source1 & ~source2 & result)) >> 5;
-
-	m_F = (result & (eF_S | eF_Y | eF_X)) | (((result & 0xFF) == 0) ? eF_Z : 0) | (half & eF_H) | (overflow & eF_PV) | ((result >> 8) & eF_C);
-
-	return (result & 0xFF);
-}
-
-//=============================================================================
-
-uint8 CZ80::HandleArithmeticSubtractFlags(uint16 source1, uint16 source2, bool withCarry)
-{
-	uint16 carry = (withCarry == true) ? (m_F & eF_C) : 0;
-	uint16 result = source1 - source2 - carry;
-	uint16 half = (source1 & 0x0F) - (source2 & 0x0F) - carry;
-	uint16 overflow = ((source1 & ~source2 & ~result) | (~source1 & source2 & result)) >> 5;
-
-	m_F = (result & (eF_S | eF_Y | eF_X)) | (((result & 0xFF) == 0) ? eF_Z : 0) | (half & eF_H) | (overflow & eF_PV) | eF_N | ((result >> 8) & eF_C);
-
-	return (result & 0xFF);
-}
-
-//=============================================================================
-
-void CZ80::HandleLogicalFlags(uint8 source)
-{
-	uint8 parity = source;
-	parity ^= parity >> 4;
-	parity &= 0xF;
-	parity = ((0x6996 >> parity) << 2);
-	m_F = (source & (eF_S | eF_Y | eF_X)) | ((source == 0) ? eF_Z : 0) | (~parity & eF_PV);
-}
-
-//=============================================================================
-
-uint16 CZ80::Handle16BitArithmeticAddFlags(uint32 source1, uint32 source2, bool withCarry)
-{
-	uint16 carry = (withCarry == true) ? (m_F & eF_C) : 0;
-	uint32 result = source1 + source2 + carry;
-	uint32 half = ((source1 & 0x0FFF) + (source2 & 0x0FFF) + carry) >> 8;
-	uint32 overflow = ((source1 & source2 & ~result) | (~source1 & ~source2 & result)) >> 13;
-
-	m_F = ((result >> 8) & (eF_S | eF_X | eF_Y)) | (((result & 0xFFFF) == 0) ? eF_Z : 0) | (half & eF_H) | (overflow & eF_PV) | ((result >> 16) & eF_C);
-
-	return (result & 0xFFFF);
-}
-
-//=============================================================================
-
-uint16 CZ80::Handle16BitArithmeticSubtractFlags(uint32 source1, uint32 source2, bool withCarry)
-{
-	uint16 carry = (withCarry == true) ? (m_F & eF_C) : 0;
-	uint32 result = source1 - source2 - carry;
-	uint32 half = ((source1 & 0x0FFF) - (source2 & 0x0FFF) - carry) >> 8;
-	uint32 overflow = ((source1 & ~source2 & ~result) | (~source1 & source2 & result)) >> 13;
-
-	m_F = ((result >> 8) & (eF_S | eF_X | eF_Y)) | (((result & 0xFFFF) == 0) ? eF_Z : 0) | (half & eF_H) | (overflow & eF_PV) | eF_N | ((result >> 16) & eF_C);
-
-	return (result & 0xFFFF);
-}
-
-//=============================================================================
-
-void CZ80::WriteMemory(uint16 address, uint8 byte)
-{
-	if (GetEnableBreakpoints() && (address == g_dataBreakpoint))
-	{
-		fprintf(stderr, "[Z80] writing %02X to %04X\n", byte, address);
-		HitBreakpoint("data");
-	}
-
-	m_pMemory->WriteMemory(address, byte);
-}
-
-//=============================================================================
-
-uint8 CZ80::ReadMemory(uint16 address) const
-{
-	uint8 byte = m_pMemory->ReadMemory(address);
-
-	if (GetEnableBreakpoints() && (address == g_dataBreakpoint))
-	{
-		fprintf(stderr, "[Z80] reading %02X from %04X\n", byte, address);
-		HitBreakpoint("data");
-	}
-
-	return byte;
-}
-
-//=============================================================================
-
-const char* CZ80::Get8BitRegisterString(uint8 threeBits) const
-{
-	switch (threeBits & 0x07)
-	{
-		case 0: return "B";			break;
-		case 1: return "C";			break;
-		case 2: return "D";			break;
-		case 3: return "E";			break;
-		case 4: return "H";			break;
-		case 5: return "L";			break;
-		case 6: return "(HL)";	break;
-		case 7: return "A";			break;
-	}
-	return "??";
-}
-
-//=============================================================================
-
-const char* CZ80::Get8BitIXRegisterString(uint8 threeBits) const
-{
-	switch (threeBits & 0x07)
-	{
-		case 0: return "B";			break;
-		case 1: return "C";			break;
-		case 2: return "D";			break;
-		case 3: return "E";			break;
-		case 4: return "IXh";		break;
-		case 5: return "IXl";		break;
-		case 6: return "(HL)";	break;
-		case 7: return "A";			break;
-	}
-	return "??";
-}
-
-//=============================================================================
-
-const char* CZ80::Get8BitIYRegisterString(uint8 threeBits) const
-{
-	switch (threeBits & 0x07)
-	{
-		case 0: return "B";			break;
-		case 1: return "C";			break;
-		case 2: return "D";			break;
-		case 3: return "E";			break;
-		case 4: return "IYh";		break;
-		case 5: return "IYl";		break;
-		case 6: return "(HL)";	break;
-		case 7: return "A";			break;
-	}
-	return "??";
-}
-
-//=============================================================================
-
-const char* CZ80::Get16BitRegisterString(uint8 twoBits) const
-{
-	switch (twoBits & 0x03)
-	{
-		case 0: return "BC";		break;
-		case 1: return "DE";		break;
-		case 2: return "HL";		break;
-		case 3: return "SP";		break;
-	}
-	return "??";
-}
-
-//=============================================================================
-
-const char* CZ80::GetConditionString(uint8 threeBits) const
-{
-	switch (threeBits & 0x07)
-	{
-		case 0: return "NZ";		break; // Not Zero
-		case 1: return "Z";			break; // Zero
-		case 2: return "NC";		break; // Not Carry
-		case 3: return "C";			break; // Carry
-		case 4: return "PO";		break; // Parity Odd
-		case 5: return "PE";		break; // Parity Even
-		case 6: return "P";			break; // Positive (Not Sign)
-		case 7: return "M";			break; // Minus (Sign)
-	}
-	return "??";
-}
-
-//=============================================================================
-
-bool CZ80::IsConditionTrue(uint8 threeBits) const
-{
-	switch (threeBits & 0x07)
-	{
-		case 0: return (m_F & eF_Z) == 0;		break; // Not Zero
-		case 1: return (m_F & eF_Z) != 0;		break; // Zero
-		case 2: return (m_F & eF_C) == 0;		break; // Not Carry
-		case 3: return (m_F & eF_C) != 0;		break; // Carry
-		case 4: return (m_F & eF_PV) == 0;	break; // Parity Odd
-		case 5: return (m_F & eF_PV) != 0;	break; // Parity Even
-		case 6: return (m_F & eF_S) == 0;		break; // Positive (Not Sign)
-		case 7: return (m_F & eF_S) != 0;		break; // Minus (Sign)
-	}
-	return false;
-}
-
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-//	8-Bit Load Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDrr(void)
-{
-	//
-	// Operation:	r <- r'
-	// Op Code:		LD
-	// Operands:	r, r'
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|d|d|d|s|s|s|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd and sss are any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	uint8 opcode = ReadMemory(m_PC++);
-	REGISTER_8BIT(opcode >> 3) = REGISTER_8BIT(opcode);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDrIXh(void)
-{
-	//
-	// Operation:	r <- IXh
-	// Op Code:		LD
-	// Operands:	r, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|d|d|d|1|0|0|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								IXh					100
-	//								IXl					101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8 (4,4)						2.00
-	//
-	++m_PC;
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8* pReg = &REGISTER_8BIT(opcode);
-	if (pReg == &m_H) pReg = &m_IXh;
-	if (pReg == &m_L) pReg = &m_IXl;
-	*pReg = m_IXh;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDrIXl(void)
-{
-	//
-	// Operation:	r <- IXl
-	// Op Code:		LD
-	// Operands:	r, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|d|d|d|1|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								IXh					100
-	//								IXl					101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8 (4,4)						2.00
-	//
-	++m_PC;
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8* pReg = &REGISTER_8BIT(opcode);
-	if (pReg == &m_H) pReg = &m_IXh;
-	if (pReg == &m_L) pReg = &m_IXl;
-	*pReg = m_IXl;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDrIYh(void)
-{
-	//
-	// Operation:	r <- IYh
-	// Op Code:		LD
-	// Operands:	r, IYh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|d|d|d|1|0|0|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								IYh					100
-	//								IYl					101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8 (4,4)						2.00
-	//
-	++m_PC;
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8* pReg = &REGISTER_8BIT(opcode);
-	if (pReg == &m_H) pReg = &m_IYh;
-	if (pReg == &m_L) pReg = &m_IYl;
-	*pReg = m_IYh;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDrIYl(void)
-{
-	//
-	// Operation:	r <- IYl
-	// Op Code:		LD
-	// Operands:	r, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|d|d|d|1|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								IYh					100
-	//								IYl					101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8 (4,4)						2.00
-	//
-	++m_PC;
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8* pReg = &REGISTER_8BIT(opcode);
-	if (pReg == &m_H) pReg = &m_IYh;
-	if (pReg == &m_L) pReg = &m_IYl;
-	*pReg = m_IYl;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDrn(void)
-{
-	//
-	// Operation:	r <- n
-	// Op Code:		LD
-	// Operands:	r, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|r|r|r|1|1|0|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75
-	//
-	uint8 opcode = ReadMemory(m_PC++);
-	REGISTER_8BIT(opcode >> 3) = ReadMemory(m_PC++);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIXhn(void)
-{
-	//
-	// Operation:	IXh <- n
-	// Op Code:		LD
-	// Operands:	IXh, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|1|0| 26
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						11 (4,4,3)				2.75
-	//
-	++++m_PC;
-	m_IXh = ReadMemory(m_PC++);
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIXhr(void)
-{
-	//
-	// Operation:	IXh <- r
-	// Op Code:		LD
-	// Operands:	IXh, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|0|s|s|s|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd and sss are any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								IXh					100
-	//								IXl					101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8	(4,4)						2.00
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	uint8* pReg = &REGISTER_8BIT(opcode);
-	if (pReg == &m_H) pReg = &m_IXh;
-	if (pReg == &m_L) pReg = &m_IXl;
-	m_IXh = *pReg;
-	++m_PC;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIXln(void)
-{
-	//
-	// Operation:	IXl <- n
-	// Op Code:		LD
-	// Operands:	IXl, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|1|0| 2E
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						11 (4,4,3)				2.75
-	//
-	++++m_PC;
-	m_IXl = ReadMemory(m_PC++);
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIXlr(void)
-{
-	//
-	// Operation:	IXl <- r
-	// Op Code:		LD
-	// Operands:	IXl, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|1|s|s|s|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd and sss are any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								IXh					100
-	//								IXl					101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8	(4,4)						2.00
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	uint8* pReg = &REGISTER_8BIT(opcode);
-	if (pReg == &m_H) pReg = &m_IXh;
-	if (pReg == &m_L) pReg = &m_IXl;
-	m_IXl = *pReg;
-	++m_PC;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIYhn(void)
-{
-	//
-	// Operation:	IYh <- n
-	// Op Code:		LD
-	// Operands:	IYh, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|1|0| 26
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						11 (4,4,3)				2.75
-	//
-	++++m_PC;
-	m_IYh = ReadMemory(m_PC++);
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIYhr(void)
-{
-	//
-	// Operation:	IYh <- r
-	// Op Code:		LD
-	// Operands:	IYh, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|0|s|s|s|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd and sss are any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								IYh					100
-	//								IYl					101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8	(4,4)						2.00
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	uint8* pReg = &REGISTER_8BIT(opcode);
-	if (pReg == &m_H) pReg = &m_IYh;
-	if (pReg == &m_L) pReg = &m_IYl;
-	m_IYh = *pReg;
-	++m_PC;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIYln(void)
-{
-	//
-	// Operation:	IYl <- n
-	// Op Code:		LD
-	// Operands:	IYl, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|1|0| 2E
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						11 (4,4,3)				2.75
-	//
-	++++m_PC;
-	m_IYl = ReadMemory(m_PC++);
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIYlr(void)
-{
-	//
-	// Operation:	IYl <- r
-	// Op Code:		LD
-	// Operands:	IYl, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|1|s|s|s|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ddd and sss are any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								IYh					100
-	//								IYl					101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8	(4,4)						2.00
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	uint8* pReg = &REGISTER_8BIT(opcode);
-	if (pReg == &m_H) pReg = &m_IYh;
-	if (pReg == &m_L) pReg = &m_IYl;
-	m_IYl = *pReg;
-	++m_PC;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDr_HL_(void)
-{
-	//
-	// Operation:	r <- (HL)
-	// Op Code:		LD
-	// Operands:	r, (HL) 
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|r|r|r|1|1|0|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75
-	//
-	uint8 opcode = ReadMemory(m_PC++);
-	REGISTER_8BIT(opcode >> 3) = ReadMemory(m_HL);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDr_IXd_(void)
-{
-	//
-	// Operation:	r <- (IX+d)
-	// Op Code:		LD
-	// Operands:	r, (IX+d) 
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|r|r|r|1|1|0|
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
-	++m_PC;
-	REGISTER_8BIT(opcode >> 3) = ReadMemory(m_IX + displacement);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDr_IYd_(void)
-{
-	//
-	// Operation:	r <- (IY+d)
-	// Op Code:		LD
-	// Operands:	r, (IY+d) 
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|r|r|r|1|1|0|
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
-	++m_PC;
-	REGISTER_8BIT(opcode >> 3) = ReadMemory(m_IY + displacement);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_HL_r(void)
-{
-	//
-	// Operation:	(HL) <- r
-	// Op Code:		LD
-	// Operands:	(HL), r
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|1|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75
-	//
-	WriteMemory(m_HL, REGISTER_8BIT(ReadMemory(m_PC++)));
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_IXd_r(void)
-{
-	//
-	// Operation:	(IX+d) <- r
-	// Op Code:		LD
-	// Operands:	(IX+d), r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|1|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
-	++m_PC;
-	WriteMemory(m_IX + displacement, REGISTER_8BIT(opcode));
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_IYd_r(void)
-{
-	//
-	// Operation:	(IY+d) <- r
-	// Op Code:		LD
-	// Operands:	(IY+d), r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|1|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
-	++m_PC;
-	WriteMemory(m_IY + displacement, REGISTER_8BIT(opcode));
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_HL_n(void)
-{
-	//
-	// Operation:	(HL) <- n
-	// Op Code:		LD
-	// Operands:	(HL), n
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|1|0| 36
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						10 (4,3,3)				2.50
-	//
-	++m_PC;
-	WriteMemory(m_HL, ReadMemory(m_PC++));
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_IXd_n(void)
-{
-	//
-	// Operation:	(IX+d) <- n
-	// Op Code:		LD
-	// Operands:	(IX+d), n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|1|0| 36
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	WriteMemory(m_IX + displacement, ReadMemory(m_PC++));
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_IYd_n(void)
-{
-	//
-	// Operation:	(IY+d) <- n
-	// Op Code:		LD
-	// Operands:	(IY+d), n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|1|0| 36
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	WriteMemory(m_IY + displacement, ReadMemory(m_PC++));
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDA_BC_(void)
-{
-	//
-	// Operation:	A <- (BC)
-	// Op Code:		LD
-	// Operands:	A, (BC) 
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|1|0|1|0| 0A
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75
-	//
-	++m_PC;
-	m_A = ReadMemory(m_BC);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDA_DE_(void)
-{
-	//
-	// Operation:	A <- (DE)
-	// Op Code:		LD
-	// Operands:	A, (DE) 
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|1|0|1|0| 1A
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75
-	//
-	++m_PC;
-	m_A = ReadMemory(m_DE);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDA_nn_(void)
-{
-	//
-	// Operation:	A <- (nn)
-	// Op Code:		LD
-	// Operands:	A, (nn) 
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|1|0|1|0| 3A
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						13 (4,3,3,3)			3.25
-	//
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = ReadMemory(++m_PC);
-	++m_PC;
-	m_A = ReadMemory(m_address);
-	return 13;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_BC_A(void)
-{
-	//
-	// Operation:	(BC) <- A
-	// Op Code:		LD
-	// Operands:	(BC), A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|0|0|1|0| 02
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75
-	//
-	WriteMemory(m_BC, m_A);
-	++m_PC; 
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_DE_A(void)
-{
-	//
-	// Operation:	(DE) <- A
-	// Op Code:		LD
-	// Operands:	(DE), A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|0|0|1|0| 12
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75
-	//
-	WriteMemory(m_DE, m_A);
-	++m_PC; 
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_nn_A(void)
-{
-	//
-	// Operation:	(nn) <- A
-	// Op Code:		LD
-	// Operands:	(nn), A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|0|0|1|0| 12
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						13 (4,3,3,3)			3.25
-	//
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = ReadMemory(++m_PC);
-	++m_PC;
-	WriteMemory(m_address, m_A);
-	return 13;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDAI(void)
-{
-	//
-	// Operation:	A <- I
-	// Op Code:		LD
-	// Operands:	A, I 
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|1|0|1|1|1| 57
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						9 (4,5)						2.25
-	//
-	m_A = m_I;
-	m_F &= eF_C;
-	m_F |= (m_A & (eF_S | eF_Y | eF_X)) | ((m_A == 0) ? eF_Z : 0) | ((m_State.m_IFF2) ? eF_PV : 0);
-	++++m_PC;
-	return 9;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDAR(void)
-{
-	//
-	// Operation:	A <- R
-	// Op Code:		LD
-	// Operands:	A, R 
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|1|1|1|1|1| 5F
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						9 (4,5)						2.25
-	//
-	m_A = m_R;
-	m_F &= eF_C;
-	m_F |= (m_A & (eF_S | eF_Y | eF_X)) | ((m_A == 0) ? eF_Z : 0) | ((m_State.m_IFF2) ? eF_PV : 0);
-	++++m_PC;
-	return 9;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIA(void)
-{
-	//
-	// Operation:	I <- A
-	// Op Code:		LD
-	// Operands:	I, A 
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|0|0|1|1|1| 47
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						9 (4,5)						2.25
-	//
-	m_I = m_A;
-	++++m_PC;
-	return 9;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDRA(void)
-{
-	//
-	// Operation:	R <- A
-	// Op Code:		LD
-	// Operands:	R, A 
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|0|1|1|1|1| 4F
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						9 (4,5)						2.25
-	//
-	m_R = m_A;
-	++++m_PC;
-	return 9;
-}
-
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-//	16-Bit Load Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDddnn(void)
-{
-	//
-	// Operation:	dd <- nn
-	// Op Code:		LD
-	// Operands:	dd, nn
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|d|d|0|0|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								SP					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						10 (4,3,3)				2.50
-	//
-	uint8 opcode = ReadMemory(m_PC++);
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	REGISTER_16BIT(opcode >> 4) = m_address;
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIXnn(void)
-{
-	//
-	// Operation:	IX <- nn
-	// Op Code:		LD
-	// Operands:	IX, nn
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|0|0|1| 21
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						14 (4,4,3,3)			3.50
-	//
-	++++m_PC;
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	m_IX = m_address;
-	return 14;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIYnn(void)
-{
-	//
-	// Operation:	IY <- nn
-	// Op Code:		LD
-	// Operands:	IY, nn
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|0|0|1| 21
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						14 (4,4,3,3)			3.50
-	//
-	++++m_PC;
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	m_IY = m_address;
-	return 14;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDHL_nn_(void)
-{
-	// Operation:	H <- (nn+1), L <- (nn)
-	// Op Code:		LD
-	// Operands:	HL, (nn)
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|0|1|0| 2A
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						16 (4,3,3,3,3)		4.00
-	//
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = ReadMemory(++m_PC);
-	++m_PC;
-	m_L = ReadMemory(m_address++);
-	m_H = ReadMemory(m_address);
-	return 16;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDdd_nn_(void)
-{
-	//
-	// Operation:	ddh <- (nn+1), ddl <- (nn)
-	// Op Code:		LD
-	// Operands:	dd, (nn)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|d|d|1|0|1|1|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								SP					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						20 (4,4,3,3,3,3)	5.00
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = ReadMemory(++m_PC);
-	++m_PC;
-	REGISTER_16BIT_LO(opcode >> 4) = ReadMemory(m_address++);
-	REGISTER_16BIT_HI(opcode >> 4) = ReadMemory(m_address);
-	return 20;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIX_nn_(void)
-{
-	//
-	// Operation:	IXh <- (nn+1), IXl <- (nn)
-	// Op Code:		LD
-	// Operands:	IX, (nn)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|1|0|1|0| 2A
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						20 (4,4,3,3,3,3)	5.00
-	//
-	++++m_PC;
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	m_IXl = ReadMemory(m_address++);
-	m_IXh = ReadMemory(m_address);
-	return 20;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIY_nn_(void)
-{
-	//
-	// Operation:	IYh <- (nn+1), IYl <- (nn)
-	// Op Code:		LD
-	// Operands:	IY, (nn)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|1|0|1|0| 2A
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						20 (4,4,3,3,3,3)	5.00
-	//
-	++++m_PC;
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	m_IYl = ReadMemory(m_address++);
-	m_IYh = ReadMemory(m_address);
-	return 20;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_nn_HL(void)
-{
-	// Operation:	(nn+1) <- H, (nn) <- L
-	// Op Code:		LD
-	// Operands:	(nn), HL
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|0|1|0| 22
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						16 (4,3,3,3,3)		4.00
-	//
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = ReadMemory(++m_PC);
-	++m_PC;
-	WriteMemory(m_address++, m_L);
-	WriteMemory(m_address, m_H);
-	return 16;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_nn_dd(void)
-{
-	//
-	// Operation:	(nn+1) <- ddh, (nn) <- ddl
-	// Op Code:		LD
-	// Operands:	(nn), dd
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|d|d|0|0|1|1|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								SP					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						20 (4,4,3,3,3,3)	5.00
-	//
-	uint8 opcode = ReadMemory(++m_PC);
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = ReadMemory(++m_PC);
-	++m_PC;
-	WriteMemory(m_address++, REGISTER_16BIT_LO(opcode >> 4));
-	WriteMemory(m_address, REGISTER_16BIT_HI(opcode >> 4));
-	return 20;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_nn_IX(void)
-{
-	//
-	// Operation:	(nn+1) <- IXh, (nn) <- IXl
-	// Op Code:		LD
-	// Operands:	(nn), IX
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|0|0|1|0| 22
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						20 (4,4,3,3,3,3)	5.00
-	//
-	++++m_PC;
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	WriteMemory(m_address++, m_IXl);
-	WriteMemory(m_address, m_IXh);
-	return 20;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLD_nn_IY(void)
-{
-	//
-	// Operation:	(nn+1) <- IYh, (nn) <- IYl
-	// Op Code:		LD
-	// Operands:	(nn), IY
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|0|0|1|0| 22
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						20 (4,4,3,3,3,3)	5.00
-	//
-	++++m_PC;
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	WriteMemory(m_address++, m_IYl);
-	WriteMemory(m_address, m_IYh);
-	return 20;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDSPHL(void)
-{
-	//
-	// Operation:	SP <- HL
-	// Op Code:		LD
-	// Operands:	SP, HL
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|0|0|1| F9
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						6									1.50
-	//
-	m_SP = m_HL;
-	++m_PC;
-	return 6;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDSPIX(void)
-{
-	//
-	// Operation:	SP <- IX
-	// Op Code:		LD
-	// Operands:	SP, IX
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|0|0|1| F9
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						10 (4,6)					2.50
-	//
-	m_SP = m_IX;
-	++m_PC;
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDSPIY(void)
-{
-	//
-	// Operation:	SP <- IY
-	// Op Code:		LD
-	// Operands:	SP, IY
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|0|0|1| F9
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						10 (4,6)					2.50
-	//
-	m_SP = m_IY;
-	++m_PC;
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementPUSHqq(void)
-{
-	//
-	// Operation:	(SP-2) <- qql, (SP-1) <- qqh
-	// Op Code:		PUSH
-	// Operands:	qq
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|d|d|0|1|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								AF					11 (see below)
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						11 (5,3,3)				2.75
-	//
-	uint8 opcode = ReadMemory(m_PC++);
-	WriteMemory(--m_SP, REGISTER_16BIT_HI(opcode >> 4));
-	WriteMemory(--m_SP, REGISTER_16BIT_LO(opcode >> 4));
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementPUSHAF(void)
-{
-	//
-	// Operation:	(SP-2) <- F, (SP-1) <- A
-	// Op Code:		PUSH
-	// Operands:	qq
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|0|1|0|1| F5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						SP is mapped to 11
-	//						in all other opcodes
-	//						so special case for
-	//						AF is needed here.
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						11 (5,3,3)				2.75
-	//
-	++m_PC;
-	WriteMemory(--m_SP, m_A);
-	WriteMemory(--m_SP, m_F);
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementPUSHIX(void)
-{
-	//
-	// Operation:	(SP-2) <- IXl, (SP-1) <- IXh
-	// Op Code:		PUSH
-	// Operands:	IX
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|0|1|0|1| E5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,5,3,3)			3.75
-	//
-	++++m_PC;
-	WriteMemory(--m_SP, m_IXh);
-	WriteMemory(--m_SP, m_IXl);
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementPUSHIY(void)
-{
-	//
-	// Operation:	(SP-2) <- IYl, (SP-1) <- IYh
-	// Op Code:		PUSH
-	// Operands:	IY
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|0|1|0|1| E5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,5,3,3)			3.75
-	//
-	++++m_PC;
-	WriteMemory(--m_SP, m_IYh);
-	WriteMemory(--m_SP, m_IYl);
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementPOPqq(void)
-{
-	//
-	// Operation:	qqh <- (SP+1), qql <- (SP)
-	// Op Code:		POP
-	// Operands:	qq
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|d|d|0|0|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								AF					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						10 (4,3,3)				2.75
-	//
-	uint8 opcode = ReadMemory(m_PC++);
-	REGISTER_16BIT_LO(opcode >> 4) = ReadMemory(m_SP++);
-	REGISTER_16BIT_HI(opcode >> 4) = ReadMemory(m_SP++);
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementPOPAF(void)
-{
-	//
-	// Operation:	A <- (SP+1), F <- (SP)
-	// Op Code:		POP
-	// Operands:	qq
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|0|0|0|1| F1
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						SP is mapped to 11
-	//						in all other opcodes
-	//						so special case for
-	//						AF is needed here.
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						10 (4,3,3)				2.75
-	//
-	++m_PC;
-	m_F = ReadMemory(m_SP++);
-	m_A = ReadMemory(m_SP++);
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementPOPIX(void)
-{
-	//
-	// Operation:	IXh <- (SP+1), IXl <- (SP)
-	// Op Code:		POP
-	// Operands:	IX
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|0|0|0|1| E1
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						14 (4,4,3,3)			3.50
-	//
-	++++m_PC;
-	m_IXl = ReadMemory(m_SP++);
-	m_IXh = ReadMemory(m_SP++);
-	return 14;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementPOPIY(void)
-{
-	//
-	// Operation:	IYh <- (SP+1), IYh <- (SP)
-	// Op Code:		POP
-	// Operands:	IY
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|0|0|0|1| E1
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						14 (4,4,3,3)			3.50
-	//
-	++++m_PC;
-	m_IYl = ReadMemory(m_SP++);
-	m_IYh = ReadMemory(m_SP++);
-	return 14;
-}
-
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-//	Exchange, Block Transfer and Search Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementEXDEHL(void)
-{
-	//
-	// Operation:	DE <-> HL
-	// Op Code:		EX
-	// Operands:	DE, HL
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|0|1|1| EB
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	m_DE ^= m_HL;
-	m_HL ^= m_DE;
-	m_DE ^= m_HL;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementEXAFAF(void)
-{
-	//
-	// Operation:	AF <-> AF'
-	// Op Code:		EX
-	// Operands:	AF, AF'
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|1|0|0|0| 08
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	m_AF ^= m_AFalt;
-	m_AFalt ^= m_AF;
-	m_AF ^= m_AFalt;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementEXX(void)
-{
-	//
-	// Operation:	BC <-> BC', DE <-> DE', HL <-> HL'
-	// Op Code:		EX
-	// Operands:	BC, BC', DE, DE', HL, HL'
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|0|0|1| D9
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	m_BC ^= m_BCalt;
-	m_BCalt ^= m_BC;
-	m_BC ^= m_BCalt;
-
-	m_DE ^= m_DEalt;
-	m_DEalt ^= m_DE;
-	m_DE ^= m_DEalt;
-
-	m_HL ^= m_HLalt;
-	m_HLalt ^= m_HL;
-	m_HL ^= m_HLalt;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementEX_SP_HL(void)
-{
-	//
-	// Operation:	H <-> (SP+1), L <-> (SP)
-	// Op Code:		EX
-	// Operands:	(SP), HL
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|0|0|1|1| E3
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,3,4,3,5)		4.75
-	//
-	++m_PC;
-	m_addresslo = ReadMemory(m_SP);
-	m_addresshi = ReadMemory(m_SP + 1);
-	WriteMemory(m_SP, m_L);
-	WriteMemory(m_SP + 1, m_H);
-	m_HL = m_address;
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementEX_SP_IX(void)
-{
-	//
-	// Operation:	IXh <-> (SP+1), IXl <-> (SP)
-	// Op Code:		EX
-	// Operands:	(SP), IX
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|0|0|1|1| E3
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,4,3,5)	5.75
-	//
-	++++m_PC;
-	m_addresslo = ReadMemory(m_SP);
-	m_addresshi = ReadMemory(m_SP + 1);
-	WriteMemory(m_SP, m_IXl);
-	WriteMemory(m_SP + 1, m_IXh);
-	m_IX = m_address;
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementEX_SP_IY(void)
-{
-	//
-	// Operation:	IYh <-> (SP+1), IYl <-> (SP)
-	// Op Code:		EX
-	// Operands:	(SP), IY
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|0|0|1|1| E3
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,4,3,5)	5.75
-	//
-	++++m_PC;
-	m_addresslo = ReadMemory(m_SP);
-	m_addresshi = ReadMemory(m_SP + 1);
-	WriteMemory(m_SP, m_IYl);
-	WriteMemory(m_SP + 1, m_IYh);
-	m_IY = m_address;
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDI(void)
-{
-	//
-	// Operation:	(DE) <- (HL), DE <- DE+1, HL <- HL+1, BC <- BC-1
-	// Op Code:		LDI
-	// Operands:	(DE), DE, (HL), HL, BC
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|0|0|0| A0
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,4,3,5)			4.00
-	//
-	++++m_PC;
-	uint8 byte = ReadMemory(m_HL++);
-	WriteMemory(m_DE++, byte);
-	--m_BC;
-	// From The Undocumented Z80:
-	byte += m_A;
-	m_F &= (eF_S | eF_Z | eF_C);
-	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y);
-	m_F |= (m_BC != 0) ? eF_PV : 0;
-	return 16;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDIR(void)
-{
-	//
-	// Operation:	(DE) <- (HL), DE <- DE+1, HL <- HL+1, BC <- BC-1
-	// Op Code:		LDIR
-	// Operands:	(DE), DE, (HL), HL, BC
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|0|0|0| B0
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						For BC != 0
-	//							M Cycles		T States					MHz E.T.
-	//								5						21 (4,4,3,5,5)		5.25
-	//
-	//						For BC == 0
-	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,4,3,5)			4.00
-	//
-	uint32 tstates = ImplementLDI();
-	if (m_BC != 0)
-	{
-		tstates += 5;
-		----m_PC;
-	}
-	return tstates;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDD(void)
-{
-	//
-	// Operation:	(DE) <- (HL), DE <- DE-1, HL <- HL-1, BC <- BC-1
-	// Op Code:		LDD
-	// Operands:	(DE), DE, (HL), HL, BC
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|0|0|0| A8
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,4,3,5)			4.00
-	//
-	++++m_PC;
-	uint8 byte = ReadMemory(m_HL--);
-	WriteMemory(m_DE--, byte);
-	--m_BC;
-	// From The Undocumented Z80:
-	byte += m_A;
-	m_F &= (eF_S | eF_Z | eF_C);
-	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y);
-	m_F |= (m_BC != 0) ? eF_PV : 0;
-	return 16;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementLDDR(void)
-{
-	//
-	// Operation:	(DE) <- (HL), DE <- DE-1, HL <- HL-1, BC <- BC-1
-	// Op Code:		LDDR
-	// Operands:	(DE), DE, (HL), HL, BC
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|0|0|0| B8
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						For BC != 0
-	//							M Cycles		T States					MHz E.T.
-	//								5						21 (4,4,3,5,5)		5.25
-	//
-	//						For BC == 0
-	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,4,3,5)			4.00
-	//
-	uint32 tstates = ImplementLDD();
-	if (m_BC != 0)
-	{
-		tstates += 5;
-		----m_PC;
-	}
-	return tstates;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPI(void)
-{
-	//
-	// Operation:	A - (HL), HL <- HL+1, BC <- BC-1
-	// Op Code:		CPI
-	// Operands:	A, (HL), HL, BC
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|0|0|1| A1
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,4,3,5)			4.00
-	//
-	++++m_PC;
-	uint8 _HL_ = ReadMemory(m_HL++);
-	--m_BC;
-	// From The Undocumented Z80:
-	uint8 origF = m_F;
-	HandleArithmeticSubtractFlags(m_A, _HL_, false);
-	uint8 byte = m_A - _HL_ - ((m_F & eF_H) >> 4);
-	m_F &= (eF_S | eF_Z | eF_H);
-	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y) | ((m_BC != 0) ? eF_PV : 0) | eF_N | (origF & eF_C);
-	return 16;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPIR(void)
-{
-	//
-	// Operation:	A - (HL), HL <- HL+1, BC <- BC-1
-	// Op Code:		CPIR
-	// Operands:	A, (HL), HL, BC
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|0|0|1| B1
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						For BC != 0
-	//							M Cycles		T States					MHz E.T.
-	//								5						21 (4,4,3,5,5)		5.25
-	//
-	//						For BC == 0
-	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,4,3,5)			4.00
-	//
-	uint32 tstates = ImplementCPI();
-	if ((m_F & eF_PV) && !(m_F & eF_Z))
-	{
-		tstates += 5;
-		----m_PC;
-	}
-	return tstates;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPD(void)
-{
-	//
-	// Operation:	A - (HL), HL <- HL-1, BC <- BC-1
-	// Op Code:		CPD
-	// Operands:	A, (HL), HL, BC
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|0|0|1| A9
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,4,3,5)			4.00
-	//
-	++++m_PC;
-	uint8 _HL_ = ReadMemory(m_HL--);
-	--m_BC;
-	// From The Undocumented Z80:
-	uint8 origF = m_F;
-	HandleArithmeticSubtractFlags(m_A, _HL_, false);
-	uint8 byte = m_A - _HL_ - ((m_F & eF_H) >> 4);
-	m_F &= (eF_S | eF_Z | eF_H);
-	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y) | ((m_BC != 0) ? eF_PV : 0) | eF_N | (origF & eF_C);
-	return 16;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPDR(void)
-{
-	//
-	// Operation:	A - (HL), HL <- HL-1, BC <- BC-1
-	// Op Code:		CPDR
-	// Operands:	A, (HL), HL, BC
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|0|0|1| B9
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						For BC != 0
-	//							M Cycles		T States					MHz E.T.
-	//								5						21 (4,4,3,5,5)		5.25
-	//
-	//						For BC == 0
-	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,4,3,5)			4.00
-	//
-	uint32 tstates = ImplementCPD();
-	if ((m_F & eF_PV) && !(m_F & eF_Z))
-	{
-		tstates += 5;
-		----m_PC;
-	}
-	return tstates;
-}
-
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-//	8-Bit Arithmetic Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDAr(void)
-{
-	//
-	// Operation:	A <- A+r
-	// Op Code:		ADD
-	// Operands:	A, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	m_A = HandleArithmeticAddFlags(m_A, REGISTER_8BIT(ReadMemory(m_PC++)), false);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDAIXh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		ADD
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|0|1|0|0| 84
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, m_IXh, false);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDAIXl(void)
-{
-	//
-	// Operation:	A <- A+IXl
-	// Op Code:		ADD
-	// Operands:	A, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|0|1|0|1| 85
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, m_IXl, false);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDAIYh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		ADD
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|0|1|0|0| 84
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, m_IYh, false);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDAIYl(void)
-{
-	//
-	// Operation:	A <- A+IYl
-	// Op Code:		ADD
-	// Operands:	A, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|0|1|0|1| 85
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, m_IYl, false);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDAn(void)
-{
-	//
-	// Operation:	A <- A+n
-	// Op Code:		ADD
-	// Operands:	A, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|0|1|1|0| C6
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_PC++), false);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDA_HL_(void)
-{
-	//
-	// Operation:	A <- A+(HL)
-	// Op Code:		ADD
-	// Operands:	A, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|0|1|1|0| 86
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_HL), false);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDA_IXd_(void)
-{
-	//
-	// Operation:	A <- A+(IX+d)
-	// Op Code:		ADD
-	// Operands:	A, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|0|1|1|0| 86
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_IX + displacement), false);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDA_IYd_(void)
-{
-	//
-	// Operation:	A <- A+(IY+d)
-	// Op Code:		ADD
-	// Operands:	A, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|0|1|1|0| 86
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_IY + displacement), false);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCAr(void)
-{
-	//
-	// Operation:	A <- A+r+C
-	// Op Code:		ADC
-	// Operands:	A, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	m_A = HandleArithmeticAddFlags(m_A, REGISTER_8BIT(ReadMemory(m_PC++)), true);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCAIXh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		ADC
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|0|0| C4
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, m_IXh, true);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCAIXl(void)
-{
-	//
-	// Operation:	A <- A+IXl
-	// Op Code:		ADC
-	// Operands:	A, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|0|1| C5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, m_IXl, true);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCAIYh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		ADC
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|0|0| C4
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, m_IYh, true);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCAIYl(void)
-{
-	//
-	// Operation:	A <- A+IYl
-	// Op Code:		ADC
-	// Operands:	A, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|0|1| C5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, m_IYl, true);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCAn(void)
-{
-	//
-	// Operation:	A <- A+n+C
-	// Op Code:		ADC
-	// Operands:	A, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|1|1|0| CE
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_PC++), true);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCA_HL_(void)
-{
-	//
-	// Operation:	A <- A+(HL)+C
-	// Op Code:		ADC
-	// Operands:	A, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|1|0| 8E
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_HL), true);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCA_IXd_(void)
-{
-	//
-	// Operation:	A <- A+(IX+d)+C
-	// Op Code:		ADC
-	// Operands:	A, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|1|0| 8E
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_IX + displacement), true);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCA_IYd_(void)
-{
-	//
-	// Operation:	A <- A+(IY+d)+C
-	// Op Code:		ADC
-	// Operands:	A, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|1|0| 8E
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_IY + displacement), true);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUBr(void)
-{
-	//
-	// Operation:	A <- A-r
-	// Op Code:		SUB
-	// Operands:	A, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	m_A = HandleArithmeticSubtractFlags(m_A, REGISTER_8BIT(ReadMemory(m_PC++)), false);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUBIXh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		SUB
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|0|0| 94
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, m_IXh, false);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUBIXl(void)
-{
-	//
-	// Operation:	A <- A+IXl
-	// Op Code:		SUB
-	// Operands:	A, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|0|1| 95
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, m_IXl, false);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUBIYh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		SUB
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|0|0| 94
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, m_IYh, false);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUBIYl(void)
-{
-	//
-	// Operation:	A <- A+IYl
-	// Op Code:		SUB
-	// Operands:	A, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|0|1| 95
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, m_IYl, false);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUBn(void)
-{
-	//
-	// Operation:	A <- A-n
-	// Op Code:		SUB
-	// Operands:	A, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|0|1|1|0| D6
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_PC++), false);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUB_HL_(void)
-{
-	//
-	// Operation:	A <- A-(HL)
-	// Op Code:		SUB
-	// Operands:	A, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|1|0| 96
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_HL), false);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUB_IXd_(void)
-{
-	//
-	// Operation:	A <- A-(IX+d)
-	// Op Code:		SUB
-	// Operands:	A, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|1|0| 96
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_IX + displacement), false);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSUB_IYd_(void)
-{
-	//
-	// Operation:	A <- A-(IY+d)
-	// Op Code:		SUB
-	// Operands:	A, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|1|0| 96
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_IY + displacement), false);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCAr(void)
-{
-	//
-	// Operation:	A <- A-r-C
-	// Op Code:		SBC
-	// Operands:	A, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	m_A = HandleArithmeticSubtractFlags(m_A, REGISTER_8BIT(ReadMemory(m_PC++)), true);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCAIXh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		SBC
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|0|0| 8C
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, m_IXh, true);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCAIXl(void)
-{
-	//
-	// Operation:	A <- A+IXl
-	// Op Code:		SBC
-	// Operands:	A, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|0|1| 8D
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, m_IXl, true);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCAIYh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		SBC
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|0|0| 8C
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, m_IYh, true);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCAIYl(void)
-{
-	//
-	// Operation:	A <- A+IYl
-	// Op Code:		SBC
-	// Operands:	A, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|0|1|1|0|1| 8D
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, m_IYl, true);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCAn(void)
-{
-	//
-	// Operation:	A <- A-n-C
-	// Op Code:		SBC
-	// Operands:	A, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|1|0| DE
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_PC++), true);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCA_HL_(void)
-{
-	//
-	// Operation:	A <- A-(HL)-C
-	// Op Code:		SBC
-	// Operands:	A, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|1|1|1|0| 9E
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_HL), true);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCA_IXd_(void)
-{
-	//
-	// Operation:	A <- A-(IX+d)-C
-	// Op Code:		SBC
-	// Operands:	A, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|1|1|1|0| 9E
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_IX + displacement), true);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCA_IYd_(void)
-{
-	//
-	// Operation:	A <- A-(IY+d)-C
-	// Op Code:		SBC
-	// Operands:	A, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|1|1|1|0| 9E
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_IY + displacement), true);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementANDr(void)
-{
-	//
-	// Operation:	A <- A&r
-	// Op Code:		AND
-	// Operands:	A, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	m_A &= REGISTER_8BIT(ReadMemory(m_PC++));
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementANDIXh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		AND
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|1|0|0| A4
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A &= m_IXh;
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementANDIXl(void)
-{
-	//
-	// Operation:	A <- A+IXl
-	// Op Code:		AND
-	// Operands:	A, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|1|0|1| A5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A &= m_IXl;
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementANDIYh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		AND
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|1|0|0| A4
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A &= m_IYh;
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementANDIYl(void)
-{
-	//
-	// Operation:	A <- A+IYl
-	// Op Code:		AND
-	// Operands:	A, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|1|0|1| A5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A &= m_IYl;
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementANDn(void)
-{
-	//
-	// Operation:	A <- A&n
-	// Op Code:		AND
-	// Operands:	A, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|0|1|1|0| E6
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A &= ReadMemory(m_PC++);
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementAND_HL_(void)
-{
-	//
-	// Operation:	A <- A&(HL)
-	// Op Code:		AND
-	// Operands:	A, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|1|1|0| A6
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A &= ReadMemory(m_HL);
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementAND_IXd_(void)
-{
-	//
-	// Operation:	A <- A&(IX+d)
-	// Op Code:		AND
-	// Operands:	A, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|1|1|0| A6
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A &= ReadMemory(m_IX + displacement);
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementAND_IYd_(void)
-{
-	//
-	// Operation:	A <- A&(IY+d)
-	// Op Code:		AND
-	// Operands:	A, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|1|1|0| A6
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A &= ReadMemory(m_IY + displacement);
-	HandleLogicalFlags(m_A);
-	m_F |= eF_H;
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementORr(void)
-{
-	//
-	// Operation:	A <- A|r
-	// Op Code:		OR
-	// Operands:	A, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	m_A |= REGISTER_8BIT(ReadMemory(m_PC++));
-	HandleLogicalFlags(m_A);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementORIXh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		OR
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|1|0|0| B4
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A |= m_IXh;
-	HandleLogicalFlags(m_A);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementORIXl(void)
-{
-	//
-	// Operation:	A <- A+IXl
-	// Op Code:		OR
-	// Operands:	A, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|1|0|1| B5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A |= m_IXl;
-	HandleLogicalFlags(m_A);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementORIYh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		OR
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|1|0|0| B4
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A |= m_IYh;
-	HandleLogicalFlags(m_A);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementORIYl(void)
-{
-	//
-	// Operation:	A <- A+IYl
-	// Op Code:		OR
-	// Operands:	A, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|1|0|1| B5
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A |= m_IYl;
-	HandleLogicalFlags(m_A);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementORn(void)
-{
-	//
-	// Operation:	A <- A|n
-	// Op Code:		OR
-	// Operands:	A, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|0|1|1|0| F6
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A |= ReadMemory(m_PC++);
-	HandleLogicalFlags(m_A);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementOR_HL_(void)
-{
-	//
-	// Operation:	A <- A|(HL)
-	// Op Code:		OR
-	// Operands:	A, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|1|1|0| B6
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A |= ReadMemory(m_HL);
-	HandleLogicalFlags(m_A);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementOR_IXd_(void)
-{
-	//
-	// Operation:	A <- A|(IX+d)
-	// Op Code:		OR
-	// Operands:	A, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|1|1|0| B6
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A |= ReadMemory(m_IX + displacement);
-	HandleLogicalFlags(m_A);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementOR_IYd_(void)
-{
-	//
-	// Operation:	A <- A|(IY+d)
-	// Op Code:		OR
-	// Operands:	A, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|1|1|0| B6
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A |= ReadMemory(m_IY + displacement);
-	HandleLogicalFlags(m_A);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXORr(void)
-{
-	//
-	// Operation:	A <- A^r
-	// Op Code:		XOR
-	// Operands:	A, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	m_A ^= REGISTER_8BIT(ReadMemory(m_PC++));
-	HandleLogicalFlags(m_A);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXORIXh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		XOR
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|1|0|0| AC
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A ^= m_IXh;
-	HandleLogicalFlags(m_A);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXORIXl(void)
-{
-	//
-	// Operation:	A <- A+IXl
-	// Op Code:		XOR
-	// Operands:	A, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|1|0|1| AD
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A ^= m_IXl;
-	HandleLogicalFlags(m_A);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXORIYh(void)
-{
-	//
-	// Operation:	A <- A+IXh
-	// Op Code:		XOR
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|1|0|0| AC
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A ^= m_IYh;
-	HandleLogicalFlags(m_A);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXORIYl(void)
-{
-	//
-	// Operation:	A <- A+IYl
-	// Op Code:		XOR
-	// Operands:	A, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|1|0|1| AD
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_A ^= m_IYl;
-	HandleLogicalFlags(m_A);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXORn(void)
-{
-	//
-	// Operation:	A <- A^n
-	// Op Code:		XOR
-	// Operands:	A, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|1|0| EE
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A ^= ReadMemory(m_PC++);
-	HandleLogicalFlags(m_A);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXOR_HL_(void)
-{
-	//
-	// Operation:	A <- A^(HL)
-	// Op Code:		XOR
-	// Operands:	A, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|1|1|0| AE
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	m_A ^= ReadMemory(m_HL);
-	HandleLogicalFlags(m_A);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXOR_IXd_(void)
-{
-	//
-	// Operation:	A <- A^(IX+d)
-	// Op Code:		XOR
-	// Operands:	A, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|1|1|0| AE
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A ^= ReadMemory(m_IX + displacement);
-	HandleLogicalFlags(m_A);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementXOR_IYd_(void)
-{
-	//
-	// Operation:	A <- A^(IY+d)
-	// Op Code:		XOR
-	// Operands:	A, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|1|1|0| AE
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_A ^= ReadMemory(m_IY + displacement);
-	HandleLogicalFlags(m_A);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPr(void)
-{
-	//
-	// Operation:	A - r
-	// Op Code:		CP
-	// Operands:	A, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	uint8 reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	HandleArithmeticSubtractFlags(m_A, reg, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= reg & (eF_Y | eF_X);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPIXh(void)
-{
-	//
-	// Operation:	A - IXh
-	// Op Code:		CP
-	// Operands:	A, IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|1|0|0| BC
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	HandleArithmeticSubtractFlags(m_A, m_IXh, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= m_IXh & (eF_Y | eF_X);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPIXl(void)
-{
-	//
-	// Operation:	A - IXl
-	// Op Code:		CP
-	// Operands:	A, IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|1|0|1| BD
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	HandleArithmeticSubtractFlags(m_A, m_IXl, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= m_IXl & (eF_Y | eF_X);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPIYh(void)
-{
-	//
-	// Operation:	A - IYh
-	// Op Code:		CP
-	// Operands:	A, IYh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|1|0|0| BC
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	HandleArithmeticSubtractFlags(m_A, m_IYh, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= m_IYh & (eF_Y | eF_X);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPIYl(void)
-{
-	//
-	// Operation:	A - IYl
-	// Op Code:		CP
-	// Operands:	A, IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|1|0|1| BD
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	HandleArithmeticSubtractFlags(m_A, m_IYl, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= m_IYl & (eF_Y | eF_X);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPn(void)
-{
-	//
-	// Operation:	A - n
-	// Op Code:		CP
-	// Operands:	A, n
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|0|1|1|0| D6
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	uint8 byte = ReadMemory(m_PC++);
-	HandleArithmeticSubtractFlags(m_A, byte, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= byte & (eF_Y | eF_X);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCP_HL_(void)
-{
-	//
-	// Operation:	A - (HL)
-	// Op Code:		CP
-	// Operands:	A, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|1|0| 96
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						7	(4,3)						1.75
-	//
-	++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	HandleArithmeticSubtractFlags(m_A, byte, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= byte & (eF_Y | eF_X);
-	return 7;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCP_IXd_(void)
-{
-	//
-	// Operation:	A - (IX+d)
-	// Op Code:		CP
-	// Operands:	A, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|1|0| 96
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 byte = ReadMemory(m_IX + displacement);
-	HandleArithmeticSubtractFlags(m_A, byte, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= byte & (eF_Y | eF_X);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCP_IYd_(void)
-{
-	//
-	// Operation:	A <- A-(IY+d)
-	// Op Code:		CP
-	// Operands:	A, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|0|1|0|1|1|0| 96
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								5						19 (4,4,3,5,3)		4.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 byte = ReadMemory(m_IY + displacement);
-	HandleArithmeticSubtractFlags(m_A, byte, false);
-	// From The Undocumented Z80:
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= byte & (eF_Y | eF_X);
-	return 19;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINCr(void)
-{
-	//
-	// Operation:	r <- r+1
-	// Op Code:		INC
-	// Operands:	r
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|r|r|r|1|0|0|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++) >> 3);
-	uint8 origF = m_F;
-	reg = HandleArithmeticAddFlags(reg, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINCIXh(void)
-{
-	//
-	// Operation:	IXh <- IXh+1
-	// Op Code:		INC
-	// Operands:	IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|0|0| 24
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8 (4,4)						2.00
-	//
-	++++m_PC;
-	uint8 origF = m_F;
-	m_IXh = HandleArithmeticAddFlags(m_IXh, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINCIXl(void)
-{
-	//
-	// Operation:	IXl <- IXl+1
-	// Op Code:		INC
-	// Operands:	IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|0|0| 2C
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8 (4,4)						2.00
-	//
-	++++m_PC;
-	uint8 origF = m_F;
-	m_IXl = HandleArithmeticAddFlags(m_IXl, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINCIYh(void)
-{
-	//
-	// Operation:	IYh <- IYh+1
-	// Op Code:		INC
-	// Operands:	IYh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|0|0| 24
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8 (4,4)						2.00
-	//
-	++++m_PC;
-	uint8 origF = m_F;
-	m_IYh = HandleArithmeticAddFlags(m_IYh, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINCIYl(void)
-{
-	//
-	// Operation:	IYl <- IYl+1
-	// Op Code:		INC
-	// Operands:	IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|0|0| 2C
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8 (4,4)						2.00
-	//
-	++++m_PC;
-	uint8 origF = m_F;
-	m_IYl = HandleArithmeticAddFlags(m_IYl, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINC_HL_(void)
-{
-	//
-	// Operation:	(HL) <- (HL)+1
-	// Op Code:		INC
-	// Operands:	(HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|0|0| 34
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						11 (4,4,3)				2.75
-	//
-	++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 origF = m_F;
-	byte = HandleArithmeticAddFlags(byte, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	WriteMemory(m_HL, byte);
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINC_IXd_(void)
-{
-	//
-	// Operation:	(IX+d) <- (IX+d)+1
-	// Op Code:		INC
-	// Operands:	(IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|0|0| 34
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 origF = m_F;
-	byte = HandleArithmeticAddFlags(byte, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	WriteMemory(m_IX + displacement, byte);
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINC_IYd_(void)
-{
-	//
-	// Operation:	(IY+d) <- (IY+d)+1
-	// Op Code:		INC
-	// Operands:	(IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|0|0| 34
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 origF = m_F;
-	byte = HandleArithmeticAddFlags(byte, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	WriteMemory(m_IY + displacement, byte);
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDECr(void)
-{
-	//
-	// Operation:	r <- r-1
-	// Op Code:		DEC
-	// Operands:	r
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|r|r|r|1|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
-	int8& reg = *reinterpret_cast<int8*>(&REGISTER_8BIT(ReadMemory(m_PC++) >> 3));
-	uint8 origF = m_F;
-	reg = HandleArithmeticSubtractFlags(reg, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDECIXh(void)
-{
-	//
-	// Operation:	IXh <- IXh-1
-	// Op Code:		DEC
-	// Operands:	IXh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|0|1| 25
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8	(4,4)						1.00
-	//
-	++++m_PC;
-	uint8 origF = m_F;
-	m_IXh = HandleArithmeticSubtractFlags(m_IXh, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDECIXl(void)
-{
-	//
-	// Operation:	IXl <- IXl-1
-	// Op Code:		DEC
-	// Operands:	IXl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|0|1| 2D
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8	(4,4)						1.00
-	//
-	++++m_PC;
-	uint8 origF = m_F;
-	m_IXl = HandleArithmeticSubtractFlags(m_IXl, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDECIYh(void)
-{
-	//
-	// Operation:	IYh <- IYh-1
-	// Op Code:		DEC
-	// Operands:	IYh
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|0|1| 25
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8	(4,4)						1.00
-	//
-	++++m_PC;
-	uint8 origF = m_F;
-	m_IYh = HandleArithmeticSubtractFlags(m_IYh, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDECIYl(void)
-{
-	//
-	// Operation:	IYl <- IYl-1
-	// Op Code:		DEC
-	// Operands:	IYl
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|0|1| 2D
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						8	(4,4)						1.00
-	//
-	++++m_PC;
-	uint8 origF = m_F;
-	m_IYl = HandleArithmeticSubtractFlags(m_IYl, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDEC_HL_(void)
-{
-	//
-	// Operation:	(HL) <- (HL)-1
-	// Op Code:		DEC
-	// Operands:	(HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|0|1| 35
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						11 (4,4,3)				2.75
-	//
-	++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 origF = m_F;
-	byte = HandleArithmeticSubtractFlags(byte, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	WriteMemory(m_HL, byte);
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDEC_IXd_(void)
-{
-	//
-	// Operation:	(IX+d) <- (IX+d)-1
-	// Op Code:		DEC
-	// Operands:	(IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|0|1| 35
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 origF = m_F;
-	byte = HandleArithmeticSubtractFlags(byte, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	WriteMemory(m_IX + displacement, byte);
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDEC_IYd_(void)
-{
-	//
-	// Operation:	(IY+d) <- (IY+d)-1
-	// Op Code:		DEC
-	// Operands:	(IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|0|1| 35
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 origF = m_F;
-	byte = HandleArithmeticSubtractFlags(byte, 1, false);
-	m_F &= ~eF_C;
-	m_F |= (origF & eF_C);
-	WriteMemory(m_IY + displacement, byte);
-	return 23;
-}
-
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-//	General-Purpose Arithmetic and CPU Control Groups
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementDAA(void)
-{
-	//
-	// Operation:	A
-	// Op Code:		DAA
-	// Operands:	A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|1|1| 27
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	uint8 correction = 0x00;
-
-	if ((m_F & eF_C) || (m_A > 0x99))
-	{
-		correction |= 0x60;
-		m_F |= eF_C;
-	}
-	else
-	{
-		m_F &= ~eF_C;
-	}
-
-	if ((m_F & eF_H) || ((m_A & 0x0F) > 9))
-	{
-		correction |= 0x06;
-	}
-
-	uint8 origA = m_A;
-
-	if (m_F & eF_N)
-	{
-		m_A -= correction;
-	}
-	else
-	{
-		m_A += correction;
-	}
-
-	uint8 origF = m_F;
-	HandleLogicalFlags(m_A);
-	m_F &= ~(eF_H | eF_N | eF_C);
-	m_F |= ((origA ^ m_A) & eF_H) | (origF & (eF_N | eF_C));
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCPL(void)
-{
-	//
-	// Operation:	A <- ~A
-	// Op Code:		CPL
-	// Operands:	A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|1|1| 27
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	m_A = ~m_A;
-	m_F &= (eF_S | eF_Z | eF_PV | eF_C);
-	m_F |= (eF_H | eF_N) | (m_A & (eF_X | eF_Y));
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementNEG(void)
-{
-	//
-	// Operation:	A <- 0-A
-	// Op Code:		NEG
-	// Operands:	A
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|0|0|1|0|0| 44
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	uint8 origA = m_A;
-	m_A = HandleArithmeticSubtractFlags(0, m_A, false);
-	m_F &= ~(eF_PV | eF_C);
-	m_F |= ((origA == 0x80) ? eF_PV : 0) | ((origA) ? eF_C : 0);
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementCCF(void)
-{
-	//
-	// Operation:	CF <- ~CF
-	// Op Code:		CCF
-	// Operands:	CF
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|1|1|1|1| 3F
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	uint8 origF = m_F;
-	m_F &= (eF_S | eF_Z | eF_PV);
-	m_F |= (m_A & (eF_X | eF_Y)) | (((origF & eF_C) << 4) & eF_H) | (~origF & eF_C);
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSCF(void)
-{
-	//
-	// Operation:	CF <- 1
-	// Op Code:		SCF
-	// Operands:	CF
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|1|1| 37
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	m_F &= (eF_S | eF_Z | eF_PV);
-	m_F |= (m_A & (eF_X | eF_Y)) | eF_C;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementNOP(void)
-{
-	//
-	// Operation:	---
-	// Op Code:		NOP
-	// Operands:	---
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|0|0|0|0| 00
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementHALT(void)
-{
-	//
-	// Operation:	---
-	// Op Code:		HALT
-	// Operands:	---
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|1|0|1|1|0| 76
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	// Intentionally don't increment PC
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDI(void)
-{
-	//
-	// Operation:	IFF <- 0
-	// Op Code:		DI
-	// Operands:	IFF
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|0|0|1|1| F3
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	m_State.m_IFF1 = 0;
-	m_State.m_IFF2 = 0;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementEI(void)
-{
-	//
-	// Operation:	IFF <- 1
-	// Op Code:		DI
-	// Operands:	IFF
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|0|1|1| FB
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
-	//
-	++m_PC;
-	m_State.m_IFF1 = 1;
-	m_State.m_IFF2 = 1;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementIM0(void)
-{
-	//
-	// Operation:	---
-	// Op Code:		IM
-	// Operands:	0
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|0|0|1|1|0| 46
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_State.m_InterruptMode = 0;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementIM1(void)
-{
-	//
-	// Operation:	---
-	// Op Code:		IM
-	// Operands:	1
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|1|0|1|1|0| 56
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_State.m_InterruptMode = 1;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementIM2(void)
-{
-	//
-	// Operation:	---
-	// Op Code:		IM
-	// Operands:	2
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|1|1|1|1|0| 5E
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00
-	//
-	++++m_PC;
-	m_State.m_InterruptMode = 2;
-	return 8;
-}
-
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-//	16-Bit Arithmetic Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDHLdd(void)
-{
-	//
-	// Operation:	HL <- HL+dd
-	// Op Code:		ADD
-	// Operands:	HL, dd
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|d|d|0|1|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								SP					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						11 (4,4,3)				2.75
-	//
-	uint8 origF = m_F;
-	m_HL = Handle16BitArithmeticAddFlags(m_HL, REGISTER_16BIT(ReadMemory(m_PC++) >> 4), false);
-	m_F &= ~(eF_S | eF_Z | eF_PV);
-	m_F |= (origF & (eF_S | eF_Z | eF_PV));
-	return 11;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADCHLdd(void)
-{
-	//
-	// Operation:	HL <- HL+dd+C
-	// Op Code:		ADC
-	// Operands:	HL, dd
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|d|d|1|0|1|0|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								AF					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75
-	//
-	++m_PC;
-	m_HL = Handle16BitArithmeticAddFlags(m_HL, REGISTER_16BIT(ReadMemory(m_PC++) >> 4), true);
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementSBCHLdd(void)
-{
-	//
-	// Operation:	HL <- HL-dd-C
-	// Op Code:		SBC
-	// Operands:	HL, dd
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|d|d|0|0|1|0|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								AF					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75
-	//
-	++m_PC;
-	m_HL = Handle16BitArithmeticSubtractFlags(m_HL, REGISTER_16BIT(ReadMemory(m_PC++) >> 4), true);
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDIXdd(void)
-{
-	//
-	// Operation:	IX <- IX+dd
-	// Op Code:		ADD
-	// Operands:	IX, dd
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|d|d|1|0|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								IX					10
-	//								AF					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						15 (4,4,4,3)			3.75
-	//
-	uint8 opcode = ReadMemory(++m_PC) >> 4;
-	++m_PC;
-	uint16 source = (opcode == 2) ? m_IX : REGISTER_16BIT(opcode);
-	uint8 origF = m_F;
-	m_IX = Handle16BitArithmeticAddFlags(m_IX, source, false);
-	m_F &= ~(eF_S | eF_Z | eF_PV);
-	m_F |= (origF & (eF_S | eF_Z | eF_PV));
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementADDIYdd(void)
-{
-	//
-	// Operation:	IY <- IY+dd
-	// Op Code:		ADD
-	// Operands:	IY, dd
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|d|d|1|0|0|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								IY					10
-	//								AF					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								3						15 (4,4,4,3)			3.75
-	//
-	uint8 opcode = ReadMemory(++m_PC) >> 4;
-	++m_PC;
-	uint16 source = (opcode == 2) ? m_IY : REGISTER_16BIT(opcode);
-	uint8 origF = m_F;
-	m_IY = Handle16BitArithmeticAddFlags(m_IY, source, false);
-	m_F &= ~(eF_S | eF_Z | eF_PV);
-	m_F |= (origF & (eF_S | eF_Z | eF_PV));
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINCdd(void)
-{
-	//
-	// Operation:	dd <- dd+1
-	// Op Code:		INC
-	// Operands:	dd
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|d|d|0|0|1|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where dd is any of:
-	//								BC					00
-	//								DE					01
-	//								HL					10
-	//								SP					11
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						6									1.50
-	//
-	++REGISTER_16BIT(ReadMemory(m_PC++) >> 4);
-	return 6;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINCIX(void)
-{
-	//
-	// Operation:	IX <- IX+1
-	// Op Code:		INC
-	// Operands:	IX
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|0|1|1| 23
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						10 (4,6)					2.50
-	//
-	++++m_PC;
-	++m_IX;
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementINCIY(void)
-{
-	//
-	// Operation:	IY <- IY+1
-	// Op Code:		INC
-	// Operands:	IY
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|0|1|1| 23
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						10 (4,6)					2.50
-	//
-	++++m_PC;
-	++m_IY;
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDECdd(void)
-{
-	//
-	// Operation:	dd <- dd-1
-	// Op Code:		DEC
-	// Operands:	dd
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|d|d|1|0|1|1|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						6									1.50
-	//
-	--REGISTER_16BIT(ReadMemory(m_PC++) >> 4);
-	return 6;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDECIX(void)
-{
-	//
-	// Operation:	IX <- IX-1
-	// Op Code:		DEC
-	// Operands:	IX
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|0|1|1| 2B
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						10 (4,6)					2.50
-	//
-	++++m_PC;
-	--m_IX;
-	return 10;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementDECIY(void)
-{
-	//
-	// Operation:	IY <- IY-1
-	// Op Code:		DEC
-	// Operands:	IY
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|0|1|1| 2B
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						10 (4,6)					2.50
-	//
-	++++m_PC;
-	--m_IY;
-	return 10;
-}
-
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-//	Rotate and Shift Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementRLCA(void)
-{
-	//
-	// Operation:	C <- 7<-0 A
-	//								 +--+
-	// Op Code:		RLCA
-	// Operands:	A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|0|1|1|1| 07
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00	
-	//
-	++m_PC;
-	uint8 carry = (m_A & eF_S) >> 7;
-	m_A = (m_A << 1) | carry;
-	m_F &= (eF_S | eF_Z | eF_PV);
-	m_F |= (m_A & (eF_X | eF_Y)) | carry;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRLA(void)
-{
-	//
-	// Operation:	C <- 7<-0 A
-	//						+-------+
-	// Op Code:		RLA
-	// Operands:	A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|0|1|1|1| 07
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00	
-	//
-	++m_PC;
-	uint8 carry = (m_A & eF_S) >> 7;
-	m_A = (m_A << 1) | (m_F & eF_C);
-	m_F &= (eF_S | eF_Z | eF_PV);
-	m_F |= (m_A & (eF_X | eF_Y)) | carry;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRRCA(void)
-{
-	//
-	// Operation:	A 7->0 -> C
-	//							+--+
-	// Op Code:		RRCA
-	// Operands:	A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|1|1|1|1| 0F
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00	
-	//
-	++m_PC;
-	uint8 carry = (m_A & eF_C);
-	m_A = (m_A >> 1) | (carry << 7);
-	m_F &= (eF_S | eF_Z | eF_PV);
-	m_F |= (m_A & (eF_X | eF_Y)) | carry;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRRA(void)
-{
-	//
-	// Operation:	A 7->0 -> C
-	//							+-------+
-	// Op Code:		RRCA
-	// Operands:	A
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|1|1|1|1| 1F
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00	
-	//
-	++m_PC;
-	uint8 carry = (m_A & eF_C);
-	m_A = (m_A >> 1) | ((m_F & eF_C) << 7);
-	m_F &= (eF_S | eF_Z | eF_PV);
-	m_F |= (m_A & (eF_X | eF_Y)) | carry;
-	return 4;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRLCr(void)
-{
-	//
-	// Operation:	C <- 7<-0 r
-	//								 +--+
-	// Op Code:		RLC
-	// Operands:	r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00	
-	//
-	++m_PC;
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	uint8 carry = (reg & eF_S) >> 7;
-	reg = (reg << 1) | carry;
-	HandleLogicalFlags(reg);
-	m_F |= carry;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRLC_HL_(void)
-{
-	//
-	// Operation:	C <- 7<-0 (HL)
-	//								 +--+
-	// Op Code:		RLC
-	// Operands:	(HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|0|1|1|0| 06
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75	
-	//
-	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | carry;
-	WriteMemory(m_HL, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRLC_IXd_(void)
-{
-	//
-	// Operation:	C <- 7<-0 (IX+d)
-	//								 +--+
-	// Op Code:		RLC
-	// Operands:	(IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|0|1|1|0| 06
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75	
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | carry;
-	WriteMemory(m_IX + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRLC_IYd_(void)
-{
-	//
-	// Operation:	C <- 7<-0 (IY+d)
-	//								 +--+
-	// Op Code:		RLC
-	// Operands:	(IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|0|1|1|0| 06
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75	
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | carry;
-	WriteMemory(m_IY + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRLr(void)
-{
-	//
-	// Operation:	C <- 7<-0 r
-	//						+-------+
-	// Op Code:		RL
-	// Operands:	r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|0|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00	
-	//
-	++m_PC;
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	uint8 carry = (reg & eF_S) >> 7;
-	reg = (reg << 1) | (m_F & eF_C);
-	HandleLogicalFlags(reg);
-	m_F |= carry;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRL_HL_(void)
-{
-	//
-	// Operation:	C <- 7<-0 (HL)
-	//						+-------+
-	// Op Code:		RL
-	// Operands:	(HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|0|1|1|0| 16
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75	
-	//
-	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | (m_F & eF_C);
-	WriteMemory(m_HL, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRL_IXd_(void)
-{
-	//
-	// Operation:	C <- 7<-0 (IX+d)
-	//						+-------+
-	// Op Code:		RL
-	// Operands:	(IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|0|1|1|0| 16
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | (m_F & eF_C);
-	WriteMemory(m_IX + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRL_IYd_(void)
-{
-	//
-	// Operation:	C <- 7<-0 (IY+d)
-	//						+-------+
-	// Op Code:		RL
-	// Operands:	(IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|0|1|1|0| 16
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | (m_F & eF_C);
-	WriteMemory(m_IY + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRRCr(void)
-{
-	//
-	// Operation:	r 7->0 -> C
-	//						  +--+
-	// Op Code:		RRC
-	// Operands:	r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|1|r|r|r|
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00	
-	//
-	++m_PC;
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	uint8 carry = (reg & eF_C);
-	reg = (reg >> 1) | (carry << 7);
-	HandleLogicalFlags(reg);
-	m_F |= carry;
-	return 8;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRRC_HL_(void)
-{
-	//
-	// Operation:	(HL) 7->0 -> C
-	//								 +--+
-	// Op Code:		RRC
-	// Operands:	(HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|1|1|1|0| 0E
-	//						+-+-+-+-+-+-+-+-+
-	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75	
-	//
-	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | (carry << 7);
-	WriteMemory(m_HL, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRRC_IXd_(void)
+uint32 CZ80::ImplementLDrr(void)
 {
 	//
-	// Operation:	(IX+d) 7->0 -> C
-	//									 +--+
-	// Op Code:		RRC
-	// Operands:	(IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	// Operation:	r <- r'
+	// Op Code:		LD
+	// Operands:	r, r'
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|1|1|1|0| 0E
+	//						|0|1|d|d|d|s|s|s|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where ddd and sss are any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75	
+	//								1						4									1.00
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
 	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | (carry << 7);
-	WriteMemory(m_IX + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	REGISTER_8BIT(opcode >> 3) = REGISTER_8BIT(opcode);
+	return 4;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRRC_IYd_(void)
+uint32 CZ80::ImplementLDrIXh(void)
 {
 	//
-	// Operation:	(IY+d) 7->0 -> C
-	//									 +--+
-	// Op Code:		RRC
-	// Operands:	(IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	r <- IXh
+	// Op Code:		LD
+	// Operands:	r, IXh
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|0|1|1|1|0| 0E
+	//						|0|1|d|d|d|1|0|0|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where ddd is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								IXh					100
+	//								IXl					101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								1						8 (4,4)						2.00
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	++m_PC;
 	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | (carry << 7);
-	WriteMemory(m_IY + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	uint8* pReg = &REGISTER_8BIT(opcode >> 3);
+	if (pReg == &m_H) pReg = &m_IXh;
+	if (pReg == &m_L) pReg = &m_IXl;
+	*pReg = m_IXh;
+	return 8;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRRr(void)
+uint32 CZ80::ImplementLDrIXl(void)
 {
 	//
-	// Operation:	r 7->0 -> C
-	//						  +-------+
-	// Op Code:		RR
-	// Operands:	r
+	// Operation:	r <- IXl
+	// Op Code:		LD
+	// Operands:	r, IXl
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|1|r|r|r|
+	//						|0|1|d|d|d|1|0|1|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where ddd is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								IXh					100
+	//								IXl					101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00	
+	//								1						8 (4,4)						2.00
 	//
 	++m_PC;
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	uint8 carry = (reg & eF_C);
-	reg = (reg >> 1) | ((m_F & eF_C) << 7);
-	HandleLogicalFlags(reg);
-	m_F |= carry;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8* pReg = &REGISTER_8BIT(opcode >> 3);
+	if (pReg == &m_H) pReg = &m_IXh;
+	if (pReg == &m_L) pReg = &m_IXl;
+	*pReg = m_IXl;
 	return 8;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRR_HL_(void)
+uint32 CZ80::ImplementLDrIYh(void)
 {
 	//
-	// Operation:	(HL) 7->0 -> C
-	//								 +-------+
-	// Op Code:		RR
-	// Operands:	(HL)
+	// Operation:	r <- IYh
+	// Op Code:		LD
+	// Operands:	r, IYh
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|1|1|1|0| 1E
+	//						|0|1|d|d|d|1|0|0|
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75	
-	//
-	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | ((m_F & eF_C) << 7);
-	WriteMemory(m_HL, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	return 15;
-}
-
-//=============================================================================
-
-uint32 CZ80::ImplementRR_IXd_(void)
-{
-	//
-	// Operation:	(IX+d) 7->0 -> C
-	//									 +-------+
-	// Op Code:		RR
-	// Operands:	(IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|1|1|1|0| 1E
-	//						+-+-+-+-+-+-+-+-+
+	//						where ddd is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								IYh					100
+	//								IYl					101
+	//								A						111
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75	
+	//								1						8 (4,4)						2.00
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	++m_PC;
 	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | ((m_F & eF_C) << 7);
-	WriteMemory(m_IX + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	uint8* pReg = &REGISTER_8BIT(opcode >> 3);
+	if (pReg == &m_H) pReg = &m_IYh;
+	if (pReg == &m_L) pReg = &m_IYl;
+	*pReg = m_IYh;
+	return 8;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRR_IYd_(void)
+uint32 CZ80::ImplementLDrIYl(void)
 {
 	//
-	// Operation:	(IY+d) 7->0 -> C
-	//									 +-------+
-	// Op Code:		RR
-	// Operands:	(IY+d)
+	// Operation:	r <- IYl
+	// Op Code:		LD
+	// Operands:	r, IYl
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|1|1|1|0| 1E
+	//						|0|1|d|d|d|1|0|1|
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75	
-	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | ((m_F & eF_C) << 7);
-	WriteMemory(m_IY + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	//						where ddd is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								IYh					100
+	//								IYl					101
+	//								A						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8 (4,4)						2.00
+	//
+	++m_PC;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8* pReg = &REGISTER_8BIT(opcode >> 3);
+	if (pReg == &m_H) pReg = &m_IYh;
+	if (pReg == &m_L) pReg = &m_IYl;
+	*pReg = m_IYl;
+	return 8;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSLAr(void)
+uint32 CZ80::ImplementLDrn(void)
 {
 	//
-	// Operation:	C <- 7<-0 r
-	// Op Code:		SLA
-	// Operands:	r
+	// Operation:	r <- n
+	// Op Code:		LD
+	// Operands:	r, n
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|0|0|r|r|r|1|1|0|
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|r|r|r|
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00	
+	//								2						7 (4,3)						1.75
 	//
-	++m_PC;
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	uint8 carry = (reg & eF_S) >> 7;
-	reg = (reg << 1);
-	HandleLogicalFlags(reg);
-	m_F |= carry;
-	return 8;
+	uint8 opcode = ReadMemory(m_PC++);
+	REGISTER_8BIT(opcode >> 3) = ReadMemory(m_PC++);
+	return 7;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSLA_HL_(void)
+uint32 CZ80::ImplementLDIXhn(void)
 {
 	//
-	// Operation:	C <- 7<-0 (HL)
-	// Op Code:		SLA
-	// Operands:	(HL)
+	// Operation:	IXh <- n
+	// Op Code:		LD
+	// Operands:	IXh, n
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
 	//						|0|0|1|0|0|1|1|0| 26
 	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75	
+	//								2						11 (4,4,3)				2.75
 	//
 	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1);
-	WriteMemory(m_HL, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	return 15;
+	m_IXh = ReadMemory(m_PC++);
+	return 11;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSLA_IXd_(void)
+uint32 CZ80::ImplementLDIXhr(void)
 {
 	//
-	// Operation:	C <- 7<-0 (IX+d)
-	// Op Code:		SLA
-	// Operands:	(IX+d)
+	// Operation:	IXh <- r
+	// Op Code:		LD
+	// Operands:	IXh, r
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|1|0| 26
+	//						|0|1|1|0|0|s|s|s|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where ddd and sss are any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								IXh					100
+	//								IXl					101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								1						8	(4,4)						2.00
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1);
-	WriteMemory(m_IX + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	uint8 opcode = ReadMemory(++m_PC);
+	uint8* pReg = &REGISTER_8BIT(opcode);
+	if (pReg == &m_H) pReg = &m_IXh;
+	if (pReg == &m_L) pReg = &m_IXl;
+	m_IXh = *pReg;
+	++m_PC;
+	return 8;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSLA_IYd_(void)
+uint32 CZ80::ImplementLDIXln(void)
 {
 	//
-	// Operation:	C <- 7<-0 (IY+d)
-	// Op Code:		SLA
-	// Operands:	(IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
+	// Operation:	IXl <- n
+	// Op Code:		LD
+	// Operands:	IXl, n
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|0|0|1|0|1|1|1|0| 2E
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|1|1|0| 26
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								2						11 (4,4,3)				2.75
 	//
 	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1);
-	WriteMemory(m_IY + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	m_IXl = ReadMemory(m_PC++);
+	return 11;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSRAr(void)
+uint32 CZ80::ImplementLDIXlr(void)
 {
 	//
-	// Operation:	r 7->0 -> C
-	//							++
-	// Op Code:		SRA
-	// Operands:	r
+	// Operation:	IXl <- r
+	// Op Code:		LD
+	// Operands:	IXl, r
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|r|r|r|
+	//						|0|1|1|0|1|s|s|s|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where ddd and sss are any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								IXh					100
+	//								IXl					101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00	
+	//								1						8	(4,4)						2.00
 	//
+	uint8 opcode = ReadMemory(++m_PC);
+	uint8* pReg = &REGISTER_8BIT(opcode);
+	if (pReg == &m_H) pReg = &m_IXh;
+	if (pReg == &m_L) pReg = &m_IXl;
+	m_IXl = *pReg;
 	++m_PC;
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	uint8 sign = (reg & eF_S);
-	uint8 carry = (reg & eF_C);
-	reg = (reg >> 1) | sign;
-	HandleLogicalFlags(reg);
-	m_F |= carry;
 	return 8;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSRA_HL_(void)
+uint32 CZ80::ImplementLDIYhn(void)
 {
 	//
-	// Operation:	(HL) 7->0 -> C
-	//								 ++
-	// Op Code:		SRA
-	// Operands:	(HL)
+	// Operation:	IYh <- n
+	// Op Code:		LD
+	// Operands:	IYh, n
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|1|0| 2E
+	//						|0|0|1|0|0|1|1|0| 26
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75	
+	//								2						11 (4,4,3)				2.75
 	//
 	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 sign = (byte & eF_S);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | sign;
-	WriteMemory(m_HL, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	return 15;
+	m_IYh = ReadMemory(m_PC++);
+	return 11;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSRA_IXd_(void)
+uint32 CZ80::ImplementLDIYhr(void)
 {
 	//
-	// Operation:	(IX+d) 7->0 -> C
-	//									 ++
-	// Op Code:		SRA
-	// Operands:	(IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	IYh <- r
+	// Op Code:		LD
+	// Operands:	IYh, r
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|1|1|0| 2E
+	//						|0|1|1|0|0|s|s|s|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where ddd and sss are any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								IYh					100
+	//								IYl					101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								1						8	(4,4)						2.00
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 sign = (byte & eF_S);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | sign;
-	WriteMemory(m_IX + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	uint8 opcode = ReadMemory(++m_PC);
+	uint8* pReg = &REGISTER_8BIT(opcode);
+	if (pReg == &m_H) pReg = &m_IYh;
+	if (pReg == &m_L) pReg = &m_IYl;
+	m_IYh = *pReg;
+	++m_PC;
+	return 8;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSRA_IYd_(void)
+uint32 CZ80::ImplementLDIYln(void)
 {
 	//
-	// Operation:	(IY+d) 7->0 -> C
-	//									 ++
-	// Op Code:		SRA
-	// Operands:	(IY+d)
+	// Operation:	IYl <- n
+	// Op Code:		LD
+	// Operands:	IYl, n
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
-	//						+-+-+-+-+-+-+-+-+
 	//						|0|0|1|0|1|1|1|0| 2E
 	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								2						11 (4,4,3)				2.75
 	//
 	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 sign = (byte & eF_S);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1) | sign;
-	WriteMemory(m_IY + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	m_IYl = ReadMemory(m_PC++);
+	return 11;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSLLr(void)
+uint32 CZ80::ImplementLDIYlr(void)
 {
 	//
-	// Operation:	C <- 7<-0 r
-	// Op Code:		SLL
-	// Operands:	r
+	// Operation:	IYl <- r
+	// Op Code:		LD
+	// Operands:	IYl, r
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|r|r|r|
+	//						|0|1|1|0|1|s|s|s|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where ddd and sss are any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								IYh					100
+	//								IYl					101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00	
+	//								1						8	(4,4)						2.00
 	//
+	uint8 opcode = ReadMemory(++m_PC);
+	uint8* pReg = &REGISTER_8BIT(opcode);
+	if (pReg == &m_H) pReg = &m_IYh;
+	if (pReg == &m_L) pReg = &m_IYl;
+	m_IYl = *pReg;
 	++m_PC;
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	uint8 carry = (reg & eF_S) >> 7;
-	reg = (reg << 1) | 0x01;
-	HandleLogicalFlags(reg);
-	m_F |= carry;
 	return 8;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSLL_HL_(void)
+uint32 CZ80::ImplementLDr_HL_(void)
 {
 	//
-	// Operation:	C <- 7<-0 (HL)
-	// Op Code:		SLL
-	// Operands:	(HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	r <- (HL)
+	// Op Code:		LD
+	// Operands:	r, (HL) 
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|1|0| 36
+	//						|0|1|r|r|r|1|1|0|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75	
+	//								2						7 (4,3)						1.75
 	//
-	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | 0x01;
-	WriteMemory(m_HL, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	return 15;
+	uint8 opcode = ReadMemory(m_PC++);
+	REGISTER_8BIT(opcode >> 3) = ReadMemory(m_HL);
+	return 7;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSLL_IXd_(void)
+uint32 CZ80::ImplementLDr_IXd_(void)
 {
 	//
-	// Operation:	C <- 7<-0 (IX+d)
-	// Op Code:		SLL
-	// Operands:	(IX+d)
+	// Operation:	r <- (IX+d)
+	// Op Code:		LD
+	// Operands:	r, (IX+d) 
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|0|1|r|r|r|1|1|0|
 	//						+-+-+-+-+-+-+-+-+
 	//						|d|d|d|d|d|d|d|d|
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|1|0| 36
-	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								5						19 (4,4,3,5,3)		4.75
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | 0x01;
-	WriteMemory(m_IX + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	uint8 opcode = ReadMemory(++m_PC);
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	m_MEMPTR = m_IX + displacement;
+	++m_PC;
+	REGISTER_8BIT(opcode >> 3) = ReadMemory(m_IX + displacement);
+	return 19;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSLL_IYd_(void)
+uint32 CZ80::ImplementLDr_IYd_(void)
 {
 	//
-	// Operation:	C <- 7<-0 (IY+d)
-	// Op Code:		SLL
-	// Operands:	(IY+d)
+	// Operation:	r <- (IY+d)
+	// Op Code:		LD
+	// Operands:	r, (IY+d) 
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|0|1|r|r|r|1|1|0|
 	//						+-+-+-+-+-+-+-+-+
 	//						|d|d|d|d|d|d|d|d|
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|1|1|0| 36
-	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								5						19 (4,4,3,5,3)		4.75
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 carry = (byte & eF_S) >> 7;
-	byte = (byte << 1) | 0x01;
-	WriteMemory(m_IY + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	uint8 opcode = ReadMemory(++m_PC);
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	m_MEMPTR = m_IY + displacement;
+	++m_PC;
+	REGISTER_8BIT(opcode >> 3) = ReadMemory(m_IY + displacement);
+	return 19;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSRLr(void)
+uint32 CZ80::ImplementLD_HL_r(void)
 {
 	//
-	// Operation:	0 -> r 7->0 -> C
-	// Op Code:		SRL
-	// Operands:	r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	(HL) <- r
+	// Op Code:		LD
+	// Operands:	(HL), r
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|1|r|r|r|
+	//						|0|1|1|1|0|r|r|r|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8	(4,4)						2.00	
+	//								2						7 (4,3)						1.75
 	//
-	++m_PC;
-	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
-	uint8 carry = (reg & eF_C);
-	reg = (reg >> 1);
-	HandleLogicalFlags(reg);
-	m_F |= carry;
-	return 8;
+	WriteMemory(m_HL, REGISTER_8BIT(ReadMemory(m_PC++)));
+	return 7;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSRL_HL_(void)
+uint32 CZ80::ImplementLD_IXd_r(void)
 {
 	//
-	// Operation:	0 -> (HL) 7->0 -> C
-	// Op Code:		SRL
-	// Operands:	(HL)
+	// Operation:	(IX+d) <- r
+	// Op Code:		LD
+	// Operands:	(IX+d), r
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|1|1|1|0| 3E
+	//						|0|1|1|1|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						15 (4,4,4,3)			3.75	
+	//								5						19 (4,4,3,5,3)		4.75
 	//
-	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1);
-	WriteMemory(m_HL, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	return 15;
+	uint8 opcode = ReadMemory(++m_PC);
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	m_MEMPTR = m_IX + displacement;
+	++m_PC;
+	WriteMemory(m_IX + displacement, REGISTER_8BIT(opcode));
+	return 19;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSRL_IXd_(void)
+uint32 CZ80::ImplementLD_IYd_r(void)
 {
 	//
-	// Operation:	0 -> (IX+d) 7->0 -> C
-	//									 ++
-	// Op Code:		SRL
-	// Operands:	(IX+d)
+	// Operation:	(IY+d) <- r
+	// Op Code:		LD
+	// Operands:	(IY+d), r
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|0|1|1|1|0|r|r|r|
 	//						+-+-+-+-+-+-+-+-+
 	//						|d|d|d|d|d|d|d|d|
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|1|1|1|0| 3E
-	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								5						19 (4,4,3,5,3)		4.75
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1);
-	WriteMemory(m_IX + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	uint8 opcode = ReadMemory(++m_PC);
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	m_MEMPTR = m_IY + displacement;
+	++m_PC;
+	WriteMemory(m_IY + displacement, REGISTER_8BIT(opcode));
+	return 19;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSRL_IYd_(void)
+uint32 CZ80::ImplementLD_HL_n(void)
 {
 	//
-	// Operation:	0 -> (IY+d) 7->0 -> C
-	// Op Code:		SRL
-	// Operands:	(IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	(HL) <- n
+	// Op Code:		LD
+	// Operands:	(HL), n
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|0|0|1|1|0|1|1|0| 36
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|1|1|1|0| 3E
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								6						23 (4,4,3,5,4,3)	5.75
+	//								3						10 (4,3,3)				2.50
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 carry = (byte & eF_C);
-	byte = (byte >> 1);
-	WriteMemory(m_IY + displacement, byte);
-	HandleLogicalFlags(byte);
-	m_F |= carry;
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 23;
+	++m_PC;
+	WriteMemory(m_HL, ReadMemory(m_PC++));
+	return 10;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRLD(void)
+uint32 CZ80::ImplementLD_IXd_n(void)
 {
 	//
-	//										+----->-----+
-	// Operation:	A 7-4 3-0 (HL) 7-4 3-0
-	//										+---<--+ +<-+
-	// Op Code:		RLD
-	// Operands:	A, (HL)
+	// Operation:	(IX+d) <- n
+	// Op Code:		LD
+	// Operands:	(IX+d), n
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|1|1|1|1| 6F
+	//						|0|0|1|1|0|1|1|0| 36
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						18 (4,4,3,4,3)		3.75
+	//								5						19 (4,4,3,5,3)		4.75
 	//
 	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 origA = m_A;
-	m_A = (m_A & 0xF0) | ((byte & 0xF0) >> 4);
-	byte = (byte << 4) | (origA & 0x0F);
-	WriteMemory(m_HL, byte);
-	uint8 origF = m_F;
-	HandleLogicalFlags(m_A);
-	m_F |= (origF & eF_C);
-	return 18;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	WriteMemory(m_IX + displacement, ReadMemory(m_PC++));
+	return 19;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRRD(void)
+uint32 CZ80::ImplementLD_IYd_n(void)
 {
 	//
-	//										+--->--+ +->+
-	// Operation:	A 7-4 3-0 (HL) 7-4 3-0
-	//										+-----<-----+
-	// Op Code:		RRD
-	// Operands:	A, (HL)
+	// Operation:	(IY+d) <- n
+	// Op Code:		LD
+	// Operands:	(IY+d), n
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|1|0|0|1|1|1| 67
+	//						|0|0|1|1|0|1|1|0| 36
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						18 (4,4,3,4,3)		3.75
+	//								5						19 (4,4,3,5,3)		4.75
 	//
 	++++m_PC;
-	uint8 byte = ReadMemory(m_HL);
-	uint8 origA = m_A;
-	m_A = (m_A & 0xF0) | (byte & 0x0F);
-	byte = ((origA & 0x0F) << 4) | (byte >> 4);
-	WriteMemory(m_HL, byte);
-	uint8 origF = m_F;
-	HandleLogicalFlags(m_A);
-	m_F |= (origF & eF_C);
-	return 18;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	WriteMemory(m_IY + displacement, ReadMemory(m_PC++));
+	return 19;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	Bit Set, Reset and Test Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementBITbr(void)
+uint32 CZ80::ImplementLDA_BC_(void)
 {
 	//
-	// Operation:	Z <- rb
-	// Op Code:		BIT
-	// Operands:	b, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	A <- (BC)
+	// Op Code:		LD
+	// Operands:	A, (BC) 
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|b|b|b|r|r|r|
+	//						|0|0|0|0|1|0|1|0| 0A
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8 (4,4)						2.00
+	//								2						7 (4,3)						1.75
 	//
-	uint8 opcode = ReadMemory(++m_PC);
 	++m_PC;
-	uint8 mask = 1 << ((opcode & 0x38) >> 3);
-	uint8 origF = m_F;
-	HandleLogicalFlags(REGISTER_8BIT(opcode) & mask);
-	m_F |= (eF_H | (origF & eF_C));
-	return 8;
+	m_A = ReadMemory(m_BC);
+	m_MEMPTR = m_BC + 1;
+	return 7;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementBITb_HL_(void)
+uint32 CZ80::ImplementLDA_DE_(void)
 {
 	//
-	// Operation:	Z <- (HL)b
-	// Op Code:		BIT
-	// Operands:	b, (HL)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	A <- (DE)
+	// Op Code:		LD
+	// Operands:	A, (DE) 
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|b|b|b|1|1|0|
+	//						|0|0|0|1|1|0|1|0| 1A
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						12 (4,4,4)				3.00
+	//								2						7 (4,3)						1.75
 	//
 	++m_PC;
-	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_HL);
-	uint8 origF = m_F;
-	HandleLogicalFlags(byte & mask);
-	m_F |= (eF_H | (origF & eF_C));
-	return 12;
+	m_A = ReadMemory(m_DE);
+	m_MEMPTR = m_DE + 1;
+	return 7;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementBITb_IXd_(void)
+uint32 CZ80::ImplementLDA_nn_(void)
 {
 	//
-	// Operation:	Z <- (IX+d)b
-	// Op Code:		BIT
-	// Operands:	b, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
+	// Operation:	A <- (nn)
+	// Op Code:		LD
+	// Operands:	A, (nn) 
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|0|0|1|1|1|0|1|0| 3A
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|b|b|b|1|1|0|
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						20 (4,4,3,5,4)		5.00
+	//								4						13 (4,3,3,3)			3.25
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	uint8 origF = m_F;
-	HandleLogicalFlags(byte & mask);
-	m_F |= (eF_H | (origF & eF_C));
-	// From The Undocumented Z80:
-	uint8 temp = (m_IX + displacement) >> 8;
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= (temp & (eF_Y | eF_X));
-	return 20;
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = ReadMemory(++m_PC);
+	++m_PC;
+	m_A = ReadMemory(m_address);
+	m_MEMPTR = m_address + 1;
+	return 13;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementBITb_IYd_(void)
+uint32 CZ80::ImplementLD_BC_A(void)
 {
-	//
-	// Operation:	Z <- (IX+d)b
-	// Op Code:		BIT
-	// Operands:	b, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
-	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//
+	// Operation:	(BC) <- A
+	// Op Code:		LD
+	// Operands:	(BC), A
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|b|b|b|1|1|0|
+	//						|0|0|0|0|0|0|1|0| 02
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						20 (4,4,3,5,4)		5.00
+	//								2						7 (4,3)						1.75
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	uint8 origF = m_F;
-	HandleLogicalFlags(byte & mask);
-	m_F |= (eF_H | (origF & eF_C));
-	// From The Undocumented Z80:
-	uint8 temp = (m_IY + displacement) >> 8;
-	m_F &= ~(eF_Y | eF_X);
-	m_F |= (temp & (eF_Y | eF_X));
-	return 20;
+	WriteMemory(m_BC, m_A);
+	m_MEMPTR = (m_A << 8) | ((m_BC + 1) & 0xFF);
+	++m_PC; 
+	return 7;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSETbr(void)
+uint32 CZ80::ImplementLD_DE_A(void)
 {
 	//
-	// Operation:	rb <- 1
-	// Op Code:		SET
-	// Operands:	b, r
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	(DE) <- A
+	// Op Code:		LD
+	// Operands:	(DE), A
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|b|b|b|r|r|r|
+	//						|0|0|0|1|0|0|1|0| 12
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8 (4,4)						2.00
+	//								2						7 (4,3)						1.75
 	//
-	uint8 opcode = ReadMemory(++m_PC);
-	++m_PC;
-	uint8 mask = 1 << ((opcode & 0x38) >> 3);
-	uint8& reg = REGISTER_8BIT(opcode);
-	reg |= mask;
-	return 8;
+	WriteMemory(m_DE, m_A);
+	m_MEMPTR = (m_A << 8) | ((m_DE + 1) & 0xFF);
+	++m_PC; 
+	return 7;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSETb_HL_(void)
+uint32 CZ80::ImplementLD_nn_A(void)
 {
 	//
-	// Operation:	(HL) <- 1
-	// Op Code:		SET
-	// Operands:	b, (HL)
+	// Operation:	(nn) <- A
+	// Op Code:		LD
+	// Operands:	(nn), A
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|0|0|0|1|0|0|1|0| 12
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|b|b|b|1|1|0|
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						12 (4,4,4)				3.00
+	//								4						13 (4,3,3,3)			3.25
 	//
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = ReadMemory(++m_PC);
 	++m_PC;
-	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_HL);
-	byte |= mask;
-	WriteMemory(m_HL, byte);
-	return 12;
+	WriteMemory(m_address, m_A);
+	m_MEMPTR = (m_A << 8) | ((m_address + 1) & 0xFF);
+	return 13;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSETb_IXd_(void)
+uint32 CZ80::ImplementLDAI(void)
 {
 	//
-	// Operation:	(IX+d)b <- 1
-	// Op Code:		SET
-	// Operands:	b, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	A <- I
+	// Op Code:		LD
+	// Operands:	A, I 
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|b|b|b|1|1|0|
+	//						|0|1|0|1|0|1|1|1| 57
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						20 (4,4,3,5,4)		5.00
+	//								2						9 (4,5)						2.25
 	//
+	m_A = m_I;
+	m_F &= eF_C;
+	m_F |= (m_A & (eF_S | eF_Y | eF_X)) | ((m_A == 0) ? eF_Z : 0) | ((m_State.m_IFF2) ? eF_PV : 0);
 	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 mask = 1 << ((opcode & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	byte |= mask;
-	WriteMemory(m_IX + displacement, byte);
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 20;
+	return 9;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementSETb_IYd_(void)
+uint32 CZ80::ImplementLDAR(void)
 {
 	//
-	// Operation:	(IY+d)b <- 1
-	// Op Code:		SET
-	// Operands:	b, (IY+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	// Operation:	A <- R
+	// Op Code:		LD
+	// Operands:	A, R 
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|b|b|b|1|1|0|
+	//						|0|1|0|1|1|1|1|1| 5F
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						20 (4,4,3,5,4)		5.00
+	//								2						9 (4,5)						2.25
 	//
+	m_A = m_R;
+	m_F &= eF_C;
+	m_F |= (m_A & (eF_S | eF_Y | eF_X)) | ((m_A == 0) ? eF_Z : 0) | ((m_State.m_IFF2) ? eF_PV : 0);
 	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 mask = 1 << ((opcode & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	byte |= mask;
-	WriteMemory(m_IY + displacement, byte);
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 20;
+	return 9;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRESbr(void)
+uint32 CZ80::ImplementLDIA(void)
 {
 	//
-	// Operation:	rb <- 1
-	// Op Code:		RES
-	// Operands:	b, r
+	// Operation:	I <- A
+	// Op Code:		LD
+	// Operands:	I, A 
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|b|b|b|r|r|r|
+	//						|0|1|0|0|0|1|1|1| 47
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//								A						111
-	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8 (4,4)						2.00
+	//								2						9 (4,5)						2.25
 	//
-	uint8 opcode = ReadMemory(++m_PC);
-	++m_PC;
-	uint8 mask = 1 << ((opcode & 0x38) >> 3);
-	uint8& reg = REGISTER_8BIT(opcode);
-	reg &= ~mask;
-	return 8;
+	m_I = m_A;
+	++++m_PC;
+	return 9;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRESb_HL_(void)
+uint32 CZ80::ImplementLDRA(void)
 {
 	//
-	// Operation:	(HL) <- 1
-	// Op Code:		RES
-	// Operands:	b, (HL)
+	// Operation:	R <- A
+	// Op Code:		LD
+	// Operands:	R, A 
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|b|b|b|1|1|0|
+	//						|0|1|0|0|1|1|1|1| 4F
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						12 (4,4,4)				3.00
+	//								2						9 (4,5)						2.25
 	//
-	++m_PC;
-	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_HL);
-	byte &= ~mask;
-	WriteMemory(m_HL, byte);
-	return 12;
+	m_R = m_A;
+	++++m_PC;
+	return 9;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRESb_IXd_(void)
+//-----------------------------------------------------------------------------
+//	16-Bit Load Group
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+
+uint32 CZ80::ImplementLDddnn(void)
 {
 	//
-	// Operation:	(IX+d)b <- 1
-	// Op Code:		RES
-	// Operands:	b, (IX+d)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
+	// Operation:	dd <- nn
+	// Op Code:		LD
+	// Operands:	dd, nn
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|0|0|d|d|0|0|0|1|
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|b|b|b|1|1|0|
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								SP					11
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						20 (4,4,3,5,4)		5.00
+	//								3						10 (4,3,3)				2.50
 	//
-	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
 	uint8 opcode = ReadMemory(m_PC++);
-	uint8 mask = 1 << ((opcode & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_IX + displacement);
-	byte &= ~mask;
-	WriteMemory(m_IX + displacement, byte);
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 20;
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	REGISTER_16BIT(opcode >> 4) = m_address;
+	return 10;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRESb_IYd_(void)
+uint32 CZ80::ImplementLDIXnn(void)
 {
 	//
-	// Operation:	(IY+d)b <- 1
-	// Op Code:		RES
-	// Operands:	b, (IY+d)
+	// Operation:	IX <- nn
+	// Op Code:		LD
+	// Operands:	IX, nn
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|1|1| CB
+	//						|0|0|1|0|0|0|0|1| 21
 	//						+-+-+-+-+-+-+-+-+
-	//						|d|d|d|d|d|d|d|d|
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|b|b|b|1|1|0|
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						20 (4,4,3,5,4)		5.00
+	//								4						14 (4,4,3,3)			3.50
 	//
 	++++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	uint8 opcode = ReadMemory(m_PC++);
-	uint8 mask = 1 << ((opcode & 0x38) >> 3);
-	uint8 byte = ReadMemory(m_IY + displacement);
-	byte &= ~mask;
-	WriteMemory(m_IY + displacement, byte);
-	// From The Undocumented Z80:
-	if ((opcode & 0x07) != 0x06)
-	{
-		REGISTER_8BIT(opcode) = byte;	
-	}
-	return 20;
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	m_IX = m_address;
+	return 14;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	Jump Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementJPnn(void)
+uint32 CZ80::ImplementLDIYnn(void)
 {
 	//
-	// Operation:	PC <- nn
-	// Op Code:		JP
-	// Operands:	nn
+	// Operation:	IY <- nn
+	// Op Code:		LD
+	// Operands:	IY, nn
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|0|0|1|1| C3
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|0|0|1| 21
 	//						+-+-+-+-+-+-+-+-+
 	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
@@ -11511,2543 +2400,5653 @@ uint32 CZ80::ImplementJPnn(void)
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						10 (4,3,3)				2.50
+	//								4						14 (4,4,3,3)			3.50
 	//
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = ReadMemory(++m_PC);
-	m_PC = m_address;
-	return 10;
+	++++m_PC;
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	m_IY = m_address;
+	return 14;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJPccnn(void)
+uint32 CZ80::ImplementLDHL_nn_(void)
 {
-	//
-	// Operation:	If cc true, PC <- nn
-	// Op Code:		JP
-	// Operands:	cc, nn
+	// Operation:	H <- (nn+1), L <- (nn)
+	// Op Code:		LD
+	// Operands:	HL, (nn)
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|c|c|c|0|1|0|
+	//						|0|0|1|0|1|0|1|0| 2A
 	//						+-+-+-+-+-+-+-+-+
 	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//						where ccc is any of:
-	//								NZ					000
-	//								Z						001
-	//								NC					010
-	//								C						011
-	//								PO					100
-	//								PE					101
-	//								P						101
-	//								M						111
-	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						10 (4,3,3)				2.50
+	//								5						16 (4,3,3,3,3)		4.00
 	//
-	uint8 opcode = ReadMemory(m_PC++);
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	if (IsConditionTrue((opcode & 0x38) >> 3))
-	{
-		m_PC = m_address;
-	}
-	return 10;
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = ReadMemory(++m_PC);
+	++m_PC;
+	m_L = ReadMemory(m_address++);
+	m_H = ReadMemory(m_address);
+	m_MEMPTR = m_address;
+	return 16;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJRe(void)
+uint32 CZ80::ImplementLDdd_nn_(void)
 {
 	//
-	// Operation:	PC <- PC + e
-	// Op Code:		JR
-	// Operands:	e
+	// Operation:	ddh <- (nn+1), ddl <- (nn)
+	// Op Code:		LD
+	// Operands:	dd, (nn)
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|1|0|0|0| 18
+	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|e|e|e|e|e|e|e|e| e-2
+	//						|0|1|d|d|1|0|1|1|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								SP					11
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						12 (4,3,5)				3.00
+	//								6						20 (4,4,3,3,3,3)	5.00
 	//
+	uint8 opcode = ReadMemory(++m_PC);
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = ReadMemory(++m_PC);
 	++m_PC;
-	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
-	m_PC += displacement;
-	return 12;
+	REGISTER_16BIT_LO(opcode >> 4) = ReadMemory(m_address++);
+	REGISTER_16BIT_HI(opcode >> 4) = ReadMemory(m_address);
+	m_MEMPTR = m_address;
+	return 20;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJRCe(void)
+uint32 CZ80::ImplementLDIX_nn_(void)
 {
 	//
-	// Operation: if C == 0, continue
-	//						if C == 1, PC <- PC + e
-	// Op Code:		JR
-	// Operands:	C, e
+	// Operation:	IXh <- (nn+1), IXl <- (nn)
+	// Op Code:		LD
+	// Operands:	IX, (nn)
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|1|0|0|0| 38
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|e|e|e|e|e|e|e|e| e-2
+	//						|0|1|1|0|1|0|1|0| 2A
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75		C == 0
-	//								3						12 (4,3,5)				3.00		C == 1
+	//								6						20 (4,4,3,3,3,3)	5.00
 	//
-	uint32 tstates = 7;
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
-	++m_PC;
-	if (m_F & eF_C)
-	{
-		m_PC += displacement;
-		tstates += 5;
-	}
-	return tstates;
+	++++m_PC;
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	m_IXl = ReadMemory(m_address++);
+	m_IXh = ReadMemory(m_address);
+	m_MEMPTR = m_address;
+	return 20;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJRNCe(void)
+uint32 CZ80::ImplementLDIY_nn_(void)
 {
 	//
-	// Operation: if C == 1, continue
-	//						if C == 0, PC <- PC + e
-	// Op Code:		JR
-	// Operands:	C, e
+	// Operation:	IYh <- (nn+1), IYl <- (nn)
+	// Op Code:		LD
+	// Operands:	IY, (nn)
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|1|0|0|0|0| 30
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|e|e|e|e|e|e|e|e| e-2
+	//						|0|1|1|0|1|0|1|0| 2A
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75		C == 1
-	//								3						12 (4,3,5)				3.00		C == 0
+	//								6						20 (4,4,3,3,3,3)	5.00
 	//
-	uint32 tstates = 7;
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
-	++m_PC;
-	if (!(m_F & eF_C))
-	{
-		m_PC += displacement;
-		tstates += 5;
-	}
-	return tstates;
+	++++m_PC;
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	m_IYl = ReadMemory(m_address++);
+	m_IYh = ReadMemory(m_address);
+	m_MEMPTR = m_address;
+	return 20;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJRZe(void)
+uint32 CZ80::ImplementLD_nn_HL(void)
 {
-	//
-	// Operation: if Z == 0, continue
-	//						if Z == 1, PC <- PC + e
-	// Op Code:		JR
-	// Operands:	Z, e
+	// Operation:	(nn+1) <- H, (nn) <- L
+	// Op Code:		LD
+	// Operands:	(nn), HL
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|1|0|0|0| 28
+	//						|0|0|1|0|0|0|1|0| 22
 	//						+-+-+-+-+-+-+-+-+
-	//						|e|e|e|e|e|e|e|e| e-2
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75		Z == 0
-	//								3						12 (4,3,5)				3.00		Z == 1
+	//								5						16 (4,3,3,3,3)		4.00
 	//
-	uint32 tstates = 7;
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = ReadMemory(++m_PC);
 	++m_PC;
-	if (m_F & eF_Z)
-	{
-		m_PC += displacement;
-		tstates += 5;
-	}
-	return tstates;
+	WriteMemory(m_address++, m_L);
+	WriteMemory(m_address, m_H);
+	m_MEMPTR = m_address;
+	return 16;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJRNZe(void)
+uint32 CZ80::ImplementLD_nn_dd(void)
 {
 	//
-	// Operation: if Z == 1, continue
-	//						if Z == 0, PC <- PC + e
-	// Op Code:		JR
-	// Operands:	Z, e
+	// Operation:	(nn+1) <- ddh, (nn) <- ddl
+	// Op Code:		LD
+	// Operands:	(nn), dd
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|1|0|0|0|0|0| 20
+	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|e|e|e|e|e|e|e|e| e-2
+	//						|0|0|d|d|0|0|1|1|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								SP					11
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						7 (4,3)						1.75		Z == 1
-	//								3						12 (4,3,5)				3.00		Z == 0
+	//								6						20 (4,4,3,3,3,3)	5.00
 	//
-	uint32 tstates = 7;
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	uint8 opcode = ReadMemory(++m_PC);
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = ReadMemory(++m_PC);
 	++m_PC;
-	if (!(m_F & eF_Z))
-	{
-		m_PC += displacement;
-		tstates += 5;
-	}
-	return tstates;
+	WriteMemory(m_address++, REGISTER_16BIT_LO(opcode >> 4));
+	WriteMemory(m_address, REGISTER_16BIT_HI(opcode >> 4));
+	m_MEMPTR = m_address;
+	return 20;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJP_HL_(void)
+uint32 CZ80::ImplementLD_nn_IX(void)
 {
 	//
-	// Operation: PC <- HL
-	// Op Code:		JP
-	// Operands:	(HL)
+	// Operation:	(nn+1) <- IXh, (nn) <- IXl
+	// Op Code:		LD
+	// Operands:	(nn), IX
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|0|0|1| E9
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|1|0|0|0|1|0| 22
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								1						4									1.00
+	//								6						20 (4,4,3,3,3,3)	5.00
 	//
-	m_PC = m_HL;
-	return 4;
+	++++m_PC;
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	WriteMemory(m_address++, m_IXl);
+	WriteMemory(m_address, m_IXh);
+	m_MEMPTR = m_address;
+	return 20;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJP_IX_(void)
+uint32 CZ80::ImplementLD_nn_IY(void)
 {
-	// Operation: PC <- IX
-	// Op Code:		JP
-	// Operands:	(IX)
+	//
+	// Operation:	(nn+1) <- IYh, (nn) <- IYl
+	// Op Code:		LD
+	// Operands:	(nn), IY
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|1|0|1| DD
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|0|0|1| E9
+	//						|0|1|1|0|0|0|1|0| 22
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8 (4,4)						1.00
+	//								6						20 (4,4,3,3,3,3)	5.00
 	//
-	m_PC = m_IX;
-	return 8;
+	++++m_PC;
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	WriteMemory(m_address++, m_IYl);
+	WriteMemory(m_address, m_IYh);
+	m_MEMPTR = m_address;
+	return 20;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementJP_IY_(void)
+uint32 CZ80::ImplementLDSPHL(void)
 {
-	// Operation: PC <- IY
-	// Op Code:		JP
-	// Operands:	(IY)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|1|1|1|0|1| FD
+	//
+	// Operation:	SP <- HL
+	// Op Code:		LD
+	// Operands:	SP, HL
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|0|0|1| E9
+	//						|1|1|1|1|1|0|0|1| F9
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8 (4,4)						1.00
+	//								1						6									1.50
 	//
-	m_PC = m_IY;
-	return 8;
+	m_SP = m_HL;
+	++m_PC;
+	return 6;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementDJNZe(void)
+uint32 CZ80::ImplementLDSPIX(void)
 {
 	//
-	// Operation: if (B - 1) == 0, continue
-	//						if (B - 1) != 0, PC <- PC + e
-	// Op Code:		DJNZ
-	// Operands:	B, e
+	// Operation:	SP <- IX
+	// Op Code:		LD
+	// Operands:	SP, IX
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|0|0|1|0|0|0|0| 20
+	//						|1|0|1|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|e|e|e|e|e|e|e|e| e-2
+	//						|1|1|1|1|1|0|0|1| F9
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								2						8 (5,3)						2.00		B != 0
-	//								3						13 (5,3,5)				3.25		B == 0
+	//								2						10 (4,6)					2.50
 	//
-	uint32 tstates = 8;
-	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
-	++m_PC;
-	if (--m_B != 0)
-	{
-		m_PC += displacement;
-		tstates += 5;
-	}
-	return tstates;
+	m_SP = m_IX;
+	m_PC += 2;
+	return 10;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	Call and Return Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementCALLnn(void)
+uint32 CZ80::ImplementLDSPIY(void)
 {
 	//
-	// Operation: (SP - 1) <- PCH, (SP - 2) <- PCL, PC <- nn
-	// Op Code:		CALL
-	// Operands:	nn
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|1|0|1| CD
+	// Operation:	SP <- IY
+	// Op Code:		LD
+	// Operands:	SP, IY
 	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
+	//						|1|1|1|1|1|0|0|1| F9
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						17 (4,3,4,3,3)		4.25
+	//								2						10 (4,6)					2.50
 	//
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = ReadMemory(++m_PC);
-	++m_PC;
-	WriteMemory(--m_SP, m_PCh);
-	WriteMemory(--m_SP, m_PCl);
-	m_PC = m_address;
-	return 17;
+	m_SP = m_IY;
+	m_PC += 2;
+	return 10;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementCALLccnn(void)
+uint32 CZ80::ImplementPUSHqq(void)
 {
 	//
-	// Operation: If cc true, (SP - 1) <- PCH, (SP - 2) <- PCL, PC <- nn
-	// Op Code:		CALL
-	// Operands:	nn
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|c|c|c|1|0|0|
-	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
+	// Operation:	(SP-2) <- qql, (SP-1) <- qqh
+	// Op Code:		PUSH
+	// Operands:	qq
 	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
+	//						|1|1|d|d|0|1|0|1|
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//						where ccc is any of:
-	//								NZ					000
-	//								Z						001
-	//								NC					010
-	//								C						011
-	//								PO					100
-	//								PE					101
-	//								P						101
-	//								M						111
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								AF					11 (see below)
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						17 (4,3,4,3,3)		4.25	cc is true
-	//								3						10 (4,3,3)				2.50	cc is false
+	//								3						11 (5,3,3)				2.75
 	//
 	uint8 opcode = ReadMemory(m_PC++);
-	m_addresslo = ReadMemory(m_PC++);
-	m_addresshi = ReadMemory(m_PC++);
-	uint32 tstates = 10;
-	if (IsConditionTrue((opcode & 0x38) >> 3))
-	{
-		WriteMemory(--m_SP, m_PCh);
-		WriteMemory(--m_SP, m_PCl);
-		m_PC = m_address;
-		tstates += 7;
-	}
-	return tstates;
+	WriteMemory(--m_SP, REGISTER_16BIT_HI(opcode >> 4));
+	WriteMemory(--m_SP, REGISTER_16BIT_LO(opcode >> 4));
+	return 11;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRET(void)
+uint32 CZ80::ImplementPUSHAF(void)
 {
 	//
-	// Operation: PCl <- (SP), PCh <- (SP + 1)
-	// Op Code:		RET
-	// Operands:	--
+	// Operation:	(SP-2) <- F, (SP-1) <- A
+	// Op Code:		PUSH
+	// Operands:	qq
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|0|1|0|0|1| C9
+	//						|1|1|1|1|0|1|0|1| F5
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						SP is mapped to 11
+	//						in all other opcodes
+	//						so special case for
+	//						AF is needed here.
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						10 (4,3,3)				2.50
+	//								3						11 (5,3,3)				2.75
 	//
-	m_PCl = ReadMemory(m_SP++);
-	m_PCh = ReadMemory(m_SP++);
-	return 10;
+	++m_PC;
+	WriteMemory(--m_SP, m_A);
+	WriteMemory(--m_SP, m_F);
+	return 11;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRETcc(void)
+uint32 CZ80::ImplementPUSHIX(void)
 {
 	//
-	// Operation: If cc true, PCl <- (SP), PCh <- (SP + 1)
-	// Op Code:		RET
-	// Operands:	cc
+	// Operation:	(SP-2) <- IXl, (SP-1) <- IXh
+	// Op Code:		PUSH
+	// Operands:	IX
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|c|c|c|0|0|0|
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|0|1|0|1| E5
 	//						+-+-+-+-+-+-+-+-+
-	//
-	//						where ccc is any of:
-	//								NZ					000
-	//								Z						001
-	//								NC					010
-	//								C						011
-	//								PO					100
-	//								PE					101
-	//								P						101
-	//								M						111
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						11 (5,3,3)				2.75	cc is true
-	//								1						5									1.25	cc is false
+	//								4						15 (4,5,3,3)			3.75
 	//
-	uint32 tstates = 5;
-	if (IsConditionTrue((ReadMemory(m_PC++) & 0x38) >> 3))
-	{
-		m_PCl = ReadMemory(m_SP++);
-		m_PCh = ReadMemory(m_SP++);
-		tstates += 6;
-	}
-	return tstates;
+	++++m_PC;
+	WriteMemory(--m_SP, m_IXh);
+	WriteMemory(--m_SP, m_IXl);
+	return 15;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRETI(void)
-{
-	//
-	// Operation:	Return from interrupt
-	// Op Code:		RETI
-	// Operands:	--
+uint32 CZ80::ImplementPUSHIY(void)
+{
+	//
+	// Operation:	(SP-2) <- IYl, (SP-1) <- IYh
+	// Op Code:		PUSH
+	// Operands:	IY
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|0|1|1|0|1| 4D
+	//						|1|1|1|0|0|1|0|1| E5
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						14 (4,4,3,3)			3.50
+	//								4						15 (4,5,3,3)			3.75
 	//
-	m_PCl = ReadMemory(m_SP++);
-	m_PCh = ReadMemory(m_SP++);
-	// From The Undocumented Z80:
-	m_State.m_IFF1 = m_State.m_IFF2;
-	return 14;
+	++++m_PC;
+	WriteMemory(--m_SP, m_IYh);
+	WriteMemory(--m_SP, m_IYl);
+	return 15;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRETN(void)
+uint32 CZ80::ImplementPOPqq(void)
 {
 	//
-	// Operation:	Return from non-maskable interrupt
-	// Op Code:		RETN
-	// Operands:	--
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	// Operation:	qqh <- (SP+1), qql <- (SP)
+	// Op Code:		POP
+	// Operands:	qq
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|0|0|0|1|0|1| 45
+	//						|1|1|d|d|0|0|0|1|
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								AF					11
+	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						14 (4,4,3,3)			3.50
+	//								3						10 (4,3,3)				2.75
 	//
-	m_PCl = ReadMemory(m_SP++);
-	m_PCh = ReadMemory(m_SP++);
-	m_State.m_IFF1 = m_State.m_IFF2;
-	return 14;
+	uint8 opcode = ReadMemory(m_PC++);
+	REGISTER_16BIT_LO(opcode >> 4) = ReadMemory(m_SP++);
+	REGISTER_16BIT_HI(opcode >> 4) = ReadMemory(m_SP++);
+	return 10;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementRSTp(void)
+uint32 CZ80::ImplementPOPAF(void)
 {
 	//
-	// Operation:	(SP - 1) <- PCH, (SP - 2) <- PCL, PCH <- 0, PCL <- p
-	// Op Code:		RST
-	// Operands:	p
+	// Operation:	A <- (SP+1), F <- (SP)
+	// Op Code:		POP
+	// Operands:	qq
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|t|t|t|1|1|1|
+	//						|1|1|1|1|0|0|0|1| F1
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//								p						 t
-	//							 00H					000
-	//							 08H					001
-	//							 10H					010
-	//							 18H					011
-	//							 20H					100
-	//							 28H					101
-	//							 30H					110
-	//							 38H					111
+	//						SP is mapped to 11
+	//						in all other opcodes
+	//						so special case for
+	//						AF is needed here.
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						11 (5,3,3)				2.75
+	//								3						10 (4,3,3)				2.75
 	//
-	uint8 opcode = ReadMemory(m_PC++);
-	WriteMemory(--m_SP, m_PCh);
-	WriteMemory(--m_SP, m_PCl);
-	m_PCh = 0;
-	m_PCl = 8 * ((opcode & 0x38) >> 3);
-	return 11;
+	++m_PC;
+	m_F = ReadMemory(m_SP++);
+	m_A = ReadMemory(m_SP++);
+	return 10;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	Input and Output Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-uint32 CZ80::ImplementINA_n_(void)
+uint32 CZ80::ImplementPOPIX(void)
 {
 	//
-	// Operation:	A <- (n)
-	// Op Code:		IN
-	// Operands:	A, (n)
+	// Operation:	IXh <- (SP+1), IXl <- (SP)
+	// Op Code:		POP
+	// Operands:	IX
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|1|0|1|1| DB
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
+	//						|1|1|1|0|0|0|0|1| E1
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						11 (4,3,4)				2.75
+	//								4						14 (4,4,3,3)			3.50
 	//
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = m_A;
-	++m_PC;
-	m_A = ReadPort(m_address);
-	return 11;
+	++++m_PC;
+	m_IXl = ReadMemory(m_SP++);
+	m_IXh = ReadMemory(m_SP++);
+	return 14;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementINr_C_(void)
+uint32 CZ80::ImplementPOPIY(void)
 {
 	//
-	// Operation:	r <- (C)
-	// Op Code:		IN
-	// Operands:	r, (C)
+	// Operation:	IYh <- (SP+1), IYh <- (SP)
+	// Op Code:		POP
+	// Operands:	IY
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|0|1|1| EB
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|r|r|r|0|0|0|
+	//						|1|1|1|0|0|0|0|1| E1
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//						Undefined				110
-	//								A						111
-	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						12 (4,4,4)				3.00
+	//								4						14 (4,4,3,3)			3.50
 	//
-	++m_PC;
-	m_addresslo = m_C;
-	m_addresshi = m_B;
-	REGISTER_8BIT(ReadMemory(m_PC++) >> 3) = ReadPort(m_address);
-	return 12;
+	++++m_PC;
+	m_IYl = ReadMemory(m_SP++);
+	m_IYh = ReadMemory(m_SP++);
+	return 14;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementINI(void)
+//-----------------------------------------------------------------------------
+//	Exchange, Block Transfer and Search Group
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+
+uint32 CZ80::ImplementEXDEHL(void)
 {
 	//
-	// Operation:	(HL) <- (C), B <- B - 1, HL <- HL + 1
-	// Op Code:		INI
-	// Operands:	--
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	// Operation:	DE <-> HL
+	// Op Code:		EX
+	// Operands:	DE, HL
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|0|1|0| A2
+	//						|1|1|1|0|1|0|1|1| EB
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,5,3,4)			4.00
+	//								1						4									1.00
 	//
-	++++m_PC;
-	m_addresslo = m_C;
-	m_addresshi = m_B;
-	uint8 byte = ReadPort(m_address);
-	WriteMemory(m_HL++, byte);
-	m_B = HandleArithmeticSubtractFlags(m_B, 1, false);
-	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
-	m_F |= ((byte >> 6) & eF_N);
-	uint16 k = byte + ((m_C + 0x01) & 0xFF);
-	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
-	k &= 0x07;
-	k ^= m_B;
-	uint8 parity = k;
-	parity ^= parity >> 4;
-	parity &= 0xF;
-	parity = ((0x6996 >> parity) << 2);
-	m_F |= (~parity & eF_PV);
-	return 16;
+	++m_PC;
+	m_DE ^= m_HL;
+	m_HL ^= m_DE;
+	m_DE ^= m_HL;
+	return 4;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementINIR(void)
+uint32 CZ80::ImplementEXAFAF(void)
 {
 	//
-	// Operation:	(HL) <- (C), B <- B - 1, HL <- HL + 1
-	// Op Code:		INI
-	// Operands:	--
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	// Operation:	AF <-> AF'
+	// Op Code:		EX
+	// Operands:	AF, AF'
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|0|1|0| A2
+	//						|0|0|0|0|1|0|0|0| 08
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						21 (4,5,3,4,5)		5.25		B != 0
-	//								4						16 (4,5,3,4)			4.00		B == 0
+	//								1						4									1.00
 	//
-	uint32 tstates = ImplementINI();
-	if (m_B != 0)
-	{
-		tstates += 5;
-		----m_PC;
-	}
-	return tstates;
+	++m_PC;
+	m_AF ^= m_AFalt;
+	m_AFalt ^= m_AF;
+	m_AF ^= m_AFalt;
+	return 4;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementIND(void)
+uint32 CZ80::ImplementEXX(void)
 {
 	//
-	// Operation:	(HL) <- (C), B <- B - 1, HL <- HL - 1
-	// Op Code:		IND
-	// Operands:	A, (n)
-	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	// Operation:	BC <-> BC', DE <-> DE', HL <-> HL'
+	// Op Code:		EX
+	// Operands:	BC, BC', DE, DE', HL, HL'
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|0|1|0| AA
+	//						|1|1|0|1|1|0|0|1| D9
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,5,3,4)			4.00		B == 0
+	//								1						4									1.00
 	//
-	++++m_PC;
-	m_addresslo = m_C;
-	m_addresshi = m_B;
-	uint8 byte = ReadPort(m_address);
-	WriteMemory(m_HL--, byte);
-	m_B = HandleArithmeticSubtractFlags(m_B, 1, false);
-	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
-	m_F |= ((byte >> 6) & eF_N);
-	uint16 k = byte + ((m_C - 0x01) & 0xFF);
-	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
-	k &= 0x07;
-	k ^= m_B;
-	uint8 parity = k;
-	parity ^= parity >> 4;
-	parity &= 0xF;
-	parity = ((0x6996 >> parity) << 2);
-	m_F |= (~parity & eF_PV);
-	return 16;
+	++m_PC;
+	m_BC ^= m_BCalt;
+	m_BCalt ^= m_BC;
+	m_BC ^= m_BCalt;
+
+	m_DE ^= m_DEalt;
+	m_DEalt ^= m_DE;
+	m_DE ^= m_DEalt;
+
+	m_HL ^= m_HLalt;
+	m_HLalt ^= m_HL;
+	m_HL ^= m_HLalt;
+	return 4;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementINDR(void)
+uint32 CZ80::ImplementEX_SP_HL(void)
 {
 	//
-	// Operation:	(HL) <- (C), B <- B - 1, HL <- HL - 1
-	// Op Code:		INI
-	// Operands:	A, (n)
+	// Operation:	H <-> (SP+1), L <-> (SP)
+	// Op Code:		EX
+	// Operands:	(SP), HL
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	//						|1|1|1|0|0|0|1|1| E3
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|0|1|0| BA
-	//						+-+-+-+-+-+-+-+-+x
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								5						21 (4,5,3,4,5)		5.25		B != 0
-	//								4						16 (4,5,3,4)			4.00		B == 0
+	//								5						19 (4,3,4,3,5)		4.75
 	//
-	uint32 tstates = ImplementIND();
-	if (m_B != 0)
-	{
-		tstates += 5;
-		----m_PC;
-	}
-	return tstates;
+	++m_PC;
+	m_addresslo = ReadMemory(m_SP);
+	m_addresshi = ReadMemory(m_SP + 1);
+	WriteMemory(m_SP, m_L);
+	WriteMemory(m_SP + 1, m_H);
+	m_HL = m_address;
+	m_MEMPTR = m_address;
+	return 19;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementOUT_n_A(void)
+uint32 CZ80::ImplementEX_SP_IX(void)
 {
 	//
-	// Operation:	(n) <- A
-	// Op Code:		OUT
-	// Operands:	(n), A
+	// Operation:	IXh <-> (SP+1), IXl <-> (SP)
+	// Op Code:		EX
+	// Operands:	(SP), IX
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|0|1|0|0|1|1| D3
+	//						|1|1|0|1|1|1|0|1| DD
 	//						+-+-+-+-+-+-+-+-+
-	//						|n|n|n|n|n|n|n|n|
+	//						|1|1|1|0|0|0|1|1| E3
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						11 (4,3,4)				2.75
+	//								6						23 (4,4,3,4,3,5)	5.75
 	//
-	m_addresslo = ReadMemory(++m_PC);
-	m_addresshi = m_A;
-	++m_PC;
-	WritePort(m_address, m_A);
-	return 11;
+	++++m_PC;
+	m_addresslo = ReadMemory(m_SP);
+	m_addresshi = ReadMemory(m_SP + 1);
+	WriteMemory(m_SP, m_IXl);
+	WriteMemory(m_SP + 1, m_IXh);
+	m_IX = m_address;
+	m_MEMPTR = m_address;
+	return 23;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementOUT_C_r(void)
+uint32 CZ80::ImplementEX_SP_IY(void)
 {
 	//
-	// Operation:	(C) <- r
-	// Op Code:		OUT
-	// Operands:	(C), r
+	// Operation:	IYh <-> (SP+1), IYl <-> (SP)
+	// Op Code:		EX
+	// Operands:	(SP), IY
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|1|1|0|1|1|0|1| ED
+	//						|1|1|1|1|1|1|0|1| FD
 	//						+-+-+-+-+-+-+-+-+
-	//						|0|1|r|r|r|0|0|1|
+	//						|1|1|1|0|0|0|1|1| E3
 	//						+-+-+-+-+-+-+-+-+
 	//
-	//						where rrr is any of:
-	//								B						000
-	//								C						001
-	//								D						010
-	//								E						011
-	//								H						100
-	//								L						101
-	//						Undefined				110
-	//								A						111
-	//
 	//							M Cycles		T States					MHz E.T.
-	//								3						12 (4,4,4)				3.00
+	//								6						23 (4,4,3,4,3,5)	5.75
 	//
-	++m_PC;
-	m_addresslo = m_C;
-	m_addresshi = m_B;
-	WritePort(m_address, REGISTER_8BIT(ReadMemory(m_PC++) >> 3));
-	return 12;
+	++++m_PC;
+	m_addresslo = ReadMemory(m_SP);
+	m_addresshi = ReadMemory(m_SP + 1);
+	WriteMemory(m_SP, m_IYl);
+	WriteMemory(m_SP + 1, m_IYh);
+	m_IY = m_address;
+	m_MEMPTR = m_address;
+	return 23;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementOUTI(void)
+uint32 CZ80::ImplementLDI(void)
 {
 	//
-	// Operation:	(C) <- (HL), B <- B - 1, HL <- HL + 1
-	// Op Code:		OUTI
-	// Operands:	--
+	// Operation:	(DE) <- (HL), DE <- DE+1, HL <- HL+1, BC <- BC-1
+	// Op Code:		LDI
+	// Operands:	(DE), DE, (HL), HL, BC
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|0|0|1|1| A3
+	//						|1|0|1|0|0|0|0|0| A0
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,5,3,4)			4.00
+	//								4						16 (4,4,3,5)			4.00
 	//
 	++++m_PC;
-	m_addresslo = m_C;
-	m_addresshi = m_B;
 	uint8 byte = ReadMemory(m_HL++);
-	WritePort(m_address, byte);
-	m_B = HandleArithmeticSubtractFlags(m_B, 1, false);
-	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
-	m_F |= ((byte >> 6) & eF_N);
-	uint16 k = byte + m_L;
-	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
-	k &= 0x07;
-	k ^= m_B;
-	uint8 parity = k;
-	parity ^= parity >> 4;
-	parity &= 0xF;
-	parity = ((0x6996 >> parity) << 2);
-	m_F |= (~parity & eF_PV);
+	WriteMemory(m_DE++, byte);
+	--m_BC;
+	// From The Undocumented Z80:
+	byte += m_A;
+	m_F &= (eF_S | eF_Z | eF_C);
+	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y);
+	m_F |= (m_BC != 0) ? eF_PV : 0;
 	return 16;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementOTIR(void)
+uint32 CZ80::ImplementLDIR(void)
 {
 	//
-	// Operation:	(C) <- (HL), B <- B - 1, HL <- HL + 1
-	// Op Code:		OTIR
-	// Operands:	--
+	// Operation:	(DE) <- (HL), DE <- DE+1, HL <- HL+1, BC <- BC-1
+	// Op Code:		LDIR
+	// Operands:	(DE), DE, (HL), HL, BC
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|0|0|1|1| B3
+	//						|1|0|1|1|0|0|0|0| B0
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						For BC != 0
 	//							M Cycles		T States					MHz E.T.
-	//								5						21 (4,5,3,4,5)		5.25		B != 0
-	//								4						16 (4,5,3,4)			4.00		B == 0
+	//								5						21 (4,4,3,5,5)		5.25
 	//
-	uint32 tstates = ImplementOUTI();
-	if (m_B != 0)
+	//						For BC == 0
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,4,3,5)			4.00
+	//
+	uint32 tstates = ImplementLDI();
+	if (m_BC != 0)
 	{
 		tstates += 5;
 		----m_PC;
+		m_MEMPTR = m_PC + 1;
+		tstates += RepeatLDxR(1);
 	}
 	return tstates;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementOUTD(void)
+uint32 CZ80::ImplementLDD(void)
 {
 	//
-	// Operation:	(C) <- (HL), B <- B - 1, HL <- HL - 1
-	// Op Code:		OUTD
-	// Operands:	--
+	// Operation:	(DE) <- (HL), DE <- DE-1, HL <- HL-1, BC <- BC-1
+	// Op Code:		LDD
+	// Operands:	(DE), DE, (HL), HL, BC
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|0|1|0|1|1| AB
+	//						|1|0|1|0|1|0|0|0| A8
 	//						+-+-+-+-+-+-+-+-+
 	//
 	//							M Cycles		T States					MHz E.T.
-	//								4						16 (4,5,3,4)			4.00
+	//								4						16 (4,4,3,5)			4.00
 	//
 	++++m_PC;
-	m_addresslo = m_C;
-	m_addresshi = m_B;
 	uint8 byte = ReadMemory(m_HL--);
-	WritePort(m_address, byte);
-	m_B = HandleArithmeticSubtractFlags(m_B, 1, false);
-	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
-	m_F |= ((byte >> 6) & eF_N);
-	uint16 k = byte + m_L;
-	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
-	k &= 0x07;
-	k ^= m_B;
-	uint8 parity = k;
-	parity ^= parity >> 4;
-	parity &= 0xF;
-	parity = ((0x6996 >> parity) << 2);
-	m_F |= (~parity & eF_PV);
+	WriteMemory(m_DE--, byte);
+	--m_BC;
+	// From The Undocumented Z80:
+	byte += m_A;
+	m_F &= (eF_S | eF_Z | eF_C);
+	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y);
+	m_F |= (m_BC != 0) ? eF_PV : 0;
 	return 16;
 }
 
 //=============================================================================
 
-uint32 CZ80::ImplementOTDR(void)
+uint32 CZ80::ImplementLDDR(void)
 {
 	//
-	// Operation:	(C) <- (HL), B <- B - 1, HL <- HL - 1
-	// Op Code:		OTIR
-	// Operands:	--
+	// Operation:	(DE) <- (HL), DE <- DE-1, HL <- HL-1, BC <- BC-1
+	// Op Code:		LDDR
+	// Operands:	(DE), DE, (HL), HL, BC
 	//						+-+-+-+-+-+-+-+-+
 	//						|1|1|1|0|1|1|0|1| ED
 	//						+-+-+-+-+-+-+-+-+
-	//						|1|0|1|1|1|0|1|1| BB
+	//						|1|0|1|1|1|0|0|0| B8
 	//						+-+-+-+-+-+-+-+-+
 	//
+	//						For BC != 0
 	//							M Cycles		T States					MHz E.T.
-	//								5						21 (4,5,3,4,5)		5.25		B != 0
-	//								4						16 (4,5,3,4)			4.00		B == 0
+	//								5						21 (4,4,3,5,5)		5.25
 	//
-	uint32 tstates = ImplementOUTD();
-	if (m_B != 0)
-	{
-		tstates += 5;
-		----m_PC;
-	}
-	return tstates;
-}
-
-//=============================================================================
-
-//-----------------------------------------------------------------------------
-//	8-Bit Load Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-void CZ80::DecodeLDrr(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD %s,%s", Get8BitRegisterString(ReadMemory(address) >> 3), Get8BitRegisterString(ReadMemory(address)));
-	++address;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDrIXh(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD %s,IXh", Get8BitRegisterString(ReadMemory(address) >> 3));
-	++++address;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDrIXl(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD %s,IXl", Get8BitRegisterString(ReadMemory(address) >> 3));
-	++++address;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDrIYh(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD %s,IYh", Get8BitRegisterString(ReadMemory(address) >> 3));
-	++++address;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDrIYl(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD %s,IYl", Get8BitRegisterString(ReadMemory(address) >> 3));
-	++++address;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDrn(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD %s,%02X", Get8BitRegisterString(ReadMemory(address) >> 3), ReadMemory(address + 1));
-	address += 2;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDIXhn(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD IXh,%02X", ReadMemory(address + 2));
-	address += 3;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDIXhr(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD IXh,%s", Get8BitIXRegisterString(ReadMemory(address + 1)));
-	address += 2;
+	//						For BC == 0
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,4,3,5)			4.00
+	//
+	uint32 tstates = ImplementLDD();
+	if (m_BC != 0)
+	{
+		tstates += 5;
+		----m_PC;
+		m_MEMPTR = m_PC + 1;
+		tstates += RepeatLDxR(-1);
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDIXln(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPI(void)
 {
-	sprintf(pMnemonic, "LD IXl,%02X", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A - (HL), HL <- HL+1, BC <- BC-1
+	// Op Code:		CPI
+	// Operands:	A, (HL), HL, BC
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|0|0|1| A1
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,4,3,5)			4.00
+	//
+	++++m_PC;
+	uint8 _HL_ = ReadMemory(m_HL++);
+	--m_BC;
+	++m_MEMPTR;
+	// From The Undocumented Z80:
+	uint8 origF = m_F;
+	HandleArithmeticSubtractFlags(m_A, _HL_, false);
+	uint8 byte = m_A - _HL_ - ((m_F & eF_H) >> 4);
+	m_F &= (eF_S | eF_Z | eF_H);
+	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y) | ((m_BC != 0) ? eF_PV : 0) | eF_N | (origF & eF_C);
+	return 16;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDIXlr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPIR(void)
 {
-	sprintf(pMnemonic, "LD IXl,%s", Get8BitIXRegisterString(ReadMemory(address + 1)));
-	address += 2;
+	//
+	// Operation:	A - (HL), HL <- HL+1, BC <- BC-1
+	// Op Code:		CPIR
+	// Operands:	A, (HL), HL, BC
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|0|0|1| B1
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						For BC != 0
+	//							M Cycles		T States					MHz E.T.
+	//								5						21 (4,4,3,5,5)		5.25
+	//
+	//						For BC == 0
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,4,3,5)			4.00
+	//
+	uint32 tstates = ImplementCPI();
+	if ((m_F & eF_PV) && !(m_F & eF_Z))
+	{
+		tstates += 5;
+		----m_PC;
+		m_MEMPTR = m_PC + 1;
+		tstates += RepeatCPxR(1);
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDIYhn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPD(void)
 {
-	sprintf(pMnemonic, "LD IYh,%02X", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A - (HL), HL <- HL-1, BC <- BC-1
+	// Op Code:		CPD
+	// Operands:	A, (HL), HL, BC
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|0|0|1| A9
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,4,3,5)			4.00
+	//
+	++++m_PC;
+	uint8 _HL_ = ReadMemory(m_HL--);
+	--m_BC;
+	--m_MEMPTR;
+	// From The Undocumented Z80:
+	uint8 origF = m_F;
+	HandleArithmeticSubtractFlags(m_A, _HL_, false);
+	uint8 byte = m_A - _HL_ - ((m_F & eF_H) >> 4);
+	m_F &= (eF_S | eF_Z | eF_H);
+	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y) | ((m_BC != 0) ? eF_PV : 0) | eF_N | (origF & eF_C);
+	return 16;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDIYhr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPDR(void)
 {
-	sprintf(pMnemonic, "LD IYh,%s", Get8BitIYRegisterString(ReadMemory(address + 1)));
-	address += 2;
+	//
+	// Operation:	A - (HL), HL <- HL-1, BC <- BC-1
+	// Op Code:		CPDR
+	// Operands:	A, (HL), HL, BC
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|1|0|0|1| B9
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						For BC != 0
+	//							M Cycles		T States					MHz E.T.
+	//								5						21 (4,4,3,5,5)		5.25
+	//
+	//						For BC == 0
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,4,3,5)			4.00
+	//
+	uint32 tstates = ImplementCPD();
+	if ((m_F & eF_PV) && !(m_F & eF_Z))
+	{
+		tstates += 5;
+		----m_PC;
+		m_MEMPTR = m_PC + 1;
+		tstates += RepeatCPxR(-1);
+	}
+	return tstates;
 }
 
 //=============================================================================
-
-void CZ80::DecodeLDIYln(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD IYl,%02X", ReadMemory(address + 2));
-	address += 3;
-}
-
+//	Bulk execution of the repeating block instructions
+//
+//	Once the first iteration has run (through the normal path, so it lands at
+//	the right time), as many more as start within the step budget are run
+//	directly on memory.  Only the final iteration's flags survive, so they're
+//	worked out once at the end exactly as the single iteration handlers do.
 //=============================================================================
 
-void CZ80::DecodeLDIYlr(uint16& address, char* pMnemonic) const
+uint32 CZ80::GetBlockRepeats(uint32 remaining) const
 {
-	sprintf(pMnemonic, "LD IYl,%s", Get8BitIYRegisterString(ReadMemory(address + 1)));
-	address += 2;
-}
-
-//=============================================================================
+	// Contention times every access, and debugging watches every instruction,
+	// so neither can skip the refetch of each iteration
+	// Each repeat starts this long after the last (the same for all of them)
+	uint32 iteration = s_opcode[OT_ED][0xB0].m_takenTstates;
+	if ((m_stepBudget <= iteration) || (m_pContention != NULL) || (m_features & (ZF_TRACE | ZF_ADDRESS_BREAKPOINTS | ZF_DATA_WATCHPOINTS)))
+	{
+		return 0;
+	}
 
-void CZ80::DecodeLDr_IXd_(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD %s,(IX+%02X)", Get8BitRegisterString(ReadMemory(address + 1) >> 3), ReadMemory(address + 2));
-	address += 3;
+	uint32 repeats = (m_stepBudget - 1) / iteration;
+	return (repeats < remaining) ? repeats : remaining;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDr_IYd_(uint16& address, char* pMnemonic) const
+static inline uint32 BytesInBlock(uint16 address, int32 step, uint32 count)
 {
-	sprintf(pMnemonic, "LD %s,(IY+%02X)", Get8BitRegisterString(ReadMemory(address + 1) >> 3), ReadMemory(address + 2));
-	address += 3;
+	// Chunks never cross a 256 byte boundary (in the direction of travel)
+	uint32 bytes = (step > 0) ? (0x100 - (address & 0xFF)) : ((address & 0xFF) + 1);
+	return (bytes < count) ? bytes : count;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLD_HL_r(uint16& address, char* pMnemonic) const
+bool CZ80::IsOpcodeInBlock(const uint8* pBlock, uint16 length) const
 {
-	sprintf(pMnemonic, "LD (HL),%s", Get8BitRegisterString(ReadMemory(address++)));
+	// Writing over the instruction itself means the next iteration runs
+	// whatever has been written there instead (compared by pointer, as the
+	// same RAM can be paged in more than once)
+	for (uint16 offset = 0; offset < 2; ++offset)
+	{
+		const uint8* pOpcode = m_pMemory->GetReadBlock(m_PC + offset, 1);
+		if ((pOpcode == NULL) || ((pOpcode >= pBlock) && (pOpcode < pBlock + length)))
+		{
+			return true;
+		}
+	}
+	return false;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLD_IXd_r(uint16& address, char* pMnemonic) const
+uint32 CZ80::RepeatLDxR(int32 step)
 {
-	sprintf(pMnemonic, "LD (IX+%02X),%s", ReadMemory(address + 2), Get8BitRegisterString(ReadMemory(address + 1)));
-	address += 3;
-}
+	uint32 repeats = GetBlockRepeats(m_BC);
+	uint32 done = 0;
+	uint8 byte = 0;
 
-//=============================================================================
+	while (done < repeats)
+	{
+		uint32 count = BytesInBlock(m_HL, step, repeats - done);
+		count = BytesInBlock(m_DE, step, count);
+		uint16 source = (step > 0) ? m_HL : (m_HL - count + 1);
+		uint16 destination = (step > 0) ? m_DE : (m_DE - count + 1);
 
-void CZ80::DecodeLD_IYd_r(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD (IY+%02X),%s", ReadMemory(address + 2), Get8BitRegisterString(ReadMemory(address + 1)));
-	address += 3;
-}
+		const uint8* pSource = m_pMemory->GetReadBlock(source, count);
+		if (pSource == NULL)
+		{
+			break;
+		}
+		uint8* pDestination = m_pMemory->GetWriteBlock(destination, count, m_stepBudget);
+		if ((pDestination == NULL) || IsOpcodeInBlock(pDestination, count))
+		{
+			break;
+		}
 
-//=============================================================================
+		if ((pDestination + count <= pSource) || (pSource + count <= pDestination))
+		{
+			memcpy(pDestination, pSource, count);
+		}
+		else if (pDestination == pSource + step)
+		{
+			// The usual fill (DE = HL+1 for LDIR, HL-1 for LDDR) repeats one byte
+			memset(pDestination, (step > 0) ? pSource[0] : pSource[count - 1], count);
+		}
+		else if (step > 0)
+		{
+			for (uint32 index = 0; index < count; ++index)
+			{
+				pDestination[index] = pSource[index];
+			}
+		}
+		else
+		{
+			for (uint32 index = count; index-- > 0; )
+			{
+				pDestination[index] = pSource[index];
+			}
+		}
 
-void CZ80::DecodeLD_HL_n(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD (HL),%02X", ReadMemory(address + 1));
-	address += 2;
-}
+		byte = (step > 0) ? pDestination[count - 1] : pDestination[0];
+		m_HL += step * static_cast<int32>(count);
+		m_DE += step * static_cast<int32>(count);
+		m_BC -= count;
+		done += count;
+	}
 
-//=============================================================================
+	if (done == 0)
+	{
+		return 0;
+	}
 
-void CZ80::DecodeLD_IXd_n(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD (IX+%02X),%02X", ReadMemory(address + 2), ReadMemory(address + 3));
-	address += 4;
-}
+	// ED and the opcode are refetched each time
+	IncrementR(static_cast<uint8>((done << 1) & 0x7F));
 
-//=============================================================================
+	// As ImplementLDI()
+	byte += m_A;
+	m_F &= (eF_S | eF_Z | eF_C);
+	m_F |= (byte & eF_X) | ((byte << 4) & eF_Y);
+	m_F |= (m_BC != 0) ? eF_PV : 0;
 
-void CZ80::DecodeLD_IYd_n(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD (IY+%02X),%02X", ReadMemory(address + 2), ReadMemory(address + 3));
-	address += 4;
+	if (m_BC == 0)
+	{
+		++++m_PC;
+		return (done * 21) - 5;
+	}
+	return done * 21;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDA_BC_(uint16& address, char* pMnemonic) const
+uint32 CZ80::RepeatCPxR(int32 step)
 {
-	sprintf(pMnemonic, "LD A,(BC)");
-	++address;
-}
+	uint32 repeats = GetBlockRepeats(m_BC);
+	uint32 done = 0;
+	uint8 byte = 0;
+	bool found = false;
 
-//=============================================================================
+	while ((done < repeats) && !found)
+	{
+		uint32 count = BytesInBlock(m_HL, step, repeats - done);
+		uint16 source = (step > 0) ? m_HL : (m_HL - count + 1);
 
-void CZ80::DecodeLDA_DE_(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD A,(DE)");
-	++address;
-}
+		const uint8* pSource = m_pMemory->GetReadBlock(source, count);
+		if (pSource == NULL)
+		{
+			break;
+		}
 
-//=============================================================================
+		// A match ends the instruction, on the iteration that finds it
+		uint32 scanned = 0;
+		if (step > 0)
+		{
+			const uint8* pMatch = static_cast<const uint8*>(memchr(pSource, m_A, count));
+			found = (pMatch != NULL);
+			scanned = found ? static_cast<uint32>(pMatch - pSource) + 1 : count;
+			byte = pSource[scanned - 1];
+		}
+		else
+		{
+			while ((scanned < count) && !found)
+			{
+				byte = pSource[count - 1 - scanned];
+				found = (byte == m_A);
+				++scanned;
+			}
+		}
 
-void CZ80::DecodeLDA_nn_(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD A,(%02X%02X)", ReadMemory(address + 2), ReadMemory(address + 1));
-	address += 3;
-}
+		m_HL += step * static_cast<int32>(scanned);
+		m_BC -= scanned;
+		done += scanned;
+	}
 
-//=============================================================================
+	if (done == 0)
+	{
+		return 0;
+	}
 
-void CZ80::DecodeLD_BC_A(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD (BC),A");
-	++address;
-}
+	IncrementR(static_cast<uint8>((done << 1) & 0x7F));
 
-//=============================================================================
+	// As ImplementCPI()
+	uint8 origF = m_F;
+	HandleArithmeticSubtractFlags(m_A, byte, false);
+	uint8 result = m_A - byte - ((m_F & eF_H) >> 4);
+	m_F &= (eF_S | eF_Z | eF_H);
+	m_F |= (result & eF_X) | ((result << 4) & eF_Y) | ((m_BC != 0) ? eF_PV : 0) | eF_N | (origF & eF_C);
 
-void CZ80::DecodeLD_DE_A(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD (DE),A");
-	++address;
+	if ((m_F & eF_PV) && !(m_F & eF_Z))
+	{
+		return done * 21;
+	}
+	++++m_PC;
+	m_MEMPTR += step;
+	return (done * 21) - 5;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLD_nn_A(uint16& address, char* pMnemonic) const
+uint32 CZ80::RepeatINxR(int32 step)
 {
-	sprintf(pMnemonic, "LD (%02X%02X),A", ReadMemory(address + 2), ReadMemory(address + 1));
-	address += 3;
-}
+	// The ports are read directly; nothing the machine returns from a read
+	// changes within the budget (the owner keeps it short of the next input
+	// event, and gives no budget while the tape is playing)
+	uint32 repeats = GetBlockRepeats(m_B);
+	uint32 done = 0;
+	uint8 byte = 0;
 
-//=============================================================================
+	while (done < repeats)
+	{
+		uint32 count = BytesInBlock(m_HL, step, repeats - done);
+		uint16 destination = (step > 0) ? m_HL : (m_HL - count + 1);
 
-void CZ80::DecodeLDAI(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD A,I");
-	++++address;
-}
+		uint8* pDestination = m_pMemory->GetWriteBlock(destination, count, m_stepBudget);
+		if ((pDestination == NULL) || IsOpcodeInBlock(pDestination, count))
+		{
+			break;
+		}
 
-//=============================================================================
+		for (uint32 index = 0; index < count; ++index)
+		{
+			m_addresslo = m_C;
+			m_addresshi = m_B;
+			byte = m_pMemory->ReadPort(m_address);
+			pDestination[(step > 0) ? index : (count - 1 - index)] = byte;
+			--m_B;
+		}
 
-void CZ80::DecodeLDAR(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD A,R");
-	++++address;
-}
+		m_HL += step * static_cast<int32>(count);
+		done += count;
+	}
 
-//=============================================================================
+	if (done == 0)
+	{
+		return 0;
+	}
 
-void CZ80::DecodeLDIA(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD I,A");
-	++++address;
-}
+	IncrementR(static_cast<uint8>((done << 1) & 0x7F));
+	m_MEMPTR = m_address + step;
 
-//=============================================================================
+	// As ImplementINI()/ImplementIND(), for the last iteration
+	m_B = HandleArithmeticSubtractFlags(m_B + 1, 1, false);
+	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
+	m_F |= ((byte >> 6) & eF_N);
+	uint16 k = byte + ((m_C + step) & 0xFF);
+	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
+	k &= 0x07;
+	k ^= m_B;
+	uint8 parity = k;
+	parity ^= parity >> 4;
+	parity &= 0xF;
+	parity = ((0x6996 >> parity) << 2);
+	m_F |= (~parity & eF_PV);
 
-void CZ80::DecodeLDRA(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD R,A");
-	++++address;
+	if (m_B == 0)
+	{
+		++++m_PC;
+		return (done * 21) - 5;
+	}
+	return done * 21;
 }
 
 //=============================================================================
 
 //-----------------------------------------------------------------------------
-//	16-Bit Load Group
+//	8-Bit Arithmetic Group
 //-----------------------------------------------------------------------------
 
 //=============================================================================
 
-void CZ80::DecodeLDddnn(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD %s,%02X%02X", Get16BitRegisterString(ReadMemory(address) >> 4), ReadMemory(address + 2), ReadMemory(address + 1));
-	address += 3;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDIXnn(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD IX,%02X%02X", ReadMemory(address + 3), ReadMemory(address + 2));
-	address += 4;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDIYnn(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "LD IY,%02X%02X", ReadMemory(address + 3), ReadMemory(address + 2));
-	address += 4;
-}
-
-//=============================================================================
-
-void CZ80::DecodeLDHL_nn_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDAr(void)
 {
-	sprintf(pMnemonic, "LD HL,(%02X%02X)", ReadMemory(address + 2), ReadMemory(address + 1));
-	address += 3;
+	//
+	// Operation:	A <- A+r
+	// Op Code:		ADD
+	// Operands:	A, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	m_A = HandleArithmeticAddFlags(m_A, REGISTER_8BIT(ReadMemory(m_PC++)), false);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDdd_nn_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDAIXh(void)
 {
-	sprintf(pMnemonic, "LD %s,(%02X%02X)", Get16BitRegisterString(ReadMemory(address + 1) >> 4), ReadMemory(address + 3), ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		ADD
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|0|1|0|0| 84
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, m_IXh, false);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDIX_nn_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDAIXl(void)
 {
-	sprintf(pMnemonic, "LD IX,(%02X%02X)", ReadMemory(address + 3), ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	A <- A+IXl
+	// Op Code:		ADD
+	// Operands:	A, IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|0|1|0|1| 85
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, m_IXl, false);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDIY_nn_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDAIYh(void)
 {
-	sprintf(pMnemonic, "LD IY,(%02X%02X)", ReadMemory(address + 3), ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		ADD
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|0|1|0|0| 84
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, m_IYh, false);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLD_nn_HL(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDAIYl(void)
 {
-	sprintf(pMnemonic, "LD (%02X%02X),HL", ReadMemory(address + 2), ReadMemory(address + 1));
-	address += 3;
+	//
+	// Operation:	A <- A+IYl
+	// Op Code:		ADD
+	// Operands:	A, IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|0|1|0|1| 85
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, m_IYl, false);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLD_nn_dd(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDAn(void)
 {
-	sprintf(pMnemonic, "LD (%02X%02X),%s", ReadMemory(address + 3), ReadMemory(address + 2), Get16BitRegisterString(ReadMemory(address + 1) >> 4));
-	address += 4;
+	//
+	// Operation:	A <- A+n
+	// Op Code:		ADD
+	// Operands:	A, n
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|0|1|1|0| C6
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_PC++), false);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLD_nn_IX(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDA_HL_(void)
 {
-	sprintf(pMnemonic, "LD (%02X%02X),IX", ReadMemory(address + 3), ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	A <- A+(HL)
+	// Op Code:		ADD
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|0|1|1|0| 86
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_HL), false);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLD_nn_IY(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDA_IXd_(void)
 {
-	sprintf(pMnemonic, "LD (%02X%02X),IY", ReadMemory(address + 3), ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	A <- A+(IX+d)
+	// Op Code:		ADD
+	// Operands:	A, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|0|1|1|0| 86
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_IX + displacement), false);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDSPHL(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDA_IYd_(void)
 {
-	sprintf(pMnemonic, "LD SP,HL");
-	++address;
+	//
+	// Operation:	A <- A+(IY+d)
+	// Op Code:		ADD
+	// Operands:	A, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|0|1|1|0| 86
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_IY + displacement), false);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDSPIX(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCAr(void)
 {
-	sprintf(pMnemonic, "LD SP,IX");
-	++address;
+	//
+	// Operation:	A <- A+r+C
+	// Op Code:		ADC
+	// Operands:	A, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	m_A = HandleArithmeticAddFlags(m_A, REGISTER_8BIT(ReadMemory(m_PC++)), true);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDSPIY(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCAIXh(void)
 {
-	sprintf(pMnemonic, "LD SP,IY");
-	++address;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		ADC
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|0|0| C4
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, m_IXh, true);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodePUSHqq(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCAIXl(void)
 {
-	sprintf(pMnemonic, "PUSH %s", Get16BitRegisterString(ReadMemory(address) >> 4));
-	++address;
+	//
+	// Operation:	A <- A+IXl
+	// Op Code:		ADC
+	// Operands:	A, IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|0|1| C5
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, m_IXl, true);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodePUSHAF(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCAIYh(void)
 {
-	sprintf(pMnemonic, "PUSH AF");
-	++address;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		ADC
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|0|0| C4
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, m_IYh, true);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodePUSHIX(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCAIYl(void)
 {
-	sprintf(pMnemonic, "PUSH IX");
-	address += 2;
+	//
+	// Operation:	A <- A+IYl
+	// Op Code:		ADC
+	// Operands:	A, IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|0|1| C5
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, m_IYl, true);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodePUSHIY(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCAn(void)
 {
-	sprintf(pMnemonic, "PUSH IY");
-	address += 2;
+	//
+	// Operation:	A <- A+n+C
+	// Op Code:		ADC
+	// Operands:	A, n
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|1|1|0| CE
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_PC++), true);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodePOPqq(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCA_HL_(void)
 {
-	sprintf(pMnemonic, "POP %s", Get16BitRegisterString(ReadMemory(address) >> 4));
-	++address;
+	//
+	// Operation:	A <- A+(HL)+C
+	// Op Code:		ADC
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|1|0| 8E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_HL), true);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodePOPAF(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCA_IXd_(void)
 {
-	sprintf(pMnemonic, "POP AF");
-	++address;
+	//
+	// Operation:	A <- A+(IX+d)+C
+	// Op Code:		ADC
+	// Operands:	A, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|1|0| 8E
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_IX + displacement), true);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodePOPIX(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCA_IYd_(void)
 {
-	sprintf(pMnemonic, "POP IX");
-	address += 2;
+	//
+	// Operation:	A <- A+(IY+d)+C
+	// Op Code:		ADC
+	// Operands:	A, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|1|0| 8E
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	m_A = HandleArithmeticAddFlags(m_A, ReadMemory(m_IY + displacement), true);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodePOPIY(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUBr(void)
 {
-	sprintf(pMnemonic, "POP IY");
-	address += 2;
+	//
+	// Operation:	A <- A-r
+	// Op Code:		SUB
+	// Operands:	A, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	m_A = HandleArithmeticSubtractFlags(m_A, REGISTER_8BIT(ReadMemory(m_PC++)), false);
+	return 4;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	Exchange, Block Transfer and Search Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-void CZ80::DecodeEXDEHL(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUBIXh(void)
 {
-	sprintf(pMnemonic, "EX DE,HL");
-	++address;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		SUB
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|0|0| 94
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, m_IXh, false);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeEXAFAF(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUBIXl(void)
 {
-	sprintf(pMnemonic, "EX AF,AF'");
-	++address;
+	//
+	// Operation:	A <- A+IXl
+	// Op Code:		SUB
+	// Operands:	A, IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|0|1| 95
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, m_IXl, false);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeEXX(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUBIYh(void)
 {
-	sprintf(pMnemonic, "EXX");
-	++address;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		SUB
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|0|0| 94
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, m_IYh, false);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeEX_SP_HL(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUBIYl(void)
 {
-	sprintf(pMnemonic, "EX (SP),HL");
-	++address;
+	//
+	// Operation:	A <- A+IYl
+	// Op Code:		SUB
+	// Operands:	A, IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|0|1| 95
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, m_IYl, false);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeEX_SP_IX(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUBn(void)
 {
-	sprintf(pMnemonic, "EX (SP),IX");
-	address += 2;
+	//
+	// Operation:	A <- A-n
+	// Op Code:		SUB
+	// Operands:	A, n
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|0|1|1|0| D6
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_PC++), false);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeEX_SP_IY(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUB_HL_(void)
 {
-	sprintf(pMnemonic, "EX (SP),IY");
-	address += 2;
+	//
+	// Operation:	A <- A-(HL)
+	// Op Code:		SUB
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|1|0| 96
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_HL), false);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDI(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUB_IXd_(void)
 {
-	sprintf(pMnemonic, "LDI");
-	address += 2;
+	//
+	// Operation:	A <- A-(IX+d)
+	// Op Code:		SUB
+	// Operands:	A, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|1|0| 96
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_IX + displacement), false);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDIR(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSUB_IYd_(void)
 {
-	sprintf(pMnemonic, "LDIR");
-	address += 2;
+	//
+	// Operation:	A <- A-(IY+d)
+	// Op Code:		SUB
+	// Operands:	A, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|1|0| 96
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_IY + displacement), false);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDD(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCAr(void)
 {
-	sprintf(pMnemonic, "LDD");
-	address += 2;
+	//
+	// Operation:	A <- A-r-C
+	// Op Code:		SBC
+	// Operands:	A, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	m_A = HandleArithmeticSubtractFlags(m_A, REGISTER_8BIT(ReadMemory(m_PC++)), true);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeLDDR(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCAIXh(void)
 {
-	sprintf(pMnemonic, "LDDR");
-	address += 2;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		SBC
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|0|0| 8C
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, m_IXh, true);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPI(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCAIXl(void)
 {
-	sprintf(pMnemonic, "CPI");
-	address += 2;
+	//
+	// Operation:	A <- A+IXl
+	// Op Code:		SBC
+	// Operands:	A, IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|0|1| 8D
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, m_IXl, true);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPIR(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCAIYh(void)
 {
-	sprintf(pMnemonic, "CPIR");
-	address += 2;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		SBC
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|0|0| 8C
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, m_IYh, true);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPD(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCAIYl(void)
 {
-	sprintf(pMnemonic, "CPD");
-	address += 2;
+	//
+	// Operation:	A <- A+IYl
+	// Op Code:		SBC
+	// Operands:	A, IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|0|1|1|0|1| 8D
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, m_IYl, true);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPDR(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCAn(void)
 {
-	sprintf(pMnemonic, "CPDR");
-	address += 2;
+	//
+	// Operation:	A <- A-n-C
+	// Op Code:		SBC
+	// Operands:	A, n
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|1|0| DE
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_PC++), true);
+	return 7;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	8-Bit Arithmetic Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-void CZ80::DecodeADDAr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCA_HL_(void)
 {
-	sprintf(pMnemonic, "ADD A,%s", Get8BitRegisterString(ReadMemory(address++)));
+	//
+	// Operation:	A <- A-(HL)-C
+	// Op Code:		SBC
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|1|1|1|0| 9E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_HL), true);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDAIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCA_IXd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "ADD A,IXh");
+	//
+	// Operation:	A <- A-(IX+d)-C
+	// Op Code:		SBC
+	// Operands:	A, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|1|1|1|0| 9E
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_IX + displacement), true);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDAIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCA_IYd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "ADD A,IXl");
+	//
+	// Operation:	A <- A-(IY+d)-C
+	// Op Code:		SBC
+	// Operands:	A, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|1|1|1|0| 9E
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	m_A = HandleArithmeticSubtractFlags(m_A, ReadMemory(m_IY + displacement), true);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDAIYh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementANDr(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "ADD A,IYh");
+	//
+	// Operation:	A <- A&r
+	// Op Code:		AND
+	// Operands:	A, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	m_A &= REGISTER_8BIT(ReadMemory(m_PC++));
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDAIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementANDIXh(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "ADD A,IYl");
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		AND
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|1|0|0| A4
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A &= m_IXh;
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDAn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementANDIXl(void)
 {
-	sprintf(pMnemonic, "ADD A,%02X", ReadMemory(++address));
-	++address;
+	//
+	// Operation:	A <- A+IXl
+	// Op Code:		AND
+	// Operands:	A, IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|1|0|1| A5
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A &= m_IXl;
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDA_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementANDIYh(void)
 {
-	sprintf(pMnemonic, "ADD A,(IX+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		AND
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|1|0|0| A4
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A &= m_IYh;
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDA_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementANDIYl(void)
 {
-	sprintf(pMnemonic, "ADD A,(IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A <- A+IYl
+	// Op Code:		AND
+	// Operands:	A, IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|1|0|1| A5
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A &= m_IYl;
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADCAr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementANDn(void)
 {
-	sprintf(pMnemonic, "ADC A,%s", Get8BitRegisterString(ReadMemory(address++)));
+	//
+	// Operation:	A <- A&n
+	// Op Code:		AND
+	// Operands:	A, n
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|0|1|1|0| E6
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A &= ReadMemory(m_PC++);
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADCAn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementAND_HL_(void)
 {
-	sprintf(pMnemonic, "ADC A,%02X", ReadMemory(++address));
-	++address;
+	//
+	// Operation:	A <- A&(HL)
+	// Op Code:		AND
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|1|1|0| A6
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A &= ReadMemory(m_HL);
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADCA_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementAND_IXd_(void)
 {
-	sprintf(pMnemonic, "ADC A,(IX+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A <- A&(IX+d)
+	// Op Code:		AND
+	// Operands:	A, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|1|1|0| A6
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	m_A &= ReadMemory(m_IX + displacement);
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADCA_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementAND_IYd_(void)
 {
-	sprintf(pMnemonic, "ADC A,(IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A <- A&(IY+d)
+	// Op Code:		AND
+	// Operands:	A, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|1|1|0| A6
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	m_A &= ReadMemory(m_IY + displacement);
+	HandleLogicalFlags(m_A);
+	m_F |= eF_H;
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSUBr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementORr(void)
 {
-	sprintf(pMnemonic, "SUB %s", Get8BitRegisterString(ReadMemory(address++)));
+	//
+	// Operation:	A <- A|r
+	// Op Code:		OR
+	// Operands:	A, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	m_A |= REGISTER_8BIT(ReadMemory(m_PC++));
+	HandleLogicalFlags(m_A);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSUBIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementORIXh(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "SUB IXh");
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		OR
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|1|0|0| B4
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A |= m_IXh;
+	HandleLogicalFlags(m_A);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSUBIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementORIXl(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "SUB IXl");
+	//
+	// Operation:	A <- A+IXl
+	// Op Code:		OR
+	// Operands:	A, IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|1|0|1| B5
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A |= m_IXl;
+	HandleLogicalFlags(m_A);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSUBIYh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementORIYh(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "SUB IYh");
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		OR
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|1|0|0| B4
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A |= m_IYh;
+	HandleLogicalFlags(m_A);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSUBIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementORIYl(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "SUB IYl");
+	//
+	// Operation:	A <- A+IYl
+	// Op Code:		OR
+	// Operands:	A, IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|1|0|1| B5
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A |= m_IYl;
+	HandleLogicalFlags(m_A);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSUBn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementORn(void)
 {
-	sprintf(pMnemonic, "SUB %02X", ReadMemory(++address));
-	++address;
+	//
+	// Operation:	A <- A|n
+	// Op Code:		OR
+	// Operands:	A, n
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|0|1|1|0| F6
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A |= ReadMemory(m_PC++);
+	HandleLogicalFlags(m_A);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSUB_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOR_HL_(void)
 {
-	sprintf(pMnemonic, "SUB (IX+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A <- A|(HL)
+	// Op Code:		OR
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|1|1|0| B6
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A |= ReadMemory(m_HL);
+	HandleLogicalFlags(m_A);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSUB_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOR_IXd_(void)
 {
-	sprintf(pMnemonic, "SUB (IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A <- A|(IX+d)
+	// Op Code:		OR
+	// Operands:	A, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|1|1|0| B6
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	m_A |= ReadMemory(m_IX + displacement);
+	HandleLogicalFlags(m_A);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCAr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOR_IYd_(void)
 {
-	sprintf(pMnemonic, "SBC A,%s", Get8BitRegisterString(ReadMemory(address++)));
+	//
+	// Operation:	A <- A|(IY+d)
+	// Op Code:		OR
+	// Operands:	A, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|1|1|0| B6
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	m_A |= ReadMemory(m_IY + displacement);
+	HandleLogicalFlags(m_A);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCAIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXORr(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "SBC A,IXh");
+	//
+	// Operation:	A <- A^r
+	// Op Code:		XOR
+	// Operands:	A, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	m_A ^= REGISTER_8BIT(ReadMemory(m_PC++));
+	HandleLogicalFlags(m_A);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCAIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXORIXh(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "SBC A,IXl");
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		XOR
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|1|0|0| AC
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A ^= m_IXh;
+	HandleLogicalFlags(m_A);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCAIYh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXORIXl(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "SBC A,IYh");
+	//
+	// Operation:	A <- A+IXl
+	// Op Code:		XOR
+	// Operands:	A, IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|1|0|1| AD
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A ^= m_IXl;
+	HandleLogicalFlags(m_A);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCAIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXORIYh(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "SBC A,IYl");
+	//
+	// Operation:	A <- A+IXh
+	// Op Code:		XOR
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|1|0|0| AC
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A ^= m_IYh;
+	HandleLogicalFlags(m_A);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCAn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXORIYl(void)
 {
-	sprintf(pMnemonic, "SBC A,%02X", ReadMemory(++address));
-	++address;
+	//
+	// Operation:	A <- A+IYl
+	// Op Code:		XOR
+	// Operands:	A, IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|1|0|1| AD
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_A ^= m_IYl;
+	HandleLogicalFlags(m_A);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCA_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXORn(void)
 {
-	sprintf(pMnemonic, "SBC A,(IX+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A <- A^n
+	// Op Code:		XOR
+	// Operands:	A, n
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|1|0| EE
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A ^= ReadMemory(m_PC++);
+	HandleLogicalFlags(m_A);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCA_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXOR_HL_(void)
 {
-	sprintf(pMnemonic, "SBC A,(IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A <- A^(HL)
+	// Op Code:		XOR
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|1|1|0| AE
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	m_A ^= ReadMemory(m_HL);
+	HandleLogicalFlags(m_A);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeANDr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXOR_IXd_(void)
 {
-	sprintf(pMnemonic, "AND %s", Get8BitRegisterString(ReadMemory(address++)));
+	//
+	// Operation:	A <- A^(IX+d)
+	// Op Code:		XOR
+	// Operands:	A, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|1|1|0| AE
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	m_A ^= ReadMemory(m_IX + displacement);
+	HandleLogicalFlags(m_A);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeANDIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementXOR_IYd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "AND IXh");
+	//
+	// Operation:	A <- A^(IY+d)
+	// Op Code:		XOR
+	// Operands:	A, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|1|1|0| AE
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	m_A ^= ReadMemory(m_IY + displacement);
+	HandleLogicalFlags(m_A);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeANDIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPr(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "AND IXl");
+	//
+	// Operation:	A - r
+	// Op Code:		CP
+	// Operands:	A, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|1|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	uint8 reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	HandleArithmeticSubtractFlags(m_A, reg, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= reg & (eF_Y | eF_X);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeANDIYh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPIXh(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "AND IYh");
+	//
+	// Operation:	A - IXh
+	// Op Code:		CP
+	// Operands:	A, IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|1|1|0|0| BC
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	HandleArithmeticSubtractFlags(m_A, m_IXh, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= m_IXh & (eF_Y | eF_X);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeANDIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPIXl(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "AND IYl");
+	//
+	// Operation:	A - IXl
+	// Op Code:		CP
+	// Operands:	A, IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|1|1|0|1| BD
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	HandleArithmeticSubtractFlags(m_A, m_IXl, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= m_IXl & (eF_Y | eF_X);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeANDn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPIYh(void)
 {
-	sprintf(pMnemonic, "AND %02X", ReadMemory(++address));
-	++address;
+	//
+	// Operation:	A - IYh
+	// Op Code:		CP
+	// Operands:	A, IYh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|1|1|0|0| BC
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	HandleArithmeticSubtractFlags(m_A, m_IYh, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= m_IYh & (eF_Y | eF_X);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeAND_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPIYl(void)
 {
-	sprintf(pMnemonic, "AND (IX+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	A - IYl
+	// Op Code:		CP
+	// Operands:	A, IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|1|1|0|1| BD
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	HandleArithmeticSubtractFlags(m_A, m_IYl, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= m_IYl & (eF_Y | eF_X);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeAND_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPn(void)
 {
-	sprintf(pMnemonic, "AND (IY+%02X)", ReadMemory(address += 2));
-	address += 3;
+	//
+	// Operation:	A - n
+	// Op Code:		CP
+	// Operands:	A, n
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|0|1|1|0| D6
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	uint8 byte = ReadMemory(m_PC++);
+	HandleArithmeticSubtractFlags(m_A, byte, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= byte & (eF_Y | eF_X);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeORr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCP_HL_(void)
 {
-	sprintf(pMnemonic, "OR %s", Get8BitRegisterString(ReadMemory(address++)));
+	//
+	// Operation:	A - (HL)
+	// Op Code:		CP
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|1|0| 96
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7	(4,3)						1.75
+	//
+	++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	HandleArithmeticSubtractFlags(m_A, byte, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= byte & (eF_Y | eF_X);
+	return 7;
 }
 
 //=============================================================================
 
-void CZ80::DecodeORIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCP_IXd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "OR IXh");
+	//
+	// Operation:	A - (IX+d)
+	// Op Code:		CP
+	// Operands:	A, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|1|0| 96
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 byte = ReadMemory(m_IX + displacement);
+	HandleArithmeticSubtractFlags(m_A, byte, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= byte & (eF_Y | eF_X);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeORIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCP_IYd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "OR IXl");
+	//
+	// Operation:	A <- A-(IY+d)
+	// Op Code:		CP
+	// Operands:	A, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|0|1|0|1|1|0| 96
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						19 (4,4,3,5,3)		4.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 byte = ReadMemory(m_IY + displacement);
+	HandleArithmeticSubtractFlags(m_A, byte, false);
+	// From The Undocumented Z80:
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= byte & (eF_Y | eF_X);
+	return 19;
 }
 
 //=============================================================================
 
-void CZ80::DecodeORIYh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINCr(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "OR IYh");
+	//
+	// Operation:	r <- r+1
+	// Op Code:		INC
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|r|r|r|1|0|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++) >> 3);
+	uint8 origF = m_F;
+	reg = HandleArithmeticAddFlags(reg, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeORIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINCIXh(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "OR IYl");
+	//
+	// Operation:	IXh <- IXh+1
+	// Op Code:		INC
+	// Operands:	IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|1|0|0| 24
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8 (4,4)						2.00
+	//
+	++++m_PC;
+	uint8 origF = m_F;
+	m_IXh = HandleArithmeticAddFlags(m_IXh, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeORn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINCIXl(void)
 {
-	sprintf(pMnemonic, "OR %02X", ReadMemory(++address));
-	++address;
+	//
+	// Operation:	IXl <- IXl+1
+	// Op Code:		INC
+	// Operands:	IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|1|0|0| 2C
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8 (4,4)						2.00
+	//
+	++++m_PC;
+	uint8 origF = m_F;
+	m_IXl = HandleArithmeticAddFlags(m_IXl, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeOR_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINCIYh(void)
 {
-	sprintf(pMnemonic, "OR (IX+%02X)", ReadMemory(address += 2));
-	address += 3;
+	//
+	// Operation:	IYh <- IYh+1
+	// Op Code:		INC
+	// Operands:	IYh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|1|0|0| 24
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8 (4,4)						2.00
+	//
+	++++m_PC;
+	uint8 origF = m_F;
+	m_IYh = HandleArithmeticAddFlags(m_IYh, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeOR_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINCIYl(void)
 {
-	sprintf(pMnemonic, "OR (IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	IYl <- IYl+1
+	// Op Code:		INC
+	// Operands:	IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|1|0|0| 2C
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8 (4,4)						2.00
+	//
+	++++m_PC;
+	uint8 origF = m_F;
+	m_IYl = HandleArithmeticAddFlags(m_IYl, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeXORr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINC_HL_(void)
 {
-	sprintf(pMnemonic, "XOR %s", Get8BitRegisterString(ReadMemory(address++)));
+	//
+	// Operation:	(HL) <- (HL)+1
+	// Op Code:		INC
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|0|0| 34
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						11 (4,4,3)				2.75
+	//
+	++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 origF = m_F;
+	byte = HandleArithmeticAddFlags(byte, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	WriteMemory(m_HL, byte);
+	return 11;
 }
 
 //=============================================================================
 
-void CZ80::DecodeXORIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINC_IXd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "XOR IXh");
+	//
+	// Operation:	(IX+d) <- (IX+d)+1
+	// Op Code:		INC
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|0|0| 34
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 origF = m_F;
+	byte = HandleArithmeticAddFlags(byte, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	WriteMemory(m_IX + displacement, byte);
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeXORIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINC_IYd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "XOR IXl");
+	//
+	// Operation:	(IY+d) <- (IY+d)+1
+	// Op Code:		INC
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|0|0| 34
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 origF = m_F;
+	byte = HandleArithmeticAddFlags(byte, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	WriteMemory(m_IY + displacement, byte);
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeXORIYh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDECr(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "XOR IYh");
+	//
+	// Operation:	r <- r-1
+	// Op Code:		DEC
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|r|r|r|1|0|1|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	int8& reg = *reinterpret_cast<int8*>(&REGISTER_8BIT(ReadMemory(m_PC++) >> 3));
+	uint8 origF = m_F;
+	reg = HandleArithmeticSubtractFlags(reg, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeXORIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDECIXh(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "XOR IYl");
+	//
+	// Operation:	IXh <- IXh-1
+	// Op Code:		DEC
+	// Operands:	IXh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|1|0|1| 25
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8	(4,4)						1.00
+	//
+	++++m_PC;
+	uint8 origF = m_F;
+	m_IXh = HandleArithmeticSubtractFlags(m_IXh, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeXORn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDECIXl(void)
 {
-	sprintf(pMnemonic, "XOR %02X", ReadMemory(++address));
-	++address;
+	//
+	// Operation:	IXl <- IXl-1
+	// Op Code:		DEC
+	// Operands:	IXl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|1|0|1| 2D
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8	(4,4)						1.00
+	//
+	++++m_PC;
+	uint8 origF = m_F;
+	m_IXl = HandleArithmeticSubtractFlags(m_IXl, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeXOR_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDECIYh(void)
 {
-	sprintf(pMnemonic, "XOR (IX+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	IYh <- IYh-1
+	// Op Code:		DEC
+	// Operands:	IYh
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|1|0|1| 25
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8	(4,4)						1.00
+	//
+	++++m_PC;
+	uint8 origF = m_F;
+	m_IYh = HandleArithmeticSubtractFlags(m_IYh, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeXOR_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDECIYl(void)
 {
-	sprintf(pMnemonic, "XOR (IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	IYl <- IYl-1
+	// Op Code:		DEC
+	// Operands:	IYl
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|1|0|1| 2D
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						8	(4,4)						1.00
+	//
+	++++m_PC;
+	uint8 origF = m_F;
+	m_IYl = HandleArithmeticSubtractFlags(m_IYl, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDEC_HL_(void)
 {
-	sprintf(pMnemonic, "CP %s", Get8BitRegisterString(ReadMemory(address++)));
+	//
+	// Operation:	(HL) <- (HL)-1
+	// Op Code:		DEC
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|0|1| 35
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						11 (4,4,3)				2.75
+	//
+	++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 origF = m_F;
+	byte = HandleArithmeticSubtractFlags(byte, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	WriteMemory(m_HL, byte);
+	return 11;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDEC_IXd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "CP IXh");
+	//
+	// Operation:	(IX+d) <- (IX+d)-1
+	// Op Code:		DEC
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|0|1| 35
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 origF = m_F;
+	byte = HandleArithmeticSubtractFlags(byte, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	WriteMemory(m_IX + displacement, byte);
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDEC_IYd_(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "CP IXl");
+	//
+	// Operation:	(IY+d) <- (IY+d)-1
+	// Op Code:		DEC
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|0|1| 35
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 origF = m_F;
+	byte = HandleArithmeticSubtractFlags(byte, 1, false);
+	m_F &= ~eF_C;
+	m_F |= (origF & eF_C);
+	WriteMemory(m_IY + displacement, byte);
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPIYh(uint16& address, char* pMnemonic) const
-{
-	address += 2;
-	sprintf(pMnemonic, "CP IYh");
-}
+//-----------------------------------------------------------------------------
+//	General-Purpose Arithmetic and CPU Control Groups
+//-----------------------------------------------------------------------------
 
 //=============================================================================
 
-void CZ80::DecodeCPIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDAA(void)
 {
-	address += 2;
-	sprintf(pMnemonic, "CP IYl");
-}
-
-//=============================================================================
+	//
+	// Operation:	A
+	// Op Code:		DAA
+	// Operands:	A
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|1|1|1| 27
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	++m_PC;
+	uint8 correction = 0x00;
 
-void CZ80::DecodeCPn(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "CP %02X", ReadMemory(++address));
-	++address;
-}
+	if ((m_F & eF_C) || (m_A > 0x99))
+	{
+		correction |= 0x60;
+		m_F |= eF_C;
+	}
+	else
+	{
+		m_F &= ~eF_C;
+	}
 
-//=============================================================================
+	if ((m_F & eF_H) || ((m_A & 0x0F) > 9))
+	{
+		correction |= 0x06;
+	}
 
-void CZ80::DecodeCP_IXd_(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "CP (IX+%02X)", ReadMemory(address + 2));
-	address += 3;
-}
+	uint8 origA = m_A;
 
-//=============================================================================
+	if (m_F & eF_N)
+	{
+		m_A -= correction;
+	}
+	else
+	{
+		m_A += correction;
+	}
 
-void CZ80::DecodeCP_IYd_(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "CP (IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	uint8 origF = m_F;
+	HandleLogicalFlags(m_A);
+	m_F &= ~(eF_H | eF_N | eF_C);
+	m_F |= ((origA ^ m_A) & eF_H) | (origF & (eF_N | eF_C));
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINCr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCPL(void)
 {
-	sprintf(pMnemonic, "INC %s", Get8BitRegisterString(ReadMemory(address++) >> 3));
+	//
+	// Operation:	A <- ~A
+	// Op Code:		CPL
+	// Operands:	A
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|1|1|1| 27
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	++m_PC;
+	m_A = ~m_A;
+	m_F &= (eF_S | eF_Z | eF_PV | eF_C);
+	m_F |= (eF_H | eF_N) | (m_A & (eF_X | eF_Y));
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINCIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementNEG(void)
 {
-	sprintf(pMnemonic, "INC IXh");
-	address += 2;
+	//
+	// Operation:	A <- 0-A
+	// Op Code:		NEG
+	// Operands:	A
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|0|0|0|1|0|0| 44
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	uint8 origA = m_A;
+	m_A = HandleArithmeticSubtractFlags(0, m_A, false);
+	m_F &= ~(eF_PV | eF_C);
+	m_F |= ((origA == 0x80) ? eF_PV : 0) | ((origA) ? eF_C : 0);
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINCIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCCF(void)
 {
-	sprintf(pMnemonic, "INC IXl");
-	address += 2;
+	//
+	// Operation:	CF <- ~CF
+	// Op Code:		CCF
+	// Operands:	CF
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|1|1|1|1| 3F
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	++m_PC;
+	uint8 origF = m_F;
+	m_F &= (eF_S | eF_Z | eF_PV);
+	m_F |= (m_A & (eF_X | eF_Y)) | (((origF & eF_C) << 4) & eF_H) | (~origF & eF_C);
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINCIYh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSCF(void)
 {
-	sprintf(pMnemonic, "INC IYh");
-	address += 2;
+	//
+	// Operation:	CF <- 1
+	// Op Code:		SCF
+	// Operands:	CF
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|1|1| 37
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	++m_PC;
+	m_F &= (eF_S | eF_Z | eF_PV);
+	m_F |= (m_A & (eF_X | eF_Y)) | eF_C;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINCIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementNOP(void)
 {
-	sprintf(pMnemonic, "INC IYl");
-	address += 2;
+	//
+	// Operation:	---
+	// Op Code:		NOP
+	// Operands:	---
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|0|0|0|0| 00
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	++m_PC;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINC_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementUnindexed(void)
 {
-	sprintf(pMnemonic, "INC (IX+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	as the opcode without the prefix
+	// Op Code:		DD or FD, then an opcode with no IX or IY form
+	// Operands:	the opcode's
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|x|1|1|1|0|1| DD or FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|o|o|o|o|o|o|o|o|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States
+	//								1 + opcode	4 + opcode
+	//
+	// The prefix just costs its M1 cycle.  Followed by another prefix (DD, ED
+	// or FD) it's a NOP of its own, and the next instruction starts at that
+	// prefix, so the refresh of its M1 cycle is left for then.
+	++m_PC;
+	uint8 opcode = ReadMemory(m_PC);
+	if ((opcode == 0xDD) || (opcode == 0xED) || (opcode == 0xFD))
+	{
+		IncrementR(0x7F);
+		return 4;
+	}
+	return 4 + (this->*s_opcode[OT_NONE][opcode].m_handler)();
 }
 
 //=============================================================================
 
-void CZ80::DecodeINC_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementHALT(void)
 {
-	sprintf(pMnemonic, "INC (IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	---
+	// Op Code:		HALT
+	// Operands:	---
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|1|1|0|1|1|0| 76
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	// Intentionally don't increment PC
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDECr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDI(void)
 {
-	sprintf(pMnemonic, "DEC %s", Get8BitRegisterString(ReadMemory(address++) >> 3));
+	//
+	// Operation:	IFF <- 0
+	// Op Code:		DI
+	// Operands:	IFF
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|0|0|1|1| F3
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	++m_PC;
+	m_State.m_IFF1 = 0;
+	m_State.m_IFF2 = 0;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDECIXh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementEI(void)
 {
-	sprintf(pMnemonic, "DEC IXh");
-	address += 2;
+	//
+	// Operation:	IFF <- 1
+	// Op Code:		DI
+	// Operands:	IFF
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|0|1|1| FB
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	++m_PC;
+	m_State.m_IFF1 = 1;
+	m_State.m_IFF2 = 1;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDECIXl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementIM0(void)
 {
-	sprintf(pMnemonic, "DEC IXl");
-	address += 2;
+	//
+	// Operation:	---
+	// Op Code:		IM
+	// Operands:	0
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|0|0|0|1|1|0| 46
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_State.m_InterruptMode = 0;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDECIYh(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementIM1(void)
 {
-	sprintf(pMnemonic, "DEC IYh");
-	address += 2;
+	//
+	// Operation:	---
+	// Op Code:		IM
+	// Operands:	1
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|0|1|0|1|1|0| 56
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_State.m_InterruptMode = 1;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDECIYl(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementIM2(void)
 {
-	sprintf(pMnemonic, "DEC IYl");
-	address += 2;
+	//
+	// Operation:	---
+	// Op Code:		IM
+	// Operands:	2
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|0|1|1|1|1|0| 5E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00
+	//
+	++++m_PC;
+	m_State.m_InterruptMode = 2;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDEC_IXd_(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "DEC (IX+%02X)", ReadMemory(address + 2));
-	address += 3;
-}
+//-----------------------------------------------------------------------------
+//	16-Bit Arithmetic Group
+//-----------------------------------------------------------------------------
 
 //=============================================================================
 
-void CZ80::DecodeDEC_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDHLdd(void)
 {
-	sprintf(pMnemonic, "DEC (IY+%02X)", ReadMemory(address + 2));
-	address += 3;
+	//
+	// Operation:	HL <- HL+dd
+	// Op Code:		ADD
+	// Operands:	HL, dd
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|d|d|0|1|0|1|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								SP					11
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						11 (4,4,3)				2.75
+	//
+	uint8 origF = m_F;
+	m_MEMPTR = m_HL + 1;
+	m_HL = Handle16BitArithmeticAddFlags(m_HL, REGISTER_16BIT(ReadMemory(m_PC++) >> 4), false);
+	m_F &= ~(eF_S | eF_Z | eF_PV);
+	m_F |= (origF & (eF_S | eF_Z | eF_PV));
+	return 11;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	General-Purpose Arithmetic and CPU Control Groups
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-void CZ80::DecodeDAA(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADCHLdd(void)
 {
-	sprintf(pMnemonic, "DAA");
-	++address;
+	//
+	// Operation:	HL <- HL+dd+C
+	// Op Code:		ADC
+	// Operands:	HL, dd
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|d|d|1|0|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								AF					11
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75
+	//
+	++m_PC;
+	m_MEMPTR = m_HL + 1;
+	m_HL = Handle16BitArithmeticAddFlags(m_HL, REGISTER_16BIT(ReadMemory(m_PC++) >> 4), true);
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCPL(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSBCHLdd(void)
 {
-	sprintf(pMnemonic, "CPL");
-	++address;
+	//
+	// Operation:	HL <- HL-dd-C
+	// Op Code:		SBC
+	// Operands:	HL, dd
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|d|d|0|0|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								AF					11
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75
+	//
+	++m_PC;
+	m_MEMPTR = m_HL + 1;
+	m_HL = Handle16BitArithmeticSubtractFlags(m_HL, REGISTER_16BIT(ReadMemory(m_PC++) >> 4), true);
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeNEG(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDIXdd(void)
 {
-	sprintf(pMnemonic, "NEG");
-	address += 2;
+	//
+	// Operation:	IX <- IX+dd
+	// Op Code:		ADD
+	// Operands:	IX, dd
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|d|d|1|0|0|1|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								IX					10
+	//								AF					11
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						15 (4,4,4,3)			3.75
+	//
+	uint8 opcode = ReadMemory(++m_PC) >> 4;
+	++m_PC;
+	uint16 source = (opcode == 2) ? m_IX : REGISTER_16BIT(opcode);
+	uint8 origF = m_F;
+	m_MEMPTR = m_IX + 1;
+	m_IX = Handle16BitArithmeticAddFlags(m_IX, source, false);
+	m_F &= ~(eF_S | eF_Z | eF_PV);
+	m_F |= (origF & (eF_S | eF_Z | eF_PV));
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCCF(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementADDIYdd(void)
 {
-	sprintf(pMnemonic, "CCF");
-	++address;
+	//
+	// Operation:	IY <- IY+dd
+	// Op Code:		ADD
+	// Operands:	IY, dd
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|d|d|1|0|0|1|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								IY					10
+	//								AF					11
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						15 (4,4,4,3)			3.75
+	//
+	uint8 opcode = ReadMemory(++m_PC) >> 4;
+	++m_PC;
+	uint16 source = (opcode == 2) ? m_IY : REGISTER_16BIT(opcode);
+	uint8 origF = m_F;
+	m_MEMPTR = m_IY + 1;
+	m_IY = Handle16BitArithmeticAddFlags(m_IY, source, false);
+	m_F &= ~(eF_S | eF_Z | eF_PV);
+	m_F |= (origF & (eF_S | eF_Z | eF_PV));
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSCF(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINCdd(void)
 {
-	sprintf(pMnemonic, "SCF");
-	++address;
+	//
+	// Operation:	dd <- dd+1
+	// Op Code:		INC
+	// Operands:	dd
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|d|d|0|0|1|1|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where dd is any of:
+	//								BC					00
+	//								DE					01
+	//								HL					10
+	//								SP					11
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						6									1.50
+	//
+	++REGISTER_16BIT(ReadMemory(m_PC++) >> 4);
+	return 6;
 }
 
 //=============================================================================
 
-void CZ80::DecodeNOP(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINCIX(void)
 {
-	sprintf(pMnemonic, "NOP");
-	++address;
+	//
+	// Operation:	IX <- IX+1
+	// Op Code:		INC
+	// Operands:	IX
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|0|1|1| 23
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						10 (4,6)					2.50
+	//
+	++++m_PC;
+	++m_IX;
+	return 10;
 }
 
 //=============================================================================
 
-void CZ80::DecodeHALT(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINCIY(void)
 {
-	sprintf(pMnemonic, "HALT");
-	++address;
+	//
+	// Operation:	IY <- IY+1
+	// Op Code:		INC
+	// Operands:	IY
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|0|1|1| 23
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						10 (4,6)					2.50
+	//
+	++++m_PC;
+	++m_IY;
+	return 10;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDI(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDECdd(void)
 {
-	sprintf(pMnemonic, "DI");
-	++address;
+	//
+	// Operation:	dd <- dd-1
+	// Op Code:		DEC
+	// Operands:	dd
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|d|d|1|0|1|1|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						6									1.50
+	//
+	--REGISTER_16BIT(ReadMemory(m_PC++) >> 4);
+	return 6;
 }
 
 //=============================================================================
 
-void CZ80::DecodeEI(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDECIX(void)
 {
-	sprintf(pMnemonic, "EI");
-	++address;
+	//
+	// Operation:	IX <- IX-1
+	// Op Code:		DEC
+	// Operands:	IX
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|0|1|1| 2B
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						10 (4,6)					2.50
+	//
+	++++m_PC;
+	--m_IX;
+	return 10;
 }
 
 //=============================================================================
 
-void CZ80::DecodeIM0(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDECIY(void)
 {
-	sprintf(pMnemonic, "IM 0");
-	address += 2;
+	//
+	// Operation:	IY <- IY-1
+	// Op Code:		DEC
+	// Operands:	IY
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|0|1|1| 2B
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						10 (4,6)					2.50
+	//
+	++++m_PC;
+	--m_IY;
+	return 10;
 }
 
 //=============================================================================
 
-void CZ80::DecodeIM1(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "IM 1");
-	address += 2;
-}
+//-----------------------------------------------------------------------------
+//	Rotate and Shift Group
+//-----------------------------------------------------------------------------
 
 //=============================================================================
 
-void CZ80::DecodeIM2(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRLCA(void)
 {
-	sprintf(pMnemonic, "IM 2");
-	address += 2;
+	//
+	// Operation:	C <- 7<-0 A
+	//								 +--+
+	// Op Code:		RLCA
+	// Operands:	A
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|0|1|1|1| 07
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00	
+	//
+	++m_PC;
+	uint8 carry = (m_A & eF_S) >> 7;
+	m_A = (m_A << 1) | carry;
+	m_F &= (eF_S | eF_Z | eF_PV);
+	m_F |= (m_A & (eF_X | eF_Y)) | carry;
+	return 4;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	16-Bit Arithmetic Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-void CZ80::DecodeADDHLdd(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRLA(void)
 {
-	sprintf(pMnemonic, "ADD HL,%s", Get16BitRegisterString(ReadMemory(address++) >> 4));
+	//
+	// Operation:	C <- 7<-0 A
+	//						+-------+
+	// Op Code:		RLA
+	// Operands:	A
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|0|1|1|1| 07
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00	
+	//
+	++m_PC;
+	uint8 carry = (m_A & eF_S) >> 7;
+	m_A = (m_A << 1) | (m_F & eF_C);
+	m_F &= (eF_S | eF_Z | eF_PV);
+	m_F |= (m_A & (eF_X | eF_Y)) | carry;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADCHLdd(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRRCA(void)
 {
-	sprintf(pMnemonic, "ADC HL,%s", Get16BitRegisterString(ReadMemory(++address) >> 4));
-	++address;
+	//
+	// Operation:	A 7->0 -> C
+	//							+--+
+	// Op Code:		RRCA
+	// Operands:	A
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|1|1|1|1| 0F
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00	
+	//
+	++m_PC;
+	uint8 carry = (m_A & eF_C);
+	m_A = (m_A >> 1) | (carry << 7);
+	m_F &= (eF_S | eF_Z | eF_PV);
+	m_F |= (m_A & (eF_X | eF_Y)) | carry;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSBCHLdd(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRRA(void)
 {
-	sprintf(pMnemonic, "SBC HL,%s", Get16BitRegisterString(ReadMemory(++address) >> 4));
-	++address;
+	//
+	// Operation:	A 7->0 -> C
+	//							+-------+
+	// Op Code:		RRCA
+	// Operands:	A
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|1|1|1|1| 1F
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00	
+	//
+	++m_PC;
+	uint8 carry = (m_A & eF_C);
+	m_A = (m_A >> 1) | ((m_F & eF_C) << 7);
+	m_F &= (eF_S | eF_Z | eF_PV);
+	m_F |= (m_A & (eF_X | eF_Y)) | carry;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDIXdd(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRLCr(void)
 {
-	uint8 opcode = ReadMemory(++address) >> 4;
-	sprintf(pMnemonic, "ADD IX,%s", (opcode == 2) ? "IX" : Get16BitRegisterString(ReadMemory(address) >> 4));
-	++address;
+	//
+	// Operation:	C <- 7<-0 r
+	//								 +--+
+	// Op Code:		RLC
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00	
+	//
+	++m_PC;
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	uint8 carry = (reg & eF_S) >> 7;
+	reg = (reg << 1) | carry;
+	HandleLogicalFlags(reg);
+	m_F |= carry;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeADDIYdd(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRLC_HL_(void)
 {
-	uint8 opcode = ReadMemory(++address) >> 4;
-	sprintf(pMnemonic, "ADD IY,%s", (opcode == 2) ? "IY" : Get16BitRegisterString(ReadMemory(address) >> 4));
-	++address;
+	//
+	// Operation:	C <- 7<-0 (HL)
+	//								 +--+
+	// Op Code:		RLC
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|0|1|1|0| 06
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75	
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | carry;
+	WriteMemory(m_HL, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINCdd(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRLC_IXd_(void)
 {
-	sprintf(pMnemonic, "INC %s", Get16BitRegisterString(ReadMemory(address++) >> 4));
+	//
+	// Operation:	C <- 7<-0 (IX+d)
+	//								 +--+
+	// Op Code:		RLC
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|0|1|1|0| 06
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75	
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | carry;
+	WriteMemory(m_IX + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINCIX(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRLC_IYd_(void)
 {
-	sprintf(pMnemonic, "INC IX");
-	address += 2;
+	//
+	// Operation:	C <- 7<-0 (IY+d)
+	//								 +--+
+	// Op Code:		RLC
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|0|1|1|0| 06
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75	
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | carry;
+	WriteMemory(m_IY + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINCIY(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRLr(void)
 {
-	sprintf(pMnemonic, "INC IY");
-	address += 2;
+	//
+	// Operation:	C <- 7<-0 r
+	//						+-------+
+	// Op Code:		RL
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00	
+	//
+	++m_PC;
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	uint8 carry = (reg & eF_S) >> 7;
+	reg = (reg << 1) | (m_F & eF_C);
+	HandleLogicalFlags(reg);
+	m_F |= carry;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDECdd(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRL_HL_(void)
 {
-	sprintf(pMnemonic, "DEC %s", Get16BitRegisterString(ReadMemory(address++) >> 4));
+	//
+	// Operation:	C <- 7<-0 (HL)
+	//						+-------+
+	// Op Code:		RL
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|0|1|1|0| 16
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75	
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | (m_F & eF_C);
+	WriteMemory(m_HL, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDECIX(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRL_IXd_(void)
 {
-	sprintf(pMnemonic, "DEC IX");
-	address += 2;
+	//
+	// Operation:	C <- 7<-0 (IX+d)
+	//						+-------+
+	// Op Code:		RL
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|0|1|1|0| 16
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | (m_F & eF_C);
+	WriteMemory(m_IX + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDECIY(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRL_IYd_(void)
 {
-	sprintf(pMnemonic, "DEC IY");
-	address += 2;
+	//
+	// Operation:	C <- 7<-0 (IY+d)
+	//						+-------+
+	// Op Code:		RL
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|0|1|1|0| 16
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | (m_F & eF_C);
+	WriteMemory(m_IY + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	Rotate and Shift Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-void CZ80::DecodeRLCA(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRRCr(void)
 {
-	sprintf(pMnemonic, "RLCA");
-	address += 1;
+	//
+	// Operation:	r 7->0 -> C
+	//						  +--+
+	// Op Code:		RRC
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|1|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00	
+	//
+	++m_PC;
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	uint8 carry = (reg & eF_C);
+	reg = (reg >> 1) | (carry << 7);
+	HandleLogicalFlags(reg);
+	m_F |= carry;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRLA(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRRC_HL_(void)
 {
-	sprintf(pMnemonic, "RLA");
-	address += 1;
+	//
+	// Operation:	(HL) 7->0 -> C
+	//								 +--+
+	// Op Code:		RRC
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|1|1|1|0| 0E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75	
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | (carry << 7);
+	WriteMemory(m_HL, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRRCA(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRRC_IXd_(void)
 {
-	sprintf(pMnemonic, "RRCA");
-	address += 1;
+	//
+	// Operation:	(IX+d) 7->0 -> C
+	//									 +--+
+	// Op Code:		RRC
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|1|1|1|0| 0E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75	
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | (carry << 7);
+	WriteMemory(m_IX + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRRA(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRRC_IYd_(void)
 {
-	sprintf(pMnemonic, "RRA");
-	address += 1;
+	//
+	// Operation:	(IY+d) 7->0 -> C
+	//									 +--+
+	// Op Code:		RRC
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|0|1|1|1|0| 0E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | (carry << 7);
+	WriteMemory(m_IY + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRLCr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRRr(void)
 {
-	sprintf(pMnemonic, "RLC %s", Get8BitRegisterString(ReadMemory(++address)));
-	++address;
+	//
+	// Operation:	r 7->0 -> C
+	//						  +-------+
+	// Op Code:		RR
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|1|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00	
+	//
+	++m_PC;
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	uint8 carry = (reg & eF_C);
+	reg = (reg >> 1) | ((m_F & eF_C) << 7);
+	HandleLogicalFlags(reg);
+	m_F |= carry;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRLC_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRR_HL_(void)
 {
-	sprintf(pMnemonic, "RLC (IX+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	(HL) 7->0 -> C
+	//								 +-------+
+	// Op Code:		RR
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|1|1|1|0| 1E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75	
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | ((m_F & eF_C) << 7);
+	WriteMemory(m_HL, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRLC_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRR_IXd_(void)
 {
-	sprintf(pMnemonic, "RLC (IY+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	(IX+d) 7->0 -> C
+	//									 +-------+
+	// Op Code:		RR
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|1|1|1|0| 1E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75	
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | ((m_F & eF_C) << 7);
+	WriteMemory(m_IX + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRLr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRR_IYd_(void)
 {
-	sprintf(pMnemonic, "RL %s", Get8BitRegisterString(ReadMemory(++address)));
-	++address;
+	//
+	// Operation:	(IY+d) 7->0 -> C
+	//									 +-------+
+	// Op Code:		RR
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|1|1|1|0| 1E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75	
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | ((m_F & eF_C) << 7);
+	WriteMemory(m_IY + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRL_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSLAr(void)
 {
-	sprintf(pMnemonic, "RL (IX+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	C <- 7<-0 r
+	// Op Code:		SLA
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00	
+	//
+	++m_PC;
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	uint8 carry = (reg & eF_S) >> 7;
+	reg = (reg << 1);
+	HandleLogicalFlags(reg);
+	m_F |= carry;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRL_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSLA_HL_(void)
 {
-	sprintf(pMnemonic, "RL (IY+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	C <- 7<-0 (HL)
+	// Op Code:		SLA
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|1|1|0| 26
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75	
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1);
+	WriteMemory(m_HL, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRRCr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSLA_IXd_(void)
 {
-	sprintf(pMnemonic, "RRC %s", Get8BitRegisterString(ReadMemory(++address)));
-	++address;
+	//
+	// Operation:	C <- 7<-0 (IX+d)
+	// Op Code:		SLA
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|1|1|0| 26
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1);
+	WriteMemory(m_IX + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRRC_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSLA_IYd_(void)
 {
-	sprintf(pMnemonic, "RRC (IX+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	C <- 7<-0 (IY+d)
+	// Op Code:		SLA
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|1|1|0| 26
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1);
+	WriteMemory(m_IY + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRRC_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSRAr(void)
 {
-	sprintf(pMnemonic, "RRC (IY+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	r 7->0 -> C
+	//							++
+	// Op Code:		SRA
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00	
+	//
+	++m_PC;
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	uint8 sign = (reg & eF_S);
+	uint8 carry = (reg & eF_C);
+	reg = (reg >> 1) | sign;
+	HandleLogicalFlags(reg);
+	m_F |= carry;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRRr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSRA_HL_(void)
 {
-	sprintf(pMnemonic, "RR %s", Get8BitRegisterString(ReadMemory(++address)));
-	++address;
+	//
+	// Operation:	(HL) 7->0 -> C
+	//								 ++
+	// Op Code:		SRA
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|1|1|0| 2E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75	
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 sign = (byte & eF_S);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | sign;
+	WriteMemory(m_HL, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRR_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSRA_IXd_(void)
 {
-	sprintf(pMnemonic, "RR (IX+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	(IX+d) 7->0 -> C
+	//									 ++
+	// Op Code:		SRA
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|1|1|0| 2E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 sign = (byte & eF_S);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | sign;
+	WriteMemory(m_IX + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRR_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSRA_IYd_(void)
 {
-	sprintf(pMnemonic, "RR (IY+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	(IY+d) 7->0 -> C
+	//									 ++
+	// Op Code:		SRA
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|1|1|0| 2E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 sign = (byte & eF_S);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1) | sign;
+	WriteMemory(m_IY + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSLAr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSLLr(void)
 {
-	sprintf(pMnemonic, "SLA %s", Get8BitRegisterString(ReadMemory(++address)));
-	++address;
+	//
+	// Operation:	C <- 7<-0 r
+	// Op Code:		SLL
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00	
+	//
+	++m_PC;
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	uint8 carry = (reg & eF_S) >> 7;
+	reg = (reg << 1) | 0x01;
+	HandleLogicalFlags(reg);
+	m_F |= carry;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSLA_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSLL_HL_(void)
 {
-	sprintf(pMnemonic, "SLA (IX+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	C <- 7<-0 (HL)
+	// Op Code:		SLL
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|1|0| 36
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75	
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | 0x01;
+	WriteMemory(m_HL, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSLA_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSLL_IXd_(void)
 {
-	sprintf(pMnemonic, "SLA (IY+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	C <- 7<-0 (IX+d)
+	// Op Code:		SLL
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|1|0| 36
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | 0x01;
+	WriteMemory(m_IX + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSRAr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSLL_IYd_(void)
 {
-	sprintf(pMnemonic, "SRA %s", Get8BitRegisterString(ReadMemory(++address)));
-	++address;
+	//
+	// Operation:	C <- 7<-0 (IY+d)
+	// Op Code:		SLL
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|1|1|0| 36
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 carry = (byte & eF_S) >> 7;
+	byte = (byte << 1) | 0x01;
+	WriteMemory(m_IY + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSRA_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSRLr(void)
 {
-	sprintf(pMnemonic, "SRA (IX+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	0 -> r 7->0 -> C
+	// Op Code:		SRL
+	// Operands:	r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|1|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8	(4,4)						2.00	
+	//
+	++m_PC;
+	uint8& reg = REGISTER_8BIT(ReadMemory(m_PC++));
+	uint8 carry = (reg & eF_C);
+	reg = (reg >> 1);
+	HandleLogicalFlags(reg);
+	m_F |= carry;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSRA_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSRL_HL_(void)
 {
-	sprintf(pMnemonic, "SRA (IY+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	0 -> (HL) 7->0 -> C
+	// Op Code:		SRL
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|1|1|1|0| 3E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						15 (4,4,4,3)			3.75	
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1);
+	WriteMemory(m_HL, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	return 15;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSLLr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSRL_IXd_(void)
 {
-	sprintf(pMnemonic, "SLL %s", Get8BitRegisterString(ReadMemory(++address)));
-	++address;
+	//
+	// Operation:	0 -> (IX+d) 7->0 -> C
+	//									 ++
+	// Op Code:		SRL
+	// Operands:	(IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|1|1|1|0| 3E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1);
+	WriteMemory(m_IX + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSLL_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSRL_IYd_(void)
 {
-	sprintf(pMnemonic, "SLL (IX+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	0 -> (IY+d) 7->0 -> C
+	// Op Code:		SRL
+	// Operands:	(IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|1|1|1|0| 3E
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								6						23 (4,4,3,5,4,3)	5.75
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 carry = (byte & eF_C);
+	byte = (byte >> 1);
+	WriteMemory(m_IY + displacement, byte);
+	HandleLogicalFlags(byte);
+	m_F |= carry;
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 23;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSLL_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRLD(void)
 {
-	sprintf(pMnemonic, "SLL (IY+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	//										+----->-----+
+	// Operation:	A 7-4 3-0 (HL) 7-4 3-0
+	//										+---<--+ +<-+
+	// Op Code:		RLD
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|1|0|1|1|1|1| 6F
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						18 (4,4,3,4,3)		3.75
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 origA = m_A;
+	m_A = (m_A & 0xF0) | ((byte & 0xF0) >> 4);
+	byte = (byte << 4) | (origA & 0x0F);
+	WriteMemory(m_HL, byte);
+	m_MEMPTR = m_HL + 1;
+	uint8 origF = m_F;
+	HandleLogicalFlags(m_A);
+	m_F |= (origF & eF_C);
+	return 18;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSRLr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRRD(void)
 {
-	sprintf(pMnemonic, "SRL %s", Get8BitRegisterString(ReadMemory(++address)));
-	++address;
+	//
+	//										+--->--+ +->+
+	// Operation:	A 7-4 3-0 (HL) 7-4 3-0
+	//										+-----<-----+
+	// Op Code:		RRD
+	// Operands:	A, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|1|0|0|1|1|1| 67
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						18 (4,4,3,4,3)		3.75
+	//
+	++++m_PC;
+	uint8 byte = ReadMemory(m_HL);
+	uint8 origA = m_A;
+	m_A = (m_A & 0xF0) | (byte & 0x0F);
+	byte = ((origA & 0x0F) << 4) | (byte >> 4);
+	WriteMemory(m_HL, byte);
+	m_MEMPTR = m_HL + 1;
+	uint8 origF = m_F;
+	HandleLogicalFlags(m_A);
+	m_F |= (origF & eF_C);
+	return 18;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSRL_IXd_(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "SRL (IX+%02X)", ReadMemory(address + 2));
-	address += 4;
-}
+//-----------------------------------------------------------------------------
+//	Bit Set, Reset and Test Group
+//-----------------------------------------------------------------------------
 
 //=============================================================================
 
-void CZ80::DecodeSRL_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementBITbr(void)
 {
-	sprintf(pMnemonic, "SRL (IY+%02X)", ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	Z <- rb
+	// Op Code:		BIT
+	// Operands:	b, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|b|b|b|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8 (4,4)						2.00
+	//
+	uint8 opcode = ReadMemory(++m_PC);
+	++m_PC;
+	uint8 mask = 1 << ((opcode & 0x38) >> 3);
+	uint8 byte = REGISTER_8BIT(opcode);
+	uint8 origF = m_F;
+	HandleLogicalFlags(byte & mask);
+	m_F |= (eF_H | (origF & eF_C));
+	// X and Y come from the whole register, not just the bit tested
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= (byte & (eF_Y | eF_X));
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRLD(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementBITb_HL_(void)
 {
-	sprintf(pMnemonic, "RLD");
-	address += 2;
+	//
+	// Operation:	Z <- (HL)b
+	// Op Code:		BIT
+	// Operands:	b, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						12 (4,4,4)				3.00
+	//
+	++m_PC;
+	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_HL);
+	uint8 origF = m_F;
+	HandleLogicalFlags(byte & mask);
+	m_F |= (eF_H | (origF & eF_C));
+	// X and Y come from the high byte of MEMPTR
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= ((m_MEMPTR >> 8) & (eF_Y | eF_X));
+	return 12;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRRD(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementBITb_IXd_(void)
 {
-	sprintf(pMnemonic, "RRD");
-	address += 2;
+	//
+	// Operation:	Z <- (IX+d)b
+	// Op Code:		BIT
+	// Operands:	b, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						20 (4,4,3,5,4)		5.00
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	uint8 origF = m_F;
+	HandleLogicalFlags(byte & mask);
+	m_F |= (eF_H | (origF & eF_C));
+	// From The Undocumented Z80:
+	uint8 temp = (m_IX + displacement) >> 8;
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= (temp & (eF_Y | eF_X));
+	return 20;
 }
 
 //=============================================================================
 
-//-----------------------------------------------------------------------------
-//	Bit Set, Reset and Test Group
-//-----------------------------------------------------------------------------
-
-//=============================================================================
-
-void CZ80::DecodeBITbr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementBITb_IYd_(void)
 {
-	sprintf(pMnemonic, "BIT %d,%s", (ReadMemory(address + 1) >> 3) & 0x07, Get8BitRegisterString(ReadMemory(address + 1)));
-	address += 2;
+	//
+	// Operation:	Z <- (IX+d)b
+	// Op Code:		BIT
+	// Operands:	b, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						20 (4,4,3,5,4)		5.00
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	uint8 origF = m_F;
+	HandleLogicalFlags(byte & mask);
+	m_F |= (eF_H | (origF & eF_C));
+	// From The Undocumented Z80:
+	uint8 temp = (m_IY + displacement) >> 8;
+	m_F &= ~(eF_Y | eF_X);
+	m_F |= (temp & (eF_Y | eF_X));
+	return 20;
 }
 
 //=============================================================================
 
-void CZ80::DecodeBITb_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSETbr(void)
 {
-	sprintf(pMnemonic, "BIT %d,(IX+%02X)", (ReadMemory(address + 3) >> 3) & 0x07, ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	rb <- 1
+	// Op Code:		SET
+	// Operands:	b, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|b|b|b|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8 (4,4)						2.00
+	//
+	uint8 opcode = ReadMemory(++m_PC);
+	++m_PC;
+	uint8 mask = 1 << ((opcode & 0x38) >> 3);
+	uint8& reg = REGISTER_8BIT(opcode);
+	reg |= mask;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeBITb_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSETb_HL_(void)
 {
-	sprintf(pMnemonic, "BIT %d,(IY+%02X)", (ReadMemory(address + 3) >> 3) & 0x07, ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	(HL) <- 1
+	// Op Code:		SET
+	// Operands:	b, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						12 (4,4,4)				3.00
+	//
+	++m_PC;
+	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_HL);
+	byte |= mask;
+	WriteMemory(m_HL, byte);
+	return 12;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSETbr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSETb_IXd_(void)
 {
-	sprintf(pMnemonic, "SET %d,%s", (ReadMemory(address + 1) >> 3) & 0x07, Get8BitRegisterString(ReadMemory(address + 1)));
-	address += 2;
+	//
+	// Operation:	(IX+d)b <- 1
+	// Op Code:		SET
+	// Operands:	b, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						20 (4,4,3,5,4)		5.00
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 mask = 1 << ((opcode & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	byte |= mask;
+	WriteMemory(m_IX + displacement, byte);
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 20;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSETb_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementSETb_IYd_(void)
 {
-	sprintf(pMnemonic, "SET %d,(IX+%02X)", (ReadMemory(address + 3) >> 3) & 0x07, ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	(IY+d)b <- 1
+	// Op Code:		SET
+	// Operands:	b, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						20 (4,4,3,5,4)		5.00
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 mask = 1 << ((opcode & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	byte |= mask;
+	WriteMemory(m_IY + displacement, byte);
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 20;
 }
 
 //=============================================================================
 
-void CZ80::DecodeSETb_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRESbr(void)
 {
-	sprintf(pMnemonic, "SET %d,(IY+%02X)", (ReadMemory(address + 3) >> 3) & 0x07, ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	rb <- 1
+	// Op Code:		RES
+	// Operands:	b, r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|b|b|b|r|r|r|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//								A						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8 (4,4)						2.00
+	//
+	uint8 opcode = ReadMemory(++m_PC);
+	++m_PC;
+	uint8 mask = 1 << ((opcode & 0x38) >> 3);
+	uint8& reg = REGISTER_8BIT(opcode);
+	reg &= ~mask;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRESbr(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRESb_HL_(void)
 {
-	sprintf(pMnemonic, "RES %d,%s", (ReadMemory(address + 1) >> 3) & 0x07, Get8BitRegisterString(ReadMemory(address + 1)));
-	address += 2;
+	//
+	// Operation:	(HL) <- 1
+	// Op Code:		RES
+	// Operands:	b, (HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						12 (4,4,4)				3.00
+	//
+	++m_PC;
+	uint8 mask = 1 << ((ReadMemory(m_PC++) & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_HL);
+	byte &= ~mask;
+	WriteMemory(m_HL, byte);
+	return 12;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRESb_IXd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRESb_IXd_(void)
 {
-	sprintf(pMnemonic, "RES %d,(IX+%02X)", (ReadMemory(address + 3) >> 3) & 0x07, ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	(IX+d)b <- 1
+	// Op Code:		RES
+	// Operands:	b, (IX+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						20 (4,4,3,5,4)		5.00
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IX + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 mask = 1 << ((opcode & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_IX + displacement);
+	byte &= ~mask;
+	WriteMemory(m_IX + displacement, byte);
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 20;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRESb_IYd_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRESb_IYd_(void)
 {
-	sprintf(pMnemonic, "RES %d,(IY+%02X)", (ReadMemory(address + 3) >> 3) & 0x07, ReadMemory(address + 2));
-	address += 4;
+	//
+	// Operation:	(IY+d)b <- 1
+	// Op Code:		RES
+	// Operands:	b, (IY+d)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|1|1| CB
+	//						+-+-+-+-+-+-+-+-+
+	//						|d|d|d|d|d|d|d|d|
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|b|b|b|1|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						20 (4,4,3,5,4)		5.00
+	//
+	++++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_MEMPTR = m_IY + displacement;
+	uint8 opcode = ReadMemory(m_PC++);
+	uint8 mask = 1 << ((opcode & 0x38) >> 3);
+	uint8 byte = ReadMemory(m_IY + displacement);
+	byte &= ~mask;
+	WriteMemory(m_IY + displacement, byte);
+	// From The Undocumented Z80:
+	if ((opcode & 0x07) != 0x06)
+	{
+		REGISTER_8BIT(opcode) = byte;	
+	}
+	return 20;
 }
 
 //=============================================================================
@@ -14058,117 +8057,306 @@ void CZ80::DecodeRESb_IYd_(uint16& address, char* pMnemonic) const
 
 //=============================================================================
 
-void CZ80::DecodeJPnn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJPnn(void)
 {
-	uint16 addr = ReadMemory(address + 1) + (static_cast<int16>(ReadMemory(address + 2)) << 8);
-	address += 3;
-	sprintf(pMnemonic, "JP %04X", addr);
+	//
+	// Operation:	PC <- nn
+	// Op Code:		JP
+	// Operands:	nn
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|0|0|1|1| C3
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						10 (4,3,3)				2.50
+	//
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = ReadMemory(++m_PC);
+	m_PC = m_address;
+	m_MEMPTR = m_address;
+	return 10;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJPccnn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJPccnn(void)
 {
-	uint8 cc = (ReadMemory(address++) & 0x38) >> 3;
-	uint16 addr = ReadMemory(address) + (static_cast<int16>(ReadMemory(address + 1)) << 8);
-	address += 2;
-	sprintf(pMnemonic, "JP %s,%04X", GetConditionString(cc), addr);
+	//
+	// Operation:	If cc true, PC <- nn
+	// Op Code:		JP
+	// Operands:	cc, nn
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|c|c|c|0|1|0|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where ccc is any of:
+	//								NZ					000
+	//								Z						001
+	//								NC					010
+	//								C						011
+	//								PO					100
+	//								PE					101
+	//								P						101
+	//								M						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						10 (4,3,3)				2.50
+	//
+	uint8 opcode = ReadMemory(m_PC++);
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	m_MEMPTR = m_address;
+	if (IsConditionTrue((opcode & 0x38) >> 3))
+	{
+		m_PC = m_address;
+	}
+	return 10;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJRe(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJRe(void)
 {
-	address += 2;
-#if defined(LEE_COMPATIBLE)
-	sprintf(pMnemonic, "JR %02X", ReadMemory(address - 1));
-#else
-	sprintf(pMnemonic, "JR %04X", address + static_cast<int8>(ReadMemory(address - 1)));
-#endif
+	//
+	// Operation:	PC <- PC + e
+	// Op Code:		JR
+	// Operands:	e
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|1|0|0|0| 18
+	//						+-+-+-+-+-+-+-+-+
+	//						|e|e|e|e|e|e|e|e| e-2
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						12 (4,3,5)				3.00
+	//
+	++m_PC;
+	int8 displacement = static_cast<int8>(ReadMemory(m_PC++));
+	m_PC += displacement;
+	m_MEMPTR = m_PC;
+	return 12;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJRCe(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJRCe(void)
 {
-	address += 2;
-#if defined(LEE_COMPATIBLE)
-	sprintf(pMnemonic, "JR C,%02X", ReadMemory(address - 1));
-#else
-	sprintf(pMnemonic, "JR C,%04X", address + static_cast<int8>(ReadMemory(address - 1)));
-#endif
+	//
+	// Operation: if C == 0, continue
+	//						if C == 1, PC <- PC + e
+	// Op Code:		JR
+	// Operands:	C, e
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|1|0|0|0| 38
+	//						+-+-+-+-+-+-+-+-+
+	//						|e|e|e|e|e|e|e|e| e-2
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7 (4,3)						1.75		C == 0
+	//								3						12 (4,3,5)				3.00		C == 1
+	//
+	uint32 tstates = 7;
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	++m_PC;
+	if (m_F & eF_C)
+	{
+		m_PC += displacement;
+		m_MEMPTR = m_PC;
+		tstates += 5;
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJRNCe(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJRNCe(void)
 {
-	address += 2;
-#if defined(LEE_COMPATIBLE)
-	sprintf(pMnemonic, "JR NC,%02X", ReadMemory(address - 1));
-#else
-	sprintf(pMnemonic, "JR NC,%04X", address + static_cast<int8>(ReadMemory(address - 1)));
-#endif
+	//
+	// Operation: if C == 1, continue
+	//						if C == 0, PC <- PC + e
+	// Op Code:		JR
+	// Operands:	C, e
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|1|0|0|0|0| 30
+	//						+-+-+-+-+-+-+-+-+
+	//						|e|e|e|e|e|e|e|e| e-2
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7 (4,3)						1.75		C == 1
+	//								3						12 (4,3,5)				3.00		C == 0
+	//
+	uint32 tstates = 7;
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	++m_PC;
+	if (!(m_F & eF_C))
+	{
+		m_PC += displacement;
+		m_MEMPTR = m_PC;
+		tstates += 5;
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJRZe(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJRZe(void)
 {
-	address += 2;
-#if defined(LEE_COMPATIBLE)
-	sprintf(pMnemonic, "JR Z,%02X", ReadMemory(address - 1));
-#else
-	sprintf(pMnemonic, "JR Z,%04X", address + static_cast<int8>(ReadMemory(address - 1)));
-#endif
+	//
+	// Operation: if Z == 0, continue
+	//						if Z == 1, PC <- PC + e
+	// Op Code:		JR
+	// Operands:	Z, e
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|1|0|0|0| 28
+	//						+-+-+-+-+-+-+-+-+
+	//						|e|e|e|e|e|e|e|e| e-2
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7 (4,3)						1.75		Z == 0
+	//								3						12 (4,3,5)				3.00		Z == 1
+	//
+	uint32 tstates = 7;
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	++m_PC;
+	if (m_F & eF_Z)
+	{
+		m_PC += displacement;
+		m_MEMPTR = m_PC;
+		tstates += 5;
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJRNZe(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJRNZe(void)
 {
-	address += 2;
-#if defined(LEE_COMPATIBLE)
-	sprintf(pMnemonic, "JR NZ,%02X", ReadMemory(address - 1));
-#else
-	sprintf(pMnemonic, "JR NZ,%04X", address + static_cast<int8>(ReadMemory(address - 1)));
-#endif
+	//
+	// Operation: if Z == 1, continue
+	//						if Z == 0, PC <- PC + e
+	// Op Code:		JR
+	// Operands:	Z, e
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|1|0|0|0|0|0| 20
+	//						+-+-+-+-+-+-+-+-+
+	//						|e|e|e|e|e|e|e|e| e-2
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						7 (4,3)						1.75		Z == 1
+	//								3						12 (4,3,5)				3.00		Z == 0
+	//
+	uint32 tstates = 7;
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	++m_PC;
+	if (!(m_F & eF_Z))
+	{
+		m_PC += displacement;
+		m_MEMPTR = m_PC;
+		tstates += 5;
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJP_HL_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJP_HL_(void)
 {
-	sprintf(pMnemonic, "JP (HL)");
-	address += 1;
+	//
+	// Operation: PC <- HL
+	// Op Code:		JP
+	// Operands:	(HL)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|0|0|1| E9
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								1						4									1.00
+	//
+	m_PC = m_HL;
+	return 4;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJP_IX_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJP_IX_(void)
 {
-	sprintf(pMnemonic, "JP (IX)");
-	address += 2;
+	// Operation: PC <- IX
+	// Op Code:		JP
+	// Operands:	(IX)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|1|0|1| DD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|0|0|1| E9
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8 (4,4)						1.00
+	//
+	m_PC = m_IX;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeJP_IY_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementJP_IY_(void)
 {
-	sprintf(pMnemonic, "JP (IY)");
-	address += 2;
+	// Operation: PC <- IY
+	// Op Code:		JP
+	// Operands:	(IY)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|1|1|1|0|1| FD
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|0|0|1| E9
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8 (4,4)						1.00
+	//
+	m_PC = m_IY;
+	return 8;
 }
 
 //=============================================================================
 
-void CZ80::DecodeDJNZe(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementDJNZe(void)
 {
-	address += 2;
-#if defined(LEE_COMPATIBLE)
-	sprintf(pMnemonic, "DJNZ %02X", ReadMemory(address - 1));
-#else
-	sprintf(pMnemonic, "DJNZ %04X", address + static_cast<int8>(ReadMemory(address - 1)));
-#endif
+	//
+	// Operation: if (B - 1) == 0, continue
+	//						if (B - 1) != 0, PC <- PC + e
+	// Op Code:		DJNZ
+	// Operands:	B, e
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|0|0|1|0|0|0|0| 20
+	//						+-+-+-+-+-+-+-+-+
+	//						|e|e|e|e|e|e|e|e| e-2
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								2						8 (5,3)						2.00		B != 0
+	//								3						13 (5,3,5)				3.25		B == 0
+	//
+	uint32 tstates = 8;
+	int8 displacement = static_cast<int8>(ReadMemory(++m_PC));
+	++m_PC;
+	if (--m_B != 0)
+	{
+		m_PC += displacement;
+		m_MEMPTR = m_PC;
+		tstates += 5;
+	}
+	return tstates;
 }
 
 //=============================================================================
@@ -14179,61 +8367,238 @@ void CZ80::DecodeDJNZe(uint16& address, char* pMnemonic) const
 
 //=============================================================================
 
-void CZ80::DecodeCALLnn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCALLnn(void)
 {
-	uint16 addr = ReadMemory(address + 1) + (static_cast<int16>(ReadMemory(address + 2)) << 8);
-	sprintf(pMnemonic, "CALL %04X", addr);
-	address += 3;
+	//
+	// Operation: (SP - 1) <- PCH, (SP - 2) <- PCL, PC <- nn
+	// Op Code:		CALL
+	// Operands:	nn
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|1|0|1| CD
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						17 (4,3,4,3,3)		4.25
+	//
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = ReadMemory(++m_PC);
+	m_MEMPTR = m_address;
+	++m_PC;
+	WriteMemory(--m_SP, m_PCh);
+	WriteMemory(--m_SP, m_PCl);
+	m_PC = m_address;
+#if defined(Z80_CALL_PROFILER)
+	m_callProfiler.Call(m_PC, m_SP);
+#endif // defined(Z80_CALL_PROFILER)
+	return 17;
 }
 
 //=============================================================================
 
-void CZ80::DecodeCALLccnn(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementCALLccnn(void)
 {
-	uint8 cc = (ReadMemory(address) & 0x38) >> 3;
-	uint16 addr = ReadMemory(address + 1) + (static_cast<int16>(ReadMemory(address + 2)) << 8);
-	sprintf(pMnemonic, "CALL %s,%04X", GetConditionString(cc), addr);
-	address += 3;
+	//
+	// Operation: If cc true, (SP - 1) <- PCH, (SP - 2) <- PCL, PC <- nn
+	// Op Code:		CALL
+	// Operands:	nn
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|c|c|c|1|0|0|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where ccc is any of:
+	//								NZ					000
+	//								Z						001
+	//								NC					010
+	//								C						011
+	//								PO					100
+	//								PE					101
+	//								P						101
+	//								M						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						17 (4,3,4,3,3)		4.25	cc is true
+	//								3						10 (4,3,3)				2.50	cc is false
+	//
+	uint8 opcode = ReadMemory(m_PC++);
+	m_addresslo = ReadMemory(m_PC++);
+	m_addresshi = ReadMemory(m_PC++);
+	m_MEMPTR = m_address;
+	uint32 tstates = 10;
+	if (IsConditionTrue((opcode & 0x38) >> 3))
+	{
+		WriteMemory(--m_SP, m_PCh);
+		WriteMemory(--m_SP, m_PCl);
+		m_PC = m_address;
+		tstates += 7;
+#if defined(Z80_CALL_PROFILER)
+		m_callProfiler.Call(m_PC, m_SP);
+#endif // defined(Z80_CALL_PROFILER)
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRET(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRET(void)
 {
-	sprintf(pMnemonic, "RET");
-	++address;
+	//
+	// Operation: PCl <- (SP), PCh <- (SP + 1)
+	// Op Code:		RET
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|0|1|0|0|1| C9
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						10 (4,3,3)				2.50
+	//
+#if defined(Z80_CALL_PROFILER)
+	m_callProfiler.Return(m_SP);
+#endif // defined(Z80_CALL_PROFILER)
+	m_PCl = ReadMemory(m_SP++);
+	m_PCh = ReadMemory(m_SP++);
+	m_MEMPTR = m_PC;
+	return 10;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRETcc(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRETcc(void)
 {
-	uint8 cc = (ReadMemory(address++) & 0x38) >> 3;
-	sprintf(pMnemonic, "RET %s", GetConditionString(cc));
+	//
+	// Operation: If cc true, PCl <- (SP), PCh <- (SP + 1)
+	// Op Code:		RET
+	// Operands:	cc
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|c|c|c|0|0|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where ccc is any of:
+	//								NZ					000
+	//								Z						001
+	//								NC					010
+	//								C						011
+	//								PO					100
+	//								PE					101
+	//								P						101
+	//								M						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						11 (5,3,3)				2.75	cc is true
+	//								1						5									1.25	cc is false
+	//
+	uint32 tstates = 5;
+	if (IsConditionTrue((ReadMemory(m_PC++) & 0x38) >> 3))
+	{
+#if defined(Z80_CALL_PROFILER)
+		m_callProfiler.Return(m_SP);
+#endif // defined(Z80_CALL_PROFILER)
+		m_PCl = ReadMemory(m_SP++);
+		m_PCh = ReadMemory(m_SP++);
+		m_MEMPTR = m_PC;
+		tstates += 6;
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRETI(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRETI(void)
 {
-	sprintf(pMnemonic, "RETI");
-	address += 2;
+	//
+	// Operation:	Return from interrupt
+	// Op Code:		RETI
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|0|0|1|1|0|1| 4D
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						14 (4,4,3,3)			3.50
+	//
+#if defined(Z80_CALL_PROFILER)
+	m_callProfiler.Return(m_SP);
+#endif // defined(Z80_CALL_PROFILER)
+	m_PCl = ReadMemory(m_SP++);
+	m_PCh = ReadMemory(m_SP++);
+	m_MEMPTR = m_PC;
+	// From The Undocumented Z80:
+	m_State.m_IFF1 = m_State.m_IFF2;
+	return 14;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRETN(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRETN(void)
 {
-	sprintf(pMnemonic, "RETN");
-	address += 2;
+	//
+	// Operation:	Return from non-maskable interrupt
+	// Op Code:		RETN
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|0|0|0|1|0|1| 45
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						14 (4,4,3,3)			3.50
+	//
+#if defined(Z80_CALL_PROFILER)
+	m_callProfiler.Return(m_SP);
+#endif // defined(Z80_CALL_PROFILER)
+	m_PCl = ReadMemory(m_SP++);
+	m_PCh = ReadMemory(m_SP++);
+	m_MEMPTR = m_PC;
+	m_State.m_IFF1 = m_State.m_IFF2;
+	return 14;
 }
 
 //=============================================================================
 
-void CZ80::DecodeRSTp(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementRSTp(void)
 {
-	uint8 location = ((ReadMemory(address++) & 0x38) >> 3) * 8;
-	sprintf(pMnemonic, "RST $%02X", location);
+	//
+	// Operation:	(SP - 1) <- PCH, (SP - 2) <- PCL, PCH <- 0, PCL <- p
+	// Op Code:		RST
+	// Operands:	p
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|t|t|t|1|1|1|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//								p						 t
+	//							 00H					000
+	//							 08H					001
+	//							 10H					010
+	//							 18H					011
+	//							 20H					100
+	//							 28H					101
+	//							 30H					110
+	//							 38H					111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						11 (5,3,3)				2.75
+	//
+	uint8 opcode = ReadMemory(m_PC++);
+	WriteMemory(--m_SP, m_PCh);
+	WriteMemory(--m_SP, m_PCl);
+	m_PCh = 0;
+	m_PCl = 8 * ((opcode & 0x38) >> 3);
+	m_MEMPTR = m_PC;
+#if defined(Z80_CALL_PROFILER)
+	m_callProfiler.Call(m_PC, m_SP);
+#endif // defined(Z80_CALL_PROFILER)
+	return 11;
 }
 
 //=============================================================================
@@ -14244,102 +8609,387 @@ void CZ80::DecodeRSTp(uint16& address, char* pMnemonic) const
 
 //=============================================================================
 
-void CZ80::DecodeINA_n_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINA_n_(void)
+{
+	//
+	// Operation:	A <- (n)
+	// Op Code:		IN
+	// Operands:	A, (n)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|1|0|1|1| DB
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						11 (4,3,4)				2.75
+	//
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = m_A;
+	++m_PC;
+	m_A = ReadPort(m_address);
+	m_MEMPTR = m_address + 1;
+	return 11;
+}
+
+//=============================================================================
+
+uint32 CZ80::ImplementINr_C_(void)
 {
-	uint8 n = ReadMemory(address + 1);
-	sprintf(pMnemonic, "IN A,(%02X)", n);
-	address += 2;
+	//
+	// Operation:	r <- (C)
+	// Op Code:		IN
+	// Operands:	r, (C)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|0|1|1| EB
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|r|r|r|0|0|0|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//						Undefined				110
+	//								A						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						12 (4,4,4)				3.00
+	//
+	++m_PC;
+	m_addresslo = m_C;
+	m_addresshi = m_B;
+	REGISTER_8BIT(ReadMemory(m_PC++) >> 3) = ReadPort(m_address);
+	m_MEMPTR = m_address + 1;
+	return 12;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINr_C_(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINI(void)
 {
-	sprintf(pMnemonic, "IN %s,(C)", Get8BitRegisterString(ReadMemory(address + 1) >> 3));
-	address += 2;
+	//
+	// Operation:	(HL) <- (C), B <- B - 1, HL <- HL + 1
+	// Op Code:		INI
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|0|1|0| A2
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,5,3,4)			4.00
+	//
+	++++m_PC;
+	m_addresslo = m_C;
+	m_addresshi = m_B;
+	uint8 byte = ReadPort(m_address);
+	m_MEMPTR = m_address + 1;
+	WriteMemory(m_HL++, byte);
+	m_B = HandleArithmeticSubtractFlags(m_B, 1, false);
+	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
+	m_F |= ((byte >> 6) & eF_N);
+	uint16 k = byte + ((m_C + 0x01) & 0xFF);
+	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
+	k &= 0x07;
+	k ^= m_B;
+	uint8 parity = k;
+	parity ^= parity >> 4;
+	parity &= 0xF;
+	parity = ((0x6996 >> parity) << 2);
+	m_F |= (~parity & eF_PV);
+	return 16;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINI(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINIR(void)
 {
-	sprintf(pMnemonic, "INI");
-	address += 2;
+	//
+	// Operation:	(HL) <- (C), B <- B - 1, HL <- HL + 1
+	// Op Code:		INI
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|0|1|0| A2
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						21 (4,5,3,4,5)		5.25		B != 0
+	//								4						16 (4,5,3,4)			4.00		B == 0
+	//
+	uint32 tstates = ImplementINI();
+	if (m_B != 0)
+	{
+		tstates += 5;
+		----m_PC;
+		tstates += RepeatINxR(1);
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINIR(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementIND(void)
 {
-	sprintf(pMnemonic, "INIR");
-	address += 2;
+	//
+	// Operation:	(HL) <- (C), B <- B - 1, HL <- HL - 1
+	// Op Code:		IND
+	// Operands:	A, (n)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|0|1|0| AA
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,5,3,4)			4.00		B == 0
+	//
+	++++m_PC;
+	m_addresslo = m_C;
+	m_addresshi = m_B;
+	uint8 byte = ReadPort(m_address);
+	m_MEMPTR = m_address - 1;
+	WriteMemory(m_HL--, byte);
+	m_B = HandleArithmeticSubtractFlags(m_B, 1, false);
+	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
+	m_F |= ((byte >> 6) & eF_N);
+	uint16 k = byte + ((m_C - 0x01) & 0xFF);
+	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
+	k &= 0x07;
+	k ^= m_B;
+	uint8 parity = k;
+	parity ^= parity >> 4;
+	parity &= 0xF;
+	parity = ((0x6996 >> parity) << 2);
+	m_F |= (~parity & eF_PV);
+	return 16;
 }
 
 //=============================================================================
 
-void CZ80::DecodeIND(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementINDR(void)
 {
-	sprintf(pMnemonic, "IND");
-	address += 2;
+	//
+	// Operation:	(HL) <- (C), B <- B - 1, HL <- HL - 1
+	// Op Code:		INI
+	// Operands:	A, (n)
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|0|1|0| BA
+	//						+-+-+-+-+-+-+-+-+x
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						21 (4,5,3,4,5)		5.25		B != 0
+	//								4						16 (4,5,3,4)			4.00		B == 0
+	//
+	uint32 tstates = ImplementIND();
+	if (m_B != 0)
+	{
+		tstates += 5;
+		----m_PC;
+		tstates += RepeatINxR(-1);
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeINDR(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOUT_n_A(void)
 {
-	sprintf(pMnemonic, "INDR");
-	address += 2;
+	//
+	// Operation:	(n) <- A
+	// Op Code:		OUT
+	// Operands:	(n), A
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|0|1|0|0|1|1| D3
+	//						+-+-+-+-+-+-+-+-+
+	//						|n|n|n|n|n|n|n|n|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						11 (4,3,4)				2.75
+	//
+	m_addresslo = ReadMemory(++m_PC);
+	m_addresshi = m_A;
+	++m_PC;
+	WritePort(m_address, m_A);
+	m_MEMPTR = (m_A << 8) | ((m_address + 1) & 0xFF);
+	return 11;
 }
 
 //=============================================================================
 
-void CZ80::DecodeOUT_n_A(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOUT_C_r(void)
 {
-	uint8 n = ReadMemory(address + 1);
-	sprintf(pMnemonic, "OUT (%02X),A", n);
-	address += 2;
+	//
+	// Operation:	(C) <- r
+	// Op Code:		OUT
+	// Operands:	(C), r
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|0|1|r|r|r|0|0|1|
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//						where rrr is any of:
+	//								B						000
+	//								C						001
+	//								D						010
+	//								E						011
+	//								H						100
+	//								L						101
+	//						Undefined				110
+	//								A						111
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								3						12 (4,4,4)				3.00
+	//
+	++m_PC;
+	m_addresslo = m_C;
+	m_addresshi = m_B;
+	WritePort(m_address, REGISTER_8BIT(ReadMemory(m_PC++) >> 3));
+	m_MEMPTR = m_address + 1;
+	return 12;
 }
 
 //=============================================================================
 
-void CZ80::DecodeOUT_C_r(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOUTI(void)
 {
-	sprintf(pMnemonic, "OUT (C),%s", Get8BitRegisterString(ReadMemory(address + 1) >> 3));
-	address += 2;
+	//
+	// Operation:	(C) <- (HL), B <- B - 1, HL <- HL + 1
+	// Op Code:		OUTI
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|0|0|1|1| A3
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,5,3,4)			4.00
+	//
+	++++m_PC;
+	m_addresslo = m_C;
+	m_addresshi = m_B;
+	uint8 byte = ReadMemory(m_HL++);
+	WritePort(m_address, byte);
+	m_B = HandleArithmeticSubtractFlags(m_B, 1, false);
+	m_MEMPTR = m_BC + 1;
+	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
+	m_F |= ((byte >> 6) & eF_N);
+	uint16 k = byte + m_L;
+	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
+	k &= 0x07;
+	k ^= m_B;
+	uint8 parity = k;
+	parity ^= parity >> 4;
+	parity &= 0xF;
+	parity = ((0x6996 >> parity) << 2);
+	m_F |= (~parity & eF_PV);
+	return 16;
 }
 
 //=============================================================================
 
-void CZ80::DecodeOUTI(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOTIR(void)
 {
-	sprintf(pMnemonic, "OUTI");
-	address += 2;
+	//
+	// Operation:	(C) <- (HL), B <- B - 1, HL <- HL + 1
+	// Op Code:		OTIR
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|0|0|1|1| B3
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						21 (4,5,3,4,5)		5.25		B != 0
+	//								4						16 (4,5,3,4)			4.00		B == 0
+	//
+	uint32 tstates = ImplementOUTI();
+	if (m_B != 0)
+	{
+		tstates += 5;
+		----m_PC;
+	}
+	return tstates;
 }
 
 //=============================================================================
 
-void CZ80::DecodeOTIR(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOUTD(void)
 {
-	sprintf(pMnemonic, "OTIR");
-	address += 2;
+	//
+	// Operation:	(C) <- (HL), B <- B - 1, HL <- HL - 1
+	// Op Code:		OUTD
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|0|1|0|1|1| AB
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								4						16 (4,5,3,4)			4.00
+	//
+	++++m_PC;
+	m_addresslo = m_C;
+	m_addresshi = m_B;
+	uint8 byte = ReadMemory(m_HL--);
+	WritePort(m_address, byte);
+	m_B = HandleArithmeticSubtractFlags(m_B, 1, false);
+	m_MEMPTR = m_BC - 1;
+	m_F &= (eF_S | eF_Z | eF_Y | eF_X);
+	m_F |= ((byte >> 6) & eF_N);
+	uint16 k = byte + m_L;
+	m_F |= ((k & 0xff00) ? (eF_H | eF_C) : 0);
+	k &= 0x07;
+	k ^= m_B;
+	uint8 parity = k;
+	parity ^= parity >> 4;
+	parity &= 0xF;
+	parity = ((0x6996 >> parity) << 2);
+	m_F |= (~parity & eF_PV);
+	return 16;
 }
 
 //=============================================================================
 
-void CZ80::DecodeOUTD(uint16& address, char* pMnemonic) const
+uint32 CZ80::ImplementOTDR(void)
 {
-	sprintf(pMnemonic, "OUTD");
-	address += 2;
+	//
+	// Operation:	(C) <- (HL), B <- B - 1, HL <- HL - 1
+	// Op Code:		OTIR
+	// Operands:	--
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|1|1|0|1|1|0|1| ED
+	//						+-+-+-+-+-+-+-+-+
+	//						|1|0|1|1|1|0|1|1| BB
+	//						+-+-+-+-+-+-+-+-+
+	//
+	//							M Cycles		T States					MHz E.T.
+	//								5						21 (4,5,3,4,5)		5.25		B != 0
+	//								4						16 (4,5,3,4)			4.00		B == 0
+	//
+	uint32 tstates = ImplementOUTD();
+	if (m_B != 0)
+	{
+		tstates += 5;
+		----m_PC;
+	}
+	return tstates;
 }
 
 //=============================================================================
-
-void CZ80::DecodeOTDR(uint16& address, char* pMnemonic) const
-{
-	sprintf(pMnemonic, "OTDR");
-	address += 2;
-}
-
 //=============================================================================
 
 /*
@@ -1,23 +1,77 @@
 #if !defined(__Z80_H__)
 #define __Z80_H__
 
+#include <stdio.h>
+
 #include "common/platform_types.h"
+#include "breakpoints.h"
+#include "callprofiler.h"
 #include "imemory.h"
+#include "z80jit.h"
+
+class CStateWriter;
+class CStateReader;
+class CTraceLog;
+
+// The programmer visible register set, for snapshot formats
+struct SZ80Registers
+{
+	uint16	m_AF;
+	uint16	m_BC;
+	uint16	m_DE;
+	uint16	m_HL;
+	uint16	m_AFalt;
+	uint16	m_BCalt;
+	uint16	m_DEalt;
+	uint16	m_HLalt;
+	uint16	m_IX;
+	uint16	m_IY;
+	uint16	m_SP;
+	uint16	m_PC;
+	uint8		m_I;
+	uint8		m_R;
+	uint8		m_IFF1;
+	uint8		m_IFF2;
+	uint8		m_interruptMode;
+};
 
 #if !defined(LITTLE_ENDIAN)
 #define LITTLE_ENDIAN
 #endif
 
+// Defining Z80_PROFILER for the whole build (cmake -DZ80_PROFILER=ON) counts
+// executions and T states per address and per opcode; it costs a few
+// increments per instruction, and nothing at all when not defined.  Likewise
+// Z80_CALL_PROFILER keeps a shadow call stack (see CCallProfiler).
+
+class CSymbolTable;
+
 class CZ80
 {
+#if defined(Z80_JIT)
+	friend class CZ80Jit;
+#endif // defined(Z80_JIT)
+
 	public:
 		CZ80(IMemory* pMemory);
+		~CZ80(void);
 
 		void Reset(void);
-		uint32 SingleStep(void);
+		uint32 SingleStep(void)											{ return (this->*m_pSingleStep)(); }
 		uint32 ServiceInterrupts(void);
+		// If the CPU is sat on a HALT, runs enough of them in one go to cover
+		// the given T states (as stepping would, the last one may overrun) and
+		// returns the T states taken; returns 0 if it has to be single stepped
+		uint32 SkipHalt(uint32 tstates);
+		// Caches the handler for each address the first time it runs, so later
+		// runs skip the decode; on by default
+		void SetEnableDecodeCache(bool set);
 
 		void LoadSNA(uint8* regs);
+		void GetRegisters(SZ80Registers& registers) const;
+		void SetRegisters(const SZ80Registers& registers);
+		void SaveState(CStateWriter& writer) const;
+		void RestoreState(CStateReader& reader);
 
 		bool GetEnableDebug(void) const;
 		void SetEnableDebug(bool set);
@@ -29,32 +83,147 @@ class CZ80
 		void SetEnableBreakpoints(bool set);
 		bool GetEnableProgramFlowBreakpoints(void) const;
 		void SetEnableProgramFlowBreakpoints(bool set);
+		// Execution breakpoints, memory read/write watchpoints and port in/out
+		// watchpoints; all only checked while breakpoints are enabled
+		CBreakpointSet& GetAddressBreakpoints(void)	{ return m_addressBreakpoints; }
+		CBreakpointSet& GetReadWatchpoints(void)		{ return m_readWatchpoints; }
+		CBreakpointSet& GetWriteWatchpoints(void)		{ return m_writeWatchpoints; }
+		CBreakpointSet& GetPortInWatchpoints(void)	{ return m_portInWatchpoints; }
+		CBreakpointSet& GetPortOutWatchpoints(void)	{ return m_portOutWatchpoints; }
 
 		void HitBreakpoint(const char* type) const;
 
+		// With a trace log, unattended debug mode records each instruction to it
+		// instead of printing it
+		void SetTraceLog(CTraceLog* pTraceLog)			{ m_pTraceLog = pTraceLog; }
+
+		// Disassembles the instruction at address, leaving address just past it
+		void Decode(uint16& address, char* pMnemonic) const;
+
+		// Everything known about each opcode, a table per prefix (see
+		// z80opcodes.cpp).  Step(), Decode(), the JIT and the profiler all work
+		// from it.
+		enum eOpcodeTable
+		{
+			OT_NONE,
+			OT_CB,
+			OT_ED,
+			OT_DD,
+			OT_FD,
+			OT_DDCB,	// DD CB d op
+			OT_FDCB,	// FD CB d op
+
+			OT_COUNT
+		};
+		enum eOpcodeFlag
+		{
+			OF_PREFIX = 1 << 0,	// m_table is the table the next opcode is in
+			OF_FLOW = 1 << 1,		// may change the program flow
+			OF_END = 1 << 2,		// always does (JP nn, RET, RST p...)
+			OF_IO = 1 << 3,			// port access
+			OF_BLOCK = 1 << 4,	// LDI and the rest, repeating or not
+			OF_HALT = 1 << 5
+		};
+		typedef uint32 (CZ80::*Handler)(void);
+		struct SOpcode
+		{
+			const char*	m_pMnemonic;	// {n}, {nn}, {d} and {e} stand for the operands
+			Handler			m_handler;		// NULL for an illegal opcode (or a prefix)
+			uint8				m_length;			// including the prefix
+			uint8				m_tstates;		// when not taken, or for one iteration
+			uint8				m_takenTstates;
+			uint8				m_flags;
+			uint8				m_table;
+		};
+		static const SOpcode s_opcode[OT_COUNT][256];
+		// Runs every handler on a scratch CPU and checks it returns the T states
+		// the table has for it (both, when they differ); reports any that don't
+		static bool AreTstatesConsistent(void);
+
+		// The table and opcode of the instruction at address (read straight
+		// from memory, so without contention or watchpoints)
+		eOpcodeTable FindOpcode(uint16 address, uint8& opcode) const;
+
+		// ULA contention: the table holds the delay for a contended access that
+		// starts on each T state of the frame (NULL disables contention
+		// entirely).  The slot mask marks which 16K slots are contended, and the
+		// owner sets the frame T state before each instruction.
+		void SetContention(const uint8* pTable, uint32 tableSize);
+		void SetContendedSlots(uint8 slotMask)		{ m_contendedSlotMask = slotMask; }
+		void SetContentionTstate(uint32 tstate)		{ m_contentionTstate = tstate; }
+
+		// T states the next instruction may run for before the owner needs
+		// control back (the end of the frame, say).  The repeating block
+		// instructions use it to run as many iterations as fit in one go; 0 (the
+		// default, and what it reverts to after each instruction) runs one.
+		void SetStepBudget(uint32 tstates)				{ m_stepBudget = tstates; }
+		// T states run so far by the current step when it's more than one
+		// instruction (a translated block); memory writes need it for the beam
+		uint32 GetStepTstates(void) const					{ return m_stepTstates; }
+
+#if defined(Z80_PROFILER)
+		void ResetProfile(void);
+		// Hotspots sorted by T states (annotated with any labels), followed by
+		// the opcode counts for each prefix
+		void WriteProfile(FILE* pFile, const CSymbolTable* pSymbols, uint32 maxHotspots) const;
+#endif // defined(Z80_PROFILER)
+
+#if defined(Z80_CALL_PROFILER)
+		CCallProfiler& GetCallProfiler(void)				{ return m_callProfiler; }
+#endif // defined(Z80_CALL_PROFILER)
+
 	protected:
 		void OutputStatus(void) const;
 		void OutputInstruction(uint16 address) const;
 		void HandleIllegalOpcode(void) const;
 
-		uint32 Step(void);
-		void Decode(uint16& address, char* pMnemonic) const;
+		// The debugger features stepping is specialised on.  Each combination
+		// has its own SingleStep(), chosen whenever one is turned on or off, so
+		// with them all off nothing is tested per instruction.
+		enum eFeature
+		{
+			ZF_TRACE = 1 << 0,			// debug or unattended debug output
+			ZF_ADDRESS_BREAKPOINTS = 1 << 1,
+			ZF_DATA_WATCHPOINTS = 1 << 2,	// memory and ports
+			ZF_FLOW_BREAKPOINTS = 1 << 3,
+
+			ZF_COMBINATIONS = 1 << 4
+		};
+		typedef uint32 (CZ80::*StepFunction)(void);
+
+		void UpdateFeatures(void) const;
+		template <uint32 FEATURES> uint32 SingleStepWith(void);
+		template <uint32 FEATURES> uint32 Step(void);
+		uint32 StepCached(void);
+		void TraceInstruction(void) const;
 		uint8 HandleArithmeticAddFlags(uint16 source1, uint16 source2, bool withCarry);
 		uint8 HandleArithmeticSubtractFlags(uint16 source1, uint16 source2, bool withCarry);
 		void HandleLogicalFlags(uint8 source);
+
+		uint32 GetBlockRepeats(uint32 remaining) const;
+		uint32 RepeatLDxR(int32 step);
+		uint32 RepeatCPxR(int32 step);
+		uint32 RepeatINxR(int32 step);
+		bool IsOpcodeInBlock(const uint8* pBlock, uint16 length) const;
 		uint16 Handle16BitArithmeticAddFlags(uint32 source1, uint32 source2, bool withCarry);
 		uint16 Handle16BitArithmeticSubtractFlags(uint32 source1, uint32 source2, bool withCarry);
 
 		void WriteMemory(uint16 address, uint8 byte);
 		uint8 ReadMemory(uint16 address) const;
-		inline void WritePort(uint16 address, uint8 byte)	{ m_pMemory->WritePort(address, byte); }
-		inline uint8 ReadPort(uint16 address) const				{ return m_pMemory->ReadPort(address); }
+		void WritePort(uint16 address, uint8 byte);
+		uint8 ReadPort(uint16 address) const;
+		bool IsBreakpointHit(const CBreakpointSet& breakpoints, uint16 address) const;
+
+		void ContendRead(uint16 address) const;
+		void ContendPort(uint16 address) const;
+		inline void Contend(uint16 address, uint32 tstates) const	{ if ((m_contendedSlotMask >> (address >> 14)) & 1) ContendULA(tstates); else m_contentionTstate += tstates; }
+		inline void ContendULA(uint32 tstates) const
+		{
+			uint32 delay = (m_contentionTstate < m_contentionTableSize) ? m_pContention[m_contentionTstate] : 0;
+			m_contentionDelay += delay;
+			m_contentionTstate += delay + tstates;
+		}
 		
-		const char* Get8BitRegisterString(uint8 threeBits) const;
-		const char* Get8BitIXRegisterString(uint8 threeBits) const;
-		const char* Get8BitIYRegisterString(uint8 threeBits) const;
-		const char* Get16BitRegisterString(uint8 twoBits) const;
-		const char* GetConditionString(uint8 threeBits) const;
 		bool IsConditionTrue(uint8 threeBits) const;
 
 		//-----------------------------------------------------------------------------
@@ -243,6 +412,7 @@ class CZ80
 		uint32 ImplementCCF(void);
 		uint32 ImplementSCF(void);
 		uint32 ImplementNOP(void);
+		uint32 ImplementUnindexed(void);
 		uint32 ImplementHALT(void);
 		uint32 ImplementDI(void);
 		uint32 ImplementEI(void);
@@ -371,299 +541,6 @@ class CZ80
 		uint32 ImplementOUTD(void);
 		uint32 ImplementOTDR(void);
 
-		//-----------------------------------------------------------------------------
-		//	8-Bit Load Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeLDrr(uint16& address, char* pMnemonic) const;
-		void DecodeLDrIXh(uint16& address, char* pMnemonic) const;
-		void DecodeLDrIXl(uint16& address, char* pMnemonic) const;
-		void DecodeLDrIYh(uint16& address, char* pMnemonic) const;
-		void DecodeLDrIYl(uint16& address, char* pMnemonic) const;
-		void DecodeLDrn(uint16& address, char* pMnemonic) const;
-		void DecodeLDIXhn(uint16& address, char* pMnemonic) const;
-		void DecodeLDIXhr(uint16& address, char* pMnemonic) const;
-		void DecodeLDIXln(uint16& address, char* pMnemonic) const;
-		void DecodeLDIXlr(uint16& address, char* pMnemonic) const;
-		void DecodeLDIYhn(uint16& address, char* pMnemonic) const;
-		void DecodeLDIYhr(uint16& address, char* pMnemonic) const;
-		void DecodeLDIYln(uint16& address, char* pMnemonic) const;
-		void DecodeLDIYlr(uint16& address, char* pMnemonic) const;
-		void DecodeLDr_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeLDr_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeLD_HL_r(uint16& address, char* pMnemonic) const;
-		void DecodeLD_IXd_r(uint16& address, char* pMnemonic) const;
-		void DecodeLD_IYd_r(uint16& address, char* pMnemonic) const;
-		void DecodeLD_HL_n(uint16& address, char* pMnemonic) const;
-		void DecodeLD_IXd_n(uint16& address, char* pMnemonic) const;
-		void DecodeLD_IYd_n(uint16& address, char* pMnemonic) const;
-		void DecodeLDA_BC_(uint16& address, char* pMnemonic) const;
-		void DecodeLDA_DE_(uint16& address, char* pMnemonic) const;
-		void DecodeLDA_nn_(uint16& address, char* pMnemonic) const;
-		void DecodeLD_BC_A(uint16& address, char* pMnemonic) const;
-		void DecodeLD_DE_A(uint16& address, char* pMnemonic) const;
-		void DecodeLD_nn_A(uint16& address, char* pMnemonic) const;
-		void DecodeLDAI(uint16& address, char* pMnemonic) const;
-		void DecodeLDAR(uint16& address, char* pMnemonic) const;
-		void DecodeLDIA(uint16& address, char* pMnemonic) const;
-		void DecodeLDRA(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	16-Bit Load Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeLDddnn(uint16& address, char* pMnemonic) const;
-		void DecodeLDIXnn(uint16& address, char* pMnemonic) const;
-		void DecodeLDIYnn(uint16& address, char* pMnemonic) const;
-		void DecodeLDHL_nn_(uint16& address, char* pMnemonic) const;
-		void DecodeLDdd_nn_(uint16& address, char* pMnemonic) const;
-		void DecodeLDIX_nn_(uint16& address, char* pMnemonic) const;
-		void DecodeLDIY_nn_(uint16& address, char* pMnemonic) const;
-		void DecodeLD_nn_HL(uint16& address, char* pMnemonic) const;
-		void DecodeLD_nn_dd(uint16& address, char* pMnemonic) const;
-		void DecodeLD_nn_IX(uint16& address, char* pMnemonic) const;
-		void DecodeLD_nn_IY(uint16& address, char* pMnemonic) const;
-		void DecodeLDSPHL(uint16& address, char* pMnemonic) const;
-		void DecodeLDSPIX(uint16& address, char* pMnemonic) const;
-		void DecodeLDSPIY(uint16& address, char* pMnemonic) const;
-		void DecodePUSHqq(uint16& address, char* pMnemonic) const;
-		void DecodePUSHAF(uint16& address, char* pMnemonic) const;
-		void DecodePUSHIX(uint16& address, char* pMnemonic) const;
-		void DecodePUSHIY(uint16& address, char* pMnemonic) const;
-		void DecodePOPqq(uint16& address, char* pMnemonic) const;
-		void DecodePOPAF(uint16& address, char* pMnemonic) const;
-		void DecodePOPIX(uint16& address, char* pMnemonic) const;
-		void DecodePOPIY(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	Exchange, Block Transfer and Search Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeEXDEHL(uint16& address, char* pMnemonic) const;
-		void DecodeEXAFAF(uint16& address, char* pMnemonic) const;
-		void DecodeEXX(uint16& address, char* pMnemonic) const;
-		void DecodeEX_SP_HL(uint16& address, char* pMnemonic) const;
-		void DecodeEX_SP_IX(uint16& address, char* pMnemonic) const;
-		void DecodeEX_SP_IY(uint16& address, char* pMnemonic) const;
-		void DecodeLDI(uint16& address, char* pMnemonic) const;
-		void DecodeLDIR(uint16& address, char* pMnemonic) const;
-		void DecodeLDD(uint16& address, char* pMnemonic) const;
-		void DecodeLDDR(uint16& address, char* pMnemonic) const;
-		void DecodeCPI(uint16& address, char* pMnemonic) const;
-		void DecodeCPIR(uint16& address, char* pMnemonic) const;
-		void DecodeCPD(uint16& address, char* pMnemonic) const;
-		void DecodeCPDR(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	8-Bit Arithmetic Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeADDAr(uint16& address, char* pMnemonic) const;
-		void DecodeADDAIXh(uint16& address, char* pMnemonic) const;
-		void DecodeADDAIXl(uint16& address, char* pMnemonic) const;
-		void DecodeADDAIYh(uint16& address, char* pMnemonic) const;
-		void DecodeADDAIYl(uint16& address, char* pMnemonic) const;
-		void DecodeADDAn(uint16& address, char* pMnemonic) const;
-		void DecodeADDA_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeADDA_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeADCAr(uint16& address, char* pMnemonic) const;
-		void DecodeADCAIXh(uint16& address, char* pMnemonic) const;
-		void DecodeADCAIXl(uint16& address, char* pMnemonic) const;
-		void DecodeADCAIYh(uint16& address, char* pMnemonic) const;
-		void DecodeADCAIYl(uint16& address, char* pMnemonic) const;
-		void DecodeADCAn(uint16& address, char* pMnemonic) const;
-		void DecodeADCA_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeADCA_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeSUBr(uint16& address, char* pMnemonic) const;
-		void DecodeSUBIXh(uint16& address, char* pMnemonic) const;
-		void DecodeSUBIXl(uint16& address, char* pMnemonic) const;
-		void DecodeSUBIYh(uint16& address, char* pMnemonic) const;
-		void DecodeSUBIYl(uint16& address, char* pMnemonic) const;
-		void DecodeSUBn(uint16& address, char* pMnemonic) const;
-		void DecodeSUB_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeSUB_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeSBCAr(uint16& address, char* pMnemonic) const;
-		void DecodeSBCAIXh(uint16& address, char* pMnemonic) const;
-		void DecodeSBCAIXl(uint16& address, char* pMnemonic) const;
-		void DecodeSBCAIYh(uint16& address, char* pMnemonic) const;
-		void DecodeSBCAIYl(uint16& address, char* pMnemonic) const;
-		void DecodeSBCAn(uint16& address, char* pMnemonic) const;
-		void DecodeSBCA_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeSBCA_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeANDr(uint16& address, char* pMnemonic) const;
-		void DecodeANDIXh(uint16& address, char* pMnemonic) const;
-		void DecodeANDIXl(uint16& address, char* pMnemonic) const;
-		void DecodeANDIYh(uint16& address, char* pMnemonic) const;
-		void DecodeANDIYl(uint16& address, char* pMnemonic) const;
-		void DecodeANDn(uint16& address, char* pMnemonic) const;
-		void DecodeAND_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeAND_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeORr(uint16& address, char* pMnemonic) const;
-		void DecodeORIXh(uint16& address, char* pMnemonic) const;
-		void DecodeORIXl(uint16& address, char* pMnemonic) const;
-		void DecodeORIYh(uint16& address, char* pMnemonic) const;
-		void DecodeORIYl(uint16& address, char* pMnemonic) const;
-		void DecodeORn(uint16& address, char* pMnemonic) const;
-		void DecodeOR_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeOR_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeXORr(uint16& address, char* pMnemonic) const;
-		void DecodeXORIXh(uint16& address, char* pMnemonic) const;
-		void DecodeXORIXl(uint16& address, char* pMnemonic) const;
-		void DecodeXORIYh(uint16& address, char* pMnemonic) const;
-		void DecodeXORIYl(uint16& address, char* pMnemonic) const;
-		void DecodeXORn(uint16& address, char* pMnemonic) const;
-		void DecodeXOR_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeXOR_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeCPr(uint16& address, char* pMnemonic) const;
-		void DecodeCPIXh(uint16& address, char* pMnemonic) const;
-		void DecodeCPIXl(uint16& address, char* pMnemonic) const;
-		void DecodeCPIYh(uint16& address, char* pMnemonic) const;
-		void DecodeCPIYl(uint16& address, char* pMnemonic) const;
-		void DecodeCPn(uint16& address, char* pMnemonic) const;
-		void DecodeCP_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeCP_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeINCr(uint16& address, char* pMnemonic) const;
-		void DecodeINCIXh(uint16& address, char* pMnemonic) const;
-		void DecodeINCIXl(uint16& address, char* pMnemonic) const;
-		void DecodeINCIYh(uint16& address, char* pMnemonic) const;
-		void DecodeINCIYl(uint16& address, char* pMnemonic) const;
-		void DecodeINC_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeINC_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeDECr(uint16& address, char* pMnemonic) const;
-		void DecodeDECIXh(uint16& address, char* pMnemonic) const;
-		void DecodeDECIXl(uint16& address, char* pMnemonic) const;
-		void DecodeDECIYh(uint16& address, char* pMnemonic) const;
-		void DecodeDECIYl(uint16& address, char* pMnemonic) const;
-		void DecodeDEC_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeDEC_IYd_(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	General-Purpose Arithmetic and CPU Control Groups
-		//-----------------------------------------------------------------------------
-
-		void DecodeDAA(uint16& address, char* pMnemonic) const;
-		void DecodeCPL(uint16& address, char* pMnemonic) const;
-		void DecodeNEG(uint16& address, char* pMnemonic) const;
-		void DecodeCCF(uint16& address, char* pMnemonic) const;
-		void DecodeSCF(uint16& address, char* pMnemonic) const;
-		void DecodeNOP(uint16& address, char* pMnemonic) const;
-		void DecodeHALT(uint16& address, char* pMnemonic) const;
-		void DecodeDI(uint16& address, char* pMnemonic) const;
-		void DecodeEI(uint16& address, char* pMnemonic) const;
-		void DecodeIM0(uint16& address, char* pMnemonic) const;
-		void DecodeIM1(uint16& address, char* pMnemonic) const;
-		void DecodeIM2(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	16-Bit Arithmetic Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeADDHLdd(uint16& address, char* pMnemonic) const;
-		void DecodeADCHLdd(uint16& address, char* pMnemonic) const;
-		void DecodeSBCHLdd(uint16& address, char* pMnemonic) const;
-		void DecodeADDIXdd(uint16& address, char* pMnemonic) const;
-		void DecodeADDIYdd(uint16& address, char* pMnemonic) const;
-		void DecodeINCdd(uint16& address, char* pMnemonic) const;
-		void DecodeINCIX(uint16& address, char* pMnemonic) const;
-		void DecodeINCIY(uint16& address, char* pMnemonic) const;
-		void DecodeDECdd(uint16& address, char* pMnemonic) const;
-		void DecodeDECIX(uint16& address, char* pMnemonic) const;
-		void DecodeDECIY(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	Rotate and Shift Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeRLCA(uint16& address, char* pMnemonic) const;
-		void DecodeRLA(uint16& address, char* pMnemonic) const;
-		void DecodeRRCA(uint16& address, char* pMnemonic) const;
-		void DecodeRRA(uint16& address, char* pMnemonic) const;
-		void DecodeRLCr(uint16& address, char* pMnemonic) const;
-		void DecodeRLC_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeRLC_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeRLr(uint16& address, char* pMnemonic) const;
-		void DecodeRL_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeRL_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeRRCr(uint16& address, char* pMnemonic) const;
-		void DecodeRRC_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeRRC_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeRRr(uint16& address, char* pMnemonic) const;
-		void DecodeRR_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeRR_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeSLAr(uint16& address, char* pMnemonic) const;
-		void DecodeSLA_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeSLA_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeSRAr(uint16& address, char* pMnemonic) const;
-		void DecodeSRA_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeSRA_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeSLLr(uint16& address, char* pMnemonic) const;
-		void DecodeSLL_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeSLL_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeSRLr(uint16& address, char* pMnemonic) const;
-		void DecodeSRL_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeSRL_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeRLD(uint16& address, char* pMnemonic) const;
-		void DecodeRRD(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	Bit Set, Reset and Test Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeBITbr(uint16& address, char* pMnemonic) const;
-		void DecodeBITb_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeBITb_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeSETbr(uint16& address, char* pMnemonic) const;
-		void DecodeSETb_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeSETb_IYd_(uint16& address, char* pMnemonic) const;
-		void DecodeRESbr(uint16& address, char* pMnemonic) const;
-		void DecodeRESb_IXd_(uint16& address, char* pMnemonic) const;
-		void DecodeRESb_IYd_(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	Jump Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeJPnn(uint16& address, char* pMnemonic) const;
-		void DecodeJPccnn(uint16& address, char* pMnemonic) const;
-		void DecodeJRe(uint16& address, char* pMnemonic) const;
-		void DecodeJRCe(uint16& address, char* pMnemonic) const;
-		void DecodeJRNCe(uint16& address, char* pMnemonic) const;
-		void DecodeJRZe(uint16& address, char* pMnemonic) const;
-		void DecodeJRNZe(uint16& address, char* pMnemonic) const;
-		void DecodeJP_HL_(uint16& address, char* pMnemonic) const;
-		void DecodeJP_IX_(uint16& address, char* pMnemonic) const;
-		void DecodeJP_IY_(uint16& address, char* pMnemonic) const;
-		void DecodeDJNZe(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	Call and Return Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeCALLnn(uint16& address, char* pMnemonic) const;
-		void DecodeCALLccnn(uint16& address, char* pMnemonic) const;
-		void DecodeRET(uint16& address, char* pMnemonic) const;
-		void DecodeRETcc(uint16& address, char* pMnemonic) const;
-		void DecodeRETI(uint16& address, char* pMnemonic) const;
-		void DecodeRETN(uint16& address, char* pMnemonic) const;
-		void DecodeRSTp(uint16& address, char* pMnemonic) const;
-
-		//-----------------------------------------------------------------------------
-		//	Input and Output Group
-		//-----------------------------------------------------------------------------
-
-		void DecodeINA_n_(uint16& address, char* pMnemonic) const;
-		void DecodeINr_C_(uint16& address, char* pMnemonic) const;
-		void DecodeINI(uint16& address, char* pMnemonic) const;
-		void DecodeINIR(uint16& address, char* pMnemonic) const;
-		void DecodeIND(uint16& address, char* pMnemonic) const;
-		void DecodeINDR(uint16& address, char* pMnemonic) const;
-		void DecodeOUT_n_A(uint16& address, char* pMnemonic) const;
-		void DecodeOUT_C_r(uint16& address, char* pMnemonic) const;
-		void DecodeOUTI(uint16& address, char* pMnemonic) const;
-		void DecodeOTIR(uint16& address, char* pMnemonic) const;
-		void DecodeOUTD(uint16& address, char* pMnemonic) const;
-		void DecodeOTDR(uint16& address, char* pMnemonic) const;
-
 		//=============================================================================
 
 		struct SProcessorState
@@ -747,7 +624,8 @@ class CZ80
 			eR_State = eR_HLalt + sizeof(uint16),
 			eR_Address = eR_State + sizeof(uint16),
 			eR_Addressh = eR_Address + HI,
-			eR_Addressl = eR_Address + LO
+			eR_Addressl = eR_Address + LO,
+			eR_MEMPTR = eR_Address + sizeof(uint16)
 		};
 
 		//=============================================================================
@@ -788,6 +666,8 @@ class CZ80
 		uint16&	m_address;
 		uint8&	m_addresshi;
 		uint8&	m_addresslo;
+		// The internal WZ register; only seen in X and Y after BIT n,(HL)
+		uint16&	m_MEMPTR;
 
 		// Opcode register decode lookups
 		uint8		m_16BitRegisterOffset[4];
@@ -799,6 +679,68 @@ class CZ80
 		mutable bool		m_enableBreakpoints;
 		bool		m_enableOutputStatus;
 		bool		m_enableProgramFlowBreakpoints;
+		mutable uint32	m_features;
+		mutable StepFunction	m_pSingleStep;
+		CTraceLog*			m_pTraceLog;
+		CBreakpointSet	m_addressBreakpoints;
+		CBreakpointSet	m_readWatchpoints;
+		CBreakpointSet	m_writeWatchpoints;
+		CBreakpointSet	m_portInWatchpoints;
+		CBreakpointSet	m_portOutWatchpoints;
+
+		// Contention state for the current instruction.  Step() and the handlers
+		// both read the opcode bytes, so only the first read of each instruction
+		// byte counts as an M cycle.
+		const uint8*		m_pContention;
+		uint32					m_contentionTableSize;
+		mutable uint32	m_contentionTstate;
+		mutable uint32	m_contentionDelay;
+		uint16					m_contentionInstruction;
+		mutable uint16	m_contentionFetched;
+		uint8						m_contendedSlotMask;
+
+		uint32					m_stepBudget;
+		uint32					m_stepTstates;
+
+		// Decode cache, one entry per address.  The memory counts writes to each
+		// 256 byte page (including paging something else in), and an entry is
+		// only used while the pages it was decoded from are unchanged.
+		struct SDecodedInstruction
+		{
+			Handler					m_handler;
+			uint32					m_generation[2];
+			uint8						m_refresh;	// M1 cycles (R increments) of the prefix and opcode
+		};
+
+		// Step() ends up here; while decoding, the handler is noted
+		inline uint32 Dispatch(Handler handler)
+		{
+			if (m_pDecoding != NULL)
+			{
+				m_pDecoding->m_handler = handler;
+			}
+			return (this->*handler)();
+		}
+
+		SDecodedInstruction*	m_pDecodeCache;
+		const uint32*		m_pWriteGenerations;
+		SDecodedInstruction*	m_pDecoding;
+
+#if defined(Z80_JIT)
+		CZ80Jit*				m_pJit;
+#endif // defined(Z80_JIT)
+
+#if defined(Z80_PROFILER)
+		void						ProfileInstruction(uint16 address, uint32 tstates);
+
+		uint32*					m_pProfileCount;		// per address
+		uint64*					m_pProfileTstates;	// per address
+		uint32					m_profileOpcodeCount[OT_COUNT][256];
+#endif // defined(Z80_PROFILER)
+
+#if defined(Z80_CALL_PROFILER)
+		CCallProfiler		m_callProfiler;
+#endif // defined(Z80_CALL_PROFILER)
 
 		//=============================================================================
 
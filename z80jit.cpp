@@ -0,0 +1,307 @@
+#include "z80jit.h"
+
+#if defined(Z80_JIT)
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/mman.h>
+
+#include "perfcounters.h"
+#include "z80.h"
+
+//=============================================================================
+// Register use in the generated code (System V AMD64):
+//		rbx		the CZ80 (first argument, passed to each handler as 'this')
+//		r12		&m_PC
+//		r13d	the step budget (second argument)
+//		r14		the memory's write generations
+//		r15		&m_stepTstates, the running T state total
+//=============================================================================
+
+typedef uint32 (*BlockFunction)(CZ80* pCPU, uint32 budget);
+
+//=============================================================================
+
+static void* GetHandlerAddress(const void* pHandler)
+{
+	// Itanium C++ ABI: a pointer to a non virtual member function is the
+	// function's address followed by the 'this' adjustment (always 0 here)
+	struct SMemberFunction
+	{
+		void*			m_pFunction;
+		ptrdiff_t	m_adjust;
+	} parts;
+
+	memcpy(&parts, pHandler, sizeof(parts));
+	return parts.m_pFunction;
+}
+
+//=============================================================================
+
+static const CZ80::SOpcode& GetOpcode(const CZ80& cpu, uint16 address)
+{
+	uint8 opcode = 0;
+	CZ80::eOpcodeTable table = cpu.FindOpcode(address, opcode);
+	return CZ80::s_opcode[table][opcode];
+}
+
+//=============================================================================
+
+CZ80Jit::CZ80Jit(CZ80& cpu)
+	: m_cpu(cpu)
+	, m_pBlocks(NULL)
+	, m_pCode(NULL)
+	, m_codeUsed(0)
+{
+	m_pBlocks = static_cast<SBlock*>(calloc(0x10000, sizeof(SBlock)));
+
+	void* pCode = mmap(NULL, JIT_CODE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (pCode == MAP_FAILED)
+	{
+		fprintf(stderr, "[Z80 JIT]: unable to allocate %d bytes of executable memory\n", JIT_CODE_SIZE);
+	}
+	else
+	{
+		m_pCode = static_cast<uint8*>(pCode);
+	}
+}
+
+//=============================================================================
+
+CZ80Jit::~CZ80Jit(void)
+{
+	if (m_pCode != NULL)
+	{
+		munmap(m_pCode, JIT_CODE_SIZE);
+	}
+	free(m_pBlocks);
+}
+
+//=============================================================================
+
+void CZ80Jit::Flush(void)
+{
+	memset(m_pBlocks, 0, 0x10000 * sizeof(SBlock));
+	m_codeUsed = 0;
+}
+
+//=============================================================================
+
+uint32 CZ80Jit::Run(uint16 address, uint32 budget)
+{
+	if ((m_pCode == NULL) || (m_pBlocks == NULL))
+	{
+		return 0;
+	}
+
+	SBlock& block = m_pBlocks[address];
+	if ((block.m_pCode != NULL) && (block.m_generation != m_cpu.m_pWriteGenerations[address >> 8]))
+	{
+		// Written to (or paged out) since it was translated; the old code is
+		// just left until the buffer is next flushed.  Self modifying code
+		// would otherwise be retranslated over and over.
+		block.m_pCode = NULL;
+		block.m_count = 0;
+		if (block.m_invalidations < JIT_MAX_INVALIDATIONS)
+		{
+			++block.m_invalidations;
+		}
+	}
+
+	if (block.m_pCode == NULL)
+	{
+		if ((block.m_invalidations == JIT_MAX_INVALIDATIONS) || (++block.m_count < (JIT_HOT_COUNT << block.m_invalidations)))
+		{
+			return 0;
+		}
+
+		// Translate() may flush every block, this one included, so the block
+		// is only filled in once it returns
+		uint8* pCode = Translate(address);
+		block.m_count = 0;
+		if (pCode == NULL)
+		{
+			return 0;
+		}
+		block.m_pCode = pCode;
+		block.m_generation = m_cpu.m_pWriteGenerations[address >> 8];
+	}
+
+	PERF_SCOPE(PF_Z80_STEP);
+	m_cpu.m_stepTstates = 0;
+	uint32 tstates = reinterpret_cast<BlockFunction>(block.m_pCode)(&m_cpu, budget);
+	m_cpu.m_stepTstates = 0;
+	return tstates;
+}
+
+//=============================================================================
+
+void CZ80Jit::Emit32(uint32 value)
+{
+	memcpy(&m_pCode[m_codeUsed], &value, sizeof(value));
+	m_codeUsed += sizeof(value);
+}
+
+//=============================================================================
+
+void CZ80Jit::Emit64(uint64 value)
+{
+	memcpy(&m_pCode[m_codeUsed], &value, sizeof(value));
+	m_codeUsed += sizeof(value);
+}
+
+//=============================================================================
+
+uint32 CZ80Jit::EmitJump(uint8 condition)
+{
+	// Jcc rel32, patched to the exit once its position is known
+	Emit8(0x0F);
+	Emit8(condition);
+	uint32 at = m_codeUsed;
+	Emit32(0);
+	return at;
+}
+
+//=============================================================================
+
+void CZ80Jit::PatchJump(uint32 at, uint32 target)
+{
+	int32 offset = static_cast<int32>(target) - static_cast<int32>(at + 4);
+	memcpy(&m_pCode[at], &offset, sizeof(offset));
+}
+
+//=============================================================================
+
+uint8* CZ80Jit::Translate(uint16 address)
+{
+	enum
+	{
+		JE = 0x84,
+		JNE = 0x85,
+		JAE = 0x83
+	};
+
+	if ((m_codeUsed + (JIT_MAX_INSTRUCTIONS * JIT_MAX_INSTRUCTION_CODE) + 64) > JIT_CODE_SIZE)
+	{
+		Flush();
+	}
+
+	uint8 page = address >> 8;
+	uint32 generation = m_cpu.m_pWriteGenerations[page];
+	uint32 start = m_codeUsed;
+	uint32 exits[JIT_MAX_INSTRUCTIONS * 3];
+	uint32 exitCount = 0;
+	uint32 instructions = 0;
+
+	// push rbx; push r12; push r13; push r14; push r15
+	Emit8(0x53);
+	Emit8(0x41); Emit8(0x54);
+	Emit8(0x41); Emit8(0x55);
+	Emit8(0x41); Emit8(0x56);
+	Emit8(0x41); Emit8(0x57);
+	// mov rbx,rdi; mov r13d,esi
+	Emit8(0x48); Emit8(0x89); Emit8(0xFB);
+	Emit8(0x41); Emit8(0x89); Emit8(0xF5);
+	// mov r12,&m_PC; mov r14,generations; mov r15,&m_stepTstates
+	Emit8(0x49); Emit8(0xBC); Emit64(reinterpret_cast<uint64>(&m_cpu.m_PC));
+	Emit8(0x49); Emit8(0xBE); Emit64(reinterpret_cast<uint64>(m_cpu.m_pWriteGenerations));
+	Emit8(0x49); Emit8(0xBF); Emit64(reinterpret_cast<uint64>(&m_cpu.m_stepTstates));
+
+	static_assert(sizeof(CZ80::Handler) == (sizeof(void*) + sizeof(ptrdiff_t)), "unexpected member function pointer layout");
+
+	uint16 pc = address;
+	while (instructions < JIT_MAX_INSTRUCTIONS)
+	{
+		// Only instructions the interpreter has decoded (and that are still
+		// valid), wholly within the page.  HALT, port access and the block
+		// instructions are left to the interpreter.
+		const CZ80::SDecodedInstruction& decoded = m_cpu.m_pDecodeCache[pc];
+		const CZ80::SOpcode& opcode = GetOpcode(m_cpu, pc);
+		uint8 lastPage = static_cast<uint16>(pc + 3) >> 8;
+		if ((decoded.m_handler == NULL) || (decoded.m_generation[0] != m_cpu.m_pWriteGenerations[pc >> 8]) || (decoded.m_generation[1] != m_cpu.m_pWriteGenerations[lastPage]) ||
+			(opcode.m_flags & (CZ80::OF_HALT | CZ80::OF_IO | CZ80::OF_BLOCK)))
+		{
+			break;
+		}
+
+		uint32 length = opcode.m_length;
+		if (((pc >> 8) != page) || (((pc + length - 1) >> 8) != page))
+		{
+			break;
+		}
+
+		if (instructions > 0)
+		{
+			// movzx eax,word [r12]; cmp eax,pc; jne exit
+			Emit8(0x41); Emit8(0x0F); Emit8(0xB7); Emit8(0x04); Emit8(0x24);
+			Emit8(0x3D); Emit32(pc);
+			exits[exitCount++] = EmitJump(JNE);
+		}
+
+		// R is refreshed once per M1 cycle (as Step() does before dispatching):
+		// mov rcx,&m_R; movzx eax,byte [rcx]; mov edx,eax; add eax,n;
+		// and eax,0x7F; and edx,0x80; or eax,edx; mov [rcx],al
+		Emit8(0x48); Emit8(0xB9); Emit64(reinterpret_cast<uint64>(&m_cpu.m_R));
+		Emit8(0x0F); Emit8(0xB6); Emit8(0x01);
+		Emit8(0x89); Emit8(0xC2);
+		Emit8(0x83); Emit8(0xC0); Emit8(decoded.m_refresh);
+		Emit8(0x83); Emit8(0xE0); Emit8(0x7F);
+		Emit8(0x81); Emit8(0xE2); Emit32(0x80);
+		Emit8(0x09); Emit8(0xD0);
+		Emit8(0x88); Emit8(0x01);
+
+		// mov rdi,rbx; mov rax,handler; call rax
+		Emit8(0x48); Emit8(0x89); Emit8(0xDF);
+		Emit8(0x48); Emit8(0xB8); Emit64(reinterpret_cast<uint64>(GetHandlerAddress(&decoded.m_handler)));
+		Emit8(0xFF); Emit8(0xD0);
+
+		// add [r15],eax; mov eax,[r15]; cmp eax,r13d; jae exit
+		Emit8(0x41); Emit8(0x01); Emit8(0x07);
+		Emit8(0x41); Emit8(0x8B); Emit8(0x07);
+		Emit8(0x44); Emit8(0x39); Emit8(0xE8);
+		exits[exitCount++] = EmitJump(JAE);
+
+		// cmp dword [r14+page*4],generation; jne exit
+		Emit8(0x41); Emit8(0x81); Emit8(0xBE); Emit32(page * sizeof(uint32)); Emit32(generation);
+		exits[exitCount++] = EmitJump(JNE);
+
+		// It can't follow an unconditional change of flow
+		++instructions;
+		pc += length;
+		if (opcode.m_flags & CZ80::OF_END)
+		{
+			break;
+		}
+	}
+
+	if (instructions < 2)
+	{
+		// Not worth it (or not possible); leave it to the interpreter
+		m_codeUsed = start;
+		return NULL;
+	}
+
+	// exit: mov eax,[r15]; pop r15; pop r14; pop r13; pop r12; pop rbx; ret
+	uint32 exit = m_codeUsed;
+	Emit8(0x41); Emit8(0x8B); Emit8(0x07);
+	Emit8(0x41); Emit8(0x5F);
+	Emit8(0x41); Emit8(0x5E);
+	Emit8(0x41); Emit8(0x5D);
+	Emit8(0x41); Emit8(0x5C);
+	Emit8(0x5B);
+	Emit8(0xC3);
+
+	for (uint32 index = 0; index < exitCount; ++index)
+	{
+		PatchJump(exits[index], exit);
+	}
+
+	return &m_pCode[start];
+}
+
+//=============================================================================
+
+#endif // defined(Z80_JIT)
@@ -0,0 +1,82 @@
+#if !defined(__Z80JIT_H__)
+#define __Z80JIT_H__
+
+#include <stddef.h>
+
+#include "common/platform_types.h"
+
+// The generated code is x86-64, and skips the per instruction profiling
+#if defined(Z80_JIT) && (!defined(__x86_64__) || defined(Z80_PROFILER) || defined(Z80_CALL_PROFILER))
+#undef Z80_JIT
+#endif
+
+#if defined(Z80_JIT)
+
+class CZ80;
+
+//=============================================================================
+// Translates hot straight line runs of Z80 code into x86-64 code that calls
+// each instruction's handler in turn (so the instructions themselves behave
+// exactly as they do in the interpreter), skipping the per instruction trip
+// through the machine's update loop.
+//
+// A block is a run of already decoded instructions within one 256 byte page,
+// ending at an unconditional jump, call or return.  It stops early if an
+// instruction doesn't leave PC where expected (a conditional branch taken),
+// the step budget runs out, or the page is written to (self modifying code).
+// I/O, HALT and the block instructions are never translated: their timing is
+// seen by the rest of the machine, so they always go through the interpreter.
+//
+// Translations are checked against the memory's write generations before they
+// run, so anything written to (or paged out) since is retranslated.
+//=============================================================================
+
+class CZ80Jit
+{
+	public:
+		CZ80Jit(CZ80& cpu);
+		~CZ80Jit(void);
+
+		// Runs the translated block at address if there is one (translating it
+		// once it's hot), returning the T states taken; 0 means the interpreter
+		// should step the instruction instead
+		uint32			Run(uint16 address, uint32 budget);
+		void				Flush(void);
+
+	protected:
+		enum eJitConstant
+		{
+			JIT_CODE_SIZE = 4 * 1024 * 1024,
+			JIT_HOT_COUNT = 16,
+			JIT_MAX_INVALIDATIONS = 8,	// each one doubles the count needed to translate again
+			JIT_MAX_INSTRUCTIONS = 64,
+			JIT_MAX_INSTRUCTION_CODE = 96	// bytes of x86-64 per Z80 instruction (with some slack)
+		};
+
+		struct SBlock
+		{
+			uint8*			m_pCode;
+			uint32			m_generation;
+			uint16			m_count;
+			uint8				m_invalidations;
+		};
+
+		uint8*			Translate(uint16 address);
+
+		void				Emit8(uint8 byte)		{ m_pCode[m_codeUsed++] = byte; }
+		void				Emit32(uint32 value);
+		void				Emit64(uint64 value);
+		uint32			EmitJump(uint8 condition);
+		void				PatchJump(uint32 at, uint32 target);
+
+		CZ80&				m_cpu;
+		SBlock*			m_pBlocks;
+		uint8*			m_pCode;
+		uint32			m_codeUsed;
+};
+
+#endif // defined(Z80_JIT)
+
+//=============================================================================
+
+#endif // !defined(__Z80JIT_H__)
@@ -0,0 +1,1877 @@
+#include "z80.h"
+
+//=============================================================================
+// One entry for every opcode of every prefix: the mnemonic, the handler that
+// runs it, its length in bytes (prefix included), T states (when a condition
+// isn't met, or for a single iteration of a repeating instruction) and T
+// states when taken, and flags.  In the mnemonics {n} is a byte operand, {nn}
+// a word, {d} an index displacement and {e} a relative jump; they're read in
+// order from just after the opcode (or the prefix, for DD CB d op and
+// FD CB d op).
+//
+// DD and FD in front of an opcode with no IX or IY form run it as if they
+// weren't there (ImplementUnindexed), just 4 T states slower.
+//=============================================================================
+
+#define ILLEGAL					{ NULL, NULL, 0, 0, 0, 0, OT_NONE }
+#define PREFIX(table)		{ NULL, NULL, 0, 0, 0, OF_PREFIX, table }
+
+constexpr CZ80::SOpcode CZ80::s_opcode[OT_COUNT][256] =
+{
+	// No prefix
+	{
+		/* 00 */	{ "NOP",             &CZ80::ImplementNOP,         1,  4,  4, 0, OT_NONE },
+		/* 01 */	{ "LD BC,{nn}",      &CZ80::ImplementLDddnn,      3, 10, 10, 0, OT_NONE },
+		/* 02 */	{ "LD (BC),A",       &CZ80::ImplementLD_BC_A,     1,  7,  7, 0, OT_NONE },
+		/* 03 */	{ "INC BC",          &CZ80::ImplementINCdd,       1,  6,  6, 0, OT_NONE },
+		/* 04 */	{ "INC B",           &CZ80::ImplementINCr,        1,  4,  4, 0, OT_NONE },
+		/* 05 */	{ "DEC B",           &CZ80::ImplementDECr,        1,  4,  4, 0, OT_NONE },
+		/* 06 */	{ "LD B,{n}",        &CZ80::ImplementLDrn,        2,  7,  7, 0, OT_NONE },
+		/* 07 */	{ "RLCA",            &CZ80::ImplementRLCA,        1,  4,  4, 0, OT_NONE },
+		/* 08 */	{ "EX AF,AF'",       &CZ80::ImplementEXAFAF,      1,  4,  4, 0, OT_NONE },
+		/* 09 */	{ "ADD HL,BC",       &CZ80::ImplementADDHLdd,     1, 11, 11, 0, OT_NONE },
+		/* 0A */	{ "LD A,(BC)",       &CZ80::ImplementLDA_BC_,     1,  7,  7, 0, OT_NONE },
+		/* 0B */	{ "DEC BC",          &CZ80::ImplementDECdd,       1,  6,  6, 0, OT_NONE },
+		/* 0C */	{ "INC C",           &CZ80::ImplementINCr,        1,  4,  4, 0, OT_NONE },
+		/* 0D */	{ "DEC C",           &CZ80::ImplementDECr,        1,  4,  4, 0, OT_NONE },
+		/* 0E */	{ "LD C,{n}",        &CZ80::ImplementLDrn,        2,  7,  7, 0, OT_NONE },
+		/* 0F */	{ "RRCA",            &CZ80::ImplementRRCA,        1,  4,  4, 0, OT_NONE },
+		/* 10 */	{ "DJNZ {e}",        &CZ80::ImplementDJNZe,       2,  8, 13, OF_FLOW, OT_NONE },
+		/* 11 */	{ "LD DE,{nn}",      &CZ80::ImplementLDddnn,      3, 10, 10, 0, OT_NONE },
+		/* 12 */	{ "LD (DE),A",       &CZ80::ImplementLD_DE_A,     1,  7,  7, 0, OT_NONE },
+		/* 13 */	{ "INC DE",          &CZ80::ImplementINCdd,       1,  6,  6, 0, OT_NONE },
+		/* 14 */	{ "INC D",           &CZ80::ImplementINCr,        1,  4,  4, 0, OT_NONE },
+		/* 15 */	{ "DEC D",           &CZ80::ImplementDECr,        1,  4,  4, 0, OT_NONE },
+		/* 16 */	{ "LD D,{n}",        &CZ80::ImplementLDrn,        2,  7,  7, 0, OT_NONE },
+		/* 17 */	{ "RLA",             &CZ80::ImplementRLA,         1,  4,  4, 0, OT_NONE },
+		/* 18 */	{ "JR {e}",          &CZ80::ImplementJRe,         2, 12, 12, OF_FLOW | OF_END, OT_NONE },
+		/* 19 */	{ "ADD HL,DE",       &CZ80::ImplementADDHLdd,     1, 11, 11, 0, OT_NONE },
+		/* 1A */	{ "LD A,(DE)",       &CZ80::ImplementLDA_DE_,     1,  7,  7, 0, OT_NONE },
+		/* 1B */	{ "DEC DE",          &CZ80::ImplementDECdd,       1,  6,  6, 0, OT_NONE },
+		/* 1C */	{ "INC E",           &CZ80::ImplementINCr,        1,  4,  4, 0, OT_NONE },
+		/* 1D */	{ "DEC E",           &CZ80::ImplementDECr,        1,  4,  4, 0, OT_NONE },
+		/* 1E */	{ "LD E,{n}",        &CZ80::ImplementLDrn,        2,  7,  7, 0, OT_NONE },
+		/* 1F */	{ "RRA",             &CZ80::ImplementRRA,         1,  4,  4, 0, OT_NONE },
+		/* 20 */	{ "JR NZ,{e}",       &CZ80::ImplementJRNZe,       2,  7, 12, OF_FLOW, OT_NONE },
+		/* 21 */	{ "LD HL,{nn}",      &CZ80::ImplementLDddnn,      3, 10, 10, 0, OT_NONE },
+		/* 22 */	{ "LD ({nn}),HL",    &CZ80::ImplementLD_nn_HL,    3, 16, 16, 0, OT_NONE },
+		/* 23 */	{ "INC HL",          &CZ80::ImplementINCdd,       1,  6,  6, 0, OT_NONE },
+		/* 24 */	{ "INC H",           &CZ80::ImplementINCr,        1,  4,  4, 0, OT_NONE },
+		/* 25 */	{ "DEC H",           &CZ80::ImplementDECr,        1,  4,  4, 0, OT_NONE },
+		/* 26 */	{ "LD H,{n}",        &CZ80::ImplementLDrn,        2,  7,  7, 0, OT_NONE },
+		/* 27 */	{ "DAA",             &CZ80::ImplementDAA,         1,  4,  4, 0, OT_NONE },
+		/* 28 */	{ "JR Z,{e}",        &CZ80::ImplementJRZe,        2,  7, 12, OF_FLOW, OT_NONE },
+		/* 29 */	{ "ADD HL,HL",       &CZ80::ImplementADDHLdd,     1, 11, 11, 0, OT_NONE },
+		/* 2A */	{ "LD HL,({nn})",    &CZ80::ImplementLDHL_nn_,    3, 16, 16, 0, OT_NONE },
+		/* 2B */	{ "DEC HL",          &CZ80::ImplementDECdd,       1,  6,  6, 0, OT_NONE },
+		/* 2C */	{ "INC L",           &CZ80::ImplementINCr,        1,  4,  4, 0, OT_NONE },
+		/* 2D */	{ "DEC L",           &CZ80::ImplementDECr,        1,  4,  4, 0, OT_NONE },
+		/* 2E */	{ "LD L,{n}",        &CZ80::ImplementLDrn,        2,  7,  7, 0, OT_NONE },
+		/* 2F */	{ "CPL",             &CZ80::ImplementCPL,         1,  4,  4, 0, OT_NONE },
+		/* 30 */	{ "JR NC,{e}",       &CZ80::ImplementJRNCe,       2,  7, 12, OF_FLOW, OT_NONE },
+		/* 31 */	{ "LD SP,{nn}",      &CZ80::ImplementLDddnn,      3, 10, 10, 0, OT_NONE },
+		/* 32 */	{ "LD ({nn}),A",     &CZ80::ImplementLD_nn_A,     3, 13, 13, 0, OT_NONE },
+		/* 33 */	{ "INC SP",          &CZ80::ImplementINCdd,       1,  6,  6, 0, OT_NONE },
+		/* 34 */	{ "INC (HL)",        &CZ80::ImplementINC_HL_,     1, 11, 11, 0, OT_NONE },
+		/* 35 */	{ "DEC (HL)",        &CZ80::ImplementDEC_HL_,     1, 11, 11, 0, OT_NONE },
+		/* 36 */	{ "LD (HL),{n}",     &CZ80::ImplementLD_HL_n,     2, 10, 10, 0, OT_NONE },
+		/* 37 */	{ "SCF",             &CZ80::ImplementSCF,         1,  4,  4, 0, OT_NONE },
+		/* 38 */	{ "JR C,{e}",        &CZ80::ImplementJRCe,        2,  7, 12, OF_FLOW, OT_NONE },
+		/* 39 */	{ "ADD HL,SP",       &CZ80::ImplementADDHLdd,     1, 11, 11, 0, OT_NONE },
+		/* 3A */	{ "LD A,({nn})",     &CZ80::ImplementLDA_nn_,     3, 13, 13, 0, OT_NONE },
+		/* 3B */	{ "DEC SP",          &CZ80::ImplementDECdd,       1,  6,  6, 0, OT_NONE },
+		/* 3C */	{ "INC A",           &CZ80::ImplementINCr,        1,  4,  4, 0, OT_NONE },
+		/* 3D */	{ "DEC A",           &CZ80::ImplementDECr,        1,  4,  4, 0, OT_NONE },
+		/* 3E */	{ "LD A,{n}",        &CZ80::ImplementLDrn,        2,  7,  7, 0, OT_NONE },
+		/* 3F */	{ "CCF",             &CZ80::ImplementCCF,         1,  4,  4, 0, OT_NONE },
+		/* 40 */	{ "LD B,B",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 41 */	{ "LD B,C",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 42 */	{ "LD B,D",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 43 */	{ "LD B,E",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 44 */	{ "LD B,H",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 45 */	{ "LD B,L",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 46 */	{ "LD B,(HL)",       &CZ80::ImplementLDr_HL_,     1,  7,  7, 0, OT_NONE },
+		/* 47 */	{ "LD B,A",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 48 */	{ "LD C,B",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 49 */	{ "LD C,C",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 4A */	{ "LD C,D",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 4B */	{ "LD C,E",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 4C */	{ "LD C,H",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 4D */	{ "LD C,L",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 4E */	{ "LD C,(HL)",       &CZ80::ImplementLDr_HL_,     1,  7,  7, 0, OT_NONE },
+		/* 4F */	{ "LD C,A",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 50 */	{ "LD D,B",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 51 */	{ "LD D,C",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 52 */	{ "LD D,D",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 53 */	{ "LD D,E",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 54 */	{ "LD D,H",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 55 */	{ "LD D,L",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 56 */	{ "LD D,(HL)",       &CZ80::ImplementLDr_HL_,     1,  7,  7, 0, OT_NONE },
+		/* 57 */	{ "LD D,A",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 58 */	{ "LD E,B",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 59 */	{ "LD E,C",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 5A */	{ "LD E,D",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 5B */	{ "LD E,E",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 5C */	{ "LD E,H",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 5D */	{ "LD E,L",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 5E */	{ "LD E,(HL)",       &CZ80::ImplementLDr_HL_,     1,  7,  7, 0, OT_NONE },
+		/* 5F */	{ "LD E,A",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 60 */	{ "LD H,B",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 61 */	{ "LD H,C",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 62 */	{ "LD H,D",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 63 */	{ "LD H,E",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 64 */	{ "LD H,H",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 65 */	{ "LD H,L",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 66 */	{ "LD H,(HL)",       &CZ80::ImplementLDr_HL_,     1,  7,  7, 0, OT_NONE },
+		/* 67 */	{ "LD H,A",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 68 */	{ "LD L,B",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 69 */	{ "LD L,C",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 6A */	{ "LD L,D",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 6B */	{ "LD L,E",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 6C */	{ "LD L,H",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 6D */	{ "LD L,L",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 6E */	{ "LD L,(HL)",       &CZ80::ImplementLDr_HL_,     1,  7,  7, 0, OT_NONE },
+		/* 6F */	{ "LD L,A",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 70 */	{ "LD (HL),B",       &CZ80::ImplementLD_HL_r,     1,  7,  7, 0, OT_NONE },
+		/* 71 */	{ "LD (HL),C",       &CZ80::ImplementLD_HL_r,     1,  7,  7, 0, OT_NONE },
+		/* 72 */	{ "LD (HL),D",       &CZ80::ImplementLD_HL_r,     1,  7,  7, 0, OT_NONE },
+		/* 73 */	{ "LD (HL),E",       &CZ80::ImplementLD_HL_r,     1,  7,  7, 0, OT_NONE },
+		/* 74 */	{ "LD (HL),H",       &CZ80::ImplementLD_HL_r,     1,  7,  7, 0, OT_NONE },
+		/* 75 */	{ "LD (HL),L",       &CZ80::ImplementLD_HL_r,     1,  7,  7, 0, OT_NONE },
+		/* 76 */	{ "HALT",            &CZ80::ImplementHALT,        1,  4,  4, OF_HALT, OT_NONE },
+		/* 77 */	{ "LD (HL),A",       &CZ80::ImplementLD_HL_r,     1,  7,  7, 0, OT_NONE },
+		/* 78 */	{ "LD A,B",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 79 */	{ "LD A,C",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 7A */	{ "LD A,D",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 7B */	{ "LD A,E",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 7C */	{ "LD A,H",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 7D */	{ "LD A,L",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 7E */	{ "LD A,(HL)",       &CZ80::ImplementLDr_HL_,     1,  7,  7, 0, OT_NONE },
+		/* 7F */	{ "LD A,A",          &CZ80::ImplementLDrr,        1,  4,  4, 0, OT_NONE },
+		/* 80 */	{ "ADD A,B",         &CZ80::ImplementADDAr,       1,  4,  4, 0, OT_NONE },
+		/* 81 */	{ "ADD A,C",         &CZ80::ImplementADDAr,       1,  4,  4, 0, OT_NONE },
+		/* 82 */	{ "ADD A,D",         &CZ80::ImplementADDAr,       1,  4,  4, 0, OT_NONE },
+		/* 83 */	{ "ADD A,E",         &CZ80::ImplementADDAr,       1,  4,  4, 0, OT_NONE },
+		/* 84 */	{ "ADD A,H",         &CZ80::ImplementADDAr,       1,  4,  4, 0, OT_NONE },
+		/* 85 */	{ "ADD A,L",         &CZ80::ImplementADDAr,       1,  4,  4, 0, OT_NONE },
+		/* 86 */	{ "ADD A,(HL)",      &CZ80::ImplementADDA_HL_,    1,  7,  7, 0, OT_NONE },
+		/* 87 */	{ "ADD A,A",         &CZ80::ImplementADDAr,       1,  4,  4, 0, OT_NONE },
+		/* 88 */	{ "ADC A,B",         &CZ80::ImplementADCAr,       1,  4,  4, 0, OT_NONE },
+		/* 89 */	{ "ADC A,C",         &CZ80::ImplementADCAr,       1,  4,  4, 0, OT_NONE },
+		/* 8A */	{ "ADC A,D",         &CZ80::ImplementADCAr,       1,  4,  4, 0, OT_NONE },
+		/* 8B */	{ "ADC A,E",         &CZ80::ImplementADCAr,       1,  4,  4, 0, OT_NONE },
+		/* 8C */	{ "ADC A,H",         &CZ80::ImplementADCAr,       1,  4,  4, 0, OT_NONE },
+		/* 8D */	{ "ADC A,L",         &CZ80::ImplementADCAr,       1,  4,  4, 0, OT_NONE },
+		/* 8E */	{ "ADC A,(HL)",      &CZ80::ImplementADCA_HL_,    1,  7,  7, 0, OT_NONE },
+		/* 8F */	{ "ADC A,A",         &CZ80::ImplementADCAr,       1,  4,  4, 0, OT_NONE },
+		/* 90 */	{ "SUB B",           &CZ80::ImplementSUBr,        1,  4,  4, 0, OT_NONE },
+		/* 91 */	{ "SUB C",           &CZ80::ImplementSUBr,        1,  4,  4, 0, OT_NONE },
+		/* 92 */	{ "SUB D",           &CZ80::ImplementSUBr,        1,  4,  4, 0, OT_NONE },
+		/* 93 */	{ "SUB E",           &CZ80::ImplementSUBr,        1,  4,  4, 0, OT_NONE },
+		/* 94 */	{ "SUB H",           &CZ80::ImplementSUBr,        1,  4,  4, 0, OT_NONE },
+		/* 95 */	{ "SUB L",           &CZ80::ImplementSUBr,        1,  4,  4, 0, OT_NONE },
+		/* 96 */	{ "SUB (HL)",        &CZ80::ImplementSUB_HL_,     1,  7,  7, 0, OT_NONE },
+		/* 97 */	{ "SUB A",           &CZ80::ImplementSUBr,        1,  4,  4, 0, OT_NONE },
+		/* 98 */	{ "SBC A,B",         &CZ80::ImplementSBCAr,       1,  4,  4, 0, OT_NONE },
+		/* 99 */	{ "SBC A,C",         &CZ80::ImplementSBCAr,       1,  4,  4, 0, OT_NONE },
+		/* 9A */	{ "SBC A,D",         &CZ80::ImplementSBCAr,       1,  4,  4, 0, OT_NONE },
+		/* 9B */	{ "SBC A,E",         &CZ80::ImplementSBCAr,       1,  4,  4, 0, OT_NONE },
+		/* 9C */	{ "SBC A,H",         &CZ80::ImplementSBCAr,       1,  4,  4, 0, OT_NONE },
+		/* 9D */	{ "SBC A,L",         &CZ80::ImplementSBCAr,       1,  4,  4, 0, OT_NONE },
+		/* 9E */	{ "SBC A,(HL)",      &CZ80::ImplementSBCA_HL_,    1,  7,  7, 0, OT_NONE },
+		/* 9F */	{ "SBC A,A",         &CZ80::ImplementSBCAr,       1,  4,  4, 0, OT_NONE },
+		/* A0 */	{ "AND B",           &CZ80::ImplementANDr,        1,  4,  4, 0, OT_NONE },
+		/* A1 */	{ "AND C",           &CZ80::ImplementANDr,        1,  4,  4, 0, OT_NONE },
+		/* A2 */	{ "AND D",           &CZ80::ImplementANDr,        1,  4,  4, 0, OT_NONE },
+		/* A3 */	{ "AND E",           &CZ80::ImplementANDr,        1,  4,  4, 0, OT_NONE },
+		/* A4 */	{ "AND H",           &CZ80::ImplementANDr,        1,  4,  4, 0, OT_NONE },
+		/* A5 */	{ "AND L",           &CZ80::ImplementANDr,        1,  4,  4, 0, OT_NONE },
+		/* A6 */	{ "AND (HL)",        &CZ80::ImplementAND_HL_,     1,  7,  7, 0, OT_NONE },
+		/* A7 */	{ "AND A",           &CZ80::ImplementANDr,        1,  4,  4, 0, OT_NONE },
+		/* A8 */	{ "XOR B",           &CZ80::ImplementXORr,        1,  4,  4, 0, OT_NONE },
+		/* A9 */	{ "XOR C",           &CZ80::ImplementXORr,        1,  4,  4, 0, OT_NONE },
+		/* AA */	{ "XOR D",           &CZ80::ImplementXORr,        1,  4,  4, 0, OT_NONE },
+		/* AB */	{ "XOR E",           &CZ80::ImplementXORr,        1,  4,  4, 0, OT_NONE },
+		/* AC */	{ "XOR H",           &CZ80::ImplementXORr,        1,  4,  4, 0, OT_NONE },
+		/* AD */	{ "XOR L",           &CZ80::ImplementXORr,        1,  4,  4, 0, OT_NONE },
+		/* AE */	{ "XOR (HL)",        &CZ80::ImplementXOR_HL_,     1,  7,  7, 0, OT_NONE },
+		/* AF */	{ "XOR A",           &CZ80::ImplementXORr,        1,  4,  4, 0, OT_NONE },
+		/* B0 */	{ "OR B",            &CZ80::ImplementORr,         1,  4,  4, 0, OT_NONE },
+		/* B1 */	{ "OR C",            &CZ80::ImplementORr,         1,  4,  4, 0, OT_NONE },
+		/* B2 */	{ "OR D",            &CZ80::ImplementORr,         1,  4,  4, 0, OT_NONE },
+		/* B3 */	{ "OR E",            &CZ80::ImplementORr,         1,  4,  4, 0, OT_NONE },
+		/* B4 */	{ "OR H",            &CZ80::ImplementORr,         1,  4,  4, 0, OT_NONE },
+		/* B5 */	{ "OR L",            &CZ80::ImplementORr,         1,  4,  4, 0, OT_NONE },
+		/* B6 */	{ "OR (HL)",         &CZ80::ImplementOR_HL_,      1,  7,  7, 0, OT_NONE },
+		/* B7 */	{ "OR A",            &CZ80::ImplementORr,         1,  4,  4, 0, OT_NONE },
+		/* B8 */	{ "CP B",            &CZ80::ImplementCPr,         1,  4,  4, 0, OT_NONE },
+		/* B9 */	{ "CP C",            &CZ80::ImplementCPr,         1,  4,  4, 0, OT_NONE },
+		/* BA */	{ "CP D",            &CZ80::ImplementCPr,         1,  4,  4, 0, OT_NONE },
+		/* BB */	{ "CP E",            &CZ80::ImplementCPr,         1,  4,  4, 0, OT_NONE },
+		/* BC */	{ "CP H",            &CZ80::ImplementCPr,         1,  4,  4, 0, OT_NONE },
+		/* BD */	{ "CP L",            &CZ80::ImplementCPr,         1,  4,  4, 0, OT_NONE },
+		/* BE */	{ "CP (HL)",         &CZ80::ImplementCP_HL_,      1,  7,  7, 0, OT_NONE },
+		/* BF */	{ "CP A",            &CZ80::ImplementCPr,         1,  4,  4, 0, OT_NONE },
+		/* C0 */	{ "RET NZ",          &CZ80::ImplementRETcc,       1,  5, 11, OF_FLOW, OT_NONE },
+		/* C1 */	{ "POP BC",          &CZ80::ImplementPOPqq,       1, 10, 10, 0, OT_NONE },
+		/* C2 */	{ "JP NZ,{nn}",      &CZ80::ImplementJPccnn,      3, 10, 10, OF_FLOW, OT_NONE },
+		/* C3 */	{ "JP {nn}",         &CZ80::ImplementJPnn,        3, 10, 10, OF_FLOW | OF_END, OT_NONE },
+		/* C4 */	{ "CALL NZ,{nn}",    &CZ80::ImplementCALLccnn,    3, 10, 17, OF_FLOW, OT_NONE },
+		/* C5 */	{ "PUSH BC",         &CZ80::ImplementPUSHqq,      1, 11, 11, 0, OT_NONE },
+		/* C6 */	{ "ADD A,{n}",       &CZ80::ImplementADDAn,       2,  7,  7, 0, OT_NONE },
+		/* C7 */	{ "RST $00",         &CZ80::ImplementRSTp,        1, 11, 11, OF_FLOW | OF_END, OT_NONE },
+		/* C8 */	{ "RET Z",           &CZ80::ImplementRETcc,       1,  5, 11, OF_FLOW, OT_NONE },
+		/* C9 */	{ "RET",             &CZ80::ImplementRET,         1, 10, 10, OF_FLOW | OF_END, OT_NONE },
+		/* CA */	{ "JP Z,{nn}",       &CZ80::ImplementJPccnn,      3, 10, 10, OF_FLOW, OT_NONE },
+		/* CB */	PREFIX(OT_CB),
+		/* CC */	{ "CALL Z,{nn}",     &CZ80::ImplementCALLccnn,    3, 10, 17, OF_FLOW, OT_NONE },
+		/* CD */	{ "CALL {nn}",       &CZ80::ImplementCALLnn,      3, 17, 17, OF_FLOW | OF_END, OT_NONE },
+		/* CE */	{ "ADC A,{n}",       &CZ80::ImplementADCAn,       2,  7,  7, 0, OT_NONE },
+		/* CF */	{ "RST $08",         &CZ80::ImplementRSTp,        1, 11, 11, OF_FLOW | OF_END, OT_NONE },
+		/* D0 */	{ "RET NC",          &CZ80::ImplementRETcc,       1,  5, 11, OF_FLOW, OT_NONE },
+		/* D1 */	{ "POP DE",          &CZ80::ImplementPOPqq,       1, 10, 10, 0, OT_NONE },
+		/* D2 */	{ "JP NC,{nn}",      &CZ80::ImplementJPccnn,      3, 10, 10, OF_FLOW, OT_NONE },
+		/* D3 */	{ "OUT ({n}),A",     &CZ80::ImplementOUT_n_A,     2, 11, 11, OF_IO, OT_NONE },
+		/* D4 */	{ "CALL NC,{nn}",    &CZ80::ImplementCALLccnn,    3, 10, 17, OF_FLOW, OT_NONE },
+		/* D5 */	{ "PUSH DE",         &CZ80::ImplementPUSHqq,      1, 11, 11, 0, OT_NONE },
+		/* D6 */	{ "SUB {n}",         &CZ80::ImplementSUBn,        2,  7,  7, 0, OT_NONE },
+		/* D7 */	{ "RST $10",         &CZ80::ImplementRSTp,        1, 11, 11, OF_FLOW | OF_END, OT_NONE },
+		/* D8 */	{ "RET C",           &CZ80::ImplementRETcc,       1,  5, 11, OF_FLOW, OT_NONE },
+		/* D9 */	{ "EXX",             &CZ80::ImplementEXX,         1,  4,  4, 0, OT_NONE },
+		/* DA */	{ "JP C,{nn}",       &CZ80::ImplementJPccnn,      3, 10, 10, OF_FLOW, OT_NONE },
+		/* DB */	{ "IN A,({n})",      &CZ80::ImplementINA_n_,      2, 11, 11, OF_IO, OT_NONE },
+		/* DC */	{ "CALL C,{nn}",     &CZ80::ImplementCALLccnn,    3, 10, 17, OF_FLOW, OT_NONE },
+		/* DD */	PREFIX(OT_DD),
+		/* DE */	{ "SBC A,{n}",       &CZ80::ImplementSBCAn,       2,  7,  7, 0, OT_NONE },
+		/* DF */	{ "RST $18",         &CZ80::ImplementRSTp,        1, 11, 11, OF_FLOW | OF_END, OT_NONE },
+		/* E0 */	{ "RET PO",          &CZ80::ImplementRETcc,       1,  5, 11, OF_FLOW, OT_NONE },
+		/* E1 */	{ "POP HL",          &CZ80::ImplementPOPqq,       1, 10, 10, 0, OT_NONE },
+		/* E2 */	{ "JP PO,{nn}",      &CZ80::ImplementJPccnn,      3, 10, 10, OF_FLOW, OT_NONE },
+		/* E3 */	{ "EX (SP),HL",      &CZ80::ImplementEX_SP_HL,    1, 19, 19, 0, OT_NONE },
+		/* E4 */	{ "CALL PO,{nn}",    &CZ80::ImplementCALLccnn,    3, 10, 17, OF_FLOW, OT_NONE },
+		/* E5 */	{ "PUSH HL",         &CZ80::ImplementPUSHqq,      1, 11, 11, 0, OT_NONE },
+		/* E6 */	{ "AND {n}",         &CZ80::ImplementANDn,        2,  7,  7, 0, OT_NONE },
+		/* E7 */	{ "RST $20",         &CZ80::ImplementRSTp,        1, 11, 11, OF_FLOW | OF_END, OT_NONE },
+		/* E8 */	{ "RET PE",          &CZ80::ImplementRETcc,       1,  5, 11, OF_FLOW, OT_NONE },
+		/* E9 */	{ "JP (HL)",         &CZ80::ImplementJP_HL_,      1,  4,  4, OF_FLOW | OF_END, OT_NONE },
+		/* EA */	{ "JP PE,{nn}",      &CZ80::ImplementJPccnn,      3, 10, 10, OF_FLOW, OT_NONE },
+		/* EB */	{ "EX DE,HL",        &CZ80::ImplementEXDEHL,      1,  4,  4, 0, OT_NONE },
+		/* EC */	{ "CALL PE,{nn}",    &CZ80::ImplementCALLccnn,    3, 10, 17, OF_FLOW, OT_NONE },
+		/* ED */	PREFIX(OT_ED),
+		/* EE */	{ "XOR {n}",         &CZ80::ImplementXORn,        2,  7,  7, 0, OT_NONE },
+		/* EF */	{ "RST $28",         &CZ80::ImplementRSTp,        1, 11, 11, OF_FLOW | OF_END, OT_NONE },
+		/* F0 */	{ "RET P",           &CZ80::ImplementRETcc,       1,  5, 11, OF_FLOW, OT_NONE },
+		/* F1 */	{ "POP AF",          &CZ80::ImplementPOPAF,       1, 10, 10, 0, OT_NONE },
+		/* F2 */	{ "JP P,{nn}",       &CZ80::ImplementJPccnn,      3, 10, 10, OF_FLOW, OT_NONE },
+		/* F3 */	{ "DI",              &CZ80::ImplementDI,          1,  4,  4, 0, OT_NONE },
+		/* F4 */	{ "CALL P,{nn}",     &CZ80::ImplementCALLccnn,    3, 10, 17, OF_FLOW, OT_NONE },
+		/* F5 */	{ "PUSH AF",         &CZ80::ImplementPUSHAF,      1, 11, 11, 0, OT_NONE },
+		/* F6 */	{ "OR {n}",          &CZ80::ImplementORn,         2,  7,  7, 0, OT_NONE },
+		/* F7 */	{ "RST $30",         &CZ80::ImplementRSTp,        1, 11, 11, OF_FLOW | OF_END, OT_NONE },
+		/* F8 */	{ "RET M",           &CZ80::ImplementRETcc,       1,  5, 11, OF_FLOW, OT_NONE },
+		/* F9 */	{ "LD SP,HL",        &CZ80::ImplementLDSPHL,      1,  6,  6, 0, OT_NONE },
+		/* FA */	{ "JP M,{nn}",       &CZ80::ImplementJPccnn,      3, 10, 10, OF_FLOW, OT_NONE },
+		/* FB */	{ "EI",              &CZ80::ImplementEI,          1,  4,  4, 0, OT_NONE },
+		/* FC */	{ "CALL M,{nn}",     &CZ80::ImplementCALLccnn,    3, 10, 17, OF_FLOW, OT_NONE },
+		/* FD */	PREFIX(OT_FD),
+		/* FE */	{ "CP {n}",          &CZ80::ImplementCPn,         2,  7,  7, 0, OT_NONE },
+		/* FF */	{ "RST $38",         &CZ80::ImplementRSTp,        1, 11, 11, OF_FLOW | OF_END, OT_NONE }
+	},
+	// CB
+	{
+		/* 00 */	{ "RLC B",           &CZ80::ImplementRLCr,        2,  8,  8, 0, OT_NONE },
+		/* 01 */	{ "RLC C",           &CZ80::ImplementRLCr,        2,  8,  8, 0, OT_NONE },
+		/* 02 */	{ "RLC D",           &CZ80::ImplementRLCr,        2,  8,  8, 0, OT_NONE },
+		/* 03 */	{ "RLC E",           &CZ80::ImplementRLCr,        2,  8,  8, 0, OT_NONE },
+		/* 04 */	{ "RLC H",           &CZ80::ImplementRLCr,        2,  8,  8, 0, OT_NONE },
+		/* 05 */	{ "RLC L",           &CZ80::ImplementRLCr,        2,  8,  8, 0, OT_NONE },
+		/* 06 */	{ "RLC (HL)",        &CZ80::ImplementRLC_HL_,     2, 15, 15, 0, OT_NONE },
+		/* 07 */	{ "RLC A",           &CZ80::ImplementRLCr,        2,  8,  8, 0, OT_NONE },
+		/* 08 */	{ "RRC B",           &CZ80::ImplementRRCr,        2,  8,  8, 0, OT_NONE },
+		/* 09 */	{ "RRC C",           &CZ80::ImplementRRCr,        2,  8,  8, 0, OT_NONE },
+		/* 0A */	{ "RRC D",           &CZ80::ImplementRRCr,        2,  8,  8, 0, OT_NONE },
+		/* 0B */	{ "RRC E",           &CZ80::ImplementRRCr,        2,  8,  8, 0, OT_NONE },
+		/* 0C */	{ "RRC H",           &CZ80::ImplementRRCr,        2,  8,  8, 0, OT_NONE },
+		/* 0D */	{ "RRC L",           &CZ80::ImplementRRCr,        2,  8,  8, 0, OT_NONE },
+		/* 0E */	{ "RRC (HL)",        &CZ80::ImplementRRC_HL_,     2, 15, 15, 0, OT_NONE },
+		/* 0F */	{ "RRC A",           &CZ80::ImplementRRCr,        2,  8,  8, 0, OT_NONE },
+		/* 10 */	{ "RL B",            &CZ80::ImplementRLr,         2,  8,  8, 0, OT_NONE },
+		/* 11 */	{ "RL C",            &CZ80::ImplementRLr,         2,  8,  8, 0, OT_NONE },
+		/* 12 */	{ "RL D",            &CZ80::ImplementRLr,         2,  8,  8, 0, OT_NONE },
+		/* 13 */	{ "RL E",            &CZ80::ImplementRLr,         2,  8,  8, 0, OT_NONE },
+		/* 14 */	{ "RL H",            &CZ80::ImplementRLr,         2,  8,  8, 0, OT_NONE },
+		/* 15 */	{ "RL L",            &CZ80::ImplementRLr,         2,  8,  8, 0, OT_NONE },
+		/* 16 */	{ "RL (HL)",         &CZ80::ImplementRL_HL_,      2, 15, 15, 0, OT_NONE },
+		/* 17 */	{ "RL A",            &CZ80::ImplementRLr,         2,  8,  8, 0, OT_NONE },
+		/* 18 */	{ "RR B",            &CZ80::ImplementRRr,         2,  8,  8, 0, OT_NONE },
+		/* 19 */	{ "RR C",            &CZ80::ImplementRRr,         2,  8,  8, 0, OT_NONE },
+		/* 1A */	{ "RR D",            &CZ80::ImplementRRr,         2,  8,  8, 0, OT_NONE },
+		/* 1B */	{ "RR E",            &CZ80::ImplementRRr,         2,  8,  8, 0, OT_NONE },
+		/* 1C */	{ "RR H",            &CZ80::ImplementRRr,         2,  8,  8, 0, OT_NONE },
+		/* 1D */	{ "RR L",            &CZ80::ImplementRRr,         2,  8,  8, 0, OT_NONE },
+		/* 1E */	{ "RR (HL)",         &CZ80::ImplementRR_HL_,      2, 15, 15, 0, OT_NONE },
+		/* 1F */	{ "RR A",            &CZ80::ImplementRRr,         2,  8,  8, 0, OT_NONE },
+		/* 20 */	{ "SLA B",           &CZ80::ImplementSLAr,        2,  8,  8, 0, OT_NONE },
+		/* 21 */	{ "SLA C",           &CZ80::ImplementSLAr,        2,  8,  8, 0, OT_NONE },
+		/* 22 */	{ "SLA D",           &CZ80::ImplementSLAr,        2,  8,  8, 0, OT_NONE },
+		/* 23 */	{ "SLA E",           &CZ80::ImplementSLAr,        2,  8,  8, 0, OT_NONE },
+		/* 24 */	{ "SLA H",           &CZ80::ImplementSLAr,        2,  8,  8, 0, OT_NONE },
+		/* 25 */	{ "SLA L",           &CZ80::ImplementSLAr,        2,  8,  8, 0, OT_NONE },
+		/* 26 */	{ "SLA (HL)",        &CZ80::ImplementSLA_HL_,     2, 15, 15, 0, OT_NONE },
+		/* 27 */	{ "SLA A",           &CZ80::ImplementSLAr,        2,  8,  8, 0, OT_NONE },
+		/* 28 */	{ "SRA B",           &CZ80::ImplementSRAr,        2,  8,  8, 0, OT_NONE },
+		/* 29 */	{ "SRA C",           &CZ80::ImplementSRAr,        2,  8,  8, 0, OT_NONE },
+		/* 2A */	{ "SRA D",           &CZ80::ImplementSRAr,        2,  8,  8, 0, OT_NONE },
+		/* 2B */	{ "SRA E",           &CZ80::ImplementSRAr,        2,  8,  8, 0, OT_NONE },
+		/* 2C */	{ "SRA H",           &CZ80::ImplementSRAr,        2,  8,  8, 0, OT_NONE },
+		/* 2D */	{ "SRA L",           &CZ80::ImplementSRAr,        2,  8,  8, 0, OT_NONE },
+		/* 2E */	{ "SRA (HL)",        &CZ80::ImplementSRA_HL_,     2, 15, 15, 0, OT_NONE },
+		/* 2F */	{ "SRA A",           &CZ80::ImplementSRAr,        2,  8,  8, 0, OT_NONE },
+		/* 30 */	{ "SLL B",           &CZ80::ImplementSLLr,        2,  8,  8, 0, OT_NONE },
+		/* 31 */	{ "SLL C",           &CZ80::ImplementSLLr,        2,  8,  8, 0, OT_NONE },
+		/* 32 */	{ "SLL D",           &CZ80::ImplementSLLr,        2,  8,  8, 0, OT_NONE },
+		/* 33 */	{ "SLL E",           &CZ80::ImplementSLLr,        2,  8,  8, 0, OT_NONE },
+		/* 34 */	{ "SLL H",           &CZ80::ImplementSLLr,        2,  8,  8, 0, OT_NONE },
+		/* 35 */	{ "SLL L",           &CZ80::ImplementSLLr,        2,  8,  8, 0, OT_NONE },
+		/* 36 */	{ "SLL (HL)",        &CZ80::ImplementSLL_HL_,     2, 15, 15, 0, OT_NONE },
+		/* 37 */	{ "SLL A",           &CZ80::ImplementSLLr,        2,  8,  8, 0, OT_NONE },
+		/* 38 */	{ "SRL B",           &CZ80::ImplementSRLr,        2,  8,  8, 0, OT_NONE },
+		/* 39 */	{ "SRL C",           &CZ80::ImplementSRLr,        2,  8,  8, 0, OT_NONE },
+		/* 3A */	{ "SRL D",           &CZ80::ImplementSRLr,        2,  8,  8, 0, OT_NONE },
+		/* 3B */	{ "SRL E",           &CZ80::ImplementSRLr,        2,  8,  8, 0, OT_NONE },
+		/* 3C */	{ "SRL H",           &CZ80::ImplementSRLr,        2,  8,  8, 0, OT_NONE },
+		/* 3D */	{ "SRL L",           &CZ80::ImplementSRLr,        2,  8,  8, 0, OT_NONE },
+		/* 3E */	{ "SRL (HL)",        &CZ80::ImplementSRL_HL_,     2, 15, 15, 0, OT_NONE },
+		/* 3F */	{ "SRL A",           &CZ80::ImplementSRLr,        2,  8,  8, 0, OT_NONE },
+		/* 40 */	{ "BIT 0,B",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 41 */	{ "BIT 0,C",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 42 */	{ "BIT 0,D",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 43 */	{ "BIT 0,E",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 44 */	{ "BIT 0,H",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 45 */	{ "BIT 0,L",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 46 */	{ "BIT 0,(HL)",      &CZ80::ImplementBITb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 47 */	{ "BIT 0,A",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 48 */	{ "BIT 1,B",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 49 */	{ "BIT 1,C",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 4A */	{ "BIT 1,D",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 4B */	{ "BIT 1,E",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 4C */	{ "BIT 1,H",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 4D */	{ "BIT 1,L",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 4E */	{ "BIT 1,(HL)",      &CZ80::ImplementBITb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 4F */	{ "BIT 1,A",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 50 */	{ "BIT 2,B",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 51 */	{ "BIT 2,C",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 52 */	{ "BIT 2,D",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 53 */	{ "BIT 2,E",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 54 */	{ "BIT 2,H",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 55 */	{ "BIT 2,L",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 56 */	{ "BIT 2,(HL)",      &CZ80::ImplementBITb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 57 */	{ "BIT 2,A",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 58 */	{ "BIT 3,B",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 59 */	{ "BIT 3,C",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 5A */	{ "BIT 3,D",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 5B */	{ "BIT 3,E",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 5C */	{ "BIT 3,H",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 5D */	{ "BIT 3,L",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 5E */	{ "BIT 3,(HL)",      &CZ80::ImplementBITb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 5F */	{ "BIT 3,A",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 60 */	{ "BIT 4,B",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 61 */	{ "BIT 4,C",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 62 */	{ "BIT 4,D",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 63 */	{ "BIT 4,E",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 64 */	{ "BIT 4,H",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 65 */	{ "BIT 4,L",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 66 */	{ "BIT 4,(HL)",      &CZ80::ImplementBITb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 67 */	{ "BIT 4,A",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 68 */	{ "BIT 5,B",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 69 */	{ "BIT 5,C",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 6A */	{ "BIT 5,D",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 6B */	{ "BIT 5,E",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 6C */	{ "BIT 5,H",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 6D */	{ "BIT 5,L",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 6E */	{ "BIT 5,(HL)",      &CZ80::ImplementBITb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 6F */	{ "BIT 5,A",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 70 */	{ "BIT 6,B",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 71 */	{ "BIT 6,C",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 72 */	{ "BIT 6,D",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 73 */	{ "BIT 6,E",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 74 */	{ "BIT 6,H",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 75 */	{ "BIT 6,L",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 76 */	{ "BIT 6,(HL)",      &CZ80::ImplementBITb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 77 */	{ "BIT 6,A",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 78 */	{ "BIT 7,B",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 79 */	{ "BIT 7,C",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 7A */	{ "BIT 7,D",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 7B */	{ "BIT 7,E",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 7C */	{ "BIT 7,H",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 7D */	{ "BIT 7,L",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 7E */	{ "BIT 7,(HL)",      &CZ80::ImplementBITb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 7F */	{ "BIT 7,A",         &CZ80::ImplementBITbr,       2,  8,  8, 0, OT_NONE },
+		/* 80 */	{ "RES 0,B",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 81 */	{ "RES 0,C",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 82 */	{ "RES 0,D",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 83 */	{ "RES 0,E",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 84 */	{ "RES 0,H",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 85 */	{ "RES 0,L",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 86 */	{ "RES 0,(HL)",      &CZ80::ImplementRESb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 87 */	{ "RES 0,A",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 88 */	{ "RES 1,B",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 89 */	{ "RES 1,C",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 8A */	{ "RES 1,D",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 8B */	{ "RES 1,E",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 8C */	{ "RES 1,H",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 8D */	{ "RES 1,L",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 8E */	{ "RES 1,(HL)",      &CZ80::ImplementRESb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 8F */	{ "RES 1,A",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 90 */	{ "RES 2,B",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 91 */	{ "RES 2,C",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 92 */	{ "RES 2,D",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 93 */	{ "RES 2,E",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 94 */	{ "RES 2,H",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 95 */	{ "RES 2,L",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 96 */	{ "RES 2,(HL)",      &CZ80::ImplementRESb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 97 */	{ "RES 2,A",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 98 */	{ "RES 3,B",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 99 */	{ "RES 3,C",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 9A */	{ "RES 3,D",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 9B */	{ "RES 3,E",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 9C */	{ "RES 3,H",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 9D */	{ "RES 3,L",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* 9E */	{ "RES 3,(HL)",      &CZ80::ImplementRESb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* 9F */	{ "RES 3,A",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A0 */	{ "RES 4,B",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A1 */	{ "RES 4,C",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A2 */	{ "RES 4,D",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A3 */	{ "RES 4,E",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A4 */	{ "RES 4,H",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A5 */	{ "RES 4,L",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A6 */	{ "RES 4,(HL)",      &CZ80::ImplementRESb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* A7 */	{ "RES 4,A",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A8 */	{ "RES 5,B",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* A9 */	{ "RES 5,C",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* AA */	{ "RES 5,D",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* AB */	{ "RES 5,E",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* AC */	{ "RES 5,H",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* AD */	{ "RES 5,L",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* AE */	{ "RES 5,(HL)",      &CZ80::ImplementRESb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* AF */	{ "RES 5,A",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B0 */	{ "RES 6,B",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B1 */	{ "RES 6,C",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B2 */	{ "RES 6,D",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B3 */	{ "RES 6,E",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B4 */	{ "RES 6,H",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B5 */	{ "RES 6,L",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B6 */	{ "RES 6,(HL)",      &CZ80::ImplementRESb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* B7 */	{ "RES 6,A",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B8 */	{ "RES 7,B",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* B9 */	{ "RES 7,C",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* BA */	{ "RES 7,D",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* BB */	{ "RES 7,E",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* BC */	{ "RES 7,H",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* BD */	{ "RES 7,L",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* BE */	{ "RES 7,(HL)",      &CZ80::ImplementRESb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* BF */	{ "RES 7,A",         &CZ80::ImplementRESbr,       2,  8,  8, 0, OT_NONE },
+		/* C0 */	{ "SET 0,B",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* C1 */	{ "SET 0,C",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* C2 */	{ "SET 0,D",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* C3 */	{ "SET 0,E",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* C4 */	{ "SET 0,H",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* C5 */	{ "SET 0,L",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* C6 */	{ "SET 0,(HL)",      &CZ80::ImplementSETb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* C7 */	{ "SET 0,A",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* C8 */	{ "SET 1,B",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* C9 */	{ "SET 1,C",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* CA */	{ "SET 1,D",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* CB */	{ "SET 1,E",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* CC */	{ "SET 1,H",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* CD */	{ "SET 1,L",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* CE */	{ "SET 1,(HL)",      &CZ80::ImplementSETb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* CF */	{ "SET 1,A",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D0 */	{ "SET 2,B",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D1 */	{ "SET 2,C",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D2 */	{ "SET 2,D",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D3 */	{ "SET 2,E",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D4 */	{ "SET 2,H",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D5 */	{ "SET 2,L",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D6 */	{ "SET 2,(HL)",      &CZ80::ImplementSETb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* D7 */	{ "SET 2,A",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D8 */	{ "SET 3,B",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* D9 */	{ "SET 3,C",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* DA */	{ "SET 3,D",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* DB */	{ "SET 3,E",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* DC */	{ "SET 3,H",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* DD */	{ "SET 3,L",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* DE */	{ "SET 3,(HL)",      &CZ80::ImplementSETb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* DF */	{ "SET 3,A",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E0 */	{ "SET 4,B",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E1 */	{ "SET 4,C",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E2 */	{ "SET 4,D",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E3 */	{ "SET 4,E",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E4 */	{ "SET 4,H",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E5 */	{ "SET 4,L",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E6 */	{ "SET 4,(HL)",      &CZ80::ImplementSETb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* E7 */	{ "SET 4,A",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E8 */	{ "SET 5,B",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* E9 */	{ "SET 5,C",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* EA */	{ "SET 5,D",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* EB */	{ "SET 5,E",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* EC */	{ "SET 5,H",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* ED */	{ "SET 5,L",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* EE */	{ "SET 5,(HL)",      &CZ80::ImplementSETb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* EF */	{ "SET 5,A",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F0 */	{ "SET 6,B",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F1 */	{ "SET 6,C",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F2 */	{ "SET 6,D",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F3 */	{ "SET 6,E",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F4 */	{ "SET 6,H",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F5 */	{ "SET 6,L",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F6 */	{ "SET 6,(HL)",      &CZ80::ImplementSETb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* F7 */	{ "SET 6,A",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F8 */	{ "SET 7,B",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* F9 */	{ "SET 7,C",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* FA */	{ "SET 7,D",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* FB */	{ "SET 7,E",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* FC */	{ "SET 7,H",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* FD */	{ "SET 7,L",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE },
+		/* FE */	{ "SET 7,(HL)",      &CZ80::ImplementSETb_HL_,    2, 12, 12, 0, OT_NONE },
+		/* FF */	{ "SET 7,A",         &CZ80::ImplementSETbr,       2,  8,  8, 0, OT_NONE }
+	},
+	// ED
+	{
+		/* 00 */	ILLEGAL,
+		/* 01 */	ILLEGAL,
+		/* 02 */	ILLEGAL,
+		/* 03 */	ILLEGAL,
+		/* 04 */	ILLEGAL,
+		/* 05 */	ILLEGAL,
+		/* 06 */	ILLEGAL,
+		/* 07 */	ILLEGAL,
+		/* 08 */	ILLEGAL,
+		/* 09 */	ILLEGAL,
+		/* 0A */	ILLEGAL,
+		/* 0B */	ILLEGAL,
+		/* 0C */	ILLEGAL,
+		/* 0D */	ILLEGAL,
+		/* 0E */	ILLEGAL,
+		/* 0F */	ILLEGAL,
+		/* 10 */	ILLEGAL,
+		/* 11 */	ILLEGAL,
+		/* 12 */	ILLEGAL,
+		/* 13 */	ILLEGAL,
+		/* 14 */	ILLEGAL,
+		/* 15 */	ILLEGAL,
+		/* 16 */	ILLEGAL,
+		/* 17 */	ILLEGAL,
+		/* 18 */	ILLEGAL,
+		/* 19 */	ILLEGAL,
+		/* 1A */	ILLEGAL,
+		/* 1B */	ILLEGAL,
+		/* 1C */	ILLEGAL,
+		/* 1D */	ILLEGAL,
+		/* 1E */	ILLEGAL,
+		/* 1F */	ILLEGAL,
+		/* 20 */	ILLEGAL,
+		/* 21 */	ILLEGAL,
+		/* 22 */	ILLEGAL,
+		/* 23 */	ILLEGAL,
+		/* 24 */	ILLEGAL,
+		/* 25 */	ILLEGAL,
+		/* 26 */	ILLEGAL,
+		/* 27 */	ILLEGAL,
+		/* 28 */	ILLEGAL,
+		/* 29 */	ILLEGAL,
+		/* 2A */	ILLEGAL,
+		/* 2B */	ILLEGAL,
+		/* 2C */	ILLEGAL,
+		/* 2D */	ILLEGAL,
+		/* 2E */	ILLEGAL,
+		/* 2F */	ILLEGAL,
+		/* 30 */	ILLEGAL,
+		/* 31 */	ILLEGAL,
+		/* 32 */	ILLEGAL,
+		/* 33 */	ILLEGAL,
+		/* 34 */	ILLEGAL,
+		/* 35 */	ILLEGAL,
+		/* 36 */	ILLEGAL,
+		/* 37 */	ILLEGAL,
+		/* 38 */	ILLEGAL,
+		/* 39 */	ILLEGAL,
+		/* 3A */	ILLEGAL,
+		/* 3B */	ILLEGAL,
+		/* 3C */	ILLEGAL,
+		/* 3D */	ILLEGAL,
+		/* 3E */	ILLEGAL,
+		/* 3F */	ILLEGAL,
+		/* 40 */	{ "IN B,(C)",        &CZ80::ImplementINr_C_,      2, 12, 12, OF_IO, OT_NONE },
+		/* 41 */	{ "OUT (C),B",       &CZ80::ImplementOUT_C_r,     2, 12, 12, OF_IO, OT_NONE },
+		/* 42 */	{ "SBC HL,BC",       &CZ80::ImplementSBCHLdd,     2, 15, 15, 0, OT_NONE },
+		/* 43 */	{ "LD ({nn}),BC",    &CZ80::ImplementLD_nn_dd,    4, 20, 20, 0, OT_NONE },
+		/* 44 */	{ "NEG",             &CZ80::ImplementNEG,         2,  8,  8, 0, OT_NONE },
+		/* 45 */	{ "RETN",            &CZ80::ImplementRETN,        2, 14, 14, OF_FLOW | OF_END, OT_NONE },
+		/* 46 */	{ "IM 0",            &CZ80::ImplementIM0,         2,  8,  8, 0, OT_NONE },
+		/* 47 */	{ "LD I,A",          &CZ80::ImplementLDIA,        2,  9,  9, 0, OT_NONE },
+		/* 48 */	{ "IN C,(C)",        &CZ80::ImplementINr_C_,      2, 12, 12, OF_IO, OT_NONE },
+		/* 49 */	{ "OUT (C),C",       &CZ80::ImplementOUT_C_r,     2, 12, 12, OF_IO, OT_NONE },
+		/* 4A */	{ "ADC HL,BC",       &CZ80::ImplementADCHLdd,     2, 15, 15, 0, OT_NONE },
+		/* 4B */	{ "LD BC,({nn})",    &CZ80::ImplementLDdd_nn_,    4, 20, 20, 0, OT_NONE },
+		/* 4C */	ILLEGAL,
+		/* 4D */	{ "RETI",            &CZ80::ImplementRETI,        2, 14, 14, OF_FLOW | OF_END, OT_NONE },
+		/* 4E */	ILLEGAL,
+		/* 4F */	{ "LD R,A",          &CZ80::ImplementLDRA,        2,  9,  9, 0, OT_NONE },
+		/* 50 */	{ "IN D,(C)",        &CZ80::ImplementINr_C_,      2, 12, 12, OF_IO, OT_NONE },
+		/* 51 */	{ "OUT (C),D",       &CZ80::ImplementOUT_C_r,     2, 12, 12, OF_IO, OT_NONE },
+		/* 52 */	{ "SBC HL,DE",       &CZ80::ImplementSBCHLdd,     2, 15, 15, 0, OT_NONE },
+		/* 53 */	{ "LD ({nn}),DE",    &CZ80::ImplementLD_nn_dd,    4, 20, 20, 0, OT_NONE },
+		/* 54 */	ILLEGAL,
+		/* 55 */	ILLEGAL,
+		/* 56 */	{ "IM 1",            &CZ80::ImplementIM1,         2,  8,  8, 0, OT_NONE },
+		/* 57 */	{ "LD A,I",          &CZ80::ImplementLDAI,        2,  9,  9, 0, OT_NONE },
+		/* 58 */	{ "IN E,(C)",        &CZ80::ImplementINr_C_,      2, 12, 12, OF_IO, OT_NONE },
+		/* 59 */	{ "OUT (C),E",       &CZ80::ImplementOUT_C_r,     2, 12, 12, OF_IO, OT_NONE },
+		/* 5A */	{ "ADC HL,DE",       &CZ80::ImplementADCHLdd,     2, 15, 15, 0, OT_NONE },
+		/* 5B */	{ "LD DE,({nn})",    &CZ80::ImplementLDdd_nn_,    4, 20, 20, 0, OT_NONE },
+		/* 5C */	ILLEGAL,
+		/* 5D */	ILLEGAL,
+		/* 5E */	{ "IM 2",            &CZ80::ImplementIM2,         2,  8,  8, 0, OT_NONE },
+		/* 5F */	{ "LD A,R",          &CZ80::ImplementLDAR,        2,  9,  9, 0, OT_NONE },
+		/* 60 */	{ "IN H,(C)",        &CZ80::ImplementINr_C_,      2, 12, 12, OF_IO, OT_NONE },
+		/* 61 */	{ "OUT (C),H",       &CZ80::ImplementOUT_C_r,     2, 12, 12, OF_IO, OT_NONE },
+		/* 62 */	{ "SBC HL,HL",       &CZ80::ImplementSBCHLdd,     2, 15, 15, 0, OT_NONE },
+		/* 63 */	{ "LD ({nn}),HL",    &CZ80::ImplementLD_nn_dd,    4, 20, 20, 0, OT_NONE },
+		/* 64 */	ILLEGAL,
+		/* 65 */	ILLEGAL,
+		/* 66 */	ILLEGAL,
+		/* 67 */	{ "RRD",             &CZ80::ImplementRRD,         2, 18, 18, 0, OT_NONE },
+		/* 68 */	{ "IN L,(C)",        &CZ80::ImplementINr_C_,      2, 12, 12, OF_IO, OT_NONE },
+		/* 69 */	{ "OUT (C),L",       &CZ80::ImplementOUT_C_r,     2, 12, 12, OF_IO, OT_NONE },
+		/* 6A */	{ "ADC HL,HL",       &CZ80::ImplementADCHLdd,     2, 15, 15, 0, OT_NONE },
+		/* 6B */	{ "LD HL,({nn})",    &CZ80::ImplementLDdd_nn_,    4, 20, 20, 0, OT_NONE },
+		/* 6C */	ILLEGAL,
+		/* 6D */	ILLEGAL,
+		/* 6E */	ILLEGAL,
+		/* 6F */	{ "RLD",             &CZ80::ImplementRLD,         2, 18, 18, 0, OT_NONE },
+		/* 70 */	ILLEGAL,
+		/* 71 */	ILLEGAL,
+		/* 72 */	{ "SBC HL,SP",       &CZ80::ImplementSBCHLdd,     2, 15, 15, 0, OT_NONE },
+		/* 73 */	{ "LD ({nn}),SP",    &CZ80::ImplementLD_nn_dd,    4, 20, 20, 0, OT_NONE },
+		/* 74 */	ILLEGAL,
+		/* 75 */	ILLEGAL,
+		/* 76 */	ILLEGAL,
+		/* 77 */	ILLEGAL,
+		/* 78 */	{ "IN A,(C)",        &CZ80::ImplementINr_C_,      2, 12, 12, OF_IO, OT_NONE },
+		/* 79 */	{ "OUT (C),A",       &CZ80::ImplementOUT_C_r,     2, 12, 12, OF_IO, OT_NONE },
+		/* 7A */	{ "ADC HL,SP",       &CZ80::ImplementADCHLdd,     2, 15, 15, 0, OT_NONE },
+		/* 7B */	{ "LD SP,({nn})",    &CZ80::ImplementLDdd_nn_,    4, 20, 20, 0, OT_NONE },
+		/* 7C */	ILLEGAL,
+		/* 7D */	ILLEGAL,
+		/* 7E */	ILLEGAL,
+		/* 7F */	ILLEGAL,
+		/* 80 */	ILLEGAL,
+		/* 81 */	ILLEGAL,
+		/* 82 */	ILLEGAL,
+		/* 83 */	ILLEGAL,
+		/* 84 */	ILLEGAL,
+		/* 85 */	ILLEGAL,
+		/* 86 */	ILLEGAL,
+		/* 87 */	ILLEGAL,
+		/* 88 */	ILLEGAL,
+		/* 89 */	ILLEGAL,
+		/* 8A */	ILLEGAL,
+		/* 8B */	ILLEGAL,
+		/* 8C */	ILLEGAL,
+		/* 8D */	ILLEGAL,
+		/* 8E */	ILLEGAL,
+		/* 8F */	ILLEGAL,
+		/* 90 */	ILLEGAL,
+		/* 91 */	ILLEGAL,
+		/* 92 */	ILLEGAL,
+		/* 93 */	ILLEGAL,
+		/* 94 */	ILLEGAL,
+		/* 95 */	ILLEGAL,
+		/* 96 */	ILLEGAL,
+		/* 97 */	ILLEGAL,
+		/* 98 */	ILLEGAL,
+		/* 99 */	ILLEGAL,
+		/* 9A */	ILLEGAL,
+		/* 9B */	ILLEGAL,
+		/* 9C */	ILLEGAL,
+		/* 9D */	ILLEGAL,
+		/* 9E */	ILLEGAL,
+		/* 9F */	ILLEGAL,
+		/* A0 */	{ "LDI",             &CZ80::ImplementLDI,         2, 16, 16, OF_BLOCK, OT_NONE },
+		/* A1 */	{ "CPI",             &CZ80::ImplementCPI,         2, 16, 16, OF_BLOCK, OT_NONE },
+		/* A2 */	{ "INI",             &CZ80::ImplementINI,         2, 16, 16, OF_IO | OF_BLOCK, OT_NONE },
+		/* A3 */	{ "OUTI",            &CZ80::ImplementOUTI,        2, 16, 16, OF_IO | OF_BLOCK, OT_NONE },
+		/* A4 */	ILLEGAL,
+		/* A5 */	ILLEGAL,
+		/* A6 */	ILLEGAL,
+		/* A7 */	ILLEGAL,
+		/* A8 */	{ "LDD",             &CZ80::ImplementLDD,         2, 16, 16, OF_BLOCK, OT_NONE },
+		/* A9 */	{ "CPD",             &CZ80::ImplementCPD,         2, 16, 16, OF_BLOCK, OT_NONE },
+		/* AA */	{ "IND",             &CZ80::ImplementIND,         2, 16, 16, OF_IO | OF_BLOCK, OT_NONE },
+		/* AB */	{ "OUTD",            &CZ80::ImplementOUTD,        2, 16, 16, OF_IO | OF_BLOCK, OT_NONE },
+		/* AC */	ILLEGAL,
+		/* AD */	ILLEGAL,
+		/* AE */	ILLEGAL,
+		/* AF */	ILLEGAL,
+		/* B0 */	{ "LDIR",            &CZ80::ImplementLDIR,        2, 16, 21, OF_BLOCK, OT_NONE },
+		/* B1 */	{ "CPIR",            &CZ80::ImplementCPIR,        2, 16, 21, OF_BLOCK, OT_NONE },
+		/* B2 */	{ "INIR",            &CZ80::ImplementINIR,        2, 16, 21, OF_IO | OF_BLOCK, OT_NONE },
+		/* B3 */	{ "OTIR",            &CZ80::ImplementOTIR,        2, 16, 21, OF_IO | OF_BLOCK, OT_NONE },
+		/* B4 */	ILLEGAL,
+		/* B5 */	ILLEGAL,
+		/* B6 */	ILLEGAL,
+		/* B7 */	ILLEGAL,
+		/* B8 */	{ "LDDR",            &CZ80::ImplementLDDR,        2, 16, 21, OF_BLOCK, OT_NONE },
+		/* B9 */	{ "CPDR",            &CZ80::ImplementCPDR,        2, 16, 21, OF_BLOCK, OT_NONE },
+		/* BA */	{ "INDR",            &CZ80::ImplementINDR,        2, 16, 21, OF_IO | OF_BLOCK, OT_NONE },
+		/* BB */	{ "OTDR",            &CZ80::ImplementOTDR,        2, 16, 21, OF_IO | OF_BLOCK, OT_NONE },
+		/* BC */	ILLEGAL,
+		/* BD */	ILLEGAL,
+		/* BE */	ILLEGAL,
+		/* BF */	ILLEGAL,
+		/* C0 */	ILLEGAL,
+		/* C1 */	ILLEGAL,
+		/* C2 */	ILLEGAL,
+		/* C3 */	ILLEGAL,
+		/* C4 */	ILLEGAL,
+		/* C5 */	ILLEGAL,
+		/* C6 */	ILLEGAL,
+		/* C7 */	ILLEGAL,
+		/* C8 */	ILLEGAL,
+		/* C9 */	ILLEGAL,
+		/* CA */	ILLEGAL,
+		/* CB */	ILLEGAL,
+		/* CC */	ILLEGAL,
+		/* CD */	ILLEGAL,
+		/* CE */	ILLEGAL,
+		/* CF */	ILLEGAL,
+		/* D0 */	ILLEGAL,
+		/* D1 */	ILLEGAL,
+		/* D2 */	ILLEGAL,
+		/* D3 */	ILLEGAL,
+		/* D4 */	ILLEGAL,
+		/* D5 */	ILLEGAL,
+		/* D6 */	ILLEGAL,
+		/* D7 */	ILLEGAL,
+		/* D8 */	ILLEGAL,
+		/* D9 */	ILLEGAL,
+		/* DA */	ILLEGAL,
+		/* DB */	ILLEGAL,
+		/* DC */	ILLEGAL,
+		/* DD */	ILLEGAL,
+		/* DE */	ILLEGAL,
+		/* DF */	ILLEGAL,
+		/* E0 */	ILLEGAL,
+		/* E1 */	ILLEGAL,
+		/* E2 */	ILLEGAL,
+		/* E3 */	ILLEGAL,
+		/* E4 */	ILLEGAL,
+		/* E5 */	ILLEGAL,
+		/* E6 */	ILLEGAL,
+		/* E7 */	ILLEGAL,
+		/* E8 */	ILLEGAL,
+		/* E9 */	ILLEGAL,
+		/* EA */	ILLEGAL,
+		/* EB */	ILLEGAL,
+		/* EC */	ILLEGAL,
+		/* ED */	ILLEGAL,
+		/* EE */	ILLEGAL,
+		/* EF */	ILLEGAL,
+		/* F0 */	ILLEGAL,
+		/* F1 */	ILLEGAL,
+		/* F2 */	ILLEGAL,
+		/* F3 */	ILLEGAL,
+		/* F4 */	ILLEGAL,
+		/* F5 */	ILLEGAL,
+		/* F6 */	ILLEGAL,
+		/* F7 */	ILLEGAL,
+		/* F8 */	ILLEGAL,
+		/* F9 */	ILLEGAL,
+		/* FA */	ILLEGAL,
+		/* FB */	ILLEGAL,
+		/* FC */	ILLEGAL,
+		/* FD */	ILLEGAL,
+		/* FE */	ILLEGAL,
+		/* FF */	ILLEGAL
+	},
+	// DD (IX)
+	{
+		/* 00 */	{ "NOP",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 01 */	{ "LD BC,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, 0, OT_NONE },
+		/* 02 */	{ "LD (BC),A",       &CZ80::ImplementUnindexed,   2, 11, 11, 0, OT_NONE },
+		/* 03 */	{ "INC BC",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 04 */	{ "INC B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 05 */	{ "DEC B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 06 */	{ "LD B,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 07 */	{ "RLCA",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 08 */	{ "EX AF,AF'",       &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 09 */	{ "ADD IX,BC",       &CZ80::ImplementADDIXdd,     2, 15, 15, 0, OT_NONE },
+		/* 0A */	{ "LD A,(BC)",       &CZ80::ImplementUnindexed,   2, 11, 11, 0, OT_NONE },
+		/* 0B */	{ "DEC BC",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 0C */	{ "INC C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 0D */	{ "DEC C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 0E */	{ "LD C,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 0F */	{ "RRCA",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 10 */	{ "DJNZ {e}",        &CZ80::ImplementUnindexed,   3, 12, 17, OF_FLOW, OT_NONE },
+		/* 11 */	{ "LD DE,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, 0, OT_NONE },
+		/* 12 */	{ "LD (DE),A",       &CZ80::ImplementUnindexed,   2, 11, 11, 0, OT_NONE },
+		/* 13 */	{ "INC DE",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 14 */	{ "INC D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 15 */	{ "DEC D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 16 */	{ "LD D,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 17 */	{ "RLA",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 18 */	{ "JR {e}",          &CZ80::ImplementUnindexed,   3, 16, 16, OF_FLOW | OF_END, OT_NONE },
+		/* 19 */	{ "ADD IX,DE",       &CZ80::ImplementADDIXdd,     2, 15, 15, 0, OT_NONE },
+		/* 1A */	{ "LD A,(DE)",       &CZ80::ImplementUnindexed,   2, 11, 11, 0, OT_NONE },
+		/* 1B */	{ "DEC DE",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 1C */	{ "INC E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 1D */	{ "DEC E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 1E */	{ "LD E,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 1F */	{ "RRA",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 20 */	{ "JR NZ,{e}",       &CZ80::ImplementUnindexed,   3, 11, 16, OF_FLOW, OT_NONE },
+		/* 21 */	{ "LD IX,{nn}",      &CZ80::ImplementLDIXnn,      4, 14, 14, 0, OT_NONE },
+		/* 22 */	{ "LD ({nn}),IX",    &CZ80::ImplementLD_nn_IX,    4, 20, 20, 0, OT_NONE },
+		/* 23 */	{ "INC IX",          &CZ80::ImplementINCIX,       2, 10, 10, 0, OT_NONE },
+		/* 24 */	{ "INC IXh",         &CZ80::ImplementINCIXh,      2,  8,  8, 0, OT_NONE },
+		/* 25 */	{ "DEC IXh",         &CZ80::ImplementDECIXh,      2,  8,  8, 0, OT_NONE },
+		/* 26 */	{ "LD IXh,{n}",      &CZ80::ImplementLDIXhn,      3, 11, 11, 0, OT_NONE },
+		/* 27 */	{ "DAA",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 28 */	{ "JR Z,{e}",        &CZ80::ImplementUnindexed,   3, 11, 16, OF_FLOW, OT_NONE },
+		/* 29 */	{ "ADD IX,IX",       &CZ80::ImplementADDIXdd,     2, 15, 15, 0, OT_NONE },
+		/* 2A */	{ "LD IX,({nn})",    &CZ80::ImplementLDIX_nn_,    4, 20, 20, 0, OT_NONE },
+		/* 2B */	{ "DEC IX",          &CZ80::ImplementDECIX,       2, 10, 10, 0, OT_NONE },
+		/* 2C */	{ "INC IXl",         &CZ80::ImplementINCIXl,      2,  8,  8, 0, OT_NONE },
+		/* 2D */	{ "DEC IXl",         &CZ80::ImplementDECIXl,      2,  8,  8, 0, OT_NONE },
+		/* 2E */	{ "LD IXl,{n}",      &CZ80::ImplementLDIXln,      3, 11, 11, 0, OT_NONE },
+		/* 2F */	{ "CPL",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 30 */	{ "JR NC,{e}",       &CZ80::ImplementUnindexed,   3, 11, 16, OF_FLOW, OT_NONE },
+		/* 31 */	{ "LD SP,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, 0, OT_NONE },
+		/* 32 */	{ "LD ({nn}),A",     &CZ80::ImplementUnindexed,   4, 17, 17, 0, OT_NONE },
+		/* 33 */	{ "INC SP",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 34 */	{ "INC (IX+{d})",    &CZ80::ImplementINC_IXd_,    3, 23, 23, 0, OT_NONE },
+		/* 35 */	{ "DEC (IX+{d})",    &CZ80::ImplementDEC_IXd_,    3, 23, 23, 0, OT_NONE },
+		/* 36 */	{ "LD (IX+{d}),{n}", &CZ80::ImplementLD_IXd_n,    4, 19, 19, 0, OT_NONE },
+		/* 37 */	{ "SCF",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 38 */	{ "JR C,{e}",        &CZ80::ImplementUnindexed,   3, 11, 16, OF_FLOW, OT_NONE },
+		/* 39 */	{ "ADD IX,SP",       &CZ80::ImplementADDIXdd,     2, 15, 15, 0, OT_NONE },
+		/* 3A */	{ "LD A,({nn})",     &CZ80::ImplementUnindexed,   4, 17, 17, 0, OT_NONE },
+		/* 3B */	{ "DEC SP",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 3C */	{ "INC A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 3D */	{ "DEC A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 3E */	{ "LD A,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 3F */	{ "CCF",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 40 */	{ "LD B,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 41 */	{ "LD B,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 42 */	{ "LD B,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 43 */	{ "LD B,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 44 */	{ "LD B,IXh",        &CZ80::ImplementLDrIXh,      2,  8,  8, 0, OT_NONE },
+		/* 45 */	{ "LD B,IXl",        &CZ80::ImplementLDrIXl,      2,  8,  8, 0, OT_NONE },
+		/* 46 */	{ "LD B,(IX+{d})",   &CZ80::ImplementLDr_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* 47 */	{ "LD B,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 48 */	{ "LD C,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 49 */	{ "LD C,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 4A */	{ "LD C,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 4B */	{ "LD C,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 4C */	{ "LD C,IXh",        &CZ80::ImplementLDrIXh,      2,  8,  8, 0, OT_NONE },
+		/* 4D */	{ "LD C,IXl",        &CZ80::ImplementLDrIXl,      2,  8,  8, 0, OT_NONE },
+		/* 4E */	{ "LD C,(IX+{d})",   &CZ80::ImplementLDr_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* 4F */	{ "LD C,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 50 */	{ "LD D,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 51 */	{ "LD D,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 52 */	{ "LD D,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 53 */	{ "LD D,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 54 */	{ "LD D,IXh",        &CZ80::ImplementLDrIXh,      2,  8,  8, 0, OT_NONE },
+		/* 55 */	{ "LD D,IXl",        &CZ80::ImplementLDrIXl,      2,  8,  8, 0, OT_NONE },
+		/* 56 */	{ "LD D,(IX+{d})",   &CZ80::ImplementLDr_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* 57 */	{ "LD D,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 58 */	{ "LD E,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 59 */	{ "LD E,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 5A */	{ "LD E,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 5B */	{ "LD E,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 5C */	{ "LD E,IXh",        &CZ80::ImplementLDrIXh,      2,  8,  8, 0, OT_NONE },
+		/* 5D */	{ "LD E,IXl",        &CZ80::ImplementLDrIXl,      2,  8,  8, 0, OT_NONE },
+		/* 5E */	{ "LD E,(IX+{d})",   &CZ80::ImplementLDr_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* 5F */	{ "LD E,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 60 */	{ "LD IXh,B",        &CZ80::ImplementLDIXhr,      2,  8,  8, 0, OT_NONE },
+		/* 61 */	{ "LD IXh,C",        &CZ80::ImplementLDIXhr,      2,  8,  8, 0, OT_NONE },
+		/* 62 */	{ "LD IXh,D",        &CZ80::ImplementLDIXhr,      2,  8,  8, 0, OT_NONE },
+		/* 63 */	{ "LD IXh,E",        &CZ80::ImplementLDIXhr,      2,  8,  8, 0, OT_NONE },
+		/* 64 */	{ "LD IXh,IXh",      &CZ80::ImplementLDIXhr,      2,  8,  8, 0, OT_NONE },
+		/* 65 */	{ "LD IXh,IXl",      &CZ80::ImplementLDIXhr,      2,  8,  8, 0, OT_NONE },
+		/* 66 */	{ "LD H,(IX+{d})",   &CZ80::ImplementLDr_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* 67 */	{ "LD IXh,A",        &CZ80::ImplementLDIXhr,      2,  8,  8, 0, OT_NONE },
+		/* 68 */	{ "LD IXl,B",        &CZ80::ImplementLDIXlr,      2,  8,  8, 0, OT_NONE },
+		/* 69 */	{ "LD IXl,C",        &CZ80::ImplementLDIXlr,      2,  8,  8, 0, OT_NONE },
+		/* 6A */	{ "LD IXl,D",        &CZ80::ImplementLDIXlr,      2,  8,  8, 0, OT_NONE },
+		/* 6B */	{ "LD IXl,E",        &CZ80::ImplementLDIXlr,      2,  8,  8, 0, OT_NONE },
+		/* 6C */	{ "LD IXl,IXh",      &CZ80::ImplementLDIXlr,      2,  8,  8, 0, OT_NONE },
+		/* 6D */	{ "LD IXl,IXl",      &CZ80::ImplementLDIXlr,      2,  8,  8, 0, OT_NONE },
+		/* 6E */	{ "LD L,(IX+{d})",   &CZ80::ImplementLDr_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* 6F */	{ "LD IXl,A",        &CZ80::ImplementLDIXlr,      2,  8,  8, 0, OT_NONE },
+		/* 70 */	{ "LD (IX+{d}),B",   &CZ80::ImplementLD_IXd_r,    3, 19, 19, 0, OT_NONE },
+		/* 71 */	{ "LD (IX+{d}),C",   &CZ80::ImplementLD_IXd_r,    3, 19, 19, 0, OT_NONE },
+		/* 72 */	{ "LD (IX+{d}),D",   &CZ80::ImplementLD_IXd_r,    3, 19, 19, 0, OT_NONE },
+		/* 73 */	{ "LD (IX+{d}),E",   &CZ80::ImplementLD_IXd_r,    3, 19, 19, 0, OT_NONE },
+		/* 74 */	{ "LD (IX+{d}),H",   &CZ80::ImplementLD_IXd_r,    3, 19, 19, 0, OT_NONE },
+		/* 75 */	{ "LD (IX+{d}),L",   &CZ80::ImplementLD_IXd_r,    3, 19, 19, 0, OT_NONE },
+		/* 76 */	{ "HALT",            &CZ80::ImplementUnindexed,   2,  8,  8, OF_HALT, OT_NONE },
+		/* 77 */	{ "LD (IX+{d}),A",   &CZ80::ImplementLD_IXd_r,    3, 19, 19, 0, OT_NONE },
+		/* 78 */	{ "LD A,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 79 */	{ "LD A,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 7A */	{ "LD A,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 7B */	{ "LD A,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 7C */	{ "LD A,IXh",        &CZ80::ImplementLDrIXh,      2,  8,  8, 0, OT_NONE },
+		/* 7D */	{ "LD A,IXl",        &CZ80::ImplementLDrIXl,      2,  8,  8, 0, OT_NONE },
+		/* 7E */	{ "LD A,(IX+{d})",   &CZ80::ImplementLDr_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* 7F */	{ "LD A,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 80 */	{ "ADD A,B",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 81 */	{ "ADD A,C",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 82 */	{ "ADD A,D",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 83 */	{ "ADD A,E",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 84 */	{ "ADD A,IXh",       &CZ80::ImplementADDAIXh,     2,  8,  8, 0, OT_NONE },
+		/* 85 */	{ "ADD A,IXl",       &CZ80::ImplementADDAIXl,     2,  8,  8, 0, OT_NONE },
+		/* 86 */	{ "ADD A,(IX+{d})",  &CZ80::ImplementADDA_IXd_,   3, 19, 19, 0, OT_NONE },
+		/* 87 */	{ "ADD A,A",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 88 */	{ "ADC A,B",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 89 */	{ "ADC A,C",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 8A */	{ "ADC A,D",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 8B */	{ "ADC A,E",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 8C */	{ "ADC A,IXh",       &CZ80::ImplementADCAIXh,     2,  8,  8, 0, OT_NONE },
+		/* 8D */	{ "ADC A,IXl",       &CZ80::ImplementADCAIXl,     2,  8,  8, 0, OT_NONE },
+		/* 8E */	{ "ADC A,(IX+{d})",  &CZ80::ImplementADCA_IXd_,   3, 19, 19, 0, OT_NONE },
+		/* 8F */	{ "ADC A,A",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 90 */	{ "SUB B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 91 */	{ "SUB C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 92 */	{ "SUB D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 93 */	{ "SUB E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 94 */	{ "SUB IXh",         &CZ80::ImplementSUBIXh,      2,  8,  8, 0, OT_NONE },
+		/* 95 */	{ "SUB IXl",         &CZ80::ImplementSUBIXl,      2,  8,  8, 0, OT_NONE },
+		/* 96 */	{ "SUB (IX+{d})",    &CZ80::ImplementSUB_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* 97 */	{ "SUB A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 98 */	{ "SBC A,B",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 99 */	{ "SBC A,C",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 9A */	{ "SBC A,D",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 9B */	{ "SBC A,E",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 9C */	{ "SBC A,IXh",       &CZ80::ImplementSBCAIXh,     2,  8,  8, 0, OT_NONE },
+		/* 9D */	{ "SBC A,IXl",       &CZ80::ImplementSBCAIXl,     2,  8,  8, 0, OT_NONE },
+		/* 9E */	{ "SBC A,(IX+{d})",  &CZ80::ImplementSBCA_IXd_,   3, 19, 19, 0, OT_NONE },
+		/* 9F */	{ "SBC A,A",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A0 */	{ "AND B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A1 */	{ "AND C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A2 */	{ "AND D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A3 */	{ "AND E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A4 */	{ "AND IXh",         &CZ80::ImplementANDIXh,      2,  8,  8, 0, OT_NONE },
+		/* A5 */	{ "AND IXl",         &CZ80::ImplementANDIXl,      2,  8,  8, 0, OT_NONE },
+		/* A6 */	{ "AND (IX+{d})",    &CZ80::ImplementAND_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* A7 */	{ "AND A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A8 */	{ "XOR B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A9 */	{ "XOR C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* AA */	{ "XOR D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* AB */	{ "XOR E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* AC */	{ "XOR IXh",         &CZ80::ImplementXORIXh,      2,  8,  8, 0, OT_NONE },
+		/* AD */	{ "XOR IXl",         &CZ80::ImplementXORIXl,      2,  8,  8, 0, OT_NONE },
+		/* AE */	{ "XOR (IX+{d})",    &CZ80::ImplementXOR_IXd_,    3, 19, 19, 0, OT_NONE },
+		/* AF */	{ "XOR A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B0 */	{ "OR B",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B1 */	{ "OR C",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B2 */	{ "OR D",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B3 */	{ "OR E",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B4 */	{ "OR IXh",          &CZ80::ImplementORIXh,       2,  8,  8, 0, OT_NONE },
+		/* B5 */	{ "OR IXl",          &CZ80::ImplementORIXl,       2,  8,  8, 0, OT_NONE },
+		/* B6 */	{ "OR (IX+{d})",     &CZ80::ImplementOR_IXd_,     3, 19, 19, 0, OT_NONE },
+		/* B7 */	{ "OR A",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B8 */	{ "CP B",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B9 */	{ "CP C",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* BA */	{ "CP D",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* BB */	{ "CP E",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* BC */	{ "CP IXh",          &CZ80::ImplementCPIXh,       2,  8,  8, 0, OT_NONE },
+		/* BD */	{ "CP IXl",          &CZ80::ImplementCPIXl,       2,  8,  8, 0, OT_NONE },
+		/* BE */	{ "CP (IX+{d})",     &CZ80::ImplementCP_IXd_,     3, 19, 19, 0, OT_NONE },
+		/* BF */	{ "CP A",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* C0 */	{ "RET NZ",          &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* C1 */	{ "POP BC",          &CZ80::ImplementUnindexed,   2, 14, 14, 0, OT_NONE },
+		/* C2 */	{ "JP NZ,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* C3 */	{ "JP {nn}",         &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW | OF_END, OT_NONE },
+		/* C4 */	{ "CALL NZ,{nn}",    &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* C5 */	{ "PUSH BC",         &CZ80::ImplementUnindexed,   2, 15, 15, 0, OT_NONE },
+		/* C6 */	{ "ADD A,{n}",       &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* C7 */	{ "RST $00",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* C8 */	{ "RET Z",           &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* C9 */	{ "RET",             &CZ80::ImplementUnindexed,   2, 14, 14, OF_FLOW | OF_END, OT_NONE },
+		/* CA */	{ "JP Z,{nn}",       &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* CB */	PREFIX(OT_DDCB),
+		/* CC */	{ "CALL Z,{nn}",     &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* CD */	{ "CALL {nn}",       &CZ80::ImplementUnindexed,   4, 21, 21, OF_FLOW | OF_END, OT_NONE },
+		/* CE */	{ "ADC A,{n}",       &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* CF */	{ "RST $08",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* D0 */	{ "RET NC",          &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* D1 */	{ "POP DE",          &CZ80::ImplementUnindexed,   2, 14, 14, 0, OT_NONE },
+		/* D2 */	{ "JP NC,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* D3 */	{ "OUT ({n}),A",     &CZ80::ImplementUnindexed,   3, 15, 15, OF_IO, OT_NONE },
+		/* D4 */	{ "CALL NC,{nn}",    &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* D5 */	{ "PUSH DE",         &CZ80::ImplementUnindexed,   2, 15, 15, 0, OT_NONE },
+		/* D6 */	{ "SUB {n}",         &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* D7 */	{ "RST $10",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* D8 */	{ "RET C",           &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* D9 */	{ "EXX",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* DA */	{ "JP C,{nn}",       &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* DB */	{ "IN A,({n})",      &CZ80::ImplementUnindexed,   3, 15, 15, OF_IO, OT_NONE },
+		/* DC */	{ "CALL C,{nn}",     &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* DD */	{ "NOP",             &CZ80::ImplementUnindexed,   1,  4,  4, 0, OT_NONE },
+		/* DE */	{ "SBC A,{n}",       &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* DF */	{ "RST $18",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* E0 */	{ "RET PO",          &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* E1 */	{ "POP IX",          &CZ80::ImplementPOPIX,       2, 14, 14, 0, OT_NONE },
+		/* E2 */	{ "JP PO,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* E3 */	{ "EX (SP),IX",      &CZ80::ImplementEX_SP_IX,    2, 23, 23, 0, OT_NONE },
+		/* E4 */	{ "CALL PO,{nn}",    &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* E5 */	{ "PUSH IX",         &CZ80::ImplementPUSHIX,      2, 15, 15, 0, OT_NONE },
+		/* E6 */	{ "AND {n}",         &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* E7 */	{ "RST $20",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* E8 */	{ "RET PE",          &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* E9 */	{ "JP (IX)",         &CZ80::ImplementJP_IX_,      2,  8,  8, OF_FLOW | OF_END, OT_NONE },
+		/* EA */	{ "JP PE,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* EB */	{ "EX DE,HL",        &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* EC */	{ "CALL PE,{nn}",    &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* ED */	{ "NOP",             &CZ80::ImplementUnindexed,   1,  4,  4, 0, OT_NONE },
+		/* EE */	{ "XOR {n}",         &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* EF */	{ "RST $28",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* F0 */	{ "RET P",           &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* F1 */	{ "POP AF",          &CZ80::ImplementUnindexed,   2, 14, 14, 0, OT_NONE },
+		/* F2 */	{ "JP P,{nn}",       &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* F3 */	{ "DI",              &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* F4 */	{ "CALL P,{nn}",     &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* F5 */	{ "PUSH AF",         &CZ80::ImplementUnindexed,   2, 15, 15, 0, OT_NONE },
+		/* F6 */	{ "OR {n}",          &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* F7 */	{ "RST $30",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* F8 */	{ "RET M",           &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* F9 */	{ "LD SP,IX",        &CZ80::ImplementLDSPIX,      2, 10, 10, 0, OT_NONE },
+		/* FA */	{ "JP M,{nn}",       &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* FB */	{ "EI",              &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* FC */	{ "CALL M,{nn}",     &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* FD */	{ "NOP",             &CZ80::ImplementUnindexed,   1,  4,  4, 0, OT_NONE },
+		/* FE */	{ "CP {n}",          &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* FF */	{ "RST $38",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE }
+	},
+	// FD (IY)
+	{
+		/* 00 */	{ "NOP",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 01 */	{ "LD BC,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, 0, OT_NONE },
+		/* 02 */	{ "LD (BC),A",       &CZ80::ImplementUnindexed,   2, 11, 11, 0, OT_NONE },
+		/* 03 */	{ "INC BC",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 04 */	{ "INC B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 05 */	{ "DEC B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 06 */	{ "LD B,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 07 */	{ "RLCA",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 08 */	{ "EX AF,AF'",       &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 09 */	{ "ADD IY,BC",       &CZ80::ImplementADDIYdd,     2, 15, 15, 0, OT_NONE },
+		/* 0A */	{ "LD A,(BC)",       &CZ80::ImplementUnindexed,   2, 11, 11, 0, OT_NONE },
+		/* 0B */	{ "DEC BC",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 0C */	{ "INC C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 0D */	{ "DEC C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 0E */	{ "LD C,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 0F */	{ "RRCA",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 10 */	{ "DJNZ {e}",        &CZ80::ImplementUnindexed,   3, 12, 17, OF_FLOW, OT_NONE },
+		/* 11 */	{ "LD DE,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, 0, OT_NONE },
+		/* 12 */	{ "LD (DE),A",       &CZ80::ImplementUnindexed,   2, 11, 11, 0, OT_NONE },
+		/* 13 */	{ "INC DE",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 14 */	{ "INC D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 15 */	{ "DEC D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 16 */	{ "LD D,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 17 */	{ "RLA",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 18 */	{ "JR {e}",          &CZ80::ImplementUnindexed,   3, 16, 16, OF_FLOW | OF_END, OT_NONE },
+		/* 19 */	{ "ADD IY,DE",       &CZ80::ImplementADDIYdd,     2, 15, 15, 0, OT_NONE },
+		/* 1A */	{ "LD A,(DE)",       &CZ80::ImplementUnindexed,   2, 11, 11, 0, OT_NONE },
+		/* 1B */	{ "DEC DE",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 1C */	{ "INC E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 1D */	{ "DEC E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 1E */	{ "LD E,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 1F */	{ "RRA",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 20 */	{ "JR NZ,{e}",       &CZ80::ImplementUnindexed,   3, 11, 16, OF_FLOW, OT_NONE },
+		/* 21 */	{ "LD IY,{nn}",      &CZ80::ImplementLDIYnn,      4, 14, 14, 0, OT_NONE },
+		/* 22 */	{ "LD ({nn}),IY",    &CZ80::ImplementLD_nn_IY,    4, 20, 20, 0, OT_NONE },
+		/* 23 */	{ "INC IY",          &CZ80::ImplementINCIY,       2, 10, 10, 0, OT_NONE },
+		/* 24 */	{ "INC IYh",         &CZ80::ImplementINCIYh,      2,  8,  8, 0, OT_NONE },
+		/* 25 */	{ "DEC IYh",         &CZ80::ImplementDECIYh,      2,  8,  8, 0, OT_NONE },
+		/* 26 */	{ "LD IYh,{n}",      &CZ80::ImplementLDIYhn,      3, 11, 11, 0, OT_NONE },
+		/* 27 */	{ "DAA",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 28 */	{ "JR Z,{e}",        &CZ80::ImplementUnindexed,   3, 11, 16, OF_FLOW, OT_NONE },
+		/* 29 */	{ "ADD IY,IY",       &CZ80::ImplementADDIYdd,     2, 15, 15, 0, OT_NONE },
+		/* 2A */	{ "LD IY,({nn})",    &CZ80::ImplementLDIY_nn_,    4, 20, 20, 0, OT_NONE },
+		/* 2B */	{ "DEC IY",          &CZ80::ImplementDECIY,       2, 10, 10, 0, OT_NONE },
+		/* 2C */	{ "INC IYl",         &CZ80::ImplementINCIYl,      2,  8,  8, 0, OT_NONE },
+		/* 2D */	{ "DEC IYl",         &CZ80::ImplementDECIYl,      2,  8,  8, 0, OT_NONE },
+		/* 2E */	{ "LD IYl,{n}",      &CZ80::ImplementLDIYln,      3, 11, 11, 0, OT_NONE },
+		/* 2F */	{ "CPL",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 30 */	{ "JR NC,{e}",       &CZ80::ImplementUnindexed,   3, 11, 16, OF_FLOW, OT_NONE },
+		/* 31 */	{ "LD SP,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, 0, OT_NONE },
+		/* 32 */	{ "LD ({nn}),A",     &CZ80::ImplementUnindexed,   4, 17, 17, 0, OT_NONE },
+		/* 33 */	{ "INC SP",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 34 */	{ "INC (IY+{d})",    &CZ80::ImplementINC_IYd_,    3, 23, 23, 0, OT_NONE },
+		/* 35 */	{ "DEC (IY+{d})",    &CZ80::ImplementDEC_IYd_,    3, 23, 23, 0, OT_NONE },
+		/* 36 */	{ "LD (IY+{d}),{n}", &CZ80::ImplementLD_IYd_n,    4, 19, 19, 0, OT_NONE },
+		/* 37 */	{ "SCF",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 38 */	{ "JR C,{e}",        &CZ80::ImplementUnindexed,   3, 11, 16, OF_FLOW, OT_NONE },
+		/* 39 */	{ "ADD IY,SP",       &CZ80::ImplementADDIYdd,     2, 15, 15, 0, OT_NONE },
+		/* 3A */	{ "LD A,({nn})",     &CZ80::ImplementUnindexed,   4, 17, 17, 0, OT_NONE },
+		/* 3B */	{ "DEC SP",          &CZ80::ImplementUnindexed,   2, 10, 10, 0, OT_NONE },
+		/* 3C */	{ "INC A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 3D */	{ "DEC A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 3E */	{ "LD A,{n}",        &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* 3F */	{ "CCF",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 40 */	{ "LD B,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 41 */	{ "LD B,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 42 */	{ "LD B,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 43 */	{ "LD B,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 44 */	{ "LD B,IYh",        &CZ80::ImplementLDrIYh,      2,  8,  8, 0, OT_NONE },
+		/* 45 */	{ "LD B,IYl",        &CZ80::ImplementLDrIYl,      2,  8,  8, 0, OT_NONE },
+		/* 46 */	{ "LD B,(IY+{d})",   &CZ80::ImplementLDr_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* 47 */	{ "LD B,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 48 */	{ "LD C,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 49 */	{ "LD C,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 4A */	{ "LD C,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 4B */	{ "LD C,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 4C */	{ "LD C,IYh",        &CZ80::ImplementLDrIYh,      2,  8,  8, 0, OT_NONE },
+		/* 4D */	{ "LD C,IYl",        &CZ80::ImplementLDrIYl,      2,  8,  8, 0, OT_NONE },
+		/* 4E */	{ "LD C,(IY+{d})",   &CZ80::ImplementLDr_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* 4F */	{ "LD C,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 50 */	{ "LD D,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 51 */	{ "LD D,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 52 */	{ "LD D,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 53 */	{ "LD D,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 54 */	{ "LD D,IYh",        &CZ80::ImplementLDrIYh,      2,  8,  8, 0, OT_NONE },
+		/* 55 */	{ "LD D,IYl",        &CZ80::ImplementLDrIYl,      2,  8,  8, 0, OT_NONE },
+		/* 56 */	{ "LD D,(IY+{d})",   &CZ80::ImplementLDr_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* 57 */	{ "LD D,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 58 */	{ "LD E,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 59 */	{ "LD E,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 5A */	{ "LD E,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 5B */	{ "LD E,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 5C */	{ "LD E,IYh",        &CZ80::ImplementLDrIYh,      2,  8,  8, 0, OT_NONE },
+		/* 5D */	{ "LD E,IYl",        &CZ80::ImplementLDrIYl,      2,  8,  8, 0, OT_NONE },
+		/* 5E */	{ "LD E,(IY+{d})",   &CZ80::ImplementLDr_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* 5F */	{ "LD E,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 60 */	{ "LD IYh,B",        &CZ80::ImplementLDIYhr,      2,  8,  8, 0, OT_NONE },
+		/* 61 */	{ "LD IYh,C",        &CZ80::ImplementLDIYhr,      2,  8,  8, 0, OT_NONE },
+		/* 62 */	{ "LD IYh,D",        &CZ80::ImplementLDIYhr,      2,  8,  8, 0, OT_NONE },
+		/* 63 */	{ "LD IYh,E",        &CZ80::ImplementLDIYhr,      2,  8,  8, 0, OT_NONE },
+		/* 64 */	{ "LD IYh,IYh",      &CZ80::ImplementLDIYhr,      2,  8,  8, 0, OT_NONE },
+		/* 65 */	{ "LD IYh,IYl",      &CZ80::ImplementLDIYhr,      2,  8,  8, 0, OT_NONE },
+		/* 66 */	{ "LD H,(IY+{d})",   &CZ80::ImplementLDr_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* 67 */	{ "LD IYh,A",        &CZ80::ImplementLDIYhr,      2,  8,  8, 0, OT_NONE },
+		/* 68 */	{ "LD IYl,B",        &CZ80::ImplementLDIYlr,      2,  8,  8, 0, OT_NONE },
+		/* 69 */	{ "LD IYl,C",        &CZ80::ImplementLDIYlr,      2,  8,  8, 0, OT_NONE },
+		/* 6A */	{ "LD IYl,D",        &CZ80::ImplementLDIYlr,      2,  8,  8, 0, OT_NONE },
+		/* 6B */	{ "LD IYl,E",        &CZ80::ImplementLDIYlr,      2,  8,  8, 0, OT_NONE },
+		/* 6C */	{ "LD IYl,IYh",      &CZ80::ImplementLDIYlr,      2,  8,  8, 0, OT_NONE },
+		/* 6D */	{ "LD IYl,IYl",      &CZ80::ImplementLDIYlr,      2,  8,  8, 0, OT_NONE },
+		/* 6E */	{ "LD L,(IY+{d})",   &CZ80::ImplementLDr_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* 6F */	{ "LD IYl,A",        &CZ80::ImplementLDIYlr,      2,  8,  8, 0, OT_NONE },
+		/* 70 */	{ "LD (IY+{d}),B",   &CZ80::ImplementLD_IYd_r,    3, 19, 19, 0, OT_NONE },
+		/* 71 */	{ "LD (IY+{d}),C",   &CZ80::ImplementLD_IYd_r,    3, 19, 19, 0, OT_NONE },
+		/* 72 */	{ "LD (IY+{d}),D",   &CZ80::ImplementLD_IYd_r,    3, 19, 19, 0, OT_NONE },
+		/* 73 */	{ "LD (IY+{d}),E",   &CZ80::ImplementLD_IYd_r,    3, 19, 19, 0, OT_NONE },
+		/* 74 */	{ "LD (IY+{d}),H",   &CZ80::ImplementLD_IYd_r,    3, 19, 19, 0, OT_NONE },
+		/* 75 */	{ "LD (IY+{d}),L",   &CZ80::ImplementLD_IYd_r,    3, 19, 19, 0, OT_NONE },
+		/* 76 */	{ "HALT",            &CZ80::ImplementUnindexed,   2,  8,  8, OF_HALT, OT_NONE },
+		/* 77 */	{ "LD (IY+{d}),A",   &CZ80::ImplementLD_IYd_r,    3, 19, 19, 0, OT_NONE },
+		/* 78 */	{ "LD A,B",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 79 */	{ "LD A,C",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 7A */	{ "LD A,D",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 7B */	{ "LD A,E",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 7C */	{ "LD A,IYh",        &CZ80::ImplementLDrIYh,      2,  8,  8, 0, OT_NONE },
+		/* 7D */	{ "LD A,IYl",        &CZ80::ImplementLDrIYl,      2,  8,  8, 0, OT_NONE },
+		/* 7E */	{ "LD A,(IY+{d})",   &CZ80::ImplementLDr_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* 7F */	{ "LD A,A",          &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 80 */	{ "ADD A,B",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 81 */	{ "ADD A,C",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 82 */	{ "ADD A,D",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 83 */	{ "ADD A,E",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 84 */	{ "ADD A,IYh",       &CZ80::ImplementADDAIYh,     2,  8,  8, 0, OT_NONE },
+		/* 85 */	{ "ADD A,IYl",       &CZ80::ImplementADDAIYl,     2,  8,  8, 0, OT_NONE },
+		/* 86 */	{ "ADD A,(IY+{d})",  &CZ80::ImplementADDA_IYd_,   3, 19, 19, 0, OT_NONE },
+		/* 87 */	{ "ADD A,A",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 88 */	{ "ADC A,B",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 89 */	{ "ADC A,C",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 8A */	{ "ADC A,D",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 8B */	{ "ADC A,E",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 8C */	{ "ADC A,IYh",       &CZ80::ImplementADCAIYh,     2,  8,  8, 0, OT_NONE },
+		/* 8D */	{ "ADC A,IYl",       &CZ80::ImplementADCAIYl,     2,  8,  8, 0, OT_NONE },
+		/* 8E */	{ "ADC A,(IY+{d})",  &CZ80::ImplementADCA_IYd_,   3, 19, 19, 0, OT_NONE },
+		/* 8F */	{ "ADC A,A",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 90 */	{ "SUB B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 91 */	{ "SUB C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 92 */	{ "SUB D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 93 */	{ "SUB E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 94 */	{ "SUB IYh",         &CZ80::ImplementSUBIYh,      2,  8,  8, 0, OT_NONE },
+		/* 95 */	{ "SUB IYl",         &CZ80::ImplementSUBIYl,      2,  8,  8, 0, OT_NONE },
+		/* 96 */	{ "SUB (IY+{d})",    &CZ80::ImplementSUB_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* 97 */	{ "SUB A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 98 */	{ "SBC A,B",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 99 */	{ "SBC A,C",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 9A */	{ "SBC A,D",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 9B */	{ "SBC A,E",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* 9C */	{ "SBC A,IYh",       &CZ80::ImplementSBCAIYh,     2,  8,  8, 0, OT_NONE },
+		/* 9D */	{ "SBC A,IYl",       &CZ80::ImplementSBCAIYl,     2,  8,  8, 0, OT_NONE },
+		/* 9E */	{ "SBC A,(IY+{d})",  &CZ80::ImplementSBCA_IYd_,   3, 19, 19, 0, OT_NONE },
+		/* 9F */	{ "SBC A,A",         &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A0 */	{ "AND B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A1 */	{ "AND C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A2 */	{ "AND D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A3 */	{ "AND E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A4 */	{ "AND IYh",         &CZ80::ImplementANDIYh,      2,  8,  8, 0, OT_NONE },
+		/* A5 */	{ "AND IYl",         &CZ80::ImplementANDIYl,      2,  8,  8, 0, OT_NONE },
+		/* A6 */	{ "AND (IY+{d})",    &CZ80::ImplementAND_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* A7 */	{ "AND A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A8 */	{ "XOR B",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* A9 */	{ "XOR C",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* AA */	{ "XOR D",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* AB */	{ "XOR E",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* AC */	{ "XOR IYh",         &CZ80::ImplementXORIYh,      2,  8,  8, 0, OT_NONE },
+		/* AD */	{ "XOR IYl",         &CZ80::ImplementXORIYl,      2,  8,  8, 0, OT_NONE },
+		/* AE */	{ "XOR (IY+{d})",    &CZ80::ImplementXOR_IYd_,    3, 19, 19, 0, OT_NONE },
+		/* AF */	{ "XOR A",           &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B0 */	{ "OR B",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B1 */	{ "OR C",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B2 */	{ "OR D",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B3 */	{ "OR E",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B4 */	{ "OR IYh",          &CZ80::ImplementORIYh,       2,  8,  8, 0, OT_NONE },
+		/* B5 */	{ "OR IYl",          &CZ80::ImplementORIYl,       2,  8,  8, 0, OT_NONE },
+		/* B6 */	{ "OR (IY+{d})",     &CZ80::ImplementOR_IYd_,     3, 19, 19, 0, OT_NONE },
+		/* B7 */	{ "OR A",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B8 */	{ "CP B",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* B9 */	{ "CP C",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* BA */	{ "CP D",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* BB */	{ "CP E",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* BC */	{ "CP IYh",          &CZ80::ImplementCPIYh,       2,  8,  8, 0, OT_NONE },
+		/* BD */	{ "CP IYl",          &CZ80::ImplementCPIYl,       2,  8,  8, 0, OT_NONE },
+		/* BE */	{ "CP (IY+{d})",     &CZ80::ImplementCP_IYd_,     3, 19, 19, 0, OT_NONE },
+		/* BF */	{ "CP A",            &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* C0 */	{ "RET NZ",          &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* C1 */	{ "POP BC",          &CZ80::ImplementUnindexed,   2, 14, 14, 0, OT_NONE },
+		/* C2 */	{ "JP NZ,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* C3 */	{ "JP {nn}",         &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW | OF_END, OT_NONE },
+		/* C4 */	{ "CALL NZ,{nn}",    &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* C5 */	{ "PUSH BC",         &CZ80::ImplementUnindexed,   2, 15, 15, 0, OT_NONE },
+		/* C6 */	{ "ADD A,{n}",       &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* C7 */	{ "RST $00",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* C8 */	{ "RET Z",           &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* C9 */	{ "RET",             &CZ80::ImplementUnindexed,   2, 14, 14, OF_FLOW | OF_END, OT_NONE },
+		/* CA */	{ "JP Z,{nn}",       &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* CB */	PREFIX(OT_FDCB),
+		/* CC */	{ "CALL Z,{nn}",     &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* CD */	{ "CALL {nn}",       &CZ80::ImplementUnindexed,   4, 21, 21, OF_FLOW | OF_END, OT_NONE },
+		/* CE */	{ "ADC A,{n}",       &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* CF */	{ "RST $08",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* D0 */	{ "RET NC",          &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* D1 */	{ "POP DE",          &CZ80::ImplementUnindexed,   2, 14, 14, 0, OT_NONE },
+		/* D2 */	{ "JP NC,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* D3 */	{ "OUT ({n}),A",     &CZ80::ImplementUnindexed,   3, 15, 15, OF_IO, OT_NONE },
+		/* D4 */	{ "CALL NC,{nn}",    &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* D5 */	{ "PUSH DE",         &CZ80::ImplementUnindexed,   2, 15, 15, 0, OT_NONE },
+		/* D6 */	{ "SUB {n}",         &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* D7 */	{ "RST $10",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* D8 */	{ "RET C",           &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* D9 */	{ "EXX",             &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* DA */	{ "JP C,{nn}",       &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* DB */	{ "IN A,({n})",      &CZ80::ImplementUnindexed,   3, 15, 15, OF_IO, OT_NONE },
+		/* DC */	{ "CALL C,{nn}",     &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* DD */	{ "NOP",             &CZ80::ImplementUnindexed,   1,  4,  4, 0, OT_NONE },
+		/* DE */	{ "SBC A,{n}",       &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* DF */	{ "RST $18",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* E0 */	{ "RET PO",          &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* E1 */	{ "POP IY",          &CZ80::ImplementPOPIY,       2, 14, 14, 0, OT_NONE },
+		/* E2 */	{ "JP PO,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* E3 */	{ "EX (SP),IY",      &CZ80::ImplementEX_SP_IY,    2, 23, 23, 0, OT_NONE },
+		/* E4 */	{ "CALL PO,{nn}",    &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* E5 */	{ "PUSH IY",         &CZ80::ImplementPUSHIY,      2, 15, 15, 0, OT_NONE },
+		/* E6 */	{ "AND {n}",         &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* E7 */	{ "RST $20",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* E8 */	{ "RET PE",          &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* E9 */	{ "JP (IY)",         &CZ80::ImplementJP_IY_,      2,  8,  8, OF_FLOW | OF_END, OT_NONE },
+		/* EA */	{ "JP PE,{nn}",      &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* EB */	{ "EX DE,HL",        &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* EC */	{ "CALL PE,{nn}",    &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* ED */	{ "NOP",             &CZ80::ImplementUnindexed,   1,  4,  4, 0, OT_NONE },
+		/* EE */	{ "XOR {n}",         &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* EF */	{ "RST $28",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* F0 */	{ "RET P",           &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* F1 */	{ "POP AF",          &CZ80::ImplementUnindexed,   2, 14, 14, 0, OT_NONE },
+		/* F2 */	{ "JP P,{nn}",       &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* F3 */	{ "DI",              &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* F4 */	{ "CALL P,{nn}",     &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* F5 */	{ "PUSH AF",         &CZ80::ImplementUnindexed,   2, 15, 15, 0, OT_NONE },
+		/* F6 */	{ "OR {n}",          &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* F7 */	{ "RST $30",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE },
+		/* F8 */	{ "RET M",           &CZ80::ImplementUnindexed,   2,  9, 15, OF_FLOW, OT_NONE },
+		/* F9 */	{ "LD SP,IY",        &CZ80::ImplementLDSPIY,      2, 10, 10, 0, OT_NONE },
+		/* FA */	{ "JP M,{nn}",       &CZ80::ImplementUnindexed,   4, 14, 14, OF_FLOW, OT_NONE },
+		/* FB */	{ "EI",              &CZ80::ImplementUnindexed,   2,  8,  8, 0, OT_NONE },
+		/* FC */	{ "CALL M,{nn}",     &CZ80::ImplementUnindexed,   4, 14, 21, OF_FLOW, OT_NONE },
+		/* FD */	{ "NOP",             &CZ80::ImplementUnindexed,   1,  4,  4, 0, OT_NONE },
+		/* FE */	{ "CP {n}",          &CZ80::ImplementUnindexed,   3, 11, 11, 0, OT_NONE },
+		/* FF */	{ "RST $38",         &CZ80::ImplementUnindexed,   2, 15, 15, OF_FLOW | OF_END, OT_NONE }
+	},
+	// DD CB d op (IX)
+	{
+		/* 00 */	{ "RLC (IX+{d})",    &CZ80::ImplementRLC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 01 */	{ "RLC (IX+{d})",    &CZ80::ImplementRLC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 02 */	{ "RLC (IX+{d})",    &CZ80::ImplementRLC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 03 */	{ "RLC (IX+{d})",    &CZ80::ImplementRLC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 04 */	{ "RLC (IX+{d})",    &CZ80::ImplementRLC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 05 */	{ "RLC (IX+{d})",    &CZ80::ImplementRLC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 06 */	{ "RLC (IX+{d})",    &CZ80::ImplementRLC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 07 */	{ "RLC (IX+{d})",    &CZ80::ImplementRLC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 08 */	{ "RRC (IX+{d})",    &CZ80::ImplementRRC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 09 */	{ "RRC (IX+{d})",    &CZ80::ImplementRRC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 0A */	{ "RRC (IX+{d})",    &CZ80::ImplementRRC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 0B */	{ "RRC (IX+{d})",    &CZ80::ImplementRRC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 0C */	{ "RRC (IX+{d})",    &CZ80::ImplementRRC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 0D */	{ "RRC (IX+{d})",    &CZ80::ImplementRRC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 0E */	{ "RRC (IX+{d})",    &CZ80::ImplementRRC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 0F */	{ "RRC (IX+{d})",    &CZ80::ImplementRRC_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 10 */	{ "RL (IX+{d})",     &CZ80::ImplementRL_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 11 */	{ "RL (IX+{d})",     &CZ80::ImplementRL_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 12 */	{ "RL (IX+{d})",     &CZ80::ImplementRL_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 13 */	{ "RL (IX+{d})",     &CZ80::ImplementRL_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 14 */	{ "RL (IX+{d})",     &CZ80::ImplementRL_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 15 */	{ "RL (IX+{d})",     &CZ80::ImplementRL_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 16 */	{ "RL (IX+{d})",     &CZ80::ImplementRL_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 17 */	{ "RL (IX+{d})",     &CZ80::ImplementRL_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 18 */	{ "RR (IX+{d})",     &CZ80::ImplementRR_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 19 */	{ "RR (IX+{d})",     &CZ80::ImplementRR_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 1A */	{ "RR (IX+{d})",     &CZ80::ImplementRR_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 1B */	{ "RR (IX+{d})",     &CZ80::ImplementRR_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 1C */	{ "RR (IX+{d})",     &CZ80::ImplementRR_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 1D */	{ "RR (IX+{d})",     &CZ80::ImplementRR_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 1E */	{ "RR (IX+{d})",     &CZ80::ImplementRR_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 1F */	{ "RR (IX+{d})",     &CZ80::ImplementRR_IXd_,     4, 23, 23, 0, OT_NONE },
+		/* 20 */	{ "SLA (IX+{d})",    &CZ80::ImplementSLA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 21 */	{ "SLA (IX+{d})",    &CZ80::ImplementSLA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 22 */	{ "SLA (IX+{d})",    &CZ80::ImplementSLA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 23 */	{ "SLA (IX+{d})",    &CZ80::ImplementSLA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 24 */	{ "SLA (IX+{d})",    &CZ80::ImplementSLA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 25 */	{ "SLA (IX+{d})",    &CZ80::ImplementSLA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 26 */	{ "SLA (IX+{d})",    &CZ80::ImplementSLA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 27 */	{ "SLA (IX+{d})",    &CZ80::ImplementSLA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 28 */	{ "SRA (IX+{d})",    &CZ80::ImplementSRA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 29 */	{ "SRA (IX+{d})",    &CZ80::ImplementSRA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 2A */	{ "SRA (IX+{d})",    &CZ80::ImplementSRA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 2B */	{ "SRA (IX+{d})",    &CZ80::ImplementSRA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 2C */	{ "SRA (IX+{d})",    &CZ80::ImplementSRA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 2D */	{ "SRA (IX+{d})",    &CZ80::ImplementSRA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 2E */	{ "SRA (IX+{d})",    &CZ80::ImplementSRA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 2F */	{ "SRA (IX+{d})",    &CZ80::ImplementSRA_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 30 */	{ "SLL (IX+{d})",    &CZ80::ImplementSLL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 31 */	{ "SLL (IX+{d})",    &CZ80::ImplementSLL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 32 */	{ "SLL (IX+{d})",    &CZ80::ImplementSLL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 33 */	{ "SLL (IX+{d})",    &CZ80::ImplementSLL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 34 */	{ "SLL (IX+{d})",    &CZ80::ImplementSLL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 35 */	{ "SLL (IX+{d})",    &CZ80::ImplementSLL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 36 */	{ "SLL (IX+{d})",    &CZ80::ImplementSLL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 37 */	{ "SLL (IX+{d})",    &CZ80::ImplementSLL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 38 */	{ "SRL (IX+{d})",    &CZ80::ImplementSRL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 39 */	{ "SRL (IX+{d})",    &CZ80::ImplementSRL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 3A */	{ "SRL (IX+{d})",    &CZ80::ImplementSRL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 3B */	{ "SRL (IX+{d})",    &CZ80::ImplementSRL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 3C */	{ "SRL (IX+{d})",    &CZ80::ImplementSRL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 3D */	{ "SRL (IX+{d})",    &CZ80::ImplementSRL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 3E */	{ "SRL (IX+{d})",    &CZ80::ImplementSRL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 3F */	{ "SRL (IX+{d})",    &CZ80::ImplementSRL_IXd_,    4, 23, 23, 0, OT_NONE },
+		/* 40 */	{ "BIT 0,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 41 */	{ "BIT 0,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 42 */	{ "BIT 0,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 43 */	{ "BIT 0,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 44 */	{ "BIT 0,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 45 */	{ "BIT 0,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 46 */	{ "BIT 0,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 47 */	{ "BIT 0,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 48 */	{ "BIT 1,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 49 */	{ "BIT 1,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 4A */	{ "BIT 1,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 4B */	{ "BIT 1,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 4C */	{ "BIT 1,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 4D */	{ "BIT 1,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 4E */	{ "BIT 1,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 4F */	{ "BIT 1,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 50 */	{ "BIT 2,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 51 */	{ "BIT 2,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 52 */	{ "BIT 2,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 53 */	{ "BIT 2,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 54 */	{ "BIT 2,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 55 */	{ "BIT 2,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 56 */	{ "BIT 2,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 57 */	{ "BIT 2,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 58 */	{ "BIT 3,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 59 */	{ "BIT 3,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 5A */	{ "BIT 3,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 5B */	{ "BIT 3,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 5C */	{ "BIT 3,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 5D */	{ "BIT 3,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 5E */	{ "BIT 3,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 5F */	{ "BIT 3,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 60 */	{ "BIT 4,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 61 */	{ "BIT 4,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 62 */	{ "BIT 4,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 63 */	{ "BIT 4,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 64 */	{ "BIT 4,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 65 */	{ "BIT 4,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 66 */	{ "BIT 4,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 67 */	{ "BIT 4,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 68 */	{ "BIT 5,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 69 */	{ "BIT 5,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 6A */	{ "BIT 5,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 6B */	{ "BIT 5,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 6C */	{ "BIT 5,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 6D */	{ "BIT 5,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 6E */	{ "BIT 5,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 6F */	{ "BIT 5,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 70 */	{ "BIT 6,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 71 */	{ "BIT 6,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 72 */	{ "BIT 6,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 73 */	{ "BIT 6,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 74 */	{ "BIT 6,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 75 */	{ "BIT 6,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 76 */	{ "BIT 6,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 77 */	{ "BIT 6,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 78 */	{ "BIT 7,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 79 */	{ "BIT 7,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 7A */	{ "BIT 7,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 7B */	{ "BIT 7,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 7C */	{ "BIT 7,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 7D */	{ "BIT 7,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 7E */	{ "BIT 7,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 7F */	{ "BIT 7,(IX+{d})",  &CZ80::ImplementBITb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 80 */	{ "RES 0,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 81 */	{ "RES 0,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 82 */	{ "RES 0,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 83 */	{ "RES 0,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 84 */	{ "RES 0,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 85 */	{ "RES 0,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 86 */	{ "RES 0,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 87 */	{ "RES 0,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 88 */	{ "RES 1,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 89 */	{ "RES 1,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 8A */	{ "RES 1,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 8B */	{ "RES 1,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 8C */	{ "RES 1,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 8D */	{ "RES 1,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 8E */	{ "RES 1,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 8F */	{ "RES 1,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 90 */	{ "RES 2,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 91 */	{ "RES 2,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 92 */	{ "RES 2,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 93 */	{ "RES 2,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 94 */	{ "RES 2,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 95 */	{ "RES 2,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 96 */	{ "RES 2,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 97 */	{ "RES 2,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 98 */	{ "RES 3,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 99 */	{ "RES 3,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 9A */	{ "RES 3,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 9B */	{ "RES 3,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 9C */	{ "RES 3,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 9D */	{ "RES 3,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 9E */	{ "RES 3,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* 9F */	{ "RES 3,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A0 */	{ "RES 4,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A1 */	{ "RES 4,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A2 */	{ "RES 4,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A3 */	{ "RES 4,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A4 */	{ "RES 4,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A5 */	{ "RES 4,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A6 */	{ "RES 4,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A7 */	{ "RES 4,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A8 */	{ "RES 5,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* A9 */	{ "RES 5,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* AA */	{ "RES 5,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* AB */	{ "RES 5,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* AC */	{ "RES 5,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* AD */	{ "RES 5,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* AE */	{ "RES 5,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* AF */	{ "RES 5,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B0 */	{ "RES 6,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B1 */	{ "RES 6,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B2 */	{ "RES 6,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B3 */	{ "RES 6,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B4 */	{ "RES 6,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B5 */	{ "RES 6,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B6 */	{ "RES 6,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B7 */	{ "RES 6,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B8 */	{ "RES 7,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* B9 */	{ "RES 7,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* BA */	{ "RES 7,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* BB */	{ "RES 7,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* BC */	{ "RES 7,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* BD */	{ "RES 7,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* BE */	{ "RES 7,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* BF */	{ "RES 7,(IX+{d})",  &CZ80::ImplementRESb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C0 */	{ "SET 0,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C1 */	{ "SET 0,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C2 */	{ "SET 0,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C3 */	{ "SET 0,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C4 */	{ "SET 0,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C5 */	{ "SET 0,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C6 */	{ "SET 0,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C7 */	{ "SET 0,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C8 */	{ "SET 1,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* C9 */	{ "SET 1,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* CA */	{ "SET 1,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* CB */	{ "SET 1,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* CC */	{ "SET 1,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* CD */	{ "SET 1,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* CE */	{ "SET 1,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* CF */	{ "SET 1,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D0 */	{ "SET 2,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D1 */	{ "SET 2,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D2 */	{ "SET 2,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D3 */	{ "SET 2,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D4 */	{ "SET 2,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D5 */	{ "SET 2,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D6 */	{ "SET 2,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D7 */	{ "SET 2,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D8 */	{ "SET 3,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* D9 */	{ "SET 3,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* DA */	{ "SET 3,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* DB */	{ "SET 3,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* DC */	{ "SET 3,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* DD */	{ "SET 3,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* DE */	{ "SET 3,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* DF */	{ "SET 3,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E0 */	{ "SET 4,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E1 */	{ "SET 4,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E2 */	{ "SET 4,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E3 */	{ "SET 4,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E4 */	{ "SET 4,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E5 */	{ "SET 4,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E6 */	{ "SET 4,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E7 */	{ "SET 4,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E8 */	{ "SET 5,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* E9 */	{ "SET 5,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* EA */	{ "SET 5,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* EB */	{ "SET 5,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* EC */	{ "SET 5,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* ED */	{ "SET 5,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* EE */	{ "SET 5,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* EF */	{ "SET 5,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F0 */	{ "SET 6,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F1 */	{ "SET 6,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F2 */	{ "SET 6,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F3 */	{ "SET 6,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F4 */	{ "SET 6,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F5 */	{ "SET 6,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F6 */	{ "SET 6,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F7 */	{ "SET 6,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F8 */	{ "SET 7,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* F9 */	{ "SET 7,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* FA */	{ "SET 7,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* FB */	{ "SET 7,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* FC */	{ "SET 7,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* FD */	{ "SET 7,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* FE */	{ "SET 7,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE },
+		/* FF */	{ "SET 7,(IX+{d})",  &CZ80::ImplementSETb_IXd_,   4, 20, 20, 0, OT_NONE }
+	},
+	// FD CB d op (IY)
+	{
+		/* 00 */	{ "RLC (IY+{d})",    &CZ80::ImplementRLC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 01 */	{ "RLC (IY+{d})",    &CZ80::ImplementRLC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 02 */	{ "RLC (IY+{d})",    &CZ80::ImplementRLC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 03 */	{ "RLC (IY+{d})",    &CZ80::ImplementRLC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 04 */	{ "RLC (IY+{d})",    &CZ80::ImplementRLC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 05 */	{ "RLC (IY+{d})",    &CZ80::ImplementRLC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 06 */	{ "RLC (IY+{d})",    &CZ80::ImplementRLC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 07 */	{ "RLC (IY+{d})",    &CZ80::ImplementRLC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 08 */	{ "RRC (IY+{d})",    &CZ80::ImplementRRC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 09 */	{ "RRC (IY+{d})",    &CZ80::ImplementRRC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 0A */	{ "RRC (IY+{d})",    &CZ80::ImplementRRC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 0B */	{ "RRC (IY+{d})",    &CZ80::ImplementRRC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 0C */	{ "RRC (IY+{d})",    &CZ80::ImplementRRC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 0D */	{ "RRC (IY+{d})",    &CZ80::ImplementRRC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 0E */	{ "RRC (IY+{d})",    &CZ80::ImplementRRC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 0F */	{ "RRC (IY+{d})",    &CZ80::ImplementRRC_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 10 */	{ "RL (IY+{d})",     &CZ80::ImplementRL_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 11 */	{ "RL (IY+{d})",     &CZ80::ImplementRL_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 12 */	{ "RL (IY+{d})",     &CZ80::ImplementRL_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 13 */	{ "RL (IY+{d})",     &CZ80::ImplementRL_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 14 */	{ "RL (IY+{d})",     &CZ80::ImplementRL_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 15 */	{ "RL (IY+{d})",     &CZ80::ImplementRL_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 16 */	{ "RL (IY+{d})",     &CZ80::ImplementRL_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 17 */	{ "RL (IY+{d})",     &CZ80::ImplementRL_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 18 */	{ "RR (IY+{d})",     &CZ80::ImplementRR_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 19 */	{ "RR (IY+{d})",     &CZ80::ImplementRR_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 1A */	{ "RR (IY+{d})",     &CZ80::ImplementRR_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 1B */	{ "RR (IY+{d})",     &CZ80::ImplementRR_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 1C */	{ "RR (IY+{d})",     &CZ80::ImplementRR_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 1D */	{ "RR (IY+{d})",     &CZ80::ImplementRR_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 1E */	{ "RR (IY+{d})",     &CZ80::ImplementRR_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 1F */	{ "RR (IY+{d})",     &CZ80::ImplementRR_IYd_,     4, 23, 23, 0, OT_NONE },
+		/* 20 */	{ "SLA (IY+{d})",    &CZ80::ImplementSLA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 21 */	{ "SLA (IY+{d})",    &CZ80::ImplementSLA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 22 */	{ "SLA (IY+{d})",    &CZ80::ImplementSLA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 23 */	{ "SLA (IY+{d})",    &CZ80::ImplementSLA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 24 */	{ "SLA (IY+{d})",    &CZ80::ImplementSLA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 25 */	{ "SLA (IY+{d})",    &CZ80::ImplementSLA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 26 */	{ "SLA (IY+{d})",    &CZ80::ImplementSLA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 27 */	{ "SLA (IY+{d})",    &CZ80::ImplementSLA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 28 */	{ "SRA (IY+{d})",    &CZ80::ImplementSRA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 29 */	{ "SRA (IY+{d})",    &CZ80::ImplementSRA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 2A */	{ "SRA (IY+{d})",    &CZ80::ImplementSRA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 2B */	{ "SRA (IY+{d})",    &CZ80::ImplementSRA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 2C */	{ "SRA (IY+{d})",    &CZ80::ImplementSRA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 2D */	{ "SRA (IY+{d})",    &CZ80::ImplementSRA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 2E */	{ "SRA (IY+{d})",    &CZ80::ImplementSRA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 2F */	{ "SRA (IY+{d})",    &CZ80::ImplementSRA_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 30 */	{ "SLL (IY+{d})",    &CZ80::ImplementSLL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 31 */	{ "SLL (IY+{d})",    &CZ80::ImplementSLL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 32 */	{ "SLL (IY+{d})",    &CZ80::ImplementSLL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 33 */	{ "SLL (IY+{d})",    &CZ80::ImplementSLL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 34 */	{ "SLL (IY+{d})",    &CZ80::ImplementSLL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 35 */	{ "SLL (IY+{d})",    &CZ80::ImplementSLL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 36 */	{ "SLL (IY+{d})",    &CZ80::ImplementSLL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 37 */	{ "SLL (IY+{d})",    &CZ80::ImplementSLL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 38 */	{ "SRL (IY+{d})",    &CZ80::ImplementSRL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 39 */	{ "SRL (IY+{d})",    &CZ80::ImplementSRL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 3A */	{ "SRL (IY+{d})",    &CZ80::ImplementSRL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 3B */	{ "SRL (IY+{d})",    &CZ80::ImplementSRL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 3C */	{ "SRL (IY+{d})",    &CZ80::ImplementSRL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 3D */	{ "SRL (IY+{d})",    &CZ80::ImplementSRL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 3E */	{ "SRL (IY+{d})",    &CZ80::ImplementSRL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 3F */	{ "SRL (IY+{d})",    &CZ80::ImplementSRL_IYd_,    4, 23, 23, 0, OT_NONE },
+		/* 40 */	{ "BIT 0,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 41 */	{ "BIT 0,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 42 */	{ "BIT 0,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 43 */	{ "BIT 0,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 44 */	{ "BIT 0,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 45 */	{ "BIT 0,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 46 */	{ "BIT 0,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 47 */	{ "BIT 0,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 48 */	{ "BIT 1,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 49 */	{ "BIT 1,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 4A */	{ "BIT 1,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 4B */	{ "BIT 1,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 4C */	{ "BIT 1,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 4D */	{ "BIT 1,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 4E */	{ "BIT 1,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 4F */	{ "BIT 1,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 50 */	{ "BIT 2,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 51 */	{ "BIT 2,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 52 */	{ "BIT 2,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 53 */	{ "BIT 2,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 54 */	{ "BIT 2,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 55 */	{ "BIT 2,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 56 */	{ "BIT 2,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 57 */	{ "BIT 2,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 58 */	{ "BIT 3,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 59 */	{ "BIT 3,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 5A */	{ "BIT 3,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 5B */	{ "BIT 3,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 5C */	{ "BIT 3,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 5D */	{ "BIT 3,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 5E */	{ "BIT 3,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 5F */	{ "BIT 3,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 60 */	{ "BIT 4,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 61 */	{ "BIT 4,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 62 */	{ "BIT 4,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 63 */	{ "BIT 4,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 64 */	{ "BIT 4,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 65 */	{ "BIT 4,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 66 */	{ "BIT 4,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 67 */	{ "BIT 4,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 68 */	{ "BIT 5,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 69 */	{ "BIT 5,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 6A */	{ "BIT 5,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 6B */	{ "BIT 5,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 6C */	{ "BIT 5,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 6D */	{ "BIT 5,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 6E */	{ "BIT 5,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 6F */	{ "BIT 5,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 70 */	{ "BIT 6,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 71 */	{ "BIT 6,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 72 */	{ "BIT 6,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 73 */	{ "BIT 6,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 74 */	{ "BIT 6,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 75 */	{ "BIT 6,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 76 */	{ "BIT 6,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 77 */	{ "BIT 6,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 78 */	{ "BIT 7,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 79 */	{ "BIT 7,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 7A */	{ "BIT 7,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 7B */	{ "BIT 7,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 7C */	{ "BIT 7,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 7D */	{ "BIT 7,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 7E */	{ "BIT 7,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 7F */	{ "BIT 7,(IY+{d})",  &CZ80::ImplementBITb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 80 */	{ "RES 0,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 81 */	{ "RES 0,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 82 */	{ "RES 0,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 83 */	{ "RES 0,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 84 */	{ "RES 0,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 85 */	{ "RES 0,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 86 */	{ "RES 0,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 87 */	{ "RES 0,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 88 */	{ "RES 1,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 89 */	{ "RES 1,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 8A */	{ "RES 1,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 8B */	{ "RES 1,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 8C */	{ "RES 1,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 8D */	{ "RES 1,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 8E */	{ "RES 1,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 8F */	{ "RES 1,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 90 */	{ "RES 2,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 91 */	{ "RES 2,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 92 */	{ "RES 2,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 93 */	{ "RES 2,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 94 */	{ "RES 2,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 95 */	{ "RES 2,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 96 */	{ "RES 2,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 97 */	{ "RES 2,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 98 */	{ "RES 3,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 99 */	{ "RES 3,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 9A */	{ "RES 3,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 9B */	{ "RES 3,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 9C */	{ "RES 3,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 9D */	{ "RES 3,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 9E */	{ "RES 3,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* 9F */	{ "RES 3,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A0 */	{ "RES 4,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A1 */	{ "RES 4,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A2 */	{ "RES 4,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A3 */	{ "RES 4,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A4 */	{ "RES 4,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A5 */	{ "RES 4,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A6 */	{ "RES 4,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A7 */	{ "RES 4,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A8 */	{ "RES 5,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* A9 */	{ "RES 5,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* AA */	{ "RES 5,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* AB */	{ "RES 5,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* AC */	{ "RES 5,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* AD */	{ "RES 5,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* AE */	{ "RES 5,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* AF */	{ "RES 5,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B0 */	{ "RES 6,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B1 */	{ "RES 6,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B2 */	{ "RES 6,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B3 */	{ "RES 6,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B4 */	{ "RES 6,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B5 */	{ "RES 6,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B6 */	{ "RES 6,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B7 */	{ "RES 6,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B8 */	{ "RES 7,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* B9 */	{ "RES 7,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* BA */	{ "RES 7,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* BB */	{ "RES 7,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* BC */	{ "RES 7,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* BD */	{ "RES 7,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* BE */	{ "RES 7,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* BF */	{ "RES 7,(IY+{d})",  &CZ80::ImplementRESb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C0 */	{ "SET 0,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C1 */	{ "SET 0,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C2 */	{ "SET 0,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C3 */	{ "SET 0,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C4 */	{ "SET 0,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C5 */	{ "SET 0,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C6 */	{ "SET 0,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C7 */	{ "SET 0,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C8 */	{ "SET 1,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* C9 */	{ "SET 1,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* CA */	{ "SET 1,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* CB */	{ "SET 1,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* CC */	{ "SET 1,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* CD */	{ "SET 1,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* CE */	{ "SET 1,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* CF */	{ "SET 1,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D0 */	{ "SET 2,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D1 */	{ "SET 2,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D2 */	{ "SET 2,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D3 */	{ "SET 2,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D4 */	{ "SET 2,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D5 */	{ "SET 2,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D6 */	{ "SET 2,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D7 */	{ "SET 2,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D8 */	{ "SET 3,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* D9 */	{ "SET 3,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* DA */	{ "SET 3,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* DB */	{ "SET 3,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* DC */	{ "SET 3,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* DD */	{ "SET 3,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* DE */	{ "SET 3,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* DF */	{ "SET 3,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E0 */	{ "SET 4,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E1 */	{ "SET 4,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E2 */	{ "SET 4,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E3 */	{ "SET 4,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E4 */	{ "SET 4,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E5 */	{ "SET 4,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E6 */	{ "SET 4,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E7 */	{ "SET 4,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E8 */	{ "SET 5,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* E9 */	{ "SET 5,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* EA */	{ "SET 5,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* EB */	{ "SET 5,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* EC */	{ "SET 5,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* ED */	{ "SET 5,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* EE */	{ "SET 5,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* EF */	{ "SET 5,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F0 */	{ "SET 6,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F1 */	{ "SET 6,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F2 */	{ "SET 6,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F3 */	{ "SET 6,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F4 */	{ "SET 6,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F5 */	{ "SET 6,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F6 */	{ "SET 6,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F7 */	{ "SET 6,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F8 */	{ "SET 7,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* F9 */	{ "SET 7,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* FA */	{ "SET 7,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* FB */	{ "SET 7,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* FC */	{ "SET 7,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* FD */	{ "SET 7,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* FE */	{ "SET 7,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE },
+		/* FF */	{ "SET 7,(IY+{d})",  &CZ80::ImplementSETb_IYd_,   4, 20, 20, 0, OT_NONE }
+	}
+};
+
+#undef ILLEGAL
+#undef PREFIX
+
+//=============================================================================
+// The lengths are checked against the operands in the mnemonics as this
+// compiles, so the two can't drift apart
+
+static constexpr uint32 GetOperandBytes(const char* pMnemonic)
+{
+	uint32 bytes = 0;
+	for (; *pMnemonic != 0; ++pMnemonic)
+	{
+		if (*pMnemonic == '{')
+		{
+			bytes += ((pMnemonic[1] == 'n') && (pMnemonic[2] == 'n')) ? 2 : 1;
+		}
+	}
+	return bytes;
+}
+
+static constexpr bool AreLengthsConsistent(void)
+{
+	for (uint32 table = 0; table < CZ80::OT_COUNT; ++table)
+	{
+		uint32 prefixBytes = (table == CZ80::OT_NONE) ? 0 : (((table == CZ80::OT_DDCB) || (table == CZ80::OT_FDCB)) ? 2 : 1);
+		for (uint32 opcode = 0; opcode < 256; ++opcode)
+		{
+			// DD or FD followed by another prefix is just the one byte
+			bool lonePrefix = ((table == CZ80::OT_DD) || (table == CZ80::OT_FD)) && ((opcode == 0xDD) || (opcode == 0xED) || (opcode == 0xFD));
+			const CZ80::SOpcode& entry = CZ80::s_opcode[table][opcode];
+			if ((entry.m_pMnemonic != NULL) && (entry.m_length != (lonePrefix ? 1 : (prefixBytes + 1 + GetOperandBytes(entry.m_pMnemonic)))))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static_assert(AreLengthsConsistent(), "an opcode's length doesn't match the operands in its mnemonic");
+
+//=============================================================================
@@ -3,37 +3,80 @@
 #include <string.h>
 
 #include <GL/glfw.h>
+#include <zlib.h>
+
+#include "common/macros.h"
 
 #include "zxspectrum.h"
+#include "ay8912.h"
 #include "display.h"
+#include "framelog.h"
+#include "tracelog.h"
+#include "inputtimeline.h"
 #include "keyboard.h"
+#include "memorypool.h"
+#include "perfcounters.h"
+#include "rewind.h"
+#include "savestate.h"
 #include "sound.h"
+#include "symbols.h"
 #include "z80.h"
 
-static CKeyboard g_keyboard;
 #define DISPLAY_SCALE (2)
 #define MAX_CLOCKRATE_MULTIPLIER (64.0f)
 #define MIN_CLOCKRATE_MULTIPLIER (0.5f)
-//#define SHOW_FRAMERATE
+#define REWIND_HISTORY_SIZE (SIZE_IN_MB(4))
+#define PROFILE_HOTSPOTS (100)
 
 // TODO:
 // fix up UpdateScanline() to use new enumerated constants
 
 //=============================================================================
 
+const CZXSpectrum::SMachineModel CZXSpectrum::s_machineModel[MM_COUNT] =
+{
+	//	name		default ROM				clock				line	top	frame		contended	RAM		contended	paging	AY
+	{ "48K",	"roms/48.rom",		3500000.0,	224,	64,	69888,	14335,		0x25,	0x20,			false,	false },
+	{ "128K",	"roms/128.rom",		3546900.0,	228,	63,	70908,	14361,		0xFF,	0xAA,			true,		true },
+	{ "+2",		"roms/plus2.rom",	3546900.0,	228,	63,	70908,	14361,		0xFF,	0xAA,			true,		true }
+};
+
+const uint8 CZXSpectrum::s_contentionPattern[8] = { 6, 5, 4, 3, 2, 1, 0, 0 };
+
+//=============================================================================
+
 CZXSpectrum::CZXSpectrum(void)
-	: m_frameStart(0.0)
+	: m_pScreen(NULL)
+	, m_pModel(NULL)
+	, m_model(MM_48K)
+	, m_port7FFD(0)
+	, m_contendedSlotMask(0)
+	, m_pRewind(NULL)
+	, m_rewindInterval(0)
+	, m_stateRAMOffset(0)
+	, m_stateVideoOffset(0)
+	, m_pContentionTable(NULL)
+	, m_enableContention(false)
+	, m_frameStart(0.0)
  	, m_frameRate(3500000.0 / 69888.0)
  	, m_frameTime(1.0 / m_frameRate)
 	, m_clockRate(1.0f)
 	, m_pDisplay(NULL)
 	, m_pZ80(NULL)
 	, m_pSound(NULL)
+	, m_pAY(NULL)
+	, m_pKeyboard(NULL)
+	, m_pInput(NULL)
+	, m_pFrameLog(NULL)
+	, m_pTraceLog(NULL)
 	, m_pFile(NULL)
 	, m_scanline(0)
 	, m_xpos(0)
 	, m_frameNumber(0)
 	, m_scanlineTstates(0)
+	, m_renderedLine(0)
+	, m_renderedColumn(0)
+	, m_frameTstates(0)
 	, m_tapeTstates(0)
 	, m_writePortFE(0)
 	, m_readPortFE(0)
@@ -41,6 +84,29 @@ CZXSpectrum::CZXSpectrum(void)
 	, m_tapeFormat(TC_FORMAT_UNKNOWN)
 	, m_tapeState(TC_STATE_READING_FORMAT)
 {
+	for (uint32 page = 0; page < SC_MAX_ROM_PAGES; ++page)
+	{
+		m_pROM[page] = CMemoryPool::GetBlankPage();
+	}
+
+	for (uint32 page = 0; page < SC_MAX_RAM_PAGES; ++page)
+	{
+		m_pRAM[page] = NULL;
+	}
+	for (uint32 slot = 0; slot < SC_MEMORY_SLOTS; ++slot)
+	{
+		m_pReadPage[slot] = m_pWritePage[slot] = NULL;
+	}
+	memset(m_writeGeneration, 0, sizeof(m_writeGeneration));
+	MarkAllDirty();
+#if defined(Z80_PROFILER)
+	memset(m_profileFile, 0, sizeof(m_profileFile));
+#endif // defined(Z80_PROFILER)
+#if defined(Z80_CALL_PROFILER)
+	memset(m_callGraphFile, 0, sizeof(m_callGraphFile));
+#endif // defined(Z80_CALL_PROFILER)
+
+	SetModel(MM_48K);
 }
 
 //=============================================================================
@@ -59,16 +125,66 @@ CZXSpectrum::~CZXSpectrum(void)
 		delete m_pSound;
 	}
 
+	if (m_pAY != NULL)
+	{
+		delete m_pAY;
+	}
+
+	if (m_pRewind != NULL)
+	{
+		delete m_pRewind;
+	}
+
+	if (m_pInput != NULL)
+	{
+		delete m_pInput;
+	}
+
+	if (m_pFrameLog != NULL)
+	{
+		delete m_pFrameLog;
+	}
+
+	if (m_pTraceLog != NULL)
+	{
+		delete m_pTraceLog;
+	}
+
+	if (m_pKeyboard != NULL)
+	{
+		m_pKeyboard->Detach();
+		delete m_pKeyboard;
+	}
+
 	if (m_pDisplay != NULL)
 	{
-		CKeyboard::Uninitialise();
 		delete m_pDisplay;
 	}
 
+#if defined(Z80_PROFILER)
+	if ((m_pZ80 != NULL) && (m_profileFile[0] != 0))
+	{
+		WriteProfile(m_profileFile);
+	}
+#endif // defined(Z80_PROFILER)
+#if defined(Z80_CALL_PROFILER)
+	if ((m_pZ80 != NULL) && (m_callGraphFile[0] != 0))
+	{
+		WriteCallGraph(m_callGraphFile);
+	}
+#endif // defined(Z80_CALL_PROFILER)
+
 	if (m_pZ80 != NULL)
 	{
 		delete m_pZ80;
 	}
+
+	for (uint32 page = 0; page < SC_MAX_RAM_PAGES; ++page)
+	{
+		CMemoryPool::FreePage(m_pRAM[page]);
+	}
+
+	free(m_pContentionTable);
 }
 
 //=============================================================================
@@ -81,48 +197,16 @@ bool CZXSpectrum::Initialise(int argc, char* argv[])
 	if (m_pDisplay != NULL)
 	{
 		m_pDisplay->SetDisplayScale(DISPLAY_SCALE);
-		CKeyboard::Initialise();
 
 		m_pSound = new CSound();
 		if (m_pSound != NULL)
 		{
 			m_pSound->Initialise();
-
-			if (m_pZ80 = new CZ80(this))
+			initialised = InitialiseMachine(argc, argv);
+			if (initialised)
 			{
-				const char* rom = "roms/48.rom";
-				const char* tape = NULL;
-				int arg = 0;
-
-				// Parse arguments
-				while (arg < argc)
-				{
-					if (strcmp(argv[arg], "-rom") == 0)
-					{
-						if (++arg < argc)
-						{
-							rom = argv[arg];
-						}
-						else
-						{
-							fprintf(stderr, "[ZX Spectrum]: missing parameter for '-rom'\n");
-						}
-					}
-					else
-					{
-						// assume any other argument is a tape
-						tape = argv[arg++];
-					}
-				}
-
-				LoadROM(rom);
-				if (tape != NULL)
-				{
-					LoadTape(tape);
-				}
-
-				fprintf(stdout, "[ZX Spectrum]: Initialised\n");
-				initialised = true;
+				// Only the windowed machine takes the host key events
+				m_pKeyboard->Attach();
 			}
 		}
 	}
@@ -132,154 +216,615 @@ bool CZXSpectrum::Initialise(int argc, char* argv[])
 
 //=============================================================================
 
-bool CZXSpectrum::Update(void)
+bool CZXSpectrum::InitialiseHeadless(int argc, char* argv[])
 {
-	bool ret = true;
+	// No window, host keyboard or audio device.  The sound is still created (but
+	// never opened or updated) so that save states have the same layout.
+	m_pSound = new CSound();
+	return (m_pSound != NULL) && InitialiseMachine(argc, argv);
+}
+
+//=============================================================================
+
+bool CZXSpectrum::InitialiseMachine(int argc, char* argv[])
+{
+	bool initialised = false;
 
-	if ((m_pZ80 != NULL) && (m_pDisplay != NULL))
+	// Bulk block repeats are timed from the opcode table rather than the
+	// handlers, so the two have to agree (checked once)
+	static bool s_tstatesChecked = false;
+	if (!s_tstatesChecked)
 	{
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_F1))
+		if (!CZ80::AreTstatesConsistent())
 		{
-			DisplayHelp();
+			fprintf(stderr, "[ZX Spectrum]: the opcode table's T states don't match the Z80 handlers\n");
+			return false;
 		}
+		s_tstatesChecked = true;
+	}
 
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_F2))
-		{
-			m_pZ80->SetEnableDebug(!m_pZ80->GetEnableDebug());
-		}
+	m_pAY = new CAY8912();
+	m_pKeyboard = new CKeyboard();
 
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_F3))
+	if (m_pZ80 = new CZ80(this))
+	{
+		const char* rom = NULL;
+		const char* tape = NULL;
+		const char* frameLog = NULL;
+		bool hashMemory = false;
+		uint32 dumpInterval = 0;
+		CFrameLog::eDumpFormat dumpFormat = CFrameLog::DF_PNG;
+		bool breakpointsGiven = false;
+		int arg = 0;
+
+		// Parse arguments
+		while (arg < argc)
 		{
-			m_pZ80->SetEnableOutputStatus(!m_pZ80->GetEnableOutputStatus());
-		}
+			if (strcmp(argv[arg], "-rom") == 0)
+			{
+				if (++arg < argc)
+				{
+					rom = argv[arg++];
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '-rom'\n");
+				}
+			}
+			else if (strcmp(argv[arg], "-model") == 0)
+			{
+				if (++arg < argc)
+				{
+					uint32 model = 0;
+					while ((model < MM_COUNT) && (strcmp(argv[arg], s_machineModel[model].m_name) != 0))
+					{
+						++model;
+					}
 
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_F5))
-		{
-			m_pZ80->SetEnableUnattendedDebug(!m_pZ80->GetEnableUnattendedDebug());
+					if (model < MM_COUNT)
+					{
+						SetModel(static_cast<eMachineModel>(model));
+					}
+					else
+					{
+						fprintf(stderr, "[ZX Spectrum]: unknown model '%s' (expected 48K, 128K or +2)\n", argv[arg]);
+					}
+					++arg;
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '-model'\n");
+				}
+			}
+			else if (strcmp(argv[arg], "-contention") == 0)
+			{
+				m_enableContention = true;
+				++arg;
+			}
+			else if ((strcmp(argv[arg], "-record") == 0) || (strcmp(argv[arg], "-playback") == 0))
+			{
+				bool record = (argv[arg][1] == 'r');
+				if (++arg < argc)
+				{
+					if (m_pInput == NULL)
+					{
+						m_pInput = new CInputTimeline();
+					}
+
+					if (record)
+					{
+						m_pInput->StartRecording(argv[arg]);
+					}
+					else if (m_pInput->LoadPlayback(argv[arg]))
+					{
+						m_pKeyboard->SetHostMatrix(false);
+					}
+					++arg;
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '%s'\n", argv[arg - 1]);
+				}
+			}
+			else if (strcmp(argv[arg], "-framelog") == 0)
+			{
+				if (++arg < argc)
+				{
+					frameLog = argv[arg++];
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '-framelog'\n");
+				}
+			}
+			else if (strcmp(argv[arg], "-trace") == 0)
+			{
+				if (++arg < argc)
+				{
+					// Traces from the start; unattended debug mode (F5) turns it off
+					// and on again
+					if (m_pTraceLog == NULL)
+					{
+						m_pTraceLog = new CTraceLog();
+					}
+					if (m_pTraceLog->Open(argv[arg++]))
+					{
+						m_pZ80->SetTraceLog(m_pTraceLog);
+						m_pZ80->SetEnableUnattendedDebug(true);
+					}
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '-trace'\n");
+				}
+			}
+			else if (strcmp(argv[arg], "-hashmemory") == 0)
+			{
+				hashMemory = true;
+				++arg;
+			}
+			else if (strcmp(argv[arg], "-dumpframes") == 0)
+			{
+				if (++arg < argc)
+				{
+					dumpInterval = atoi(argv[arg++]);
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '-dumpframes'\n");
+				}
+			}
+			else if (strcmp(argv[arg], "-dumpraw") == 0)
+			{
+				dumpFormat = CFrameLog::DF_RAW;
+				++arg;
+			}
+#if defined(Z80_PROFILER)
+			else if (strcmp(argv[arg], "-profile") == 0)
+			{
+				if (++arg < argc)
+				{
+					strncpy(m_profileFile, argv[arg++], sizeof(m_profileFile) - 1);
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '-profile'\n");
+				}
+			}
+#endif // defined(Z80_PROFILER)
+#if defined(Z80_CALL_PROFILER)
+			else if (strcmp(argv[arg], "-callgraph") == 0)
+			{
+				if (++arg < argc)
+				{
+					strncpy(m_callGraphFile, argv[arg++], sizeof(m_callGraphFile) - 1);
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '-callgraph'\n");
+				}
+			}
+#endif // defined(Z80_CALL_PROFILER)
+			else if ((strcmp(argv[arg], "-break") == 0) || (strcmp(argv[arg], "-watchread") == 0) || (strcmp(argv[arg], "-watchwrite") == 0) ||
+				(strcmp(argv[arg], "-watchin") == 0) || (strcmp(argv[arg], "-watchout") == 0))
+			{
+				const char* pOption = argv[arg];
+				CBreakpointSet* pBreakpoints = &m_pZ80->GetAddressBreakpoints();
+				if (strcmp(pOption, "-watchread") == 0)
+				{
+					pBreakpoints = &m_pZ80->GetReadWatchpoints();
+				}
+				else if (strcmp(pOption, "-watchwrite") == 0)
+				{
+					pBreakpoints = &m_pZ80->GetWriteWatchpoints();
+				}
+				else if (strcmp(pOption, "-watchin") == 0)
+				{
+					pBreakpoints = &m_pZ80->GetPortInWatchpoints();
+				}
+				else if (strcmp(pOption, "-watchout") == 0)
+				{
+					pBreakpoints = &m_pZ80->GetPortOutWatchpoints();
+				}
+
+				if (++arg < argc)
+				{
+					if (!pBreakpoints->Parse(argv[arg]))
+					{
+						fprintf(stderr, "[ZX Spectrum]: bad %s '%s' (expected <first>[-<last>][:<register>=<value>][@<hit count>])\n", pOption, argv[arg]);
+					}
+					breakpointsGiven = true;
+					++arg;
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '%s'\n", pOption);
+				}
+			}
+			else if (strcmp(argv[arg], "-rewind") == 0)
+			{
+				if (++arg < argc)
+				{
+					m_rewindInterval = atoi(argv[arg++]);
+				}
+				else
+				{
+					fprintf(stderr, "[ZX Spectrum]: missing parameter for '-rewind'\n");
+				}
+			}
+			else
+			{
+				// assume any other argument is a tape
+				tape = argv[arg++];
+			}
 		}
 
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_F7))
+		if (!breakpointsGiven)
 		{
-			m_pZ80->SetEnableBreakpoints(!m_pZ80->GetEnableBreakpoints());
+			m_pZ80->GetAddressBreakpoints().Add(0x1024); // ED_ENTER
+			m_pZ80->GetReadWatchpoints().Add(0); // 0x5C3A is ERR_NR
+			m_pZ80->GetWriteWatchpoints().Add(0);
 		}
 
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_F8))
+		BuildContentionTable();
+		if (!LoadROM((rom != NULL) ? rom : m_pModel->m_defaultROM))
 		{
-			m_pZ80->SetEnableProgramFlowBreakpoints(!m_pZ80->GetEnableProgramFlowBreakpoints());
+			return false;
 		}
-
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_PAGEUP))
+		if (tape != NULL)
 		{
-			if (m_pFile != NULL)
-			{
-				m_tapePlaying = !m_tapePlaying;
-				fprintf(stdout, "[ZX Spectrum]: tape is now %s\n", m_tapePlaying ? "playing" : "stopped");
-			}
-			else
-			{
-				fprintf(stdout, "[ZX Spectrum]: no tape loaded\n");
-			}
+			LoadTape(tape);
 		}
 
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_HOME))
+		if ((frameLog != NULL) || (dumpInterval > 0))
 		{
-			if (m_pFile != NULL)
+			// Dumps are named after the log (less its extension)
+			char prefix[256] = "frame";
+			if (frameLog != NULL)
 			{
-				fseek(m_pFile, 0, SEEK_SET);
-				fprintf(stdout, "[ZX Spectrum]: tape is now at start (and %s)\n", m_tapePlaying ? "playing" : "stopped");
+				strncpy(prefix, frameLog, sizeof(prefix) - 1);
+				prefix[sizeof(prefix) - 1] = 0;
+				char* pExtension = strrchr(prefix, '.');
+				if ((pExtension != NULL) && (strchr(pExtension, '/') == NULL))
+				{
+					*pExtension = 0;
+				}
 			}
-			else
+
+			m_pFrameLog = new CFrameLog();
+			if (frameLog != NULL)
 			{
-				fprintf(stdout, "[ZX Spectrum]: no tape loaded\n");
+				m_pFrameLog->Open(frameLog, hashMemory);
 			}
+			m_pFrameLog->SetDumps(prefix, dumpInterval, dumpFormat);
 		}
 
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_UP))
+		if (m_rewindInterval > 0)
 		{
-			if (m_clockRate < MAX_CLOCKRATE_MULTIPLIER)
-			{
-				m_clockRate *= 2.0f;
-				m_frameTime = (1.0 / m_frameRate) / m_clockRate;
-				fprintf(stdout, "[ZX Spectrum]: increased emulation speed to %.02f\n", m_clockRate);
-			}
+			m_pRewind = new CRewindBuffer(GetStateSize(), REWIND_HISTORY_SIZE);
+			fprintf(stdout, "[ZX Spectrum]: rewind history captured every %d frames\n", m_rewindInterval);
 		}
 
-		if (CKeyboard::IsKeyPressed(GLFW_KEY_DOWN))
+		fprintf(stdout, "[ZX Spectrum]: Initialised\n");
+		initialised = true;
+	}
+
+	return initialised;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::RunFrames(uint32 frames)
+{
+	uint32 lastFrame = m_frameNumber + frames;
+	bool ret = true;
+
+	while (ret && (m_frameNumber != lastFrame))
+	{
+		ret = Update();
+	}
+
+	return ret;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::Update(void)
+{
+	PERF_SCOPE(PF_UPDATE);
+
+	bool ret = true;
+
+	if (m_pZ80 != NULL)
+	{
+		if (!IsHeadless())
 		{
-			if (m_clockRate > MIN_CLOCKRATE_MULTIPLIER)
-			{
-				m_clockRate /= 2.0f;
-				m_frameTime = (1.0 / m_frameRate) / m_clockRate;
-				fprintf(stdout, "[ZX Spectrum]: decreased emulation speed to %.02f\n", m_clockRate);
-			}
+			UpdateHotKeys();
 		}
 
 		// Timings:
 		// Each line is 224 tstates (24 tstates of left border, 128 tstates of
 		// screen, 24 tstates of right border and 48 tstates of flyback
 		// Each frame is 64 + 192 + 56 lines
+		// (the 128K machines have 228 tstate lines and 63 + 192 + 56 lines)
 	
-		double currentTime = glfwGetTime();
-		double elapsedTime = currentTime - m_frameStart;
+		// A headless machine isn't paced; each frame is due as soon as the last
+		// one has finished
+		double currentTime = IsHeadless() ? 0.0 : glfwGetTime();
+		double elapsedTime = IsHeadless() ? m_frameTime : currentTime - m_frameStart;
 
-		bool updateZ80 = !m_pZ80->GetEnableDebug() || m_pZ80->GetEnableUnattendedDebug() || CKeyboard::IsKeyPressed(GLFW_KEY_F9) || CKeyboard::IsKeyPressed(GLFW_KEY_F10);
+		bool updateZ80 = IsHeadless() || !m_pZ80->GetEnableDebug() || m_pZ80->GetEnableUnattendedDebug() || m_pKeyboard->IsKeyPressed(GLFW_KEY_F9) || m_pKeyboard->IsKeyPressed(GLFW_KEY_F10);
 
 		if (updateZ80)
 		{
 			uint32 tstates = 0;
-			if (m_scanline >= (SC_TOP_BORDER + SC_PIXEL_SCREEN_HEIGHT + SC_BOTTOM_BORDER))
+			bool frameStarted = false;
+			if (m_scanline >= (m_pModel->m_frameTstates / m_pModel->m_lineTstates))
 			{
 				if (elapsedTime >= m_frameTime)
 				{
-					ret &= m_pDisplay->Update(this);
+					RenderTo(m_scanline, 0);
+					if (m_pFrameLog != NULL)
+					{
+						m_pFrameLog->EndFrame(m_frameNumber, this, m_pRAM, SC_MAX_RAM_PAGES, SC_PAGE_SIZE);
+					}
+
+					if (!IsHeadless())
+					{
+						ret &= m_pDisplay->Update(this);
+					}
+
+					if (m_pModel->m_hasAY)
+					{
+						// The AY only renders when written to, so catch it up to the end
+						// of the frame and hand its output over to be mixed
+						m_pAY->EndFrame(m_frameTstates);
+						if (!IsHeadless())
+						{
+							m_pSound->MixSamples(m_pAY->GetSamples(), m_pAY->GetSampleCount());
+						}
+						m_pAY->ClearSamples();
+					}
+
 					tstates = m_pZ80->ServiceInterrupts();
 					m_frameStart = currentTime;
 					++m_frameNumber;
 					m_scanline = 0;
+					m_renderedLine = 0;
+					m_renderedColumn = 0;
+					m_frameTstates = 0;
+					frameStarted = true;
+					PERF_END_FRAME();
 				}
 			}
 			else
 			{
-				tstates = m_pZ80->SingleStep();
+				if ((m_pInput != NULL) && m_pInput->IsPlaying())
+				{
+					const uint8* pMatrix = m_pInput->Playback(m_frameNumber, m_frameTstates);
+					if (pMatrix != NULL)
+					{
+						m_pKeyboard->SetMatrix(pMatrix);
+					}
+				}
+
+				// Nothing needs to see individual T states go by until the end of the
+				// frame (or the next input event), so a halted CPU can jump straight
+				// there and block instructions can run many iterations at once; the
+				// tape is the exception
+				uint32 toEvent = 0;
+				if (!m_tapePlaying)
+				{
+					uint32 frameLines = m_pModel->m_frameTstates / m_pModel->m_lineTstates;
+					toEvent = ((frameLines - m_scanline) * m_pModel->m_lineTstates) - m_scanlineTstates;
+					if (m_pInput != NULL)
+					{
+						uint32 toInput = m_pInput->GetTstatesToNextEvent(m_frameNumber, m_frameTstates);
+						toEvent = (toInput < toEvent) ? toInput : toEvent;
+					}
+					tstates = m_pZ80->SkipHalt(toEvent);
+				}
+
+				if (tstates == 0)
+				{
+					if (m_pContentionTable != NULL)
+					{
+						m_pZ80->SetContentionTstate(m_frameTstates);
+					}
+					if (m_pTraceLog != NULL)
+					{
+						m_pTraceLog->SetTstate(m_frameTstates);
+					}
+					m_pZ80->SetStepBudget(toEvent);
+					tstates = m_pZ80->SingleStep();
+				}
 			}
 
 			if (tstates > 0)
 			{
+				m_frameTstates += tstates;
 				UpdateScanline(tstates);
 				UpdateTape(tstates);
 			}
 
-			m_pSound->Update(tstates, ((m_writePortFE & PC_EAR_OUT) | (m_readPortFE & PC_EAR_IN)) ? 1.0f : 0.0f);
+			if (!IsHeadless())
+			{
+				m_pSound->Update(tstates, ((m_writePortFE & PC_EAR_OUT) | (m_readPortFE & PC_EAR_IN)) ? 1.0f : 0.0f);
+			}
+
+			// Capturing right at the start of a frame means nothing has been
+			// rendered yet, so the frame buffer needn't be kept
+			if (frameStarted && (m_pRewind != NULL) && ((m_frameNumber % m_rewindInterval) == 0))
+			{
+				CaptureRewind();
+			}
 		}
 		else
 		{
 			if (elapsedTime >= m_frameTime)
 			{
-				// Needed to update the keyboard...
+				// Needed to update the keyboard (and shows how far the beam has got
+				// when single stepping)...
+				UpdateBeam();
 				ret &= m_pDisplay->Update(this);
 				m_frameStart = currentTime;
 			}
 		}
-
-#if defined(SHOW_FRAMERATE)
-		static double startTime = currentTime;
-		static uint32 startFrame = m_frameNumber;
-		if ((currentTime - startTime) > 1.0)
-		{
-			double framerate = (double)(m_frameNumber - startFrame) / (currentTime - startTime);
-			fprintf(stdout, "[ZX Spectrum]: average frame rate is %.02f\n", framerate);
-			startFrame = m_frameNumber;
-			startTime = currentTime;
-		}
-#endif // defined(SHOW_FRAMERATE)
 	}
 
-	ret &= !CKeyboard::IsKeyPressed(GLFW_KEY_ESC);
+	if (!IsHeadless())
+	{
+		ret &= !m_pKeyboard->IsKeyPressed(GLFW_KEY_ESC);
+	}
 	return ret;
 }
 
 //=============================================================================
 
+void CZXSpectrum::UpdateHotKeys(void)
+{
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_F1))
+	{
+		DisplayHelp();
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_F2))
+	{
+		m_pZ80->SetEnableDebug(!m_pZ80->GetEnableDebug());
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_F3))
+	{
+		m_pZ80->SetEnableOutputStatus(!m_pZ80->GetEnableOutputStatus());
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_F5))
+	{
+		m_pZ80->SetEnableUnattendedDebug(!m_pZ80->GetEnableUnattendedDebug());
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_F7))
+	{
+		m_pZ80->SetEnableBreakpoints(!m_pZ80->GetEnableBreakpoints());
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_F8))
+	{
+		m_pZ80->SetEnableProgramFlowBreakpoints(!m_pZ80->GetEnableProgramFlowBreakpoints());
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_F11))
+	{
+		RewindHistory();
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_F12))
+	{
+		char fileName[32];
+		sprintf(fileName, "snapshot%05d.szx", m_frameNumber);
+		SaveSnapshot(fileName);
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_PAGEUP))
+	{
+		if (m_pFile != NULL)
+		{
+			m_tapePlaying = !m_tapePlaying;
+			fprintf(stdout, "[ZX Spectrum]: tape is now %s\n", m_tapePlaying ? "playing" : "stopped");
+		}
+		else
+		{
+			fprintf(stdout, "[ZX Spectrum]: no tape loaded\n");
+		}
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_HOME))
+	{
+		if (m_pFile != NULL)
+		{
+			fseek(m_pFile, 0, SEEK_SET);
+			fprintf(stdout, "[ZX Spectrum]: tape is now at start (and %s)\n", m_tapePlaying ? "playing" : "stopped");
+		}
+		else
+		{
+			fprintf(stdout, "[ZX Spectrum]: no tape loaded\n");
+		}
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_UP))
+	{
+		if (m_clockRate < MAX_CLOCKRATE_MULTIPLIER)
+		{
+			m_clockRate *= 2.0f;
+			m_frameTime = (1.0 / m_frameRate) / m_clockRate;
+			fprintf(stdout, "[ZX Spectrum]: increased emulation speed to %.02f\n", m_clockRate);
+		}
+	}
+
+	if (m_pKeyboard->IsKeyPressed(GLFW_KEY_DOWN))
+	{
+		if (m_clockRate > MIN_CLOCKRATE_MULTIPLIER)
+		{
+			m_clockRate /= 2.0f;
+			m_frameTime = (1.0 / m_frameRate) / m_clockRate;
+			fprintf(stdout, "[ZX Spectrum]: decreased emulation speed to %.02f\n", m_clockRate);
+		}
+	}
+}
+
+//=============================================================================
+
+#if defined(Z80_PROFILER)
+void CZXSpectrum::WriteProfile(const char* fileName) const
+{
+	FILE* pFile = fopen(fileName, "w");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[ZX Spectrum]: unable to write profile to '%s'\n", fileName);
+		return;
+	}
+
+	// The labels are for the 48K ROM (which is also the 128K machines' ROM 1)
+	CSymbolTable symbols;
+	symbols.LoadZX82("zx82.htm");
+	m_pZ80->WriteProfile(pFile, &symbols, PROFILE_HOTSPOTS);
+	fclose(pFile);
+
+	fprintf(stdout, "[ZX Spectrum]: written profile to '%s'\n", fileName);
+}
+
+//=============================================================================
+#endif // defined(Z80_PROFILER)
+
+//=============================================================================
+
+#if defined(Z80_CALL_PROFILER)
+void CZXSpectrum::WriteCallGraph(const char* fileName)
+{
+	FILE* pFile = fopen(fileName, "w");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[ZX Spectrum]: unable to write call graph to '%s'\n", fileName);
+		return;
+	}
+
+	// Collapsed stacks to the file (for flamegraph.pl), and the heaviest
+	// routines to the console
+	CSymbolTable symbols;
+	symbols.LoadZX82("zx82.htm");
+	const CCallProfiler& profiler = m_pZ80->GetCallProfiler();
+	profiler.WriteCollapsedStacks(pFile, &symbols);
+	fclose(pFile);
+
+	profiler.WriteCallees(stdout, &symbols, PROFILE_HOTSPOTS);
+	fprintf(stdout, "[ZX Spectrum]: written call graph to '%s'\n", fileName);
+}
+
+//=============================================================================
+#endif // defined(Z80_CALL_PROFILER)
+
+//=============================================================================
+
 void CZXSpectrum::DisplayHelp(void) const
 {
 	fprintf(stderr, "[ZX Spectrum]: Help keys:\n");
@@ -290,6 +835,8 @@ void CZXSpectrum::DisplayHelp(void) const
 	fprintf(stderr, "[ZX Spectrum]:      [F7]     Toggle enable break points\n");
 	fprintf(stderr, "[ZX Spectrum]:      [F8]     Toggle enable program flow break points\n");
 	fprintf(stderr, "[ZX Spectrum]:      [F9/F10] Single step\n");
+	fprintf(stderr, "[ZX Spectrum]:      [F11]    Rewind (when enabled with -rewind)\n");
+	fprintf(stderr, "[ZX Spectrum]:      [F12]    Save snapshot\n");
 	fprintf(stderr, "[ZX Spectrum]:      [PgUp]   Start/stop tape\n");
 	fprintf(stderr, "[ZX Spectrum]:      [Home]   Rewind tape\n");
 	fprintf(stderr, "[ZX Spectrum]:      [Up]     Increase emulation speen\n");
@@ -301,9 +848,17 @@ void CZXSpectrum::DisplayHelp(void) const
 
 void CZXSpectrum::WriteMemory(uint16 address, uint8 byte)
 {
-	if (address >= 0x4000)
+	uint8* pPage = m_pWritePage[address >> SC_PAGE_SHIFT];
+
+	if (pPage != NULL)
 	{
-		m_memory[address] = byte;
+		NoteWrite(address, 1);
+		if ((pPage == m_pScreen) && ((address & SC_PAGE_MASK) < SC_SCREEN_SIZE_BYTES))
+		{
+			// Everything the beam has already passed sees the old value
+			UpdateBeam();
+		}
+		pPage[address & SC_PAGE_MASK] = byte;
 	}
 	else
 	{
@@ -315,7 +870,79 @@ void CZXSpectrum::WriteMemory(uint16 address, uint8 byte)
 
 uint8 CZXSpectrum::ReadMemory(uint16 address) const
 {
-	return m_memory[address];
+	return m_pReadPage[address >> SC_PAGE_SHIFT][address & SC_PAGE_MASK];
+}
+
+//=============================================================================
+
+const uint8* CZXSpectrum::GetReadBlock(uint16 address, uint16 length) const
+{
+	if (((address & SC_PAGE_MASK) + length) > SC_PAGE_SIZE)
+	{
+		return NULL;
+	}
+
+	return &m_pReadPage[address >> SC_PAGE_SHIFT][address & SC_PAGE_MASK];
+}
+
+//=============================================================================
+
+uint8* CZXSpectrum::GetWriteBlock(uint16 address, uint16 length, uint32 tstates)
+{
+	uint8* pPage = m_pWritePage[address >> SC_PAGE_SHIFT];
+	uint32 offset = address & SC_PAGE_MASK;
+
+	if ((pPage == NULL) || ((offset + length) > SC_PAGE_SIZE))
+	{
+		return NULL;
+	}
+
+	if ((pPage == m_pScreen) && (offset < SC_SCREEN_SIZE_BYTES))
+	{
+		// When the writes land only matters if the beam draws the pixel lines
+		// before they've all been made; in the border it can't tell
+		uint32 topBorder = m_pModel->m_topBorderLines;
+		uint32 endLine = m_scanline + ((m_scanlineTstates + tstates) / m_pModel->m_lineTstates);
+		if ((endLine >= topBorder) && (m_scanline < (topBorder + SC_PIXEL_SCREEN_HEIGHT)))
+		{
+			return NULL;
+		}
+
+		UpdateBeam();
+	}
+
+	NoteWrite(address, length);
+
+	return &pPage[offset];
+}
+
+//=============================================================================
+
+void CZXSpectrum::NoteWrite(uint16 address, uint32 length)
+{
+	// A bank paged in at two addresses is one bank: anything decoded through
+	// either mapping is stale after a write through the other
+	uint32 slot = address >> SC_PAGE_SHIFT;
+	uint32 alias = m_aliasSlot[slot];
+	uint32 offset = address & SC_PAGE_MASK;
+	uint32 pagesPerSlot = SC_PAGE_SIZE >> 8;
+
+	for (uint32 block = (offset >> 8); block <= ((offset + length - 1) >> 8); ++block)
+	{
+		m_dirtyBlocks[m_slotBank[slot]] |= 1ULL << block;
+		++m_writeGeneration[(slot * pagesPerSlot) + block];
+		if (alias != 0)
+		{
+			++m_writeGeneration[(alias * pagesPerSlot) + block];
+		}
+	}
+}
+
+//=============================================================================
+
+const uint32* CZXSpectrum::GetWriteGenerations(void) const
+{
+	return m_writeGeneration;
 }
 
 //=============================================================================
@@ -328,6 +955,10 @@ void CZXSpectrum::WritePort(uint16 address, uint8 byte)
 			// +---+---+---+---+---+---+---+---+
 			// |   |   |   | E | M |  Border   |
 			// +---+---+---+---+---+---+---+---+
+			if ((m_writePortFE ^ byte) & PC_BORDER_MASK)
+			{
+				UpdateBeam();
+			}
 			m_writePortFE = byte & PC_OUTPUT_MASK;
 			//fprintf(stderr, "[ZX Spectrum]: WritePort for address %04X, data %02X [%d%d%d %d %d %d%d%d]\n", address, byte,
 			//	(byte & 0x80) >> 7, (byte & 0x40) >> 6, (byte & 0x20) >> 5,
@@ -337,6 +968,40 @@ void CZXSpectrum::WritePort(uint16 address, uint8 byte)
 			break;
 
 		default:
+			if (m_pModel->m_hasPaging && ((address & 0x8002) == 0))
+			{
+				// 128K memory paging (partially decoded on A15 and A1)
+				// +---+---+---+---+---+---+---+---+
+				// |   |   | L | R | S |   RAM     |
+				// +---+---+---+---+---+---+---+---+
+				// L = lock paging until reset, R = ROM select, S = shadow screen
+				if ((m_port7FFD & PG_LOCK) == 0)
+				{
+					if ((m_port7FFD ^ byte) & PG_SHADOW_SCREEN)
+					{
+						UpdateBeam();
+					}
+					m_port7FFD = byte;
+					MapMemory();
+				}
+				break;
+			}
+
+			if (m_pModel->m_hasAY && ((address & 0x8002) == 0x8000))
+			{
+				// AY register select (FFFD) and data (BFFD), decoded on A15, A14 and
+				// A1
+				if (address & 0x4000)
+				{
+					m_pAY->SelectRegister(byte);
+				}
+				else
+				{
+					m_pAY->WriteRegister(byte, m_frameTstates);
+				}
+				break;
+			}
+
 			fprintf(stderr, "[ZX Spectrum]: WritePort for unhandled address %04X, data %02X [%d%d%d %d %d %d%d%d]\n", address, byte,
 				(byte & 0x80) >> 7, (byte & 0x40) >> 6, (byte & 0x20) >> 5,
 				(byte & 0x10) >> 4,
@@ -350,6 +1015,11 @@ void CZXSpectrum::WritePort(uint16 address, uint8 byte)
 
 uint8 CZXSpectrum::ReadPort(uint16 address) const
 {
+	if (m_pModel->m_hasAY && ((address & 0xC002) == 0xC000))
+	{
+		return m_pAY->ReadRegister();
+	}
+
 	if (address & 0x0001)
 	{
 		return 0xFF;
@@ -361,81 +1031,23 @@ uint8 CZXSpectrum::ReadPort(uint16 address) const
 	// keys: 0=pressed; 1=not pressed
 
 	m_readPortFE |= 0xBF;
-	uint8 mask = 0x00;
-	uint8 line = ~(address >> 8);
-
-	if (line & 0x01)
-	{
-		// SHIFT, Z, X, C, V
-		if (CKeyboard::IsKeyDown(GLFW_KEY_LSHIFT)) mask |= 0x01;
-		if (CKeyboard::IsKeyDown('Z')) mask |= 0x02;
-		if (CKeyboard::IsKeyDown('X')) mask |= 0x04;
-		if (CKeyboard::IsKeyDown('C')) mask |= 0x08;
-		if (CKeyboard::IsKeyDown('V')) mask |= 0x10;
-	}
-
-	if (line & 0x02)
-	{
-		// A, S, D, F, G
-		if (CKeyboard::IsKeyDown('A')) mask |= 0x01;
-		if (CKeyboard::IsKeyDown('S')) mask |= 0x02;
-		if (CKeyboard::IsKeyDown('D')) mask |= 0x04;
-		if (CKeyboard::IsKeyDown('F')) mask |= 0x08;
-		if (CKeyboard::IsKeyDown('G')) mask |= 0x10;
-	}
-
-	if (line & 0x04) // Q, W, E, R, T
-	{
-		if (CKeyboard::IsKeyDown('Q')) mask |= 0x01;
-		if (CKeyboard::IsKeyDown('W')) mask |= 0x02;
-		if (CKeyboard::IsKeyDown('E')) mask |= 0x04;
-		if (CKeyboard::IsKeyDown('R')) mask |= 0x08;
-		if (CKeyboard::IsKeyDown('T')) mask |= 0x10;
-	}
-
-	if (line & 0x08) // 1, 2, 3, 4, 5
-	{
-		if (CKeyboard::IsKeyDown('1')) mask |= 0x01;
-		if (CKeyboard::IsKeyDown('2')) mask |= 0x02;
-		if (CKeyboard::IsKeyDown('3')) mask |= 0x04;
-		if (CKeyboard::IsKeyDown('4')) mask |= 0x08;
-		if (CKeyboard::IsKeyDown('5')) mask |= 0x10;
-	}
-
-	if (line & 0x10) // 0, 9, 8, 7, 6
-	{
-		if (CKeyboard::IsKeyDown('0')) mask |= 0x01;
-		if (CKeyboard::IsKeyDown('9')) mask |= 0x02;
-		if (CKeyboard::IsKeyDown('8')) mask |= 0x04;
-		if (CKeyboard::IsKeyDown('7')) mask |= 0x08;
-		if (CKeyboard::IsKeyDown('6')) mask |= 0x10;
-	}
-
-	if (line & 0x20) // P, O, I, U, Y
-	{
-		if (CKeyboard::IsKeyDown('P')) mask |= 0x01;
-		if (CKeyboard::IsKeyDown('O')) mask |= 0x02;
-		if (CKeyboard::IsKeyDown('I')) mask |= 0x04;
-		if (CKeyboard::IsKeyDown('U')) mask |= 0x08;
-		if (CKeyboard::IsKeyDown('Y')) mask |= 0x10;
-	}
 
-	if (line & 0x40) // ENTER, L, K, J, H
+	// Every half row whose address line is low is scanned
+	const uint8* pMatrix = m_pKeyboard->GetMatrix();
+	if ((m_pInput != NULL) && m_pInput->IsRecording())
 	{
-		if (CKeyboard::IsKeyDown(GLFW_KEY_ENTER)) mask |= 0x01;
-		if (CKeyboard::IsKeyDown('L')) mask |= 0x02;
-		if (CKeyboard::IsKeyDown('K')) mask |= 0x04;
-		if (CKeyboard::IsKeyDown('J')) mask |= 0x08;
-		if (CKeyboard::IsKeyDown('H')) mask |= 0x10;
+		// Changes are recorded when the machine first sees them (at the start of
+		// this instruction), which is exactly where playback applies them
+		m_pInput->Record(m_frameNumber, m_frameTstates, pMatrix);
 	}
-
-	if (line & 0x80) // SPACE, SYM SHIFT, M, N, B
+	uint8 line = ~(address >> 8);
+	uint8 mask = 0x00;
+	for (uint32 row = 0; row < CKeyboard::KB_MATRIX_ROWS; ++row)
 	{
-		if (CKeyboard::IsKeyDown(GLFW_KEY_SPACE)) mask |= 0x01;
-		if (CKeyboard::IsKeyDown(GLFW_KEY_RSHIFT)) mask |= 0x02;
-		if (CKeyboard::IsKeyDown('M')) mask |= 0x04;
-		if (CKeyboard::IsKeyDown('N')) mask |= 0x08;
-		if (CKeyboard::IsKeyDown('B')) mask |= 0x10;
+		if (line & (1 << row))
+		{
+			mask |= pMatrix[row];
+		}
 	}
 
 	m_readPortFE &= ~mask;
@@ -471,188 +1083,1351 @@ uint32 CZXSpectrum::GetScreenHeight(void) const
 
 //=============================================================================
 
+void CZXSpectrum::GetRegisters(SZ80Registers& registers) const
+{
+	m_pZ80->GetRegisters(registers);
+}
+
+//=============================================================================
+
+uint32 CZXSpectrum::GetFrameTstate(void) const
+{
+	// From the beam rather than m_frameTstates, which starts again at the
+	// interrupt without whatever the last instruction of the frame overran by
+	return (m_scanline * m_pModel->m_lineTstates) + m_scanlineTstates;
+}
+
+//=============================================================================
+
+uint32 CZXSpectrum::GetTstatesPerFrame(void) const
+{
+	return m_pModel->m_frameTstates;
+}
+
+//=============================================================================
+
 bool CZXSpectrum::LoadROM(const char* fileName)
 {
-	memset(m_memory, 0, sizeof(m_memory));
-	m_pFile = fopen(fileName, "rb");
-	bool success = false;
+	for (uint32 page = 0; page < SC_MAX_RAM_PAGES; ++page)
+	{
+		if (m_pRAM[page] != NULL)
+		{
+			memset(m_pRAM[page], 0, SC_PAGE_SIZE);
+		}
+	}
 
-	if (m_pFile != NULL)
+	// The 128K machines have two ROMs (the 128K editor followed by 48K BASIC),
+	// supplied as a single 32K image
+	uint32 pages = m_pModel->m_hasPaging ? SC_MAX_ROM_PAGES : 1;
+	bool success = true;
+
+	for (uint32 page = 0; page < SC_MAX_ROM_PAGES; ++page)
 	{
-		size_t result = fread(m_memory, sizeof(m_memory), 1, m_pFile);
-		fclose(m_pFile);
-		m_pFile = NULL;
+		const uint8* pROM = (page < pages) ? CMemoryPool::GetROMPage(fileName, page) : NULL;
+		if ((pROM == NULL) && (page < pages))
+		{
+			success = false;
+		}
+		m_pROM[page] = (pROM != NULL) ? pROM : CMemoryPool::GetBlankPage();
+	}
 
+	if (success)
+	{
 		fprintf(stdout, "[ZX Spectrum]: loaded rom [%s] successfully\n", fileName);
-
-		success = true;
 	}
 	else
 	{
-		fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
+		fprintf(stderr, "[ZX Spectrum]: failed to load [%s] (%s model needs %d bytes)\n", fileName, m_pModel->m_name, pages * SC_PAGE_SIZE);
+		if (m_pModel->m_hasPaging)
+		{
+			// Only the 48K ROM ships with the emulator (see roms/README)
+			fprintf(stderr, "[ZX Spectrum]: the %s ROM isn't included; put its 32K image at [%s] or pass one with -rom\n", m_pModel->m_name, m_pModel->m_defaultROM);
+		}
 	}
 
+	MarkAllDirty();
+	m_port7FFD = 0;
+	MapMemory();
 	return success;
 }
 
 //=============================================================================
 
-bool CZXSpectrum::LoadTape(const char* fileName)
+void CZXSpectrum::SetModel(eMachineModel model)
 {
-	// Find extension
-	const char* extension = strrchr(fileName, '.');
+	m_model = model;
+	m_pModel = &s_machineModel[model];
+	m_frameRate = m_pModel->m_clockRate / static_cast<double>(m_pModel->m_frameTstates);
+	m_frameTime = (1.0 / m_frameRate) / m_clockRate;
 
-	if (extension != NULL)
+	// Only the banks the model has fitted come out of the pool
+	for (uint32 page = 0; page < SC_MAX_RAM_PAGES; ++page)
 	{
-		if (strcmp(extension, ".sna") == 0)
+		bool fitted = ((m_pModel->m_ramPageMask >> page) & 1) != 0;
+		if (fitted && (m_pRAM[page] == NULL))
 		{
-			return LoadSNA(fileName);
+			m_pRAM[page] = CMemoryPool::AllocatePage();
 		}
-
-		struct STapeFormat
+		else if (!fitted && (m_pRAM[page] != NULL))
 		{
-			eTapeConstant m_formatID;
-			const char* m_formatExtension;
-		} types[] = { { TC_FORMAT_RAW, ".raw" }, { TC_FORMAT_TAP, ".tap" }, { TC_FORMAT_TZX, ".tzx" } };
-		
-		for (uint32 format = 0; format < (sizeof(types) / sizeof(STapeFormat)); ++format)
-		{
-			if (strcmp(extension, types[format].m_formatExtension) == 0)
-			{
-				m_pFile = fopen(fileName, "rb");
-				if (m_pFile != NULL)
-				{
-					fprintf(stdout, "[ZX Spectrum]: tape opened [%s] successfully\n", fileName);
-					m_tapeFormat = types[format].m_formatID;
-					return true;
-				}
-			}
+			CMemoryPool::FreePage(m_pRAM[page]);
+			m_pRAM[page] = NULL;
 		}
 	}
 
-	fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
-	return false;
+	m_port7FFD = 0;
+	MapMemory();
+	BuildContentionTable();
 }
 
 //=============================================================================
 
-bool CZXSpectrum::LoadSNA(const char* fileName)
+void CZXSpectrum::MapMemory(void)
 {
-	m_pFile = fopen(fileName, "rb");
-	bool success = false;
+	// Slot 0 is always ROM and slots 1 and 2 are always banks 5 and 2, so the
+	// 48K machine is just a 128K machine that never writes to 7FFD
+	uint8 bank = m_port7FFD & PG_RAM_MASK;
+	const uint8* pPreviousPage[SC_MEMORY_SLOTS] = { m_pReadPage[0], m_pReadPage[1], m_pReadPage[2], m_pReadPage[3] };
+
+	m_pReadPage[0] = m_pROM[(m_port7FFD & PG_ROM_SELECT) ? 1 : 0];
+	m_pWritePage[0] = NULL;
+	m_pReadPage[1] = m_pWritePage[1] = m_pRAM[PG_SLOT1_BANK];
+	m_pReadPage[2] = m_pWritePage[2] = m_pRAM[PG_SLOT2_BANK];
+	m_pReadPage[3] = m_pWritePage[3] = m_pRAM[bank];
+	m_slotBank[0] = 0;
+	m_slotBank[1] = PG_SLOT1_BANK;
+	m_slotBank[2] = PG_SLOT2_BANK;
+	m_slotBank[3] = bank;
+	memset(m_aliasSlot, 0, sizeof(m_aliasSlot));
+	if ((bank == PG_SLOT1_BANK) || (bank == PG_SLOT2_BANK))
+	{
+		uint8 slot = (bank == PG_SLOT1_BANK) ? 1 : 2;
+		m_aliasSlot[slot] = 3;
+		m_aliasSlot[3] = slot;
+	}
 
-	char scratch[49179];
-	if (m_pFile != NULL)
+	// Anything decoded from a slot that now holds something else is stale
+	for (uint32 slot = 0; slot < SC_MEMORY_SLOTS; ++slot)
 	{
-		size_t result = fread(scratch, sizeof(scratch), 1, m_pFile);
-		fclose(m_pFile);
-		m_pFile = NULL;
+		if (m_pReadPage[slot] != pPreviousPage[slot])
+		{
+			for (uint32 page = (slot << (SC_PAGE_SHIFT - 8)); page < ((slot + 1) << (SC_PAGE_SHIFT - 8)); ++page)
+			{
+				++m_writeGeneration[page];
+			}
+		}
+	}
 
-		fprintf(stdout, "[ZX Spectrum]: loaded SNA [%s] successfully\n", fileName);
+	m_pScreen = m_pRAM[(m_port7FFD & PG_SHADOW_SCREEN) ? PG_SHADOW_SCREEN_BANK : PG_NORMAL_SCREEN_BANK];
 
-		memcpy(&m_memory[SC_SCREEN_START_ADDRESS], &scratch[27], SC_48K_SPECTRUM - SC_SCREEN_START_ADDRESS);
-		m_pZ80->LoadSNA(reinterpret_cast<uint8*>(scratch));
+	uint8 contended = m_pModel->m_contendedPageMask;
+	m_contendedSlotMask = (((contended >> PG_SLOT1_BANK) & 1) << 1) | (((contended >> PG_SLOT2_BANK) & 1) << 2) | (((contended >> bank) & 1) << 3);
 
-		success = true;
-	}
-	else
+	if (m_pZ80 != NULL)
 	{
-		fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
+		m_pZ80->SetContendedSlots(m_contendedSlotMask);
 	}
-
-	return success;
 }
 
 //=============================================================================
 
-void CZXSpectrum::UpdateScanline(uint32 tstates)
+void CZXSpectrum::MarkAllDirty(void)
 {
-	m_scanlineTstates += tstates;
-	if (m_scanlineTstates < 224)
+	// For when memory has been rewritten wholesale (loads and resets)
+	memset(m_dirtyBlocks, 0xFF, sizeof(m_dirtyBlocks));
+	for (uint32 page = 0; page < 256; ++page)
 	{
-		return;
+		++m_writeGeneration[page];
 	}
-	m_scanlineTstates -= 224;
+}
 
-	if ((m_scanline < (SC_TOP_BORDER - SC_VISIBLE_BORDER_SIZE)) || (m_scanline >= (SC_TOP_BORDER + SC_PIXEL_SCREEN_HEIGHT + SC_VISIBLE_BORDER_SIZE)))
-	{
-		//printf("CZXSpectrum::UpdateScanline() outside visible bounds %d\n", m_scanline);
-	}
+//=============================================================================
+
+void CZXSpectrum::BuildContentionTable(void)
+{
+	free(m_pContentionTable);
+	m_pContentionTable = NULL;
+
+	if (m_enableContention)
+	{
+		// Accesses only wait while the ULA is fetching the 128 T states of each
+		// pixel line; the border and flyback are free
+		uint32 frameTstates = m_pModel->m_frameTstates;
+		m_pContentionTable = static_cast<uint8*>(calloc(frameTstates, sizeof(uint8)));
+
+		if (m_pContentionTable != NULL)
+		{
+			for (uint32 line = 0; line < SC_PIXEL_SCREEN_HEIGHT; ++line)
+			{
+				uint32 lineStart = m_pModel->m_firstContendedTstate + (line * m_pModel->m_lineTstates);
+				for (uint32 tstate = 0; tstate < (SC_PIXEL_SCREEN_WIDTH >> 1); ++tstate)
+				{
+					m_pContentionTable[lineStart + tstate] = s_contentionPattern[tstate & 7];
+				}
+			}
+		}
+	}
+
+	if (m_pZ80 != NULL)
+	{
+		m_pZ80->SetContention(m_pContentionTable, (m_pContentionTable != NULL) ? m_pModel->m_frameTstates : 0);
+	}
+}
+
+//=============================================================================
+
+bool CZXSpectrum::LoadTape(const char* fileName)
+{
+	// Find extension
+	const char* extension = strrchr(fileName, '.');
+
+	if (extension != NULL)
+	{
+		if (strcmp(extension, ".sna") == 0)
+		{
+			return LoadSNA(fileName);
+		}
+
+		if (strcmp(extension, ".z80") == 0)
+		{
+			return LoadZ80(fileName);
+		}
+
+		if (strcmp(extension, ".szx") == 0)
+		{
+			return LoadSZX(fileName);
+		}
+
+		struct STapeFormat
+		{
+			eTapeConstant m_formatID;
+			const char* m_formatExtension;
+		} types[] = { { TC_FORMAT_RAW, ".raw" }, { TC_FORMAT_TAP, ".tap" }, { TC_FORMAT_TZX, ".tzx" } };
+		
+		for (uint32 format = 0; format < (sizeof(types) / sizeof(STapeFormat)); ++format)
+		{
+			if (strcmp(extension, types[format].m_formatExtension) == 0)
+			{
+				m_pFile = fopen(fileName, "rb");
+				if (m_pFile != NULL)
+				{
+					fprintf(stdout, "[ZX Spectrum]: tape opened [%s] successfully\n", fileName);
+					m_tapeFormat = types[format].m_formatID;
+					return true;
+				}
+			}
+		}
+	}
+
+	fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
+	return false;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::LoadSNA(const char* fileName)
+{
+	m_pFile = fopen(fileName, "rb");
+	bool success = false;
+
+	char scratch[49179];
+	if (m_pFile != NULL)
+	{
+		size_t result = fread(scratch, sizeof(scratch), 1, m_pFile);
+		fclose(m_pFile);
+		m_pFile = NULL;
+
+		fprintf(stdout, "[ZX Spectrum]: loaded SNA [%s] successfully\n", fileName);
+
+		for (uint32 slot = 1; slot < SC_MEMORY_SLOTS; ++slot)
+		{
+			memcpy(m_pWritePage[slot], &scratch[27 + ((slot - 1) << SC_PAGE_SHIFT)], SC_PAGE_SIZE);
+		}
+		m_pZ80->LoadSNA(reinterpret_cast<uint8*>(scratch));
+		MarkAllDirty();
+
+		success = true;
+	}
 	else
 	{
-		uint32 scanline = m_scanline - (SC_TOP_BORDER - SC_VISIBLE_BORDER_SIZE);
-		uint8* pScreenMemory = &m_memory[SC_SCREEN_START_ADDRESS];
+		fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
+	}
 
-		uint32 borderRGB = 0xFF000000;
-		if (m_writePortFE & CC_BLUE) borderRGB |= 0x00CD0000;
-		if (m_writePortFE & CC_RED) borderRGB |= 0x000000CD;
-		if (m_writePortFE & CC_GREEN) borderRGB |= 0x0000CD00;
+	return success;
+}
+
+//=============================================================================
 
-		if ((scanline < SC_VISIBLE_BORDER_SIZE) || (scanline >= (SC_VISIBLE_BORDER_SIZE + SC_PIXEL_SCREEN_HEIGHT)))
+bool CZXSpectrum::SetSnapshotModel(eMachineModel model)
+{
+	// Switching model needs that model's ROM; staying put just needs clean RAM
+	if (model != m_model)
+	{
+		SetModel(model);
+		return LoadROM(m_pModel->m_defaultROM);
+	}
+	else
+	{
+		for (uint32 page = 0; page < SC_MAX_RAM_PAGES; ++page)
 		{
-			//printf("CZXSpectrum::UpdateScanline() top or bottom border %d\n", m_scanline);
-			for (uint32 x = 0; x < SC_VIDEO_MEMORY_WIDTH; ++x)
+			if (m_pRAM[page] != NULL)
 			{
-				m_videoMemory[(scanline * SC_VIDEO_MEMORY_WIDTH) + x] = borderRGB; 
+				memset(m_pRAM[page], 0, SC_PAGE_SIZE);
 			}
 		}
-		else
+		MarkAllDirty();
+	}
+
+	return true;
+}
+
+//=============================================================================
+
+void CZXSpectrum::SetFrameTstate(uint32 tstate)
+{
+	// Snapshots resume part way through a frame; the beam is put where it would
+	// be then, and everything before it is rendered from the loaded screen the
+	// next time the beam is caught up.  It may be just past the end of the
+	// frame, if the interrupt was due.
+	if (tstate >= (m_pModel->m_frameTstates + m_pModel->m_lineTstates))
+	{
+		tstate = 0;
+	}
+
+	m_frameTstates = tstate;
+	m_scanline = tstate / m_pModel->m_lineTstates;
+	m_scanlineTstates = tstate % m_pModel->m_lineTstates;
+	m_renderedLine = 0;
+	m_renderedColumn = 0;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::LoadZ80(const char* fileName)
+{
+	FILE* pFile = fopen(fileName, "rb");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
+		return false;
+	}
+
+	uint8 header[SN_Z80_MAX_HEADER_SIZE];
+	memset(header, 0, sizeof(header));
+	bool success = (fread(header, SN_Z80_V1_HEADER_SIZE, 1, pFile) == 1);
+
+	uint16 pc = header[6] | (header[7] << 8);
+	uint32 version = 1;
+	eMachineModel model = MM_48K;
+
+	if (success && (pc == 0))
+	{
+		// Version 2 and 3 have an additional header after the PC moved there
+		success = (fread(&header[SN_Z80_V1_HEADER_SIZE], 2, 1, pFile) == 1);
+		uint16 extra = header[30] | (header[31] << 8);
+		success &= ((extra == SN_Z80_V2_EXTRA_SIZE) || (extra == SN_Z80_V3_EXTRA_SIZE) || (extra == SN_Z80_V3_EXTRA_SIZE_1FFD));
+		success = success && (fread(&header[SN_Z80_V1_HEADER_SIZE + 2], extra, 1, pFile) == 1);
+		version = (extra == SN_Z80_V2_EXTRA_SIZE) ? 2 : 3;
+		pc = header[32] | (header[33] << 8);
+
+		// Hardware numbering changed between versions 2 and 3 (bit 7 of byte 37
+		// turns a 128K into a +2)
+		uint8 hardware = header[34];
+		bool is48K = (hardware == 0) || (hardware == 1) || ((version == 3) && (hardware == 3));
+		bool is128K = (version == 2) ? ((hardware == 3) || (hardware == 4)) : ((hardware >= 4) && (hardware <= 6));
+		if (is128K)
 		{
-			//printf("CZXSpectrum::UpdateScanline() screen scanline %d, scanline %d\n", m_scanline, scanline);
+			model = (header[37] & 0x80) ? MM_PLUS2 : MM_128K;
+		}
+		else if ((version == 3) && (hardware == 12))
+		{
+			model = MM_PLUS2;
+		}
+		else if (!is48K)
+		{
+			fprintf(stderr, "[ZX Spectrum]: [%s] is for unsupported hardware (type %d)\n", fileName, hardware);
+			success = false;
+		}
+	}
 
-			uint32 pixelByte = PixelByteIndex(0, scanline - SC_VISIBLE_BORDER_SIZE);
-			uint32 attributeByte = AttributeByteIndex(0, scanline - SC_VISIBLE_BORDER_SIZE);
-			//printf("CZXSpectrum::UpdateScanline() pixel offset %d attribute offset %d\n", pixelByte, attributeByte);
+	if (success)
+	{
+		success = SetSnapshotModel(model);
+	}
 
-			for (uint32 x = 0; x < SC_VIDEO_MEMORY_WIDTH; ++x)
+	if (success)
+	{
+		// Version 1 is a single (optionally compressed) 48K image, later versions
+		// are a series of 16K pages
+		if (version == 1)
+		{
+			uint8* pPages[3] = { m_pWritePage[1], m_pWritePage[2], m_pWritePage[3] };
+			if (header[12] & 0x20)
+			{
+				long start = ftell(pFile);
+				fseek(pFile, 0, SEEK_END);
+				uint32 size = static_cast<uint32>(ftell(pFile) - start);
+				fseek(pFile, start, SEEK_SET);
+				success = DecodeZ80Block(pFile, size, pPages, 3);
+			}
+			else
+			{
+				for (uint32 page = 0; success && (page < 3); ++page)
+				{
+					success = (fread(pPages[page], SC_PAGE_SIZE, 1, pFile) == 1);
+				}
+			}
+		}
+		else
+		{
+			uint8 block[3];
+			while (success && (fread(block, sizeof(block), 1, pFile) == 1))
 			{
-				if ((x < SC_VISIBLE_BORDER_SIZE) || (x >= (SC_VISIBLE_BORDER_SIZE + SC_PIXEL_SCREEN_WIDTH)))
+				uint16 length = block[0] | (block[1] << 8);
+				uint8* pPage = NULL;
+				if (m_pModel->m_hasPaging)
 				{
-					//printf("CZXSpectrum::UpdateScanline() x %d\n", x);
-					m_videoMemory[(scanline * SC_VIDEO_MEMORY_WIDTH) + x] = borderRGB; 
+					pPage = ((block[2] >= 3) && (block[2] <= 10)) ? m_pRAM[block[2] - 3] : NULL;
 				}
 				else
 				{
-					uint32 offset = (x - SC_VISIBLE_BORDER_SIZE) >> 3;
-					//printf("CZXSpectrum::UpdateScanline() byte offset %d\n", offset);
-
-					uint8 ink = (pScreenMemory[attributeByte + offset] & 0x07) >> 0;
-					uint8 paper = (pScreenMemory[attributeByte + offset] & 0x38) >> 3;
-					uint32 bright = (pScreenMemory[attributeByte + offset] & 0x40) ? 0x00FFFFFF : 0x00CDCDCD;
-					bool flash = (pScreenMemory[attributeByte + offset] & 0x80) ? true : false;
-
-					uint32 paperRGB = 0xFF000000;
-					if (paper & CC_BLUE) paperRGB |= 0x00FF0000;
-					if (paper & CC_RED) paperRGB |= 0x000000FF;
-					if (paper & CC_GREEN) paperRGB |= 0x0000FF00;
-					paperRGB &= bright;
-					uint32 inkRGB = 0xFF000000;
-					if (ink & CC_BLUE) inkRGB |= 0x00FF0000;
-					if (ink & CC_RED) inkRGB |= 0x000000FF;
-					if (ink & CC_GREEN) inkRGB |= 0x0000FF00;
-					inkRGB &= bright;
-
-					bool pixel = ((pScreenMemory[pixelByte + offset] & (1 << (7 - (x & 0x07))))) ? true : false;
-					if (flash & ((m_frameNumber >> 5) & 0x0001))
+					switch (block[2])
 					{
-						// Flash attribute swaps ink and paper every 32 frames on a real Speccy
-						pixel = !pixel;
+						case 4: pPage = m_pRAM[2]; break;
+						case 5: pPage = m_pRAM[0]; break;
+						case 8: pPage = m_pRAM[5]; break;
 					}
+				}
 
-					uint32 colour = pixel ? inkRGB : paperRGB;
-					m_videoMemory[x + (scanline * SC_VIDEO_MEMORY_WIDTH)] = colour;
+				uint32 size = (length == SN_Z80_UNCOMPRESSED_BLOCK) ? SC_PAGE_SIZE : length;
+				if (pPage == NULL)
+				{
+					// ROM or interface pages we don't have
+					fseek(pFile, size, SEEK_CUR);
+				}
+				else if (length == SN_Z80_UNCOMPRESSED_BLOCK)
+				{
+					success = (fread(pPage, SC_PAGE_SIZE, 1, pFile) == 1);
+				}
+				else
+				{
+					success = DecodeZ80Block(pFile, size, &pPage, 1);
 				}
 			}
 		}
 	}
+	fclose(pFile);
+
+	if (!success)
+	{
+		fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
+		return false;
+	}
+
+	SZ80Registers registers;
+	registers.m_AF = (header[0] << 8) | header[1];
+	registers.m_BC = header[2] | (header[3] << 8);
+	registers.m_HL = header[4] | (header[5] << 8);
+	registers.m_PC = pc;
+	registers.m_SP = header[8] | (header[9] << 8);
+	registers.m_I = header[10];
+	uint8 flags = (header[12] == 0xFF) ? 0x01 : header[12];
+	registers.m_R = (header[11] & 0x7F) | ((flags & 0x01) << 7);
+	registers.m_DE = header[13] | (header[14] << 8);
+	registers.m_BCalt = header[15] | (header[16] << 8);
+	registers.m_DEalt = header[17] | (header[18] << 8);
+	registers.m_HLalt = header[19] | (header[20] << 8);
+	registers.m_AFalt = (header[21] << 8) | header[22];
+	registers.m_IY = header[23] | (header[24] << 8);
+	registers.m_IX = header[25] | (header[26] << 8);
+	registers.m_IFF1 = (header[27] != 0) ? 1 : 0;
+	registers.m_IFF2 = (header[28] != 0) ? 1 : 0;
+	registers.m_interruptMode = header[29] & 0x03;
+	m_pZ80->SetRegisters(registers);
+
+	// Version 3 has the T state counter, which counts down to the end of each
+	// quarter of the frame, with the quarter in the next byte (offset by 1)
+	uint32 tstate = 0;
+	if (version == 3)
+	{
+		uint32 quarter = m_pModel->m_frameTstates >> 2;
+		uint32 low = header[55] | (header[56] << 8);
+		tstate = (((header[57] + 1) & 0x03) * quarter) + ((low < quarter) ? (quarter - low - 1) : 0);
+	}
+	SetFrameTstate(tstate);
+
+	m_writePortFE = (m_writePortFE & ~PC_BORDER_MASK) | ((flags >> 1) & PC_BORDER_MASK);
+
+	if (m_pModel->m_hasPaging)
+	{
+		m_port7FFD = header[35];
+		MapMemory();
+	}
+
+	if (m_pModel->m_hasAY && (version > 1))
+	{
+		for (uint8 reg = 0; reg < 16; ++reg)
+		{
+			m_pAY->SelectRegister(reg);
+			m_pAY->WriteRegister(header[39 + reg], 0);
+		}
+		m_pAY->SelectRegister(header[38]);
+	}
+
+	fprintf(stdout, "[ZX Spectrum]: loaded Z80 (version %d, %s) [%s] successfully\n", version, m_pModel->m_name, fileName);
+	return true;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::SaveZ80(const char* fileName) const
+{
+	FILE* pFile = fopen(fileName, "wb");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[ZX Spectrum]: failed to save [%s]\n", fileName);
+		return false;
+	}
+
+	SZ80Registers registers;
+	m_pZ80->GetRegisters(registers);
+
+	// Always version 3 (PC in the version 1 header is zero)
+	uint8 header[SN_Z80_V1_HEADER_SIZE + 2 + SN_Z80_V3_EXTRA_SIZE];
+	memset(header, 0, sizeof(header));
+	header[0] = registers.m_AF >> 8;
+	header[1] = registers.m_AF & 0xFF;
+	header[2] = registers.m_BC & 0xFF;
+	header[3] = registers.m_BC >> 8;
+	header[4] = registers.m_HL & 0xFF;
+	header[5] = registers.m_HL >> 8;
+	header[8] = registers.m_SP & 0xFF;
+	header[9] = registers.m_SP >> 8;
+	header[10] = registers.m_I;
+	header[11] = registers.m_R & 0x7F;
+	header[12] = (registers.m_R >> 7) | ((m_writePortFE & PC_BORDER_MASK) << 1);
+	header[13] = registers.m_DE & 0xFF;
+	header[14] = registers.m_DE >> 8;
+	header[15] = registers.m_BCalt & 0xFF;
+	header[16] = registers.m_BCalt >> 8;
+	header[17] = registers.m_DEalt & 0xFF;
+	header[18] = registers.m_DEalt >> 8;
+	header[19] = registers.m_HLalt & 0xFF;
+	header[20] = registers.m_HLalt >> 8;
+	header[21] = registers.m_AFalt >> 8;
+	header[22] = registers.m_AFalt & 0xFF;
+	header[23] = registers.m_IY & 0xFF;
+	header[24] = registers.m_IY >> 8;
+	header[25] = registers.m_IX & 0xFF;
+	header[26] = registers.m_IX >> 8;
+	header[27] = registers.m_IFF1;
+	header[28] = registers.m_IFF2;
+	header[29] = registers.m_interruptMode;
+	header[30] = SN_Z80_V3_EXTRA_SIZE;
+	header[32] = registers.m_PC & 0xFF;
+	header[33] = registers.m_PC >> 8;
+	header[34] = (m_model == MM_48K) ? 0 : ((m_model == MM_128K) ? 4 : 12);
+	header[35] = m_pModel->m_hasPaging ? m_port7FFD : 0;
+	if (m_pModel->m_hasAY)
+	{
+		header[37] = 0x04;
+		header[38] = m_pAY->GetSelectedRegister();
+		for (uint8 reg = 0; reg < 16; ++reg)
+		{
+			header[39 + reg] = m_pAY->GetRegister(reg);
+		}
+	}
 
-	++m_scanline;
+	// The T state counter counts quarter frames
+	uint32 quarter = m_pModel->m_frameTstates >> 2;
+	uint32 tstate = GetFrameTstate();
+	uint32 low = quarter - (tstate % quarter) - 1;
+	header[55] = low & 0xFF;
+	header[56] = low >> 8;
+	header[57] = ((tstate / quarter) + 3) & 0x03;
+	header[61] = 0xFF;
+	header[62] = 0xFF;
+
+	bool success = (fwrite(header, sizeof(header), 1, pFile) == 1);
+
+	// 128K pages are numbered bank + 3, 48K just has 3 pages
+	static const uint8 s_48KPages[3][2] = { { 8, 5 }, { 4, 2 }, { 5, 0 } };
+	uint32 pageCount = m_pModel->m_hasPaging ? SC_MAX_RAM_PAGES : 3;
+	for (uint32 index = 0; success && (index < pageCount); ++index)
+	{
+		uint8 page = m_pModel->m_hasPaging ? (index + 3) : s_48KPages[index][0];
+		const uint8* pPage = m_pRAM[m_pModel->m_hasPaging ? index : s_48KPages[index][1]];
+
+		uint8 data[SC_PAGE_SIZE];
+		uint32 size = EncodeZ80Block(pPage, data);
+		uint16 length = (size < SC_PAGE_SIZE) ? size : SN_Z80_UNCOMPRESSED_BLOCK;
+		uint8 block[3] = { static_cast<uint8>(length & 0xFF), static_cast<uint8>(length >> 8), page };
+
+		success = (fwrite(block, sizeof(block), 1, pFile) == 1);
+		success = success && (fwrite((size < SC_PAGE_SIZE) ? data : pPage, (size < SC_PAGE_SIZE) ? size : SC_PAGE_SIZE, 1, pFile) == 1);
+	}
+	fclose(pFile);
+
+	if (success)
+	{
+		fprintf(stdout, "[ZX Spectrum]: saved Z80 [%s] successfully\n", fileName);
+	}
+	else
+	{
+		fprintf(stderr, "[ZX Spectrum]: failed to save [%s]\n", fileName);
+	}
+
+	return success;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::DecodeZ80Block(FILE* pFile, uint32 size, uint8* const* ppPages, uint32 pageCount)
+{
+	// ED ED nn bb is nn repeats of bb; anything else is literal.  Output goes
+	// straight into the pages.
+	uint32 total = pageCount << SC_PAGE_SHIFT;
+	uint32 out = 0;
+
+	while ((size > 0) && (out < total))
+	{
+		int byte = fgetc(pFile);
+		--size;
+		if (byte == EOF)
+		{
+			return false;
+		}
+
+		if ((byte == 0xED) && (size > 0))
+		{
+			int next = fgetc(pFile);
+			--size;
+			if (next == 0xED)
+			{
+				int count = fgetc(pFile);
+				int value = fgetc(pFile);
+				size = (size >= 2) ? size - 2 : 0;
+				if ((count == EOF) || (value == EOF))
+				{
+					return false;
+				}
+
+				while ((count-- > 0) && (out < total))
+				{
+					ppPages[out >> SC_PAGE_SHIFT][out & SC_PAGE_MASK] = static_cast<uint8>(value);
+					++out;
+				}
+				continue;
+			}
+
+			ppPages[out >> SC_PAGE_SHIFT][out & SC_PAGE_MASK] = 0xED;
+			++out;
+			byte = next;
+			if ((byte == EOF) || (out >= total))
+			{
+				continue;
+			}
+		}
+
+		ppPages[out >> SC_PAGE_SHIFT][out & SC_PAGE_MASK] = static_cast<uint8>(byte);
+		++out;
+	}
+
+	// Any remainder (e.g. the version 1 end marker) is ignored
+	if (size > 0)
+	{
+		fseek(pFile, size, SEEK_CUR);
+	}
+
+	return (out == total);
+}
+
+//=============================================================================
+
+uint32 CZXSpectrum::EncodeZ80Block(const uint8* pPage, uint8* pOut) const
+{
+	// Runs of 5 or more (2 or more for ED) become ED ED nn bb, and the byte
+	// after a lone ED is never part of a run.  Gives up (returning the page
+	// size) as soon as it stops being smaller than the original.
+	uint32 in = 0;
+	uint32 out = 0;
+
+	while (in < SC_PAGE_SIZE)
+	{
+		uint8 byte = pPage[in];
+		uint32 run = 1;
+		while (((in + run) < SC_PAGE_SIZE) && (pPage[in + run] == byte) && (run < 255))
+		{
+			++run;
+		}
+
+		if ((run >= 5) || ((byte == 0xED) && (run >= 2)))
+		{
+			if ((out + 4) >= SC_PAGE_SIZE)
+			{
+				return SC_PAGE_SIZE;
+			}
+			pOut[out++] = 0xED;
+			pOut[out++] = 0xED;
+			pOut[out++] = static_cast<uint8>(run);
+			pOut[out++] = byte;
+			in += run;
+		}
+		else
+		{
+			if ((out + 2) >= SC_PAGE_SIZE)
+			{
+				return SC_PAGE_SIZE;
+			}
+			pOut[out++] = byte;
+			++in;
+			if ((byte == 0xED) && (in < SC_PAGE_SIZE))
+			{
+				pOut[out++] = pPage[in++];
+			}
+		}
+	}
+
+	return out;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::LoadSZX(const char* fileName)
+{
+	FILE* pFile = fopen(fileName, "rb");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
+		return false;
+	}
+
+	uint8 header[SN_SZX_HEADER_SIZE];
+	bool success = (fread(header, sizeof(header), 1, pFile) == 1) && (memcmp(header, "ZXST", 4) == 0);
+
+	eMachineModel model = MM_48K;
+	switch (header[6])
+	{
+		case SN_SZX_MACHINE_48K: model = MM_48K; break;
+		case SN_SZX_MACHINE_128K: model = MM_128K; break;
+		case SN_SZX_MACHINE_PLUS2: model = MM_PLUS2; break;
+		default:
+			if (success)
+			{
+				fprintf(stderr, "[ZX Spectrum]: [%s] is for an unsupported machine (type %d)\n", fileName, header[6]);
+				success = false;
+			}
+			break;
+	}
+
+	if (success)
+	{
+		success = SetSnapshotModel(model);
+	}
+
+	// A series of blocks, each a 4 character id and a size; unknown blocks are
+	// skipped
+	uint8 block[8];
+	while (success && (fread(block, sizeof(block), 1, pFile) == 1))
+	{
+		uint32 size = block[4] | (block[5] << 8) | (block[6] << 16) | (block[7] << 24);
+		uint8 data[SN_SZX_Z80R_SIZE];
+		memset(data, 0, sizeof(data));
+
+		if (memcmp(block, "Z80R", 4) == 0)
+		{
+			uint32 length = (size < SN_SZX_Z80R_SIZE) ? size : SN_SZX_Z80R_SIZE;
+			success = (fread(data, length, 1, pFile) == 1);
+			fseek(pFile, size - length, SEEK_CUR);
+
+			SZ80Registers registers;
+			uint16* pRegister[12] = { &registers.m_AF, &registers.m_BC, &registers.m_DE, &registers.m_HL, &registers.m_AFalt, &registers.m_BCalt, &registers.m_DEalt, &registers.m_HLalt, &registers.m_IX, &registers.m_IY, &registers.m_SP, &registers.m_PC };
+			for (uint32 index = 0; index < 12; ++index)
+			{
+				*pRegister[index] = data[index << 1] | (data[(index << 1) + 1] << 8);
+			}
+			registers.m_I = data[24];
+			registers.m_R = data[25];
+			registers.m_IFF1 = data[26];
+			registers.m_IFF2 = data[27];
+			registers.m_interruptMode = data[28];
+			m_pZ80->SetRegisters(registers);
+			SetFrameTstate(data[29] | (data[30] << 8) | (data[31] << 16) | (data[32] << 24));
+		}
+		else if (memcmp(block, "SPCR", 4) == 0)
+		{
+			uint32 length = (size < SN_SZX_SPCR_SIZE) ? size : SN_SZX_SPCR_SIZE;
+			success = (fread(data, length, 1, pFile) == 1);
+			fseek(pFile, size - length, SEEK_CUR);
+
+			m_writePortFE = (data[3] & PC_OUTPUT_MASK & ~PC_BORDER_MASK) | (data[0] & PC_BORDER_MASK);
+			if (m_pModel->m_hasPaging)
+			{
+				m_port7FFD = data[1];
+				MapMemory();
+			}
+		}
+		else if (memcmp(block, "AY\0\0", 4) == 0)
+		{
+			uint32 length = (size < SN_SZX_AY_SIZE) ? size : SN_SZX_AY_SIZE;
+			success = (fread(data, length, 1, pFile) == 1);
+			fseek(pFile, size - length, SEEK_CUR);
+
+			if (m_pModel->m_hasAY)
+			{
+				for (uint8 reg = 0; reg < 16; ++reg)
+				{
+					m_pAY->SelectRegister(reg);
+					m_pAY->WriteRegister(data[2 + reg], 0);
+				}
+				m_pAY->SelectRegister(data[1]);
+			}
+		}
+		else if ((memcmp(block, "RAMP", 4) == 0) && (size >= 3))
+		{
+			success = (fread(data, 3, 1, pFile) == 1);
+			uint16 flags = data[0] | (data[1] << 8);
+			uint8* pPage = (data[2] < SC_MAX_RAM_PAGES) ? m_pRAM[data[2]] : NULL;
+
+			if (pPage == NULL)
+			{
+				fseek(pFile, size - 3, SEEK_CUR);
+			}
+			else if (flags & SN_SZX_RAMP_COMPRESSED)
+			{
+				success = success && InflateSZXBlock(pFile, size - 3, pPage);
+			}
+			else
+			{
+				success = success && (size - 3 >= SC_PAGE_SIZE) && (fread(pPage, SC_PAGE_SIZE, 1, pFile) == 1);
+				fseek(pFile, size - 3 - SC_PAGE_SIZE, SEEK_CUR);
+			}
+		}
+		else
+		{
+			fseek(pFile, size, SEEK_CUR);
+		}
+	}
+	fclose(pFile);
+
+	if (!success)
+	{
+		fprintf(stderr, "[ZX Spectrum]: failed to load [%s]\n", fileName);
+		return false;
+	}
+
+	fprintf(stdout, "[ZX Spectrum]: loaded SZX (%s) [%s] successfully\n", m_pModel->m_name, fileName);
+	return true;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::InflateSZXBlock(FILE* pFile, uint32 size, uint8* pPage)
+{
+	// Inflates straight into the page, feeding the compressed data through a
+	// small buffer
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	if (inflateInit(&stream) != Z_OK)
+	{
+		return false;
+	}
+
+	stream.next_out = pPage;
+	stream.avail_out = SC_PAGE_SIZE;
+
+	uint8 input[SN_CHUNK_SIZE];
+	int result = Z_OK;
+	while ((size > 0) && (result == Z_OK))
+	{
+		uint32 chunk = (size < SN_CHUNK_SIZE) ? size : SN_CHUNK_SIZE;
+		if (fread(input, chunk, 1, pFile) != 1)
+		{
+			break;
+		}
+		size -= chunk;
+
+		stream.next_in = input;
+		stream.avail_in = chunk;
+		result = inflate(&stream, Z_NO_FLUSH);
+	}
+
+	bool success = (result == Z_STREAM_END) && (stream.total_out == SC_PAGE_SIZE);
+	inflateEnd(&stream);
+
+	if (size > 0)
+	{
+		fseek(pFile, size, SEEK_CUR);
+	}
+
+	return success;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::SaveSZX(const char* fileName) const
+{
+	FILE* pFile = fopen(fileName, "wb");
+	if (pFile == NULL)
+	{
+		fprintf(stderr, "[ZX Spectrum]: failed to save [%s]\n", fileName);
+		return false;
+	}
+
+	uint8 machine = (m_model == MM_48K) ? SN_SZX_MACHINE_48K : ((m_model == MM_128K) ? SN_SZX_MACHINE_128K : SN_SZX_MACHINE_PLUS2);
+	uint8 header[SN_SZX_HEADER_SIZE] = { 'Z', 'X', 'S', 'T', SN_SZX_MAJOR_VERSION, SN_SZX_MINOR_VERSION, machine, 0 };
+	bool success = (fwrite(header, sizeof(header), 1, pFile) == 1);
+
+	SZ80Registers registers;
+	m_pZ80->GetRegisters(registers);
+
+	uint8 z80r[8 + SN_SZX_Z80R_SIZE] = { 'Z', '8', '0', 'R', SN_SZX_Z80R_SIZE, 0, 0, 0 };
+	uint16 value[12] = { registers.m_AF, registers.m_BC, registers.m_DE, registers.m_HL, registers.m_AFalt, registers.m_BCalt, registers.m_DEalt, registers.m_HLalt, registers.m_IX, registers.m_IY, registers.m_SP, registers.m_PC };
+	memset(&z80r[8], 0, SN_SZX_Z80R_SIZE);
+	for (uint32 index = 0; index < 12; ++index)
+	{
+		z80r[8 + (index << 1)] = value[index] & 0xFF;
+		z80r[8 + (index << 1) + 1] = value[index] >> 8;
+	}
+	z80r[8 + 24] = registers.m_I;
+	z80r[8 + 25] = registers.m_R;
+	z80r[8 + 26] = registers.m_IFF1;
+	z80r[8 + 27] = registers.m_IFF2;
+	z80r[8 + 28] = registers.m_interruptMode;
+	uint32 tstate = GetFrameTstate();
+	z80r[8 + 29] = tstate & 0xFF;
+	z80r[8 + 30] = (tstate >> 8) & 0xFF;
+	z80r[8 + 31] = (tstate >> 16) & 0xFF;
+	success = success && (fwrite(z80r, sizeof(z80r), 1, pFile) == 1);
+
+	uint8 spcr[8 + SN_SZX_SPCR_SIZE] = { 'S', 'P', 'C', 'R', SN_SZX_SPCR_SIZE, 0, 0, 0, static_cast<uint8>(m_writePortFE & PC_BORDER_MASK), m_port7FFD, 0, m_writePortFE, 0, 0, 0, 0 };
+	success = success && (fwrite(spcr, sizeof(spcr), 1, pFile) == 1);
+
+	if (m_pModel->m_hasAY)
+	{
+		uint8 ay[8 + SN_SZX_AY_SIZE] = { 'A', 'Y', 0, 0, SN_SZX_AY_SIZE, 0, 0, 0, 0, m_pAY->GetSelectedRegister() };
+		for (uint8 reg = 0; reg < 16; ++reg)
+		{
+			ay[10 + reg] = m_pAY->GetRegister(reg);
+		}
+		success = success && (fwrite(ay, sizeof(ay), 1, pFile) == 1);
+	}
+
+	for (uint32 page = 0; success && (page < SC_MAX_RAM_PAGES); ++page)
+	{
+		if (m_pRAM[page] != NULL)
+		{
+			uint8 data[SC_PAGE_SIZE + 64];
+			uLongf size = sizeof(data);
+			success = (compress2(data, &size, m_pRAM[page], SC_PAGE_SIZE, Z_BEST_COMPRESSION) == Z_OK);
+
+			uint32 blockSize = static_cast<uint32>(size) + 3;
+			uint8 ramp[8 + 3] = { 'R', 'A', 'M', 'P', static_cast<uint8>(blockSize & 0xFF), static_cast<uint8>((blockSize >> 8) & 0xFF), static_cast<uint8>(blockSize >> 16), 0, SN_SZX_RAMP_COMPRESSED, 0, static_cast<uint8>(page) };
+			success = success && (fwrite(ramp, sizeof(ramp), 1, pFile) == 1);
+			success = success && (fwrite(data, size, 1, pFile) == 1);
+		}
+	}
+	fclose(pFile);
+
+	if (success)
+	{
+		fprintf(stdout, "[ZX Spectrum]: saved SZX [%s] successfully\n", fileName);
+	}
+	else
+	{
+		fprintf(stderr, "[ZX Spectrum]: failed to save [%s]\n", fileName);
+	}
+
+	return success;
+}
+
+//=============================================================================
+
+bool CZXSpectrum::SaveSnapshot(const char* fileName) const
+{
+	const char* extension = strrchr(fileName, '.');
+
+	if ((m_pZ80 != NULL) && (extension != NULL))
+	{
+		if (strcmp(extension, ".z80") == 0)
+		{
+			return SaveZ80(fileName);
+		}
+
+		if (strcmp(extension, ".szx") == 0)
+		{
+			return SaveSZX(fileName);
+		}
+	}
+
+	fprintf(stderr, "[ZX Spectrum]: can't save [%s] (expected .z80 or .szx)\n", fileName);
+	return false;
+}
+
+//=============================================================================
+
+uint32 CZXSpectrum::GetStateSize(void) const
+{
+	// A writer without a buffer just counts
+	CStateWriter writer(NULL, 0);
+	WriteState(writer);
+	return writer.GetPosition();
+}
+
+//=============================================================================
+
+uint32 CZXSpectrum::SaveState(void* pBuffer, uint32 size) const
+{
+	if (m_pZ80 == NULL)
+	{
+		return 0;
+	}
+
+	CStateWriter writer(pBuffer, size);
+	WriteState(writer);
+
+	if (!writer.IsValid())
+	{
+		fprintf(stderr, "[ZX Spectrum]: save state needs %d bytes, buffer is only %d\n", GetStateSize(), size);
+		return 0;
+	}
+
+	// Size is only known at the end
+	reinterpret_cast<SStateHeader*>(writer.GetBuffer())->m_size = writer.GetPosition();
+	return writer.GetPosition();
+}
+
+//=============================================================================
+
+bool CZXSpectrum::RestoreState(const void* pBuffer, uint32 size)
+{
+	if ((m_pZ80 == NULL) || (pBuffer == NULL) || (size < sizeof(SStateHeader)))
+	{
+		return false;
+	}
+
+	// Check everything up front so a bad state never leaves the machine half
+	// restored
+	SStateHeader header;
+	memcpy(&header, pBuffer, sizeof(header));
+	if ((header.m_magic != SStateHeader::SS_MAGIC) || (header.m_version != SStateHeader::SS_VERSION))
+	{
+		fprintf(stderr, "[ZX Spectrum]: not a save state (or unsupported version)\n");
+		return false;
+	}
+
+	if (header.m_model != m_model)
+	{
+		fprintf(stderr, "[ZX Spectrum]: save state is for the %s, not the %s\n", (header.m_model < MM_COUNT) ? s_machineModel[header.m_model].m_name : "unknown model", m_pModel->m_name);
+		return false;
+	}
+
+	if ((header.m_size != size) || (header.m_size != GetStateSize()))
+	{
+		fprintf(stderr, "[ZX Spectrum]: save state is the wrong size (%d bytes)\n", size);
+		return false;
+	}
+
+	CStateReader reader(pBuffer, size);
+	ReadState(reader);
+	return reader.IsValid();
+}
+
+//=============================================================================
+
+void CZXSpectrum::WriteState(CStateWriter& writer) const
+{
+	SStateHeader header;
+	header.m_magic = SStateHeader::SS_MAGIC;
+	header.m_version = SStateHeader::SS_VERSION;
+	header.m_model = static_cast<uint16>(m_model);
+	header.m_size = 0;
+	writer.Write(header);
+
+	// CPU
+	m_pZ80->SaveState(writer);
+
+	// Memory (only the banks this model has fitted; the ROM is not saved)
+	writer.Write(m_port7FFD);
+	m_stateRAMOffset = writer.GetPosition();
+	for (uint32 page = 0; page < SC_MAX_RAM_PAGES; ++page)
+	{
+		if (m_pRAM[page] != NULL)
+		{
+			writer.Write(m_pRAM[page], SC_PAGE_SIZE);
+		}
+	}
+
+	// ULA
+	writer.Write(m_writePortFE);
+	writer.Write(m_readPortFE);
+	writer.Write(m_scanline);
+	writer.Write(m_scanlineTstates);
+	writer.Write(m_frameTstates);
+	writer.Write(m_frameNumber);
+	writer.Write(m_renderedLine);
+	writer.Write(m_renderedColumn);
+	m_stateVideoOffset = writer.GetPosition();
+	writer.Write(m_videoMemory, sizeof(m_videoMemory));
+
+	// Tape
+	int64 tapePosition = (m_pFile != NULL) ? ftell(m_pFile) : -1;
+	writer.Write(tapePosition);
+	writer.Write(m_tapeTstates);
+	writer.Write(m_tapePlaying);
+	writer.Write(m_tapeFormat);
+	writer.Write(m_tapeState);
+	writer.Write(m_tapeBlockSize);
+	writer.Write(m_tapeDataBitMask);
+	writer.Write(m_tapeDataByteMask);
+	writer.Write(m_tapeByte);
+	writer.Write(m_tapePulseCounter);
+	writer.Write(m_tapeBlockInfo);
+	writer.Write(m_tapeError);
+
+	// Audio
+	m_pSound->SaveState(writer);
+	m_pAY->SaveState(writer);
+}
+
+//=============================================================================
+
+void CZXSpectrum::ReadState(CStateReader& reader)
+{
+	SStateHeader header;
+	reader.Read(header);
+
+	m_pZ80->RestoreState(reader);
+
+	reader.Read(m_port7FFD);
+	for (uint32 page = 0; page < SC_MAX_RAM_PAGES; ++page)
+	{
+		if (m_pRAM[page] != NULL)
+		{
+			reader.Read(m_pRAM[page], SC_PAGE_SIZE);
+		}
+	}
+	MarkAllDirty();
+	MapMemory();
+
+	reader.Read(m_writePortFE);
+	reader.Read(m_readPortFE);
+	reader.Read(m_scanline);
+	reader.Read(m_scanlineTstates);
+	reader.Read(m_frameTstates);
+	reader.Read(m_frameNumber);
+	reader.Read(m_renderedLine);
+	reader.Read(m_renderedColumn);
+	reader.Read(m_videoMemory, sizeof(m_videoMemory));
+
+	int64 tapePosition = 0;
+	reader.Read(tapePosition);
+	if ((m_pFile != NULL) && (tapePosition >= 0))
+	{
+		fseek(m_pFile, static_cast<long>(tapePosition), SEEK_SET);
+	}
+	reader.Read(m_tapeTstates);
+	reader.Read(m_tapePlaying);
+	reader.Read(m_tapeFormat);
+	reader.Read(m_tapeState);
+	reader.Read(m_tapeBlockSize);
+	reader.Read(m_tapeDataBitMask);
+	reader.Read(m_tapeDataByteMask);
+	reader.Read(m_tapeByte);
+	reader.Read(m_tapePulseCounter);
+	reader.Read(m_tapeBlockInfo);
+	reader.Read(m_tapeError);
+
+	m_pSound->RestoreState(reader);
+	m_pAY->RestoreState(reader);
+}
+
+//=============================================================================
+
+void CZXSpectrum::CaptureRewind(void)
+{
+	if (SaveState(m_pRewind->GetCaptureBuffer(), m_pRewind->GetStateSize()) == 0)
+	{
+		return;
+	}
+
+	// Dirty blocks in the order the banks appear in the state
+	SRewindLayout layout;
+	uint64 dirtyBlocks[SC_MAX_RAM_PAGES];
+	layout.m_ramOffset = m_stateRAMOffset;
+	layout.m_ramPages = 0;
+	layout.m_skipOffset = m_stateVideoOffset;
+	layout.m_skipSize = sizeof(m_videoMemory);
+	for (uint32 page = 0; page < SC_MAX_RAM_PAGES; ++page)
+	{
+		if (m_pRAM[page] != NULL)
+		{
+			dirtyBlocks[layout.m_ramPages++] = m_dirtyBlocks[page];
+		}
+	}
+
+	m_pRewind->CommitCapture(layout, dirtyBlocks);
+	memset(m_dirtyBlocks, 0, sizeof(m_dirtyBlocks));
+}
+
+//=============================================================================
+
+void CZXSpectrum::RewindHistory(void)
+{
+	if (m_pRewind == NULL)
+	{
+		fprintf(stdout, "[ZX Spectrum]: rewind not enabled\n");
+		return;
+	}
+
+	const uint8* pState = m_pRewind->Rewind(1);
+	if ((pState != NULL) && RestoreState(pState, m_pRewind->GetStateSize()))
+	{
+		// The machine now matches the latest capture again
+		memset(m_dirtyBlocks, 0, sizeof(m_dirtyBlocks));
+		fprintf(stdout, "[ZX Spectrum]: rewound to frame %d (%d captures, %d bytes of history left)\n", m_frameNumber, m_pRewind->GetEntryCount(), m_pRewind->GetBytesUsed());
+	}
+	else
+	{
+		fprintf(stdout, "[ZX Spectrum]: no more rewind history\n");
+	}
+}
+
+//=============================================================================
+
+void CZXSpectrum::UpdateScanline(uint32 tstates)
+{
+	PERF_SCOPE(PF_SCANLINE);
+
+	// Only the beam moves here; the video memory is caught up lazily by
+	// UpdateBeam() when something visible changes, or at the end of the frame
+	// (a skipped HALT can cover several lines at once)
+	m_scanlineTstates += tstates;
+	while (m_scanlineTstates >= m_pModel->m_lineTstates)
+	{
+		m_scanlineTstates -= m_pModel->m_lineTstates;
+		++m_scanline;
+	}
+}
+
+//=============================================================================
+
+void CZXSpectrum::UpdateBeam(void)
+{
+	// The beam is 2 pixels further on every T state, reaching the left edge of
+	// the visible border at the start of the line.  Part way through a step
+	// that runs several instructions, it's as far as they've got.
+	uint32 line = m_scanline;
+	uint32 tstates = m_scanlineTstates + m_pZ80->GetStepTstates();
+	while (tstates >= m_pModel->m_lineTstates)
+	{
+		tstates -= m_pModel->m_lineTstates;
+		++line;
+	}
+	uint32 column = tstates << 1;
+	RenderTo(line, (column < SC_VIDEO_MEMORY_WIDTH) ? column : SC_VIDEO_MEMORY_WIDTH);
+}
+
+//=============================================================================
+
+void CZXSpectrum::RenderTo(uint32 line, uint32 column)
+{
+	PERF_SCOPE(PF_RENDER);
+
+	uint32 topBorder = m_pModel->m_topBorderLines;
+	uint32 firstLine = topBorder - SC_VISIBLE_BORDER_SIZE;
+	uint32 lastLine = topBorder + SC_PIXEL_SCREEN_HEIGHT + SC_VISIBLE_BORDER_SIZE;
+
+	while ((m_renderedLine < line) || ((m_renderedLine == line) && (m_renderedColumn < column)))
+	{
+		uint32 toColumn = (m_renderedLine < line) ? SC_VIDEO_MEMORY_WIDTH : column;
+
+		if ((m_renderedLine >= firstLine) && (m_renderedLine < lastLine))
+		{
+			RenderSpan(m_renderedLine - firstLine, m_renderedColumn, toColumn);
+		}
+
+		if (toColumn == SC_VIDEO_MEMORY_WIDTH)
+		{
+			++m_renderedLine;
+			m_renderedColumn = 0;
+		}
+		else
+		{
+			m_renderedColumn = toColumn;
+		}
+	}
+}
+
+//=============================================================================
+
+void CZXSpectrum::RenderSpan(uint32 scanline, uint32 fromColumn, uint32 toColumn)
+{
+	const uint8* pScreenMemory = m_pScreen;
+	uint32* pVideoMemory = &m_videoMemory[scanline * SC_VIDEO_MEMORY_WIDTH];
+
+	uint32 borderRGB = 0xFF000000;
+	if (m_writePortFE & CC_BLUE) borderRGB |= 0x00CD0000;
+	if (m_writePortFE & CC_RED) borderRGB |= 0x000000CD;
+	if (m_writePortFE & CC_GREEN) borderRGB |= 0x0000CD00;
+
+	if ((scanline < SC_VISIBLE_BORDER_SIZE) || (scanline >= (SC_VISIBLE_BORDER_SIZE + SC_PIXEL_SCREEN_HEIGHT)))
+	{
+		for (uint32 x = fromColumn; x < toColumn; ++x)
+		{
+			pVideoMemory[x] = borderRGB;
+		}
+	}
+	else
+	{
+		uint32 pixelByte = PixelByteIndex(0, scanline - SC_VISIBLE_BORDER_SIZE);
+		uint32 attributeByte = AttributeByteIndex(0, scanline - SC_VISIBLE_BORDER_SIZE);
+
+		for (uint32 x = fromColumn; x < toColumn; ++x)
+		{
+			if ((x < SC_VISIBLE_BORDER_SIZE) || (x >= (SC_VISIBLE_BORDER_SIZE + SC_PIXEL_SCREEN_WIDTH)))
+			{
+				pVideoMemory[x] = borderRGB;
+			}
+			else
+			{
+				uint32 offset = (x - SC_VISIBLE_BORDER_SIZE) >> 3;
+
+				uint8 ink = (pScreenMemory[attributeByte + offset] & 0x07) >> 0;
+				uint8 paper = (pScreenMemory[attributeByte + offset] & 0x38) >> 3;
+				uint32 bright = (pScreenMemory[attributeByte + offset] & 0x40) ? 0x00FFFFFF : 0x00CDCDCD;
+				bool flash = (pScreenMemory[attributeByte + offset] & 0x80) ? true : false;
+
+				uint32 paperRGB = 0xFF000000;
+				if (paper & CC_BLUE) paperRGB |= 0x00FF0000;
+				if (paper & CC_RED) paperRGB |= 0x000000FF;
+				if (paper & CC_GREEN) paperRGB |= 0x0000FF00;
+				paperRGB &= bright;
+				uint32 inkRGB = 0xFF000000;
+				if (ink & CC_BLUE) inkRGB |= 0x00FF0000;
+				if (ink & CC_RED) inkRGB |= 0x000000FF;
+				if (ink & CC_GREEN) inkRGB |= 0x0000FF00;
+				inkRGB &= bright;
+
+				bool pixel = ((pScreenMemory[pixelByte + offset] & (1 << (7 - (x & 0x07))))) ? true : false;
+				if (flash & ((m_frameNumber >> 5) & 0x0001))
+				{
+					// Flash attribute swaps ink and paper every 32 frames on a real Speccy
+					pixel = !pixel;
+				}
+
+				pVideoMemory[x] = pixel ? inkRGB : paperRGB;
+			}
+		}
+	}
 }
 
 //=============================================================================
 
 void CZXSpectrum::UpdateTape(uint32 tstates)
 {
+	PERF_SCOPE(PF_TAPE);
+
 	// TODO: refactor this out into a tape class
 	uint16 blockSize = 0;
 	bool stopTape = false;
@@ -6,9 +6,18 @@
 #include "imemory.h"
 #include "iscreenmemory.h"
 
+class CAY8912;
 class CDisplay;
+class CKeyboard;
+class CInputTimeline;
+class CFrameLog;
+class CTraceLog;
 class CZ80;
 class CSound;
+class CRewindBuffer;
+class CStateWriter;
+class CStateReader;
+struct SZ80Registers;
 
 class CZXSpectrum : public IMemory, public IScreenMemory
 {
@@ -21,6 +30,9 @@ class CZXSpectrum : public IMemory, public IScreenMemory
 		virtual uint8 ReadMemory(uint16 address) const;
 		virtual void WritePort(uint16 address, uint8 byte);
 		virtual uint8 ReadPort(uint16 address) const;
+		virtual const uint8* GetReadBlock(uint16 address, uint16 length) const;
+		virtual uint8* GetWriteBlock(uint16 address, uint16 length, uint32 tstates);
+		virtual const uint32* GetWriteGenerations(void) const;
 		// ~IMemory
 
 		// IScreenMemory
@@ -32,12 +44,53 @@ class CZXSpectrum : public IMemory, public IScreenMemory
 						bool				Initialise(int argc, char* argv[]);
 						bool				Update(void);
 
+		// A headless machine has no window, host keyboard or audio and isn't
+		// paced to real time, so many can be run side by side (e.g. on worker threads)
+						bool				InitialiseHeadless(int argc, char* argv[]);
+						bool				RunFrames(uint32 frames);
+						uint32			GetFrameNumber(void) const	{ return m_frameNumber; }
+		// Where the CPU is, and when in the frame (for handing the machine's state
+		// over to another core, e.g. the lockstep checker)
+						void				GetRegisters(SZ80Registers& registers) const;
+						uint32			GetFrameTstate(void) const;
+						uint32			GetTstatesPerFrame(void) const;
+
+		// Save states capture the whole machine (CPU, memory, ULA, tape position
+		// and audio phase) in a versioned binary image.  Restoring only accepts a
+		// state saved from the same model.
+						uint32			GetStateSize(void) const;
+						uint32			SaveState(void* pBuffer, uint32 size) const;
+						bool				RestoreState(const void* pBuffer, uint32 size);
+
+		// Writes a .z80 (version 3) or .szx snapshot, depending on the extension
+						bool				SaveSnapshot(const char* fileName) const;
+
 	protected:
+						bool				InitialiseMachine(int argc, char* argv[]);
+						bool				IsHeadless(void) const			{ return m_pDisplay == NULL; }
+						void				UpdateHotKeys(void);
 						bool				LoadROM(const char* fileName);
 						bool				LoadTape(const char* fileName);
 						bool				LoadSNA(const char* fileName);
+						bool				LoadZ80(const char* fileName);
+						bool				SaveZ80(const char* fileName) const;
+						bool				LoadSZX(const char* fileName);
+						bool				SaveSZX(const char* fileName) const;
+						bool				DecodeZ80Block(FILE* pFile, uint32 size, uint8* const* ppPages, uint32 pageCount);
+						uint32			EncodeZ80Block(const uint8* pPage, uint8* pOut) const;
+						bool				InflateSZXBlock(FILE* pFile, uint32 size, uint8* pPage);
+						void				WriteState(CStateWriter& writer) const;
+						void				ReadState(CStateReader& reader);
+						void				CaptureRewind(void);
+						void				RewindHistory(void);
 
 						void				DisplayHelp(void) const;
+#if defined(Z80_PROFILER)
+						void				WriteProfile(const char* fileName) const;
+#endif // defined(Z80_PROFILER)
+#if defined(Z80_CALL_PROFILER)
+						void				WriteCallGraph(const char* fileName);
+#endif // defined(Z80_CALL_PROFILER)
 
 		enum eSpectrumConstant
 		{
@@ -65,7 +118,83 @@ class CZXSpectrum : public IMemory, public IScreenMemory
 			SC_FRAME_TSTATES = 69888, // (24+128+24+48)*(64+192+56)
 
 			SC_16K_SPECTRUM = 32768,
-			SC_48K_SPECTRUM = 65536
+			SC_48K_SPECTRUM = 65536,
+
+			// Memory is mapped into the Z80 address space in four 16K slots
+			SC_PAGE_SHIFT = 14,
+			SC_PAGE_SIZE = 1 << SC_PAGE_SHIFT,
+			SC_PAGE_MASK = SC_PAGE_SIZE - 1,
+			SC_MEMORY_SLOTS = SC_48K_SPECTRUM >> SC_PAGE_SHIFT,
+			SC_MAX_ROM_PAGES = 2,
+			SC_MAX_RAM_PAGES = 8
+		};
+
+		enum eMachineModel
+		{
+			MM_48K,
+			MM_128K,
+			MM_PLUS2,
+
+			MM_COUNT
+		};
+
+		// Everything that differs between the supported models.  The 128K
+		// machines have the same 7FFD paging, but different ROMs.
+		struct SMachineModel
+		{
+			const char*	m_name;
+			const char*	m_defaultROM;
+			double			m_clockRate;
+			uint32			m_lineTstates;
+			uint32			m_topBorderLines;
+			uint32			m_frameTstates;
+			uint32			m_firstContendedTstate;	// T state of the first contended cycle of the first pixel line
+			uint8				m_ramPageMask;					// RAM banks fitted
+			uint8				m_contendedPageMask;		// RAM banks shared with the ULA
+			bool				m_hasPaging;
+			bool				m_hasAY;
+		};
+		static const SMachineModel s_machineModel[MM_COUNT];
+
+		// The ULA contention delay pattern for each 8 T state period of the pixel
+		// area (the same on all models, only the start point moves)
+		static const uint8 s_contentionPattern[8];
+
+		// Snapshot file formats
+		enum eSnapshotConstant
+		{
+			SN_Z80_V1_HEADER_SIZE = 30,
+			SN_Z80_V2_EXTRA_SIZE = 23,
+			SN_Z80_V3_EXTRA_SIZE = 54,
+			SN_Z80_V3_EXTRA_SIZE_1FFD = 55,
+			SN_Z80_MAX_HEADER_SIZE = SN_Z80_V1_HEADER_SIZE + 2 + SN_Z80_V3_EXTRA_SIZE_1FFD,
+			SN_Z80_UNCOMPRESSED_BLOCK = 0xFFFF,
+
+			SN_SZX_HEADER_SIZE = 8,
+			SN_SZX_MAJOR_VERSION = 1,
+			SN_SZX_MINOR_VERSION = 4,
+			SN_SZX_MACHINE_48K = 1,
+			SN_SZX_MACHINE_128K = 2,
+			SN_SZX_MACHINE_PLUS2 = 3,
+			SN_SZX_Z80R_SIZE = 37,
+			SN_SZX_SPCR_SIZE = 8,
+			SN_SZX_AY_SIZE = 18,
+			SN_SZX_RAMP_COMPRESSED = 1,
+
+			SN_CHUNK_SIZE = 4096
+		};
+
+		enum ePagingConstant
+		{
+			PG_RAM_MASK = 0x07,
+			PG_SHADOW_SCREEN = 0x08,
+			PG_ROM_SELECT = 0x10,
+			PG_LOCK = 0x20,
+
+			PG_NORMAL_SCREEN_BANK = 5,
+			PG_SHADOW_SCREEN_BANK = 7,
+			PG_SLOT1_BANK = 5,
+			PG_SLOT2_BANK = 2
 		};
 
 		// The ZX Spectrum screen starts at memory address 16384 and is 256*192
@@ -108,7 +237,18 @@ class CZXSpectrum : public IMemory, public IScreenMemory
 		// + (x / 8)
 		inline	uint32	PixelByteIndex(uint8 x, uint8 y) const { return ((y & 0xC0) << 5) + ((y & 0x38) << 2) + ((y & 0x07) << 8) + (x >> 3); };
 		inline	uint32	AttributeByteIndex(uint8 x, uint8 y) const { return (SC_PIXEL_SCREEN_BYTES + ((y >> 3) * SC_ATTRIBUTE_SCREEN_WIDTH) + (x >> 3)); }
+						void		SetModel(eMachineModel model);
+						bool		SetSnapshotModel(eMachineModel model);
+						void		SetFrameTstate(uint32 tstate);
+						void		MapMemory(void);
+						void		MarkAllDirty(void);
+						void		NoteWrite(uint16 address, uint32 length);
+						void		BuildContentionTable(void);
+						bool		IsContended(uint16 address) const { return (m_contendedSlotMask >> (address >> SC_PAGE_SHIFT)) & 1; }
 						void		UpdateScanline(uint32 tstates);
+						void		UpdateBeam(void);
+						void		RenderTo(uint32 line, uint32 column);
+						void		RenderSpan(uint32 scanline, uint32 fromColumn, uint32 toColumn);
 						void		UpdateTape(uint32 tstates);
 						bool		UpdatePulse(uint32 length);
 						bool		UpdateBlock(void);
@@ -217,8 +357,34 @@ class CZXSpectrum : public IMemory, public IScreenMemory
 
 		// Memory for the OpenGL texture used to represent the ZX Spectrum screen
 		uint32			m_videoMemory[SC_VIDEO_MEMORY_WIDTH * SC_VIDEO_MEMORY_HEIGHT];
-		// Main memory for the 48K ZX Spectrum
-		uint8				m_memory[SC_48K_SPECTRUM];
+		// Main memory is addressed through a page table of 16K slots.  The ROM
+		// page is shared (read only) between all instances; ROM slots have no
+		// write page.
+		const uint8*	m_pReadPage[SC_MEMORY_SLOTS];
+		uint8*				m_pWritePage[SC_MEMORY_SLOTS];
+		const uint8*	m_pROM[SC_MAX_ROM_PAGES];
+		uint8*				m_pRAM[SC_MAX_RAM_PAGES];
+		const uint8*	m_pScreen;
+		const SMachineModel*	m_pModel;
+		eMachineModel	m_model;
+		uint8				m_port7FFD;
+		uint8				m_contendedSlotMask;
+		// RAM bank in each slot, the other slot holding the same bank (or 0), and
+		// which 256 byte blocks of each bank have been written since the last
+		// rewind capture
+		uint8				m_slotBank[SC_MEMORY_SLOTS];
+		uint8				m_aliasSlot[SC_MEMORY_SLOTS];
+		uint64			m_dirtyBlocks[SC_MAX_RAM_PAGES];
+		uint32			m_writeGeneration[256];	// per 256 byte page of the address space
+		CRewindBuffer*	m_pRewind;
+		uint32			m_rewindInterval;
+		// Where the RAM and frame buffer were put by the last WriteState()
+		mutable uint32	m_stateRAMOffset;
+		mutable uint32	m_stateVideoOffset;
+		// Delay for a contended access on each T state of the frame (only built
+		// when contention is enabled)
+		uint8*			m_pContentionTable;
+		bool				m_enableContention;
 		double			m_frameStart;
 		double			m_frameRate;
 		double			m_frameTime;
@@ -226,11 +392,26 @@ class CZXSpectrum : public IMemory, public IScreenMemory
 		CDisplay*		m_pDisplay;
 		CZ80*				m_pZ80;
 		CSound*			m_pSound;
+		CAY8912*		m_pAY;
+		CKeyboard*	m_pKeyboard;
+		CInputTimeline*	m_pInput;
+		CFrameLog*	m_pFrameLog;
+		CTraceLog*	m_pTraceLog;
+#if defined(Z80_PROFILER)
+		char				m_profileFile[256];
+#endif // defined(Z80_PROFILER)
+#if defined(Z80_CALL_PROFILER)
+		char				m_callGraphFile[256];
+#endif // defined(Z80_CALL_PROFILER)
 		FILE*				m_pFile;
 		uint32			m_scanline;
 		uint32			m_xpos;
 		uint32			m_frameNumber;
 		uint32			m_scanlineTstates;
+		// How far the video memory has been rendered (frame line and video column)
+		uint32			m_renderedLine;
+		uint32			m_renderedColumn;
+		uint32			m_frameTstates;
 		uint64			m_tapeTstates;
 		uint8				m_writePortFE;
 		mutable uint8				m_readPortFE;